@@ -6,6 +6,7 @@
 #ifndef CLIENT_NETWORKRECEIVESYSTEM_HPP_
 #define CLIENT_NETWORKRECEIVESYSTEM_HPP_
 
+#include "../../engineCore/include/ecs/BulletPool.hpp"
 #include "../../engineCore/include/ecs/ISystem.hpp"
 #include "../../network/include/INetworkManager.hpp"
 #include <functional>
@@ -108,6 +109,12 @@ public:
    */
   void setLevelCompleteCallback(std::function<void(const std::string &, const std::string &)> callback);
 
+  /**
+   * @brief Enemy bullets rebuilt from the volleys of the snapshots (they are not entities)
+   * @return Bullet pool, advanced every update
+   */
+  [[nodiscard]] const ecs::BulletPool &getBullets() const;
+
 private:
   std::shared_ptr<INetworkManager> m_networkManager;
   std::function<void()> m_gameStartedCallback;
@@ -120,6 +127,7 @@ private:
   std::function<void(const std::string &, const std::string &)> m_levelCompleteCallback;
   std::function<void(const std::string &, int)> m_lobbyMessageCallback;
   std::function<void(const nlohmann::json &)> m_lobbyEndCallback;
+  ecs::BulletPool m_bullets;
 
   /** @brief Handle entity creation from a network message. */
   void handleEntityCreated(ecs::World &world, const nlohmann::json &json);
@@ -127,6 +135,8 @@ private:
   void handleEntityUpdate(ecs::World &world, const nlohmann::json &json);
   /** @brief Handle a snapshot update from the server. */
   void handleSnapshot(ecs::World &world, const nlohmann::json &json);
+  /** @brief Rebuild the volleys of a snapshot and remove the bullets that hit a player. */
+  void handleBullets(const nlohmann::json &json);
   /** @brief Trigger the game-start callback. */
   void handleGameStarted();
 };
@@ -10,7 +10,9 @@
 #include "../../engineCore/include/ecs/ISystem.hpp"
 #include "../../engineCore/include/ecs/components/Input.hpp"
 #include "../../network/include/INetworkManager.hpp"
+#include <cstdint>
 #include <nlohmann/json.hpp>
+#include <vector>
 
 /**
  * @class NetworkSendSystem
@@ -67,6 +69,7 @@ protected:
 private:
   std::shared_ptr<INetworkManager> m_networkManager;
   std::uint32_t m_clientId = 0;
+  std::vector<std::uint8_t> m_sendBuffer; ///< Reused serialization buffer for inputs
 
   /**
    * @brief Send input data to server
@@ -6,6 +6,7 @@
 #include "Game.hpp"
 #include "../../engineCore/include/ecs/components/Input.hpp"
 #include "../../engineCore/include/ecs/components/Score.hpp"
+#include "../../engineCore/include/utils/Trace.hpp"
 #include "../interface/IColorBlindSupport.hpp"
 #include "../interface/KeyCodes.hpp"
 #include "Menu/MenuState.hpp"
@@ -286,14 +287,26 @@ void Game::run()
     return;
   }
 
+  RTYPE_TRACE_INSTALL_DUMP_SIGNAL();
+  RTYPE_TRACE_THREAD("main");
   while (isRunning) {
-    processInput();
+    RTYPE_TRACE_POLL_DUMP("rtype_client_trace.json");
+    RTYPE_TRACE_SCOPE("Game::frame");
+    {
+      RTYPE_TRACE_SCOPE("Game::processInput");
+      processInput();
+    }
 
     float deltaTime = renderer->getDeltaTime();
-    update(deltaTime);
+    {
+      RTYPE_TRACE_SCOPE("Game::update");
+      update(deltaTime);
+    }
 
+    RTYPE_TRACE_SCOPE("Game::render");
     render();
   }
+  RTYPE_TRACE_DUMP("rtype_client_trace.json");
 }
 
 void Game::shutdown()
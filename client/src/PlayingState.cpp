@@ -17,6 +17,7 @@
 #include "../../network/include/AsioClient.hpp"
 #include "../include/AssetPath.hpp"
 #include "../include/AudioManager.hpp"
+#include "../include/systems/NetworkReceiveSystem.hpp"
 #include "../include/systems/NetworkSendSystem.hpp"
 #include "../interface/Geometry.hpp"
 #include "../interface/KeyCodes.hpp"
@@ -792,6 +793,8 @@ void PlayingState::render()
     }
   }
 
+  renderBullets();
+
   // Render info overlay (hitboxes, panels) while still in game viewport
   if (m_infoMode) {
     m_infoMode->render();
@@ -816,6 +819,43 @@ void PlayingState::render()
   }
 }
 
+void PlayingState::renderBullets()
+{
+  auto *receiveSystem = world->getSystem<ClientNetworkReceiveSystem>();
+  if (receiveSystem == nullptr) {
+    return;
+  }
+
+  // Bullet positions are centers; frames are laid out in one row like the other shots
+  constexpr Color COLOR_BULLET_RED = {.r = 255, .g = 100, .b = 100, .a = 255};
+  const auto &bullets = receiveSystem->getBullets();
+  for (std::size_t i = 0; i < bullets.size(); ++i) {
+    const auto *volley = bullets.volleyOf(i);
+    if (volley == nullptr) {
+      continue;
+    }
+    const int scaledWidth = static_cast<int>(static_cast<float>(volley->width) * volley->scale * m_scaleX);
+    const int scaledHeight = static_cast<int>(static_cast<float>(volley->height) * volley->scale * m_scaleY);
+    const int destX = static_cast<int>(bullets.x(i) * m_scaleX) - scaledWidth / 2;
+    const int destY = static_cast<int>(bullets.y(i) * m_scaleY) - scaledHeight / 2;
+
+    auto textureIt = m_spriteTextures.find(volley->spriteId);
+    if (textureIt == m_spriteTextures.end() || textureIt->second == nullptr) {
+      renderer->drawRect(destX, destY, scaledWidth, scaledHeight, COLOR_BULLET_RED);
+      continue;
+    }
+    int frame = 0;
+    if (volley->frameCount > 1 && volley->frameTime > 0.0f) {
+      frame = static_cast<int>(bullets.age(i) / volley->frameTime) % static_cast<int>(volley->frameCount);
+    }
+    const int frameWidth = static_cast<int>(volley->width);
+    const int frameHeight = static_cast<int>(volley->height);
+    renderer->drawTextureRegion(textureIt->second,
+                                {.x = frame * frameWidth, .y = 0, .width = frameWidth, .height = frameHeight},
+                                {.x = destX, .y = destY, .width = scaledWidth, .height = scaledHeight});
+  }
+}
+
 void PlayingState::renderHUD()
 {
   if (renderer == nullptr) {
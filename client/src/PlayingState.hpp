@@ -203,6 +203,11 @@ private:
    */
   void renderHUD();
 
+  /**
+   * @brief Render the pooled enemy bullets (not entities, see ClientNetworkReceiveSystem::getBullets)
+   */
+  void renderBullets();
+
   /**
    * @brief Update HUD data from ECS world
    */
@@ -3,6 +3,7 @@
  * @brief Client application entry point
  */
 
+#include "../../engineCore/include/utils/Log.hpp"
 #include "Game.hpp"
 #include <SDL.h>
 #include <cstdio>
@@ -25,6 +26,7 @@ static void printUsage(const char *programName)
             << "Options:\n"
             << "  -h, --help          Display this help message and exit\n"
             << "  --r RENDERER        Choose renderer module: sdl2 or sfml (default: sdl2)\n"
+            << "  --log LEVEL         Log threshold: trace, debug, info, warn or error (default: info)\n"
             << std::endl;
 }
 
@@ -43,6 +45,7 @@ int main(int argc, char **argv)
   std::string host = "127.0.0.1";
   std::string port = "4242";
   std::string rendererType = "auto"; // auto means default based on platform
+  logging::LogSettings logSettings;
 
   // Parse command line arguments
   for (int i = 1; i < argc; ++i) {
@@ -67,6 +70,12 @@ int main(int argc, char **argv)
         std::cerr << "Error: --r requires a value (sdl2 or sfml)." << std::endl;
         return EXIT_FAILURE;
       }
+    } else if (arg == "--log") {
+      if (i + 1 >= argc) {
+        std::cerr << "Error: --log requires a value (trace, debug, info, warn or error)." << std::endl;
+        return EXIT_FAILURE;
+      }
+      logSettings.level = logging::parseLevel(argv[++i], logSettings.level);
     } else if (host == "127.0.0.1" && arg.find('.') != std::string::npos) {
       // Assume it's the host if it contains a dot and host hasn't been set yet
       host = arg;
@@ -89,6 +98,8 @@ int main(int argc, char **argv)
 #endif
   }
 
+  logging::Logger::instance().configure(logSettings);
+
   Game game(host, port, rendererType);
   if (!game.init()) {
     return EXIT_FAILURE;
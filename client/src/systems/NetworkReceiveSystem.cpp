@@ -12,8 +12,8 @@
 #include "../../engineCore/include/ecs/components/Score.hpp"
 #include "../../engineCore/include/ecs/components/Sprite.hpp"
 #include "../../engineCore/include/ecs/components/Transform.hpp"
+#include "../../engineCore/include/utils/Log.hpp"
 #include "../../include/systems/NetworkSendSystem.hpp"
-#include <iostream>
 #include <nlohmann/json.hpp>
 #include <unordered_map>
 
@@ -38,8 +38,7 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
 
   NetworkPacket packet;
   while (m_networkManager->poll(packet)) {
-    std::string message =
-      m_networkManager->getPacketHandler()->deserialize(packet.getData(), packet.getBytesTransferred()).value_or("");
+    std::string message = m_networkManager->getPacketHandler()->deserialize(packet.getPayload()).value_or("");
 
     if (message.empty()) {
       continue;
@@ -61,14 +60,14 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
           if (auto *sendSys = world.getSystem<NetworkSendSystem>()) {
             sendSys->setClientId(clientId);
           }
-          std::cout << "[Client] Assigned client_id=" << clientId << std::endl;
+          RTYPE_LOG_INFO("[Client] Assigned client_id=" << clientId);
         }
         continue;
       }
 
       // Server told us that this player is dead
       if (type == "player_dead" || type == "player_died_spectate") {
-        std::cout << "[Client] Received " << type << " from server" << std::endl;
+        RTYPE_LOG_INFO("[Client] Received " << type << " from server");
         // Only stop accepting snapshots for full game over (player_dead)
         if (type == "player_dead") {
           g_acceptSnapshots = false;
@@ -82,7 +81,7 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
 
       // Lobby end: show end-screen with scores
       if (type == "lobby_end") {
-        std::cout << "[Client] Received lobby_end from server" << std::endl;
+        RTYPE_LOG_INFO("[Client] Received lobby_end from server");
         if (m_lobbyEndCallback) {
           m_lobbyEndCallback(json);
         }
@@ -91,7 +90,7 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
 
       // Server told us we've been kicked
       if (type == "player_kicked") {
-        std::cout << "[Client] Received player_kicked from server" << std::endl;
+        RTYPE_LOG_INFO("[Client] Received player_kicked from server");
         // Stop accepting snapshots immediately
         g_acceptSnapshots = false;
         if (m_playerDeadCallback) {
@@ -102,7 +101,7 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
 
       // Lobby left acknowledgement from server
       if (type == "lobby_left") {
-        std::cout << "[Client] Received lobby_left from server" << std::endl;
+        RTYPE_LOG_INFO("[Client] Received lobby_left from server");
         // Stop accepting snapshots immediately
         g_acceptSnapshots = false;
         if (m_lobbyStateCallback) {
@@ -132,7 +131,7 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
       // Lobby messages
       else if (type == "lobby_joined") {
         std::string code = json.value("code", "");
-        std::cout << "[Client] Joined lobby: " << code << std::endl;
+        RTYPE_LOG_INFO("[Client] Joined lobby: " << code);
 
         // Clear existing entities and network id mapping when joining a lobby
         // to avoid leftover entities from previous lobbies causing visual/HP glitches.
@@ -148,8 +147,10 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
           }
           // Clear client-side mapping of network ids to entities
           g_networkIdToEntity.clear();
+          // Volley ids restart with every lobby world
+          m_bullets.clear();
         } catch (const std::exception &e) {
-          std::cerr << "[Client] Error clearing world on lobby join: " << e.what() << std::endl;
+          RTYPE_LOG_ERROR("[Client] Error clearing world on lobby join: " << e.what());
         }
 
         if (m_lobbyJoinedCallback) {
@@ -159,21 +160,21 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
         std::string code = json.value("code", "");
         int playerCount = json.value("player_count", 0);
         int spectatorCount = json.value("spectator_count", 0);
-        std::cout << "[Client] Lobby " << code << " has " << playerCount << " players and " << spectatorCount
-                  << " spectators" << std::endl;
+        RTYPE_LOG_DEBUG("[Client] Lobby " << code << " has " << playerCount << " players and " << spectatorCount
+                                          << " spectators");
         if (m_lobbyStateCallback) {
           m_lobbyStateCallback(code, playerCount, spectatorCount);
         }
       } else if (type == "lobby_message") {
         std::string msg = json.value("message", "");
         int dur = json.value("duration", 3);
-        std::cout << "[Client] Lobby message: '" << msg << "' (" << dur << "s)" << std::endl;
+        RTYPE_LOG_DEBUG("[Client] Lobby message: '" << msg << "' (" << dur << "s)");
         if (m_lobbyMessageCallback) {
           m_lobbyMessageCallback(msg, dur);
         }
       } else if (type == "error") {
         std::string errorMsg = json.value("message", "Unknown error");
-        std::cerr << "[Client] Server error: " << errorMsg << std::endl;
+        RTYPE_LOG_WARN("[Client] Server error: " << errorMsg);
         if (m_errorCallback) {
           m_errorCallback(errorMsg);
         }
@@ -182,7 +183,7 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
         std::string sender = json.value("sender", "Unknown");
         std::string content = json.value("content", "");
         std::uint32_t senderId = json.value("senderId", 0);
-        std::cout << "[Client] Chat from " << sender << ": " << content << std::endl;
+        RTYPE_LOG_DEBUG("[Client] Chat from " << sender << ": " << content);
         if (m_chatMessageCallback) {
           m_chatMessageCallback(sender, content, senderId);
         }
@@ -190,16 +191,20 @@ void ClientNetworkReceiveSystem::update(ecs::World &world, float deltaTime)
         // Handle level complete event from server
         std::string currentLevel = json.value("current_level", "");
         std::string nextLevel = json.value("next_level", "");
-        std::cout << "[Client] ✓ Level complete: " << currentLevel << " → " << nextLevel << std::endl;
+        RTYPE_LOG_INFO("[Client] ✓ Level complete: " << currentLevel << " → " << nextLevel);
         if (m_levelCompleteCallback) {
           m_levelCompleteCallback(currentLevel, nextLevel);
         }
       }
 
     } catch (const std::exception &e) {
-      std::cerr << "[Client] Error parsing message: " << e.what() << std::endl;
+      RTYPE_LOG_EVERY(::logging::Level::ERR, 1.0, "[Client] Error parsing message: " << e.what());
     }
   }
+
+  // Bullets move on their own between snapshots; only their volleys and hits are sent
+  m_bullets.update(deltaTime);
+  m_bullets.forget(0.0F);
 }
 
 void ClientNetworkReceiveSystem::handleSnapshot(ecs::World &world, const nlohmann::json &json)
@@ -209,7 +214,7 @@ void ClientNetworkReceiveSystem::handleSnapshot(ecs::World &world, const nlohman
   }
 
   if (!g_loggedFirstSnapshot) {
-    std::cout << "[Client] Snapshot received (entities=" << json["entities"].size() << ")" << std::endl;
+    RTYPE_LOG_DEBUG("[Client] Snapshot received (entities=" << json["entities"].size() << ")");
     g_loggedFirstSnapshot = true;
   }
 
@@ -343,14 +348,20 @@ void ClientNetworkReceiveSystem::handleSnapshot(ecs::World &world, const nlohman
     }
   }
 
-  // Handle destroyed entities
-  if (json.contains("destroyed") && json["destroyed"].is_array()) {
-    for (const auto &destroyedId : json["destroyed"]) {
-      if (!destroyedId.is_number_unsigned()) {
+  handleBullets(json);
+
+  // Handle destroyed entities, and entities that left our interest area
+  // (server stops replicating them; they come back in full when they re-enter)
+  for (const char *key : {"destroyed", "exited"}) {
+    if (!json.contains(key) || !json[key].is_array()) {
+      continue;
+    }
+    for (const auto &removedId : json[key]) {
+      if (!removedId.is_number_unsigned()) {
         continue;
       }
 
-      const std::uint32_t networkId = destroyedId.get<std::uint32_t>();
+      const std::uint32_t networkId = removedId.get<std::uint32_t>();
       auto it = g_networkIdToEntity.find(networkId);
       if (it != g_networkIdToEntity.end()) {
         ecs::Entity entity = it->second;
@@ -431,18 +442,37 @@ void ClientNetworkReceiveSystem::handleSnapshot(ecs::World &world, const nlohman
     bool changed = (displayedHp != prevHp) || (displayedScore != prevScore);
     // Log if changed or every 120 snapshots (~2s at 60Hz snapshots)
     if (changed || (tickCounter % 120) == 0) {
-      std::cout << "[Client][RECV] snapshot entities=" << json["entities"].size() << " clientId=" << myClientId
-                << " entity=" << myEntity << " hp=" << displayedHp << "/" << displayedMaxHp
-                << " score=" << displayedScore << std::endl;
+      RTYPE_LOG_DEBUG("[Client][RECV] snapshot entities=" << json["entities"].size() << " clientId=" << myClientId
+                                                           << " entity=" << myEntity << " hp=" << displayedHp << "/"
+                                                           << displayedMaxHp << " score=" << displayedScore);
       // Also echo what the HUD will display (concise)
-      std::cout << "[Client][DISPLAY] HP=" << (displayedHp >= 0 ? std::to_string(displayedHp) : "n/a")
-                << " Score=" << (displayedScore >= 0 ? std::to_string(displayedScore) : "n/a") << std::endl;
+      RTYPE_LOG_DEBUG("[Client][DISPLAY] HP=" << (displayedHp >= 0 ? std::to_string(displayedHp) : "n/a") << " Score="
+                                               << (displayedScore >= 0 ? std::to_string(displayedScore) : "n/a"));
       prevHp = displayedHp;
       prevScore = displayedScore;
     }
   }
 }
 
+void ClientNetworkReceiveSystem::handleBullets(const nlohmann::json &json)
+{
+  // Volleys are repeated in several snapshots; receive() keeps the first copy only
+  if (json.contains("volleys") && json["volleys"].is_array()) {
+    for (const auto &volleyJson : json["volleys"]) {
+      float age = 0.0F;
+      const ecs::BulletVolley volley = ecs::BulletVolley::fromJson(volleyJson, age);
+      m_bullets.receive(volley, age);
+    }
+  }
+  if (json.contains("bullet_hits") && json["bullet_hits"].is_array()) {
+    for (const auto &hit : json["bullet_hits"]) {
+      if (hit.is_array() && hit.size() == 2) {
+        m_bullets.kill(hit[0].get<std::uint32_t>(), hit[1].get<std::uint16_t>());
+      }
+    }
+  }
+}
+
 void ClientNetworkReceiveSystem::handleEntityCreated(ecs::World &world, const nlohmann::json &json)
 {
   const std::uint32_t networkId = json["entity_id"].get<std::uint32_t>();
@@ -525,10 +555,11 @@ void ClientNetworkReceiveSystem::setErrorCallback(std::function<void(const std::
 
 void ClientNetworkReceiveSystem::handleGameStarted()
 {
-  std::cout << "[Client] Received game_started message from server" << std::endl;
+  RTYPE_LOG_INFO("[Client] Received game_started message from server");
 
   // Allow snapshots once the game starts
   g_acceptSnapshots = true;
+  m_bullets.clear();
 
   if (m_gameStartedCallback) {
     m_gameStartedCallback();
@@ -567,6 +598,11 @@ void ClientNetworkReceiveSystem::setLevelCompleteCallback(
   m_levelCompleteCallback = std::move(callback);
 }
 
+const ecs::BulletPool &ClientNetworkReceiveSystem::getBullets() const
+{
+  return m_bullets;
+}
+
 void ClientNetworkReceiveSystem::setLobbyEndCallback(std::function<void(const nlohmann::json &)> callback)
 {
   m_lobbyEndCallback = std::move(callback);
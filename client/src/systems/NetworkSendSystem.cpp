@@ -6,8 +6,7 @@
 #include "../../include/systems/NetworkSendSystem.hpp"
 #include "../../engineCore/include/ecs/World.hpp"
 #include "../../engineCore/include/ecs/components/Input.hpp"
-#include <iostream>
-#include <optional>
+#include "../../engineCore/include/utils/Log.hpp"
 
 namespace
 {
@@ -56,25 +55,6 @@ ecs::ComponentSignature NetworkSendSystem::getSignature() const
 
 void NetworkSendSystem::sendInputToServer(UNUSED ecs::Entity entity, const ecs::Input &input)
 {
-  struct InputState {
-    bool up;
-    bool down;
-    bool left;
-    bool right;
-    bool shoot;
-    bool chargedShoot;
-    bool detach;
-  };
-
-  static std::optional<InputState> last;
-  static float logAccumulator = 0.0f;
-  logAccumulator += SEND_INTERVAL;
-
-  const InputState now{input.up, input.down, input.left, input.right, input.shoot, input.chargedShoot, input.detach};
-  const bool changed = !last.has_value() || last->up != now.up || last->down != now.down || last->left != now.left ||
-    last->right != now.right || last->shoot != now.shoot || last->chargedShoot != now.chargedShoot ||
-    last->detach != now.detach;
-
   // Create JSON message with player input
   nlohmann::json message;
   message["type"] = "player_input";
@@ -93,20 +73,16 @@ void NetworkSendSystem::sendInputToServer(UNUSED ecs::Entity entity, const ecs::
   std::string jsonStr = message.dump();
 
   // Use Cap'n Proto handler to serialize the message
-  auto serialized = m_networkManager->getPacketHandler()->serialize(jsonStr);
+  m_networkManager->getPacketHandler()->serializeInto(jsonStr, m_sendBuffer);
 
-  // Send to server (endpoint ID 0 for client -> server communication)
+  // Send to server (endpoint ID 0 for client -> server communication).
+  // Inputs are full state, a lost one is replaced by the next tick's.
   m_networkManager->send(
-    std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()), 0);
-
-  // Low-noise logging: print on change, and also periodically (2Hz) to confirm activity.
-  if (changed || logAccumulator >= 0.5f) {
-    // Minimal send log — avoid flooding. Detailed inspection is done on receive/display.
-    std::cout << "[Client][SEND] input updated (client_id=" << m_clientId << ")" << std::endl;
-    logAccumulator = 0.0f;
-  }
+    std::span<const std::byte>(reinterpret_cast<const std::byte *>(m_sendBuffer.data()), m_sendBuffer.size()), 0,
+    Channel::UNRELIABLE_SEQUENCED);
 
-  last = now;
+  // Low-noise logging (2Hz) to confirm activity. Detailed inspection is done on receive/display.
+  RTYPE_LOG_EVERY(::logging::Level::DEBUG, 0.5, "[Client][SEND] input updated (client_id=" << m_clientId << ")");
 }
 
 void NetworkSendSystem::sendSetDifficulty(Difficulty diff)
@@ -131,5 +107,5 @@ void NetworkSendSystem::sendSetDifficulty(Difficulty diff)
   m_networkManager->send(
     std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()), 0);
 
-  std::cout << "[Client][SEND] set difficulty to " << diffStr << std::endl;
+  RTYPE_LOG_DEBUG("[Client][SEND] set difficulty to " << diffStr);
 }
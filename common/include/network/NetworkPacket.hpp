@@ -9,8 +9,12 @@
 #define NETWORK_PACKET_HPP_
 
 #include "../Common.hpp"
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <vector>
 
 /**
@@ -47,6 +51,19 @@ public:
   {
   }
 
+  /**
+   * @brief Construct a network packet from a reassembled message
+   *
+   * @param data Message bytes (truncated to BUFFER_SIZE)
+   * @param senderEndpointId ID of the sending endpoint
+   */
+  NetworkPacket(std::span<const std::byte> data, std::uint32_t senderEndpointId)
+      : m_senderEndpointId(senderEndpointId),
+        m_bytesTransferred(static_cast<std::uint32_t>(std::min(data.size(), m_data.size())))
+  {
+    std::memcpy(m_data.data(), data.data(), m_bytesTransferred);
+  }
+
   ~NetworkPacket() = default;
 
   /**
@@ -56,6 +73,19 @@ public:
    */
   std::array<char, BUFFER_SIZE> getData() const { return m_data; }
 
+  /**
+   * @brief View the received bytes without copying the buffer
+   *
+   * The view starts 8-byte aligned so serializers can read it in place.
+   *
+   * @return Span over the first getBytesTransferred() bytes
+   */
+  std::span<const std::byte> getPayload() const
+  {
+    return {reinterpret_cast<const std::byte *>(m_data.data()),
+            std::min<std::size_t>(m_bytesTransferred, m_data.size())};
+  }
+
   /**
    * @brief Set the message data
    *
@@ -85,7 +115,7 @@ public:
   void setBytesTransferred(std::uint32_t bytesTransferred) { m_bytesTransferred = bytesTransferred; }
 
 private:
-  std::array<char, BUFFER_SIZE> m_data;
+  alignas(alignof(std::uint64_t)) std::array<char, BUFFER_SIZE> m_data;
   std::uint32_t m_senderEndpointId{0};
   std::uint32_t m_bytesTransferred{0};
 };
@@ -9,6 +9,7 @@
 #define SAFE_QUEUE_HPP_
 
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
 #include <mutex>
 
@@ -51,6 +52,15 @@ public:
     return true;
   }
 
+  /**
+   * @brief Number of queued elements (a snapshot, for statistics)
+   */
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queue.size();
+  }
+
   /**
    * @brief Pop an element, waiting if necessary
    *
@@ -67,7 +77,7 @@ public:
 
 private:
   std::deque<T> m_queue;
-  std::mutex m_mutex;
+  mutable std::mutex m_mutex;
   std::condition_variable m_conditionVariable;
 };
 
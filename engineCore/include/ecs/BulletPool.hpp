@@ -0,0 +1,353 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** BulletPool.hpp
+*/
+
+#ifndef ECS_BULLETPOOL_HPP_
+#define ECS_BULLETPOOL_HPP_
+
+#include "Entity.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <vector>
+
+namespace ecs
+{
+
+/**
+ * @brief Bullets fired together by an emitter: same origin, speed and look
+ *
+ * Bullet i flies at angle + i * arc / count for a full ring (arc of 360),
+ * and spreads evenly over [angle - arc / 2, angle + arc / 2] for a fan.
+ * The volley alone rebuilds all of its bullets, so it is what the server
+ * replicates instead of one entity per bullet.
+ */
+struct BulletVolley {
+  std::uint32_t id = 0; ///< Set by BulletPool::emit(), increases with every volley
+  float x = 0.0F; ///< Origin, bullet positions are their centers
+  float y = 0.0F;
+  float angle = 180.0F; ///< Degrees in screen space: 0 is right, 90 is down
+  float arc = 360.0F;
+  std::uint16_t count = 1;
+  float speed = 0.0F;
+  float lifetime = 0.0F;
+  float radius = 0.0F; ///< Collision radius
+  std::uint32_t spriteId = 0;
+  std::uint32_t width = 0;
+  std::uint32_t height = 0;
+  std::uint32_t frameCount = 1;
+  float frameTime = 0.1F;
+  float scale = 1.0F;
+  Entity owner = 0; ///< Server side only, never replicated
+  int damage = 0; ///< Per bullet, server side only, never replicated
+
+  /** @brief Unit direction of bullet slot */
+  void direction(std::uint16_t slot, float &dirX, float &dirY) const
+  {
+    constexpr float DEG_TO_RAD = 3.14159265F / 180.0F;
+    float degrees = angle;
+    if (arc >= 360.0F) {
+      degrees += 360.0F * static_cast<float>(slot) / static_cast<float>(count);
+    } else if (count > 1) {
+      degrees += arc * (static_cast<float>(slot) / static_cast<float>(count - 1) - 0.5F);
+    }
+    dirX = std::cos(degrees * DEG_TO_RAD);
+    dirY = std::sin(degrees * DEG_TO_RAD);
+  }
+
+  [[nodiscard]] nlohmann::json toJson(float age) const
+  {
+    return {{"id", id},
+            {"x", x},
+            {"y", y},
+            {"angle", angle},
+            {"arc", arc},
+            {"count", count},
+            {"speed", speed},
+            {"lifetime", lifetime},
+            {"radius", radius},
+            {"age", age},
+            {"sprite",
+             {{"spriteId", spriteId},
+              {"width", width},
+              {"height", height},
+              {"frameCount", frameCount},
+              {"frameTime", frameTime},
+              {"scale", scale}}}};
+  }
+
+  static BulletVolley fromJson(const nlohmann::json &json, float &age)
+  {
+    BulletVolley volley;
+    volley.id = json.value("id", 0U);
+    volley.x = json.value("x", 0.0F);
+    volley.y = json.value("y", 0.0F);
+    volley.angle = json.value("angle", 180.0F);
+    volley.arc = json.value("arc", 360.0F);
+    volley.count = json.value("count", static_cast<std::uint16_t>(1));
+    volley.speed = json.value("speed", 0.0F);
+    volley.lifetime = json.value("lifetime", 0.0F);
+    volley.radius = json.value("radius", 0.0F);
+    age = json.value("age", 0.0F);
+    if (json.contains("sprite") && json["sprite"].is_object()) {
+      const auto &sprite = json["sprite"];
+      volley.spriteId = sprite.value("spriteId", 0U);
+      volley.width = sprite.value("width", 0U);
+      volley.height = sprite.value("height", 0U);
+      volley.frameCount = sprite.value("frameCount", 1U);
+      volley.frameTime = sprite.value("frameTime", 0.1F);
+      volley.scale = sprite.value("scale", 1.0F);
+    }
+    return volley;
+  }
+};
+
+/**
+ * @brief Enemy bullets outside the ECS, stored as parallel arrays
+ *
+ * A bullet is a position, a velocity, a time to live and a radius; it has
+ * no components to look up, so moving thousands of them is one loop over
+ * contiguous floats. The server fills the pool with emit() and the client
+ * rebuilds the same bullets from the replicated volleys with receive().
+ * Bullets die when their lifetime ends, when they leave the screen (the
+ * same test on both sides) or when kill() is called for a hit.
+ */
+class BulletPool
+{
+public:
+  static constexpr std::size_t MAX_BULLETS = 8192;
+  // Screen space of the game, bullets past these bounds plus the margin are gone
+  static constexpr float SCREEN_WIDTH = 1920.0F;
+  static constexpr float SCREEN_HEIGHT = 1080.0F;
+  static constexpr float SCREEN_MARGIN = 64.0F;
+
+  /** @brief A volley the pool still knows about */
+  struct VolleyRecord {
+    BulletVolley volley;
+    float firedAt = 0.0F; ///< Pool clock when the volley was fired
+    std::uint32_t alive = 0; ///< Bullets of the volley still in the pool
+  };
+
+  /** @brief A bullet removed by kill(), named by its volley and slot */
+  struct Hit {
+    std::uint32_t volley = 0;
+    std::uint16_t slot = 0;
+    float time = 0.0F; ///< Pool clock of the hit
+  };
+
+  /**
+   * @brief Fire a new volley (server side)
+   * @return The id given to the volley, 0 when it does not fit in MAX_BULLETS
+   */
+  std::uint32_t emit(BulletVolley volley)
+  {
+    if (volley.count == 0 || size() + volley.count > MAX_BULLETS) {
+      return 0;
+    }
+    volley.id = ++m_lastVolley;
+    spawn(volley, 0.0F);
+    return volley.id;
+  }
+
+  /**
+   * @brief Rebuild a volley fired age seconds ago (client side)
+   * @return false for a volley already received
+   */
+  bool receive(const BulletVolley &volley, float age)
+  {
+    if (volley.id <= m_lastVolley) {
+      return false;
+    }
+    m_lastVolley = volley.id;
+    spawn(volley, age);
+    return true;
+  }
+
+  /** @brief Move every bullet and remove the expired and off-screen ones */
+  void update(float deltaTime)
+  {
+    m_clock += deltaTime;
+    const std::size_t count = size();
+    for (std::size_t i = 0; i < count; ++i) {
+      m_x[i] += m_dx[i] * deltaTime;
+      m_y[i] += m_dy[i] * deltaTime;
+      m_ttl[i] -= deltaTime;
+    }
+
+    // Compact in place, the surviving bullets keep their order
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      if (m_ttl[i] <= 0.0F || m_x[i] < -SCREEN_MARGIN || m_x[i] > SCREEN_WIDTH + SCREEN_MARGIN ||
+          m_y[i] < -SCREEN_MARGIN || m_y[i] > SCREEN_HEIGHT + SCREEN_MARGIN) {
+        release(m_volley[i]);
+        continue;
+      }
+      if (kept != i) {
+        move(i, kept);
+      }
+      ++kept;
+    }
+    resize(kept);
+  }
+
+  /**
+   * @brief Remove bullet index after a hit, and remember the hit for replication
+   * @note The last bullet takes its index
+   */
+  void kill(std::size_t index)
+  {
+    m_hits.push_back({m_volley[index], m_slot[index], m_clock});
+    release(m_volley[index]);
+    const std::size_t last = size() - 1;
+    if (index != last) {
+      move(last, index);
+    }
+    resize(last);
+  }
+
+  /**
+   * @brief Remove the bullet a replicated hit names
+   * @return false when the bullet is already gone
+   */
+  bool kill(std::uint32_t volley, std::uint16_t slot)
+  {
+    for (std::size_t i = 0; i < size(); ++i) {
+      if (m_volley[i] == volley && m_slot[i] == slot) {
+        kill(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** @brief Drop the hits and the volleys without bullets that are older than keepSeconds */
+  void forget(float keepSeconds)
+  {
+    const float horizon = m_clock - keepSeconds;
+    std::erase_if(m_volleys,
+                  [horizon](const VolleyRecord &record) { return record.alive == 0 && record.firedAt < horizon; });
+    std::erase_if(m_hits, [horizon](const Hit &hit) { return hit.time < horizon; });
+  }
+
+  void clear()
+  {
+    resize(0);
+    m_volleys.clear();
+    m_hits.clear();
+    m_lastVolley = 0;
+    m_clock = 0.0F;
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return m_x.size(); }
+  [[nodiscard]] bool empty() const noexcept { return m_x.empty(); }
+  [[nodiscard]] float x(std::size_t index) const { return m_x[index]; }
+  [[nodiscard]] float y(std::size_t index) const { return m_y[index]; }
+  [[nodiscard]] float radius(std::size_t index) const { return m_radius[index]; }
+  [[nodiscard]] std::uint32_t volleyId(std::size_t index) const { return m_volley[index]; }
+
+  /** @brief Seconds since the bullet was fired */
+  [[nodiscard]] float age(std::size_t index) const
+  {
+    const auto *record = find(m_volley[index]);
+    return record != nullptr ? record->volley.lifetime - m_ttl[index] : 0.0F;
+  }
+
+  /** @brief Volley a bullet belongs to (look, owner) */
+  [[nodiscard]] const BulletVolley *volleyOf(std::size_t index) const
+  {
+    const auto *record = find(m_volley[index]);
+    return record != nullptr ? &record->volley : nullptr;
+  }
+
+  /** @brief Known volleys, oldest first */
+  [[nodiscard]] const std::vector<VolleyRecord> &getVolleys() const noexcept { return m_volleys; }
+  [[nodiscard]] const std::vector<Hit> &getHits() const noexcept { return m_hits; }
+  [[nodiscard]] float getClock() const noexcept { return m_clock; }
+
+private:
+  void spawn(const BulletVolley &volley, float age)
+  {
+    VolleyRecord record{volley, m_clock - age, 0};
+    const float ttl = volley.lifetime - age;
+    for (std::uint16_t slot = 0; slot < volley.count; ++slot) {
+      float dirX = 0.0F;
+      float dirY = 0.0F;
+      volley.direction(slot, dirX, dirY);
+      m_x.push_back(volley.x + dirX * volley.speed * age);
+      m_y.push_back(volley.y + dirY * volley.speed * age);
+      m_dx.push_back(dirX * volley.speed);
+      m_dy.push_back(dirY * volley.speed);
+      m_ttl.push_back(ttl);
+      m_radius.push_back(volley.radius);
+      m_volley.push_back(volley.id);
+      m_slot.push_back(slot);
+      ++record.alive;
+    }
+    m_volleys.push_back(record);
+  }
+
+  // Volley ids only grow, so the records stay sorted by id
+  template <typename Records>
+  static auto *findIn(Records &records, std::uint32_t id)
+  {
+    auto it = std::lower_bound(records.begin(), records.end(), id,
+                               [](const VolleyRecord &record, std::uint32_t value) { return record.volley.id < value; });
+    return it != records.end() && it->volley.id == id ? &*it : nullptr;
+  }
+
+  [[nodiscard]] const VolleyRecord *find(std::uint32_t id) const { return findIn(m_volleys, id); }
+
+  void release(std::uint32_t id)
+  {
+    if (auto *record = findIn(m_volleys, id); record != nullptr && record->alive > 0) {
+      --record->alive;
+    }
+  }
+
+  void move(std::size_t from, std::size_t to)
+  {
+    m_x[to] = m_x[from];
+    m_y[to] = m_y[from];
+    m_dx[to] = m_dx[from];
+    m_dy[to] = m_dy[from];
+    m_ttl[to] = m_ttl[from];
+    m_radius[to] = m_radius[from];
+    m_volley[to] = m_volley[from];
+    m_slot[to] = m_slot[from];
+  }
+
+  void resize(std::size_t count)
+  {
+    m_x.resize(count);
+    m_y.resize(count);
+    m_dx.resize(count);
+    m_dy.resize(count);
+    m_ttl.resize(count);
+    m_radius.resize(count);
+    m_volley.resize(count);
+    m_slot.resize(count);
+  }
+
+  std::vector<float> m_x;
+  std::vector<float> m_y;
+  std::vector<float> m_dx;
+  std::vector<float> m_dy;
+  std::vector<float> m_ttl;
+  std::vector<float> m_radius;
+  std::vector<std::uint32_t> m_volley;
+  std::vector<std::uint16_t> m_slot;
+
+  std::vector<VolleyRecord> m_volleys;
+  std::vector<Hit> m_hits;
+  std::uint32_t m_lastVolley = 0;
+  float m_clock = 0.0F;
+};
+
+} // namespace ecs
+
+#endif // ECS_BULLETPOOL_HPP_
@@ -8,6 +8,7 @@
 #ifndef ECS_COMPONENTMANAGER_HPP_
 #define ECS_COMPONENTMANAGER_HPP_
 
+#include "ComponentSignature.hpp"
 #include "ComponentStorage.hpp"
 #include "Entity.hpp"
 #include "IComponentStorage.hpp"
@@ -86,6 +87,25 @@ public:
     }
   }
 
+  // ========= REMOVE SOME =========
+  // Removes the components whose bit is set in the mask, whatever their type
+  void removeComponents(ecs::Entity ent, const ecs::ComponentSignature &components)
+  {
+    for (auto &pair : storages) {
+      if (components.test(pair.second->getComponentId())) {
+        pair.second->removeComponent(ent);
+      }
+    }
+  }
+
+  // ========= STORAGE =========
+  // Direct access for batch writes (see ecs::Prefab): one lookup for many entities
+  template <typename T>
+  ComponentStorage<T> &getStorage()
+  {
+    return ensureStorage<T>();
+  }
+
 private:
   std::unordered_map<std::type_index, std::unique_ptr<IComponentStorage>> storages;
 
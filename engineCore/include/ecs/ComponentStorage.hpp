@@ -8,6 +8,7 @@
 #ifndef ECS_COMPONENTSTORAGE_HPP_
 #define ECS_COMPONENTSTORAGE_HPP_
 
+#include "ComponentSignature.hpp"
 #include "Entity.hpp"
 #include "IComponentStorage.hpp"
 #include <cstddef>
@@ -64,6 +65,8 @@ public:
     return ent < sparseArray.size() && sparseArray[ent] != INVALID;
   }
 
+  [[nodiscard]] std::size_t getComponentId() const noexcept override { return ecs::getComponentId<T>(); }
+
   T &getComponent(ecs::Entity ent)
   {
     if (!hasComponent(ent)) {
@@ -33,6 +33,7 @@
 
 // Core systems
 #include "systems/MovementSystem.hpp"
+#include "systems/SpatialIndexSystem.hpp"
 // IWYU pragma: end_exports
 
 #endif /* !ENGINECOMPONENTS_HPP_ */
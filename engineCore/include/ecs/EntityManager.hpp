@@ -88,6 +88,39 @@ public:
     --m_livingEntityCount;
   }
 
+  /**
+   * @brief Parks a living entity: it stops being alive but keeps its ID
+   * @param entity The entity to park
+   *
+   * Unlike destroyEntity(), the ID is not freed for reuse by createEntity():
+   * the owner of the parked entity brings it back with unparkEntity().
+   */
+  void parkEntity(Entity entity)
+  {
+    if (entity >= m_alive.size() || (m_alive[entity] == 0U)) {
+      return;
+    }
+
+    m_alive[entity] = 0;
+    m_signatures[entity].reset();
+    --m_livingEntityCount;
+  }
+
+  /**
+   * @brief Brings a parked entity back to life, with an empty signature
+   * @param entity An entity parked by parkEntity()
+   */
+  void unparkEntity(Entity entity)
+  {
+    if (entity >= m_alive.size() || (m_alive[entity] != 0U)) {
+      return;
+    }
+
+    m_alive[entity] = 1;
+    m_signatures[entity].reset();
+    ++m_livingEntityCount;
+  }
+
   /**
    * @brief Sets the component signature for an entity
    * @param entity Target entity
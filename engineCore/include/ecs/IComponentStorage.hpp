@@ -9,6 +9,7 @@
 #define ECS_ICOMPONENTSTORAGE_HPP_
 
 #include "Entity.hpp"
+#include <cstddef>
 
 class IComponentStorage
 {
@@ -16,6 +17,8 @@ public:
   virtual ~IComponentStorage() = default;
   virtual void removeComponent(ecs::Entity ent) = 0;
   [[nodiscard]] virtual bool hasComponent(ecs::Entity ent) const = 0;
+  /** @brief ecs::getComponentId() of the stored type, its bit in a ComponentSignature */
+  [[nodiscard]] virtual std::size_t getComponentId() const noexcept = 0;
 };
 
 #endif // ECS_ICOMPONENTSTORAGE_HPP_
\ No newline at end of file
@@ -0,0 +1,162 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Prefab.hpp
+*/
+
+#ifndef ECS_PREFAB_HPP_
+#define ECS_PREFAB_HPP_
+
+#include "ComponentManager.hpp"
+#include "ComponentSignature.hpp"
+#include "Entity.hpp"
+
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecs
+{
+
+/**
+ * @brief Precompiled entity template: a full signature and one value per component
+ *
+ * A prefab is built once (from a config, or from constants) and then
+ * instantiated with World::instantiate(). Instantiation looks each
+ * component storage up once per batch instead of once per entity and
+ * component, and writes the signature of every new entity in one step
+ * instead of once per addComponent().
+ *
+ * @example
+ * Prefab bullet;
+ * bullet.set(bulletVelocity).set(bulletSprite)
+ *   .set(Networked{}, [](Networked &net, Entity entity) { net.networkId = entity; });
+ * std::vector<Entity> bullets;
+ * world.instantiate(bullet, std::span<const Transform>(positions), bullets);
+ */
+class Prefab
+{
+public:
+  /** @brief Per-entity fix-up applied after the copy (e.g. a component that stores its own entity id) */
+  template <typename T>
+  using Stamp = void (*)(T &component, Entity entity);
+
+  Prefab() = default;
+  ~Prefab() = default;
+
+  Prefab(const Prefab &other) : m_signature(other.m_signature)
+  {
+    m_slots.reserve(other.m_slots.size());
+    for (const auto &slot : other.m_slots) {
+      m_slots.push_back(slot->clone());
+    }
+  }
+
+  Prefab &operator=(const Prefab &other)
+  {
+    if (this != &other) {
+      Prefab copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  Prefab(Prefab &&) noexcept = default;
+  Prefab &operator=(Prefab &&) noexcept = default;
+
+  /**
+   * @brief Set the value every instance gets for component T (replaces a previous value)
+   * @param stamp Optional fix-up run on each instance's copy
+   */
+  template <typename T>
+  Prefab &set(T component, std::type_identity_t<Stamp<T>> stamp = nullptr)
+  {
+    if (auto *slot = find<T>()) {
+      slot->value = std::move(component);
+      slot->stamp = stamp;
+      return *this;
+    }
+    m_slots.push_back(std::make_unique<Slot<T>>(std::move(component), stamp));
+    m_signature.set(getComponentId<T>());
+    return *this;
+  }
+
+  /** @brief Template value of component T, nullptr if the prefab has none */
+  template <typename T>
+  [[nodiscard]] const T *get() const
+  {
+    const auto *slot = find<T>();
+    return slot != nullptr ? &slot->value : nullptr;
+  }
+
+  template <typename T>
+  [[nodiscard]] bool has() const
+  {
+    return m_signature.test(getComponentId<T>());
+  }
+
+  [[nodiscard]] const ComponentSignature &getSignature() const noexcept { return m_signature; }
+
+  /**
+   * @brief Add every component of the prefab to the given entities
+   * @note Used by World::instantiate(), which also writes the signatures
+   */
+  void addTo(ComponentManager &components, std::span<const Entity> entities) const
+  {
+    for (const auto &slot : m_slots) {
+      slot->addTo(components, entities);
+    }
+  }
+
+private:
+  struct ISlot {
+    virtual ~ISlot() = default;
+    [[nodiscard]] virtual std::unique_ptr<ISlot> clone() const = 0;
+    virtual void addTo(ComponentManager &components, std::span<const Entity> entities) const = 0;
+  };
+
+  template <typename T>
+  struct Slot final : ISlot {
+    Slot(T initial, Stamp<T> fixUp) : value(std::move(initial)), stamp(fixUp) {}
+
+    [[nodiscard]] std::unique_ptr<ISlot> clone() const override { return std::make_unique<Slot<T>>(value, stamp); }
+
+    void addTo(ComponentManager &components, std::span<const Entity> entities) const override
+    {
+      auto &storage = components.getStorage<T>();
+      for (const Entity entity : entities) {
+        storage.addComponent(entity, value);
+        if (stamp != nullptr) {
+          stamp(storage.getComponent(entity), entity);
+        }
+      }
+    }
+
+    T value;
+    Stamp<T> stamp;
+  };
+
+  template <typename T>
+  [[nodiscard]] Slot<T> *find() const
+  {
+    if (!m_signature.test(getComponentId<T>())) {
+      return nullptr;
+    }
+    for (const auto &slot : m_slots) {
+      if (auto *typed = dynamic_cast<Slot<T> *>(slot.get())) {
+        return typed;
+      }
+    }
+    return nullptr;
+  }
+
+  std::vector<std::unique_ptr<ISlot>> m_slots;
+  ComponentSignature m_signature;
+};
+
+} // namespace ecs
+
+#endif // ECS_PREFAB_HPP_
@@ -0,0 +1,379 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** SpatialIndex.hpp
+*/
+
+#ifndef ECS_SPATIALINDEX_HPP_
+#define ECS_SPATIALINDEX_HPP_
+
+#include "ComponentSignature.hpp"
+#include "Entity.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ecs
+{
+
+/**
+ * @brief Uniform grid over the positions of a World's entities, for nearest, radius and k-NN queries
+ *
+ * The index is a snapshot: SpatialIndexSystem clears it, inserts every entity
+ * with a Transform and builds it once per tick, right after the movement.
+ * Queries walk the grid cells around the query point and test only the
+ * entries there, so their cost depends on how crowded that area is and not
+ * on how many entities the world holds.
+ *
+ * Each entry keeps the component signature the entity had when it was
+ * inserted; the filter of a query keeps the entries whose signature has
+ * every bit of the filter, and an optional predicate can reject more.
+ *
+ * @note Entities destroyed after the build stay in the index until the next
+ *       one: callers that read components of a result check isAlive() first.
+ */
+class SpatialIndex
+{
+public:
+  static constexpr float DEFAULT_CELL_SIZE = 128.0F;
+  // Bounds the grid when entities are far apart: the cells grow instead
+  static constexpr std::size_t MAX_CELLS_PER_AXIS = 128;
+
+  /** @brief An entity as seen by the index, positions are centers */
+  struct Entry {
+    Entity entity = 0;
+    float x = 0.0F;
+    float y = 0.0F;
+    float radius = 0.0F; ///< Bounding radius of the collider, 0 without one
+    float dx = 0.0F; ///< Velocity, 0 without one
+    float dy = 0.0F;
+    ComponentSignature signature;
+  };
+
+  struct AcceptAll {
+    constexpr bool operator()(const Entry & /*entry*/) const noexcept { return true; }
+  };
+
+  explicit SpatialIndex(float cellSize = DEFAULT_CELL_SIZE) : m_cellSize(cellSize) {}
+
+  /** @brief Drop every entry, insert() then build() fill the index again */
+  void clear()
+  {
+    m_pending.clear();
+    m_entries.clear();
+    m_cellStart.clear();
+    m_cols = 0;
+    m_rows = 0;
+    m_maxRadius = 0.0F;
+    m_maxSpeed = 0.0F;
+  }
+
+  /** @brief Add an entry to the next build(), entries without a finite position are ignored */
+  void insert(const Entry &entry)
+  {
+    if (std::isfinite(entry.x) && std::isfinite(entry.y)) {
+      m_pending.push_back(entry);
+    }
+  }
+
+  /** @brief Sort the inserted entries into the grid */
+  void build(std::uint64_t tick)
+  {
+    m_tick = tick;
+    m_entries.resize(m_pending.size());
+    if (m_pending.empty()) {
+      m_cellStart.assign(1, 0);
+      m_cols = 0;
+      m_rows = 0;
+      return;
+    }
+
+    float maxX = m_pending.front().x;
+    float maxY = m_pending.front().y;
+    float maxSpeedSquared = 0.0F;
+    m_originX = maxX;
+    m_originY = maxY;
+    for (const auto &entry : m_pending) {
+      m_originX = std::min(m_originX, entry.x);
+      m_originY = std::min(m_originY, entry.y);
+      maxX = std::max(maxX, entry.x);
+      maxY = std::max(maxY, entry.y);
+      m_maxRadius = std::max(m_maxRadius, entry.radius);
+      maxSpeedSquared = std::max(maxSpeedSquared, entry.dx * entry.dx + entry.dy * entry.dy);
+    }
+    m_maxSpeed = std::sqrt(maxSpeedSquared);
+    const auto maxCells = static_cast<float>(MAX_CELLS_PER_AXIS);
+    m_cell = std::max({m_cellSize, (maxX - m_originX) / maxCells, (maxY - m_originY) / maxCells});
+    m_cols = std::min(static_cast<int>((maxX - m_originX) / m_cell) + 1, static_cast<int>(MAX_CELLS_PER_AXIS));
+    m_rows = std::min(static_cast<int>((maxY - m_originY) / m_cell) + 1, static_cast<int>(MAX_CELLS_PER_AXIS));
+
+    // Counting sort by cell: the entries of a cell are contiguous and keep their insertion order
+    m_cellStart.assign(static_cast<std::size_t>(m_cols * m_rows) + 1, 0);
+    m_cellOfPending.resize(m_pending.size());
+    for (std::size_t i = 0; i < m_pending.size(); ++i) {
+      m_cellOfPending[i] = cellOf(m_pending[i].x, m_pending[i].y);
+      ++m_cellStart[m_cellOfPending[i] + 1];
+    }
+    for (std::size_t i = 1; i < m_cellStart.size(); ++i) {
+      m_cellStart[i] += m_cellStart[i - 1];
+    }
+    m_cursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (std::size_t i = 0; i < m_pending.size(); ++i) {
+      m_entries[m_cursor[m_cellOfPending[i]]++] = m_pending[i];
+    }
+  }
+
+  /**
+   * @brief Entry nearest to (x, y) matching filter and accept, nullptr if none is within maxDistance
+   * @note Ties go to the lowest entity, so the result does not depend on the grid
+   */
+  template <typename Accept = AcceptAll>
+  [[nodiscard]] const Entry *nearest(float x, float y, const ComponentSignature &filter,
+                                     float maxDistance = std::numeric_limits<float>::infinity(),
+                                     Accept &&accept = {}) const
+  {
+    const Entry *best = nullptr;
+    float bestDistance = maxDistance * maxDistance;
+    const auto visit = [&](const Entry &entry) {
+      if (!matches(entry, filter) || !accept(entry)) {
+        return;
+      }
+      const float distance = distanceSquared(entry, x, y);
+      if (distance < bestDistance || (distance == bestDistance && best != nullptr && entry.entity < best->entity)) {
+        best = &entry;
+        bestDistance = distance;
+      }
+    };
+    searchRings(x, y, visit, bestDistance);
+    return best;
+  }
+
+  /**
+   * @brief The k entries nearest to (x, y) matching filter and accept, nearest first
+   * @param out Cleared, then filled with at most k entries within maxDistance
+   */
+  template <typename Accept = AcceptAll>
+  void kNearest(float x, float y, std::size_t k, const ComponentSignature &filter, std::vector<const Entry *> &out,
+                float maxDistance = std::numeric_limits<float>::infinity(), Accept &&accept = {}) const
+  {
+    out.clear();
+    if (k == 0) {
+      return;
+    }
+    // Max-heap on (distance, entity): the top is the farthest of the k kept so far
+    std::vector<std::pair<float, const Entry *>> heap;
+    const auto closer = [](const auto &lhs, const auto &rhs) {
+      return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second->entity < rhs.second->entity);
+    };
+    float bound = maxDistance * maxDistance;
+    const auto visit = [&](const Entry &entry) {
+      if (!matches(entry, filter) || !accept(entry)) {
+        return;
+      }
+      const std::pair<float, const Entry *> candidate{distanceSquared(entry, x, y), &entry};
+      if (candidate.first > bound) {
+        return;
+      }
+      if (heap.size() == k) {
+        if (!closer(candidate, heap.front())) {
+          return;
+        }
+        std::pop_heap(heap.begin(), heap.end(), closer);
+        heap.pop_back();
+      }
+      heap.push_back(candidate);
+      std::push_heap(heap.begin(), heap.end(), closer);
+      if (heap.size() == k) {
+        bound = heap.front().first;
+      }
+    };
+    searchRings(x, y, visit, bound);
+
+    std::sort_heap(heap.begin(), heap.end(), closer);
+    for (const auto &[distance, entry] : heap) {
+      out.push_back(entry);
+    }
+  }
+
+  /**
+   * @brief Entries matching filter and accept whose bounding circle touches the circle (x, y, radius)
+   * @param out Cleared, then filled in entity order
+   */
+  template <typename Accept = AcceptAll>
+  void queryRadius(float x, float y, float radius, const ComponentSignature &filter, std::vector<const Entry *> &out,
+                   Accept &&accept = {}) const
+  {
+    out.clear();
+    const float reach = radius + m_maxRadius;
+    forEachInCells(x - reach, y - reach, x + reach, y + reach, [&](const Entry &entry) {
+      const float range = radius + entry.radius;
+      if (matches(entry, filter) && distanceSquared(entry, x, y) <= range * range && accept(entry)) {
+        out.push_back(&entry);
+      }
+    });
+    sortByEntity(out);
+  }
+
+  /**
+   * @brief Entries matching filter and accept whose center is in [minX, maxX] x [minY, maxY]
+   * @param out Cleared, then filled in entity order
+   */
+  template <typename Accept = AcceptAll>
+  void queryRect(float minX, float minY, float maxX, float maxY, const ComponentSignature &filter,
+                 std::vector<const Entry *> &out, Accept &&accept = {}) const
+  {
+    out.clear();
+    forEachInCells(minX, minY, maxX, maxY, [&](const Entry &entry) {
+      if (matches(entry, filter) && entry.x >= minX && entry.x <= maxX && entry.y >= minY && entry.y <= maxY &&
+          accept(entry)) {
+        out.push_back(&entry);
+      }
+    });
+    sortByEntity(out);
+  }
+
+  /**
+   * @brief Every entry matching filter, wherever it is (e.g. all the players)
+   * @param out Cleared, then filled in entity order
+   */
+  void collect(const ComponentSignature &filter, std::vector<const Entry *> &out) const
+  {
+    out.clear();
+    for (const auto &entry : m_entries) {
+      if (matches(entry, filter)) {
+        out.push_back(&entry);
+      }
+    }
+    sortByEntity(out);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+  [[nodiscard]] bool empty() const noexcept { return m_entries.empty(); }
+  /** @brief World tick of the last build() */
+  [[nodiscard]] std::uint64_t getTick() const noexcept { return m_tick; }
+  [[nodiscard]] float getMaxRadius() const noexcept { return m_maxRadius; }
+  /** @brief Fastest entry, to widen a query that predicts where entries will be */
+  [[nodiscard]] float getMaxSpeed() const noexcept { return m_maxSpeed; }
+
+private:
+  static bool matches(const Entry &entry, const ComponentSignature &filter)
+  {
+    return (entry.signature & filter) == filter;
+  }
+
+  static float distanceSquared(const Entry &entry, float x, float y)
+  {
+    const float dx = entry.x - x;
+    const float dy = entry.y - y;
+    return dx * dx + dy * dy;
+  }
+
+  static void sortByEntity(std::vector<const Entry *> &entries)
+  {
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry *lhs, const Entry *rhs) { return lhs->entity < rhs->entity; });
+  }
+
+  [[nodiscard]] int colOf(float x) const
+  {
+    return static_cast<int>(std::clamp(std::floor((x - m_originX) / m_cell), 0.0F, static_cast<float>(m_cols - 1)));
+  }
+
+  [[nodiscard]] int rowOf(float y) const
+  {
+    return static_cast<int>(std::clamp(std::floor((y - m_originY) / m_cell), 0.0F, static_cast<float>(m_rows - 1)));
+  }
+
+  [[nodiscard]] std::size_t cellOf(float x, float y) const
+  {
+    return static_cast<std::size_t>(rowOf(y) * m_cols + colOf(x));
+  }
+
+  template <typename Visit>
+  void forEachInCell(int col, int row, Visit &visit) const
+  {
+    const auto cell = static_cast<std::size_t>(row * m_cols + col);
+    for (std::size_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+      visit(m_entries[i]);
+    }
+  }
+
+  template <typename Visit>
+  void forEachInCells(float minX, float minY, float maxX, float maxY, Visit &&visit) const
+  {
+    if (m_entries.empty() || !(minX <= maxX) || !(minY <= maxY)) {
+      return;
+    }
+    const int lastRow = rowOf(maxY);
+    const int lastCol = colOf(maxX);
+    for (int row = rowOf(minY); row <= lastRow; ++row) {
+      for (int col = colOf(minX); col <= lastCol; ++col) {
+        forEachInCell(col, row, visit);
+      }
+    }
+  }
+
+  /**
+   * Visits the cells ring by ring around the cell of (x, y), and stops once
+   * every cell left is farther than the squared distance bound, which the
+   * visitor tightens as it finds closer entries.
+   */
+  template <typename Visit>
+  void searchRings(float x, float y, Visit &visit, const float &bound) const
+  {
+    if (m_entries.empty()) {
+      return;
+    }
+    const int col = colOf(x);
+    const int row = rowOf(y);
+    const float inf = std::numeric_limits<float>::infinity();
+    for (int ring = 0;; ++ring) {
+      for (int r = row - ring; r <= row + ring; ++r) {
+        if (r < 0 || r >= m_rows) {
+          continue;
+        }
+        const bool edge = r == row - ring || r == row + ring;
+        const int step = edge || ring == 0 ? 1 : 2 * ring;
+        for (int c = col - ring; c <= col + ring; c += step) {
+          if (c >= 0 && c < m_cols) {
+            forEachInCell(c, r, visit);
+          }
+        }
+      }
+
+      // Distance from (x, y) to the cells not visited yet; a side past the grid has none
+      const float left = col - ring > 0 ? x - (m_originX + static_cast<float>(col - ring) * m_cell) : inf;
+      const float right = col + ring < m_cols - 1 ? m_originX + static_cast<float>(col + ring + 1) * m_cell - x : inf;
+      const float top = row - ring > 0 ? y - (m_originY + static_cast<float>(row - ring) * m_cell) : inf;
+      const float bottom = row + ring < m_rows - 1 ? m_originY + static_cast<float>(row + ring + 1) * m_cell - y : inf;
+      const float remaining = std::max(0.0F, std::min({left, right, top, bottom}));
+      if (remaining == inf || remaining * remaining > bound) {
+        return;
+      }
+    }
+  }
+
+  float m_cellSize;
+  float m_cell = DEFAULT_CELL_SIZE; ///< Cell size of the current build, at least m_cellSize
+  float m_originX = 0.0F;
+  float m_originY = 0.0F;
+  int m_cols = 0;
+  int m_rows = 0;
+  float m_maxRadius = 0.0F;
+  float m_maxSpeed = 0.0F;
+  std::uint64_t m_tick = 0;
+  std::vector<Entry> m_pending;
+  std::vector<Entry> m_entries; ///< Sorted by cell
+  std::vector<std::size_t> m_cellStart; ///< Entries of cell i are [m_cellStart[i], m_cellStart[i + 1])
+  std::vector<std::size_t> m_cellOfPending;
+  std::vector<std::size_t> m_cursor;
+};
+
+} // namespace ecs
+
+#endif // ECS_SPATIALINDEX_HPP_
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Sweep.hpp - Continuous overlap tests for shapes moving during a tick
+*/
+
+#ifndef ECS_SWEEP_HPP_
+#define ECS_SWEEP_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace ecs::sweep
+{
+
+/**
+ * The tests below answer "do the two shapes overlap at some time of the
+ * step", both moving in a straight line at constant speed from their start
+ * position by their displacement. They work on the motion of the first shape
+ * relative to the second one, so a fast shot and a moving target are tested
+ * the same way as a shot and a still target. Overlaps are strict, like the
+ * discrete tests: shapes that only touch do not collide.
+ */
+
+/** @brief Axis-aligned box by its top-left corner, as the box Colliders */
+struct Box {
+  float x;
+  float y;
+  float width;
+  float height;
+};
+
+/**
+ * @brief Whether the segment from (ox, oy) by (dx, dy) enters the open rectangle ]minX, maxX[ x ]minY, maxY[
+ */
+inline bool segmentHitsRect(float ox, float oy, float dx, float dy, float minX, float minY, float maxX, float maxY)
+{
+  float tEnter = 0.0F;
+  float tExit = 1.0F;
+  const std::array<float, 2> origin = {ox, oy};
+  const std::array<float, 2> delta = {dx, dy};
+  const std::array<float, 2> lows = {minX, minY};
+  const std::array<float, 2> highs = {maxX, maxY};
+  for (std::size_t axis = 0; axis < 2; ++axis) {
+    if (delta[axis] == 0.0F) {
+      if (origin[axis] <= lows[axis] || origin[axis] >= highs[axis]) {
+        return false;
+      }
+      continue;
+    }
+    float tNear = (lows[axis] - origin[axis]) / delta[axis];
+    float tFar = (highs[axis] - origin[axis]) / delta[axis];
+    if (tNear > tFar) {
+      std::swap(tNear, tFar);
+    }
+    tEnter = std::max(tEnter, tNear);
+    tExit = std::min(tExit, tFar);
+    if (tEnter >= tExit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Whether the segment from (ox, oy) by (dx, dy) passes closer than radius to (px, py)
+ */
+inline bool segmentNearPoint(float ox, float oy, float dx, float dy, float px, float py, float radius)
+{
+  const float toX = px - ox;
+  const float toY = py - oy;
+  const float lengthSq = (dx * dx) + (dy * dy);
+  float t = 0.0F;
+  if (lengthSq > 0.0F) {
+    t = std::clamp(((toX * dx) + (toY * dy)) / lengthSq, 0.0F, 1.0F);
+  }
+  const float gapX = toX - (dx * t);
+  const float gapY = toY - (dy * t);
+  return (gapX * gapX) + (gapY * gapY) < radius * radius;
+}
+
+/**
+ * @brief Box a moving by (adx, ady) against box b moving by (bdx, bdy)
+ *
+ * The top-left corner of a, relative to b, is a point moving through b grown
+ * by the size of a (their Minkowski difference).
+ */
+inline bool boxBox(const Box &a, float adx, float ady, const Box &b, float bdx, float bdy)
+{
+  return segmentHitsRect(a.x, a.y, adx - bdx, ady - bdy, b.x - a.width, b.y - a.height, b.x + b.width,
+                         b.y + b.height);
+}
+
+/**
+ * @brief Circle centered on (ax, ay) moving by (adx, ady) against circle (bx, by) moving by (bdx, bdy)
+ */
+inline bool circleCircle(float ax, float ay, float aRadius, float adx, float ady, float bx, float by, float bRadius,
+                         float bdx, float bdy)
+{
+  return segmentNearPoint(ax, ay, adx - bdx, ady - bdy, bx, by, aRadius + bRadius);
+}
+
+/**
+ * @brief Box moving by (bdx, bdy) against the circle centered on (cx, cy) moving by (cdx, cdy)
+ *
+ * The box grown by the radius has rounded corners: it is the union of the box
+ * widened by the radius, the box heightened by the radius and the four
+ * circles on its corners, and the center of the circle is tested against each.
+ */
+inline bool boxCircle(const Box &box, float bdx, float bdy, float cx, float cy, float radius, float cdx, float cdy)
+{
+  const float dx = cdx - bdx;
+  const float dy = cdy - bdy;
+  const float right = box.x + box.width;
+  const float bottom = box.y + box.height;
+  if (segmentHitsRect(cx, cy, dx, dy, box.x - radius, box.y, right + radius, bottom) ||
+      segmentHitsRect(cx, cy, dx, dy, box.x, box.y - radius, right, bottom + radius)) {
+    return true;
+  }
+  return segmentNearPoint(cx, cy, dx, dy, box.x, box.y, radius) ||
+    segmentNearPoint(cx, cy, dx, dy, right, box.y, radius) || segmentNearPoint(cx, cy, dx, dy, box.x, bottom, radius) ||
+    segmentNearPoint(cx, cy, dx, dy, right, bottom, radius);
+}
+
+} // namespace ecs::sweep
+
+#endif // ECS_SWEEP_HPP_
@@ -11,6 +11,7 @@
 #include "ComponentSignature.hpp"
 #include "Entity.hpp"
 #include "ISystem.hpp"
+#include "../utils/Trace.hpp"
 
 #include <cstddef>
 #include <memory>
@@ -144,6 +145,7 @@ public:
   void update(World &world, float deltaTime)
   {
     for (auto &system : systems) {
+      RTYPE_TRACE_SCOPE_TYPE(*system);
       system->update(world, deltaTime);
     }
   }
@@ -12,12 +12,17 @@
 #include "ComponentSignature.hpp"
 #include "Entity.hpp"
 #include "EntityManager.hpp"
+#include "Prefab.hpp"
+#include "SpatialIndex.hpp"
 #include "SystemManager.hpp"
 #include "events/EventBus.hpp"
 #include "events/EventListenerHandle.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <random>
+#include <span>
 #include <vector>
 
 namespace ecs
@@ -61,20 +66,154 @@ public:
   [[nodiscard]] Entity createEntity()
   {
     Entity entity = m_entityManager.createEntity();
+    ++m_entityStats.created;
     return entity;
   }
 
+  /**
+   * @brief Destroy an entity, or park it if it came from acquire()
+   */
   void destroyEntity(Entity entity)
   {
     if (!m_entityManager.isAlive(entity)) {
       return;
     }
+    if (entity < m_poolOf.size() && m_poolOf[entity] != NO_POOL) {
+      park(entity);
+      ++m_entityStats.parked;
+      return;
+    }
 
     m_componentManager.removeAllComponents(entity);
     m_systemManager.onEntityDestroyed(entity);
     m_entityManager.destroyEntity(entity);
+    ++m_entityStats.destroyed;
+  }
+
+  /**
+   * @brief Create one entity from a prefab, with its full signature set at once
+   */
+  Entity instantiate(const Prefab &prefab)
+  {
+    const Entity entity = createEntity();
+    prefab.addTo(m_componentManager, std::span<const Entity>(&entity, 1));
+    m_entityManager.setSignature(entity, prefab.getSignature());
+    m_systemManager.onEntitySignatureChanged(entity, prefab.getSignature());
+    return entity;
   }
 
+  /**
+   * @brief Create one entity from a prefab with its own T (e.g. its Transform)
+   */
+  template <typename T>
+  Entity instantiate(const Prefab &prefab, const T &value)
+  {
+    const Entity entity = createEntity();
+    prefab.addTo(m_componentManager, std::span<const Entity>(&entity, 1));
+    m_componentManager.getStorage<T>().addComponent(entity, value);
+    ComponentSignature signature = prefab.getSignature();
+    signature.set(ecs::getComponentId<T>());
+    m_entityManager.setSignature(entity, signature);
+    m_systemManager.onEntitySignatureChanged(entity, signature);
+    return entity;
+  }
+
+  /**
+   * @brief Create count entities from a prefab
+   * @param entities Receives the new entities, in creation order
+   */
+  void instantiate(const Prefab &prefab, std::size_t count, std::vector<Entity> &entities)
+  {
+    createInstances(prefab, count, entities);
+    setSignatures(entities, prefab.getSignature());
+  }
+
+  /**
+   * @brief Create one entity per value of T from a prefab, each with its own T (e.g. its Transform)
+   * @param values Per-entity component, replacing the prefab's T if it has one
+   * @param entities Receives the new entities, entities[i] got values[i]
+   */
+  template <typename T>
+  void instantiate(const Prefab &prefab, std::span<const T> values, std::vector<Entity> &entities)
+  {
+    createInstances(prefab, values.size(), entities);
+    auto &storage = m_componentManager.getStorage<T>();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      storage.addComponent(entities[i], values[i]);
+    }
+    ComponentSignature signature = prefab.getSignature();
+    signature.set(ecs::getComponentId<T>());
+    setSignatures(entities, signature);
+  }
+
+  // ============================================================
+  // ====================== POOLING =============================
+
+  /**
+   * @brief Create an entity from a prefab, reusing one of its parked entities when there is one
+   *
+   * Entities acquired from a prefab are parked by destroyEntity() instead of
+   * being destroyed: they keep their ID and their component slots, and the
+   * next acquire() of the same prefab rewrites the prefab values in place.
+   * Components added after acquire() are removed when the entity is parked.
+   *
+   * @note The prefab is the pool key: it must outlive the world (e.g. a static or config-owned prefab)
+   */
+  Entity acquire(const Prefab &prefab)
+  {
+    const Entity entity = acquireInstance(prefab);
+    activate(entity, prefab.getSignature());
+    return entity;
+  }
+
+  /**
+   * @brief acquire() with the entity's own T (e.g. its Transform)
+   */
+  template <typename T>
+  Entity acquire(const Prefab &prefab, const T &value)
+  {
+    const Entity entity = acquireInstance(prefab);
+    m_componentManager.getStorage<T>().addComponent(entity, value);
+    ComponentSignature signature = prefab.getSignature();
+    signature.set(ecs::getComponentId<T>());
+    activate(entity, signature);
+    return entity;
+  }
+
+  /**
+   * @brief Create parked entities of a prefab until count of them are waiting to be acquired
+   */
+  void prewarm(const Prefab &prefab, std::size_t count)
+  {
+    const std::size_t poolIndex = getPool(prefab);
+    while (m_pools[poolIndex].parked.size() < count) {
+      const Entity entity = instantiate(prefab);
+      setPool(entity, poolIndex);
+      park(entity);
+    }
+  }
+
+  /** @brief Entities of the prefab parked and ready to be acquired */
+  [[nodiscard]] std::size_t getParkedCount(const Prefab &prefab) const
+  {
+    for (const auto &pool : m_pools) {
+      if (pool.prefab == &prefab) {
+        return pool.parked.size();
+      }
+    }
+    return 0;
+  }
+
+  /** @brief Entity lifecycle counters since the world was created */
+  struct EntityStats {
+    std::uint64_t created = 0; ///< New entity IDs handed out
+    std::uint64_t destroyed = 0; ///< Entities destroyed with all their components
+    std::uint64_t reused = 0; ///< acquire() calls served by a parked entity
+    std::uint64_t parked = 0; ///< destroyEntity() calls that parked a pooled entity
+  };
+
+  [[nodiscard]] const EntityStats &getEntityStats() const noexcept { return m_entityStats; }
+
   [[nodiscard]] bool isAlive(Entity entity) const { return m_entityManager.isAlive(entity); }
 
   [[nodiscard]] std::size_t getEntityCount() const { return m_entityManager.getAliveCount(); }
@@ -112,12 +251,51 @@ public:
     m_systemManager.removeSystem<T>();
   }
 
-  void update(float deltaTime) { m_systemManager.update(*this, deltaTime); }
+  /**
+   * @brief Runs every system once, then advances the tick
+   * @note While systems run, getTick() is the index of the tick being simulated
+   */
+  void update(float deltaTime)
+  {
+    m_systemManager.update(*this, deltaTime);
+    ++m_tick;
+  }
+
+  /** @brief Number of completed updates: the simulation tick of this world */
+  [[nodiscard]] std::uint64_t getTick() const noexcept { return m_tick; }
 
   [[nodiscard]] std::size_t getSystemCount() const noexcept { return m_systemManager.getSystemCount(); }
 
+  // ============================================================
+  // ====================== RANDOMNESS ==========================
+
+  /**
+   * @brief Restart the world's random sequence from a seed
+   * @note Game logic must draw from getRandom() only: the same seed and inputs then replay the same run
+   */
+  void seedRandom(std::uint64_t seed)
+  {
+    m_randomSeed = seed;
+    m_random.seed(static_cast<std::mt19937::result_type>(seed ^ (seed >> 32)));
+  }
+
+  [[nodiscard]] std::uint64_t getRandomSeed() const noexcept { return m_randomSeed; }
+
+  /** @brief Random generator of this world, seeded by seedRandom() */
+  [[nodiscard]] std::mt19937 &getRandom() noexcept { return m_random; }
+
   void clearSystems() noexcept { m_systemManager.clear(); }
 
+  // ============================================================
+  // ====================== SPATIAL INDEX =======================
+
+  /**
+   * @brief Positions of the entities as of the last SpatialIndexSystem update
+   * @note Empty in a world that does not register a SpatialIndexSystem
+   */
+  [[nodiscard]] SpatialIndex &getSpatialIndex() noexcept { return m_spatialIndex; }
+  [[nodiscard]] const SpatialIndex &getSpatialIndex() const noexcept { return m_spatialIndex; }
+
   // ============================================================
   // ================= COMPONENT MANAGEMENT ======================
 
@@ -153,6 +331,17 @@ public:
     return m_componentManager.hasComponent<T>(entity);
   }
 
+  /**
+   * @brief Storage of component T, for systems that read one component of many entities
+   *
+   * getComponent() looks the storage up on every call; a batch looks it up once.
+   */
+  template <typename T>
+  ComponentStorage<T> &getStorage()
+  {
+    return m_componentManager.getStorage<T>();
+  }
+
   template <typename T>
   void removeComponent(Entity entity)
   {
@@ -237,10 +426,99 @@ public:
   }
 
 private:
+  void createInstances(const Prefab &prefab, std::size_t count, std::vector<Entity> &entities)
+  {
+    entities.clear();
+    entities.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      entities.push_back(createEntity());
+    }
+    prefab.addTo(m_componentManager, entities);
+  }
+
+  void setSignatures(const std::vector<Entity> &entities, const ComponentSignature &signature)
+  {
+    for (const Entity entity : entities) {
+      m_entityManager.setSignature(entity, signature);
+      m_systemManager.onEntitySignatureChanged(entity, signature);
+    }
+  }
+
+  struct Pool {
+    const Prefab *prefab;
+    std::vector<Entity> parked;
+  };
+
+  static constexpr std::uint16_t NO_POOL = UINT16_MAX;
+
+  std::size_t getPool(const Prefab &prefab)
+  {
+    for (std::size_t i = 0; i < m_pools.size(); ++i) {
+      if (m_pools[i].prefab == &prefab) {
+        return i;
+      }
+    }
+    m_pools.push_back({&prefab, {}});
+    return m_pools.size() - 1;
+  }
+
+  void setPool(Entity entity, std::size_t poolIndex)
+  {
+    if (entity >= m_poolOf.size()) {
+      m_poolOf.resize(entity + 1, NO_POOL);
+    }
+    m_poolOf[entity] = static_cast<std::uint16_t>(poolIndex);
+  }
+
+  // Entity with the prefab components written, not yet visible to systems
+  Entity acquireInstance(const Prefab &prefab)
+  {
+    const std::size_t poolIndex = getPool(prefab);
+    auto &parked = m_pools[poolIndex].parked;
+    Entity entity = 0;
+    if (parked.empty()) {
+      entity = createEntity();
+      setPool(entity, poolIndex);
+    } else {
+      entity = parked.back();
+      parked.pop_back();
+      m_entityManager.unparkEntity(entity);
+      ++m_entityStats.reused;
+    }
+    prefab.addTo(m_componentManager, std::span<const Entity>(&entity, 1));
+    return entity;
+  }
+
+  void activate(Entity entity, const ComponentSignature &signature)
+  {
+    m_entityManager.setSignature(entity, signature);
+    m_systemManager.onEntitySignatureChanged(entity, signature);
+  }
+
+  // Keeps the prefab components in their storage slots, the next acquireInstance() overwrites them
+  void park(Entity entity)
+  {
+    Pool &pool = m_pools[m_poolOf[entity]];
+    const ComponentSignature extra = m_entityManager.getSignature(entity) & ~pool.prefab->getSignature();
+    if (extra.any()) {
+      m_componentManager.removeComponents(entity, extra);
+    }
+    m_systemManager.onEntityDestroyed(entity);
+    m_entityManager.parkEntity(entity);
+    pool.parked.push_back(entity);
+  }
+
   EntityManager m_entityManager;
   ComponentManager m_componentManager;
+  std::vector<Pool> m_pools;
+  std::vector<std::uint16_t> m_poolOf; ///< Pool index per entity ID, NO_POOL if not pooled
+  EntityStats m_entityStats;
   SystemManager m_systemManager;
   EventBus m_eventBus;
+  SpatialIndex m_spatialIndex;
+  std::uint64_t m_tick = 0;
+  std::uint64_t m_randomSeed = std::mt19937::default_seed;
+  std::mt19937 m_random;
 };
 
 } // namespace ecs
@@ -0,0 +1,27 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** BoomerangState.hpp - Flight state of the Evangelic boss shots
+*/
+
+#ifndef ECS_COMPONENTS_BOOMERANGSTATE_HPP_
+#define ECS_COMPONENTS_BOOMERANGSTATE_HPP_
+
+namespace ecs
+{
+
+/**
+ * @brief Evangelic shot: homes on the player, flies back to where it spawned, then homes again
+ */
+struct BoomerangState {
+  float spawnX = 0.0F;
+  float spawnY = 0.0F;
+  float timer = 0.0F;
+  bool returning = false;
+  bool hasReachedSpawn = false;
+};
+
+} // namespace ecs
+
+#endif // ECS_COMPONENTS_BOOMERANGSTATE_HPP_
@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** BossState.hpp - Movement state of the Dobkeratops boss
+*/
+
+#ifndef ECS_COMPONENTS_BOSSSTATE_HPP_
+#define ECS_COMPONENTS_BOSSSTATE_HPP_
+
+namespace ecs
+{
+
+/**
+ * @brief Dobkeratops ("boss_pattern"): enters from the right, then patrols vertically at changing speeds
+ */
+struct BossState {
+  bool verticalMode = false;
+  float speedChangeTimer = 0.0F;
+  float nextChangeInterval = 1.0F;
+  float targetSpeed = 150.0F;
+};
+
+} // namespace ecs
+
+#endif // ECS_COMPONENTS_BOSSSTATE_HPP_
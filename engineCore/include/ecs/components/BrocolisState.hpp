@@ -0,0 +1,25 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** BrocolisState.hpp - State of the Brocolis boss and of its eggs
+*/
+
+#ifndef ECS_COMPONENTS_BROCOLISSTATE_HPP_
+#define ECS_COMPONENTS_BROCOLISSTATE_HPP_
+
+namespace ecs
+{
+
+/**
+ * @brief Brocolis ("boss_brocolis_pattern"): entry of a boss, or hatching of one of its shots into a mini boss
+ */
+struct BrocolisState {
+  bool hasEntered = false;
+  bool isHatching = false;
+  float hatchingTimer = 0.0F;
+};
+
+} // namespace ecs
+
+#endif // ECS_COMPONENTS_BROCOLISSTATE_HPP_
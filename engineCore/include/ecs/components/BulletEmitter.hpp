@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** BulletEmitter.hpp - Data-driven bullet patterns of an enemy
+*/
+
+#ifndef ECS_COMPONENTS_BULLETEMITTER_HPP_
+#define ECS_COMPONENTS_BULLETEMITTER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ecs
+{
+
+/**
+ * @brief One emitter of an enemy type, from the "emitters" list of enemies.json
+ *
+ * The shapes only pick defaults: a ring is a 360 degree volley, a spiral a
+ * ring whose angle turns after every volley, a fan an arc centered on the
+ * nearest player and a burst a fan fired several times in a row.
+ */
+struct EmitterConfig {
+  std::uint16_t count = 1; ///< Bullets per volley
+  float arc = 360.0F; ///< Degrees covered by a volley, 360 for a ring
+  float angle = 180.0F; ///< First angle when not aimed (0 is right, 90 is down)
+  float spin = 0.0F; ///< Degrees added to the angle after each volley
+  bool aimed = false; ///< Center the volley on the nearest player
+  float delay = 1.0F; ///< Seconds before the first volley
+  float interval = 1.0F; ///< Seconds between volleys, or between bursts
+  std::uint16_t burst = 1; ///< Volleys per burst
+  float burstInterval = 0.1F; ///< Seconds between the volleys of a burst
+  float speed = 250.0F;
+  float lifetime = 6.0F;
+  float radius = 10.0F;
+  int damage = 20; ///< Dealt by each bullet that hits
+  float offsetX = 0.0F; ///< Origin from the center of the enemy
+  float offsetY = 0.0F;
+  float minHealth = 0.0F; ///< Fires while the health fraction is in (minHealth, maxHealth]
+  float maxHealth = 1.0F;
+  std::uint32_t spriteId = 0;
+  std::uint32_t width = 16;
+  std::uint32_t height = 16;
+  std::uint32_t frameCount = 1;
+  float frameTime = 0.1F;
+  float scale = 1.0F;
+};
+
+/**
+ * @brief Bullet emitters of an enemy and their timers, run by BulletPatternSystem
+ *
+ * The configs are shared by every enemy of a type; only the timers are per enemy.
+ */
+struct BulletEmitter {
+  static constexpr std::size_t MAX_EMITTERS = 4;
+
+  struct State {
+    float timer = 0.0F; ///< Seconds to the next volley
+    float angle = 0.0F; ///< Angle of the next unaimed volley
+    std::uint16_t burstLeft = 0; ///< Volleys left in the current burst
+  };
+
+  std::shared_ptr<const std::vector<EmitterConfig>> configs;
+  std::array<State, MAX_EMITTERS> states{};
+};
+
+} // namespace ecs
+
+#endif // ECS_COMPONENTS_BULLETEMITTER_HPP_
@@ -9,10 +9,30 @@
 #define ENGINECORE_ECS_COMPONENTS_PATTERN_HPP
 
 #include "IComponent.hpp"
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace ecs
 {
+/**
+ * @brief Pattern types the enemy AI knows, interned from Pattern::patternType
+ */
+enum class PatternKind : std::uint8_t {
+  NONE, // Unknown type, or "none": moved by its velocity only
+  STRAIGHT,
+  SINE_WAVE,
+  ZIGZAG,
+  BOUNCE,
+  GROUND_WALK,
+  ELITE_TRACK,
+  BOSS_DOBKERATOPS, // "boss_pattern"
+  BOSS_BROCOLIS,
+  BOSS_EVANGELIC,
+  COUNT
+};
+
 /**
  * @brief Defines the movement pattern of an entity
  *
@@ -21,15 +41,43 @@ namespace ecs
  */
 struct Pattern : public IComponent {
   std::string patternType; // e.g., "sine_wave", "straight", "zigzag", "circle"
+  PatternKind kind; // patternType interned by the constructors, what the AI dispatches on
   float amplitude; // Amplitude for wave patterns
   float frequency; // Frequency for oscillating patterns
   float phase; // Current phase in the pattern cycle
 
-  Pattern() : patternType("straight"), amplitude(0.0f), frequency(0.0f), phase(0.0f) {}
+  Pattern() : patternType("straight"), kind(PatternKind::STRAIGHT), amplitude(0.0f), frequency(0.0f), phase(0.0f) {}
 
   Pattern(std::string type, float amp = 0.0f, float freq = 0.0f)
-      : patternType(std::move(type)), amplitude(amp), frequency(freq), phase(0.0f)
+      : patternType(std::move(type)), kind(intern(patternType)), amplitude(amp), frequency(freq), phase(0.0f)
+  {
+  }
+
+  [[nodiscard]] static PatternKind intern(std::string_view type)
+  {
+    static constexpr std::pair<std::string_view, PatternKind> KINDS[] = {
+      {"straight", PatternKind::STRAIGHT},
+      {"sine_wave", PatternKind::SINE_WAVE},
+      {"zigzag", PatternKind::ZIGZAG},
+      {"bounce", PatternKind::BOUNCE},
+      {"ground_walk", PatternKind::GROUND_WALK},
+      {"elite_track", PatternKind::ELITE_TRACK},
+      {"boss_pattern", PatternKind::BOSS_DOBKERATOPS},
+      {"boss_brocolis_pattern", PatternKind::BOSS_BROCOLIS},
+      {"boss_evangelic_pattern", PatternKind::BOSS_EVANGELIC},
+    };
+    for (const auto &[name, kind] : KINDS) {
+      if (name == type) {
+        return kind;
+      }
+    }
+    return PatternKind::NONE;
+  }
+
+  [[nodiscard]] bool isBoss() const
   {
+    return kind == PatternKind::BOSS_DOBKERATOPS || kind == PatternKind::BOSS_BROCOLIS ||
+      kind == PatternKind::BOSS_EVANGELIC;
   }
 
   [[nodiscard]] nlohmann::json toJson() const override
@@ -0,0 +1,29 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Swept.hpp - Marks fast entities whose collisions are tested along their path
+*/
+
+#ifndef ECS_COMPONENTS_SWEPT_HPP_
+#define ECS_COMPONENTS_SWEPT_HPP_
+
+namespace ecs
+{
+
+/**
+ * @brief Position before the last movement step, kept by MovementSystem
+ *
+ * CollisionSystem tests an entity with Swept over the segment from
+ * (prevX, prevY) to its Transform instead of at its Transform only, so a shot
+ * that moves further than a target's width in one tick still hits it.
+ */
+struct Swept {
+  float prevX = 0.0F;
+  float prevY = 0.0F;
+  bool moved = false; // False until MovementSystem has stepped the entity once
+};
+
+} // namespace ecs
+
+#endif // ECS_COMPONENTS_SWEPT_HPP_
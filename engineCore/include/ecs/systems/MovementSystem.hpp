@@ -11,6 +11,7 @@
 #include "../Entity.hpp"
 #include "../ISystem.hpp"
 #include "../World.hpp"
+#include "../components/Swept.hpp"
 #include "../components/Transform.hpp"
 #include "../components/Velocity.hpp"
 #include <vector>
@@ -21,7 +22,8 @@ namespace ecs
  * @brief System that updates entity positions based on their velocity
  *
  * This system processes all entities with Transform and Velocity components,
- * updating their position each frame based on deltaTime.
+ * updating their position each frame based on deltaTime. Entities with Swept
+ * also get their position from before the step, for the swept collision tests.
  */
 class MovementSystem : public ISystem
 {
@@ -32,10 +34,17 @@ public:
     std::vector<Entity> entities;
     world.getEntitiesWithSignature(getSignature(), entities);
 
+    auto &sweeps = world.getStorage<Swept>();
     for (auto entity : entities) {
       auto &transform = world.getComponent<Transform>(entity);
       auto &velocity = world.getComponent<Velocity>(entity);
 
+      if (sweeps.hasComponent(entity)) {
+        auto &swept = sweeps.getComponent(entity);
+        swept.prevX = transform.x;
+        swept.prevY = transform.y;
+        swept.moved = true;
+      }
       transform.x += velocity.dx * deltaTime;
       transform.y += velocity.dy * deltaTime;
     }
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** SpatialIndexSystem
+*/
+
+#ifndef SPATIALINDEXSYSTEM_HPP_
+#define SPATIALINDEXSYSTEM_HPP_
+#include "../ComponentSignature.hpp"
+#include "../Entity.hpp"
+#include "../ISystem.hpp"
+#include "../SpatialIndex.hpp"
+#include "../World.hpp"
+#include "../components/Collider.hpp"
+#include "../components/Transform.hpp"
+#include "../components/Velocity.hpp"
+#include <cmath>
+#include <vector>
+
+namespace ecs
+{
+/**
+ * @brief System that rebuilds the world's SpatialIndex from every entity with a Transform
+ *
+ * Registered right after MovementSystem, so the index holds the positions of
+ * the tick; the systems before it in the next tick query the same snapshot.
+ * A box collider is centered on its box and a circle collider on its
+ * Transform, as CollisionSystem tests them.
+ */
+class SpatialIndexSystem : public ISystem
+{
+public:
+  SpatialIndexSystem() = default;
+  void update(World &world, float /*deltaTime*/) override
+  {
+    auto &index = world.getSpatialIndex();
+    index.clear();
+    world.getEntitiesWithSignature(getSignature(), m_entities);
+
+    const auto colliderId = getComponentId<Collider>();
+    const auto velocityId = getComponentId<Velocity>();
+    auto &transforms = world.getStorage<Transform>();
+    auto &colliders = world.getStorage<Collider>();
+    auto &velocities = world.getStorage<Velocity>();
+    for (const auto entity : m_entities) {
+      const auto &transform = transforms.getComponent(entity);
+      SpatialIndex::Entry entry;
+      entry.entity = entity;
+      entry.x = transform.x;
+      entry.y = transform.y;
+      entry.signature = world.getEntitySignature(entity);
+      if (entry.signature.test(colliderId)) {
+        const auto &collider = colliders.getComponent(entity);
+        if (collider.shape == Collider::Shape::BOX) {
+          entry.x += collider.width * 0.5F;
+          entry.y += collider.height * 0.5F;
+          entry.radius = std::hypot(collider.width, collider.height) * 0.5F;
+        } else {
+          entry.radius = collider.radius;
+        }
+      }
+      if (entry.signature.test(velocityId)) {
+        const auto &velocity = velocities.getComponent(entity);
+        entry.dx = velocity.dx;
+        entry.dy = velocity.dy;
+      }
+      index.insert(entry);
+    }
+    index.build(world.getTick());
+  };
+
+  [[nodiscard]] ComponentSignature getSignature() const override
+  {
+    ComponentSignature sig;
+    sig.set(getComponentId<Transform>());
+    return sig;
+  }
+
+private:
+  std::vector<Entity> m_entities;
+};
+} // namespace ecs
+
+#endif /* !SPATIALINDEXSYSTEM_HPP_ */
@@ -0,0 +1,489 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Log.hpp - Asynchronous leveled logger
+*/
+
+#ifndef UTILS_LOG_HPP_
+#define UTILS_LOG_HPP_
+
+/**
+ * @file Log.hpp
+ * @brief Leveled logging that never writes from the calling thread
+ *
+ * RTYPE_LOG_INFO("[Server] New client " << id) formats the line on the
+ * calling thread and pushes it into that thread's lock-free ring; a
+ * background writer thread drains every ring, prints to the console and
+ * optionally appends to a rotating file. Game threads never block on a
+ * flush or a syscall for logging.
+ *
+ * Levels below RTYPE_LOG_LEVEL (0 trace ... 4 error, default 1) are removed
+ * at compile time; Logger::configure() raises the threshold at run time.
+ * A full ring drops the line and counts it rather than wait.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef RTYPE_LOG_LEVEL
+#define RTYPE_LOG_LEVEL 1
+#endif
+
+namespace logging
+{
+/** @brief Severity; ERR rather than ERROR, which <windows.h> defines as a macro */
+enum class Level : int { TRACE = 0, DEBUG = 1, INFO = 2, WARN = 3, ERR = 4 };
+
+inline const char *toString(Level level)
+{
+  switch (level) {
+  case Level::TRACE:
+    return "TRACE";
+  case Level::DEBUG:
+    return "DEBUG";
+  case Level::INFO:
+    return "INFO";
+  case Level::WARN:
+    return "WARN";
+  case Level::ERR:
+    return "ERROR";
+  }
+  return "?";
+}
+
+/** @brief Parse "trace", "debug", "info", "warn" or "error"; fallback otherwise. */
+inline Level parseLevel(std::string_view name, Level fallback)
+{
+  static constexpr std::pair<std::string_view, Level> NAMES[] = {
+    {"trace", Level::TRACE}, {"debug", Level::DEBUG}, {"info", Level::INFO},
+    {"warn", Level::WARN},   {"error", Level::ERR},
+  };
+  for (const auto &[text, level] : NAMES) {
+    if (text == name) {
+      return level;
+    }
+  }
+  return fallback;
+}
+
+struct LogSettings {
+  Level level = Level::INFO; // Run-time threshold, on top of RTYPE_LOG_LEVEL
+  bool console = true; // WARN and above to stderr, the rest to stdout, text unchanged
+  std::string file; // Empty: no file
+  std::size_t maxFileBytes = 10 * 1024 * 1024; // Rotate once the file would exceed this
+  std::size_t maxFiles = 3; // Rotated copies kept: file.1 (newest) ... file.N
+};
+
+/**
+ * @brief Single-producer single-consumer byte ring of one thread
+ *
+ * Records are a header and the text, padded to 8 bytes. A record that does
+ * not fit before the end of the ring leaves a wrap marker and starts over
+ * at offset 0.
+ */
+class ThreadQueue
+{
+public:
+  static constexpr std::size_t CAPACITY = 64 * 1024;
+  static constexpr std::size_t MAX_LINE = CAPACITY / 4;
+
+  struct Record {
+    Level level = Level::INFO;
+    std::int64_t timeNs = 0; // system_clock
+    std::string text;
+  };
+
+  ThreadQueue() : m_data(std::make_unique<std::byte[]>(CAPACITY)) {}
+
+  /** @brief Producer side; false (line dropped) when the ring is full. */
+  bool push(Level level, std::int64_t timeNs, std::string_view text)
+  {
+    text = text.substr(0, MAX_LINE);
+    const std::size_t size = recordSize(text.size());
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    const std::size_t tail = m_tail.load(std::memory_order_acquire);
+    std::size_t offset = head % CAPACITY;
+    std::size_t needed = size;
+    if (offset + size > CAPACITY) {
+      needed += CAPACITY - offset; // Skipped up to the end of the ring
+    }
+    if (head + needed - tail > CAPACITY) {
+      return false;
+    }
+    if (offset + size > CAPACITY) {
+      if (CAPACITY - offset >= sizeof(Header)) {
+        writeHeader(offset, Header{WRAP, 0, 0});
+      }
+      offset = 0;
+    }
+    writeHeader(offset, Header{static_cast<std::uint32_t>(text.size()), static_cast<std::uint32_t>(level), timeNs});
+    std::memcpy(m_data.get() + offset + sizeof(Header), text.data(), text.size());
+    m_head.store(head + needed, std::memory_order_release);
+    return true;
+  }
+
+  /** @brief Consumer side: append every complete record to out. */
+  void drain(std::vector<Record> &out)
+  {
+    const std::size_t head = m_head.load(std::memory_order_acquire);
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    while (tail != head) {
+      const std::size_t offset = tail % CAPACITY;
+      Header header{WRAP, 0, 0};
+      if (CAPACITY - offset >= sizeof(Header)) {
+        std::memcpy(&header, m_data.get() + offset, sizeof(Header));
+      }
+      if (header.length == WRAP) {
+        tail += CAPACITY - offset;
+        continue;
+      }
+      const auto *text = reinterpret_cast<const char *>(m_data.get() + offset + sizeof(Header));
+      out.push_back(Record{static_cast<Level>(header.level), header.timeNs, std::string(text, header.length)});
+      tail += recordSize(header.length);
+    }
+    m_tail.store(tail, std::memory_order_release);
+  }
+
+  /** @brief Set when the owning thread exits; the writer forgets the queue once drained. */
+  std::atomic<bool> abandoned{false};
+
+private:
+  struct Header {
+    std::uint32_t length;
+    std::uint32_t level;
+    std::int64_t timeNs;
+  };
+
+  static constexpr std::uint32_t WRAP = 0xFFFFFFFF;
+
+  static std::size_t recordSize(std::size_t length) { return (sizeof(Header) + length + 7) & ~std::size_t{7}; }
+
+  void writeHeader(std::size_t offset, const Header &header)
+  {
+    std::memcpy(m_data.get() + offset, &header, sizeof(Header));
+  }
+
+  std::unique_ptr<std::byte[]> m_data;
+  std::atomic<std::size_t> m_head{0}; // Bytes ever written
+  std::atomic<std::size_t> m_tail{0}; // Bytes ever consumed
+};
+
+/**
+ * @brief Process-wide logger and its writer thread
+ *
+ * Started on first use. The destructor drains what is left, so lines
+ * logged before exit are not lost.
+ */
+class Logger
+{
+public:
+  static Logger &instance()
+  {
+    static Logger logger;
+    return logger;
+  }
+
+  Logger(const Logger &) = delete;
+  Logger &operator=(const Logger &) = delete;
+
+  ~Logger()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_wake.notify_all();
+    if (m_writer.joinable()) {
+      m_writer.join();
+    }
+  }
+
+  void configure(const LogSettings &settings)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_settings = settings;
+    m_level.store(static_cast<int>(settings.level), std::memory_order_relaxed);
+    m_file.close();
+    m_fileBytes = 0;
+    if (!m_settings.file.empty()) {
+      openFile();
+    }
+  }
+
+  [[nodiscard]] bool isEnabled(Level level) const
+  {
+    return static_cast<int>(level) >= m_level.load(std::memory_order_relaxed);
+  }
+
+  void write(Level level, std::string_view text)
+  {
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    const auto timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    if (!threadQueue().push(level, timeNs, text)) {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /** @brief Block until everything logged so far is written out. */
+  void flush()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const std::uint64_t target = ++m_flushRequested;
+    m_wake.notify_all();
+    m_flushed.wait(lock, [this, target]() { return m_flushDone >= target || m_stopping; });
+  }
+
+private:
+  static constexpr auto WRITE_PERIOD = std::chrono::milliseconds(10);
+
+  /** @brief Registers the queue on creation, marks it abandoned when the thread exits */
+  struct QueueHandle {
+    std::shared_ptr<ThreadQueue> queue = std::make_shared<ThreadQueue>();
+    QueueHandle() { Logger::instance().registerQueue(queue); }
+    ~QueueHandle() { queue->abandoned.store(true, std::memory_order_release); }
+  };
+
+  Logger() : m_writer([this]() { run(); }) {}
+
+  static ThreadQueue &threadQueue()
+  {
+    thread_local QueueHandle handle;
+    return *handle.queue;
+  }
+
+  void registerQueue(std::shared_ptr<ThreadQueue> queue)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queues.push_back(std::move(queue));
+  }
+
+  void run()
+  {
+    std::vector<ThreadQueue::Record> records;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_wake.wait_for(lock, WRITE_PERIOD, [this]() { return m_stopping || m_flushRequested > m_flushDone; });
+      const bool stopping = m_stopping;
+      const std::uint64_t flushTarget = m_flushRequested;
+
+      records.clear();
+      for (std::size_t index = 0; index < m_queues.size();) {
+        // Read before the drain, so the lines of a thread that just exited are not lost
+        const bool abandoned = m_queues[index]->abandoned.load(std::memory_order_acquire);
+        m_queues[index]->drain(records);
+        if (abandoned) {
+          m_queues[index] = std::move(m_queues.back());
+          m_queues.pop_back();
+        } else {
+          ++index;
+        }
+      }
+      std::stable_sort(records.begin(), records.end(),
+                       [](const auto &lhs, const auto &rhs) { return lhs.timeNs < rhs.timeNs; });
+      if (const std::uint64_t dropped = m_dropped.exchange(0, std::memory_order_relaxed); dropped > 0) {
+        records.push_back(ThreadQueue::Record{Level::WARN, records.empty() ? 0 : records.back().timeNs,
+                                              "[Log] " + std::to_string(dropped) + " lines dropped (queue full)"});
+      }
+      for (const auto &record : records) {
+        output(record);
+      }
+      if (!records.empty()) {
+        std::cout.flush();
+        m_file.flush();
+      }
+
+      m_flushDone = flushTarget;
+      m_flushed.notify_all();
+      if (stopping) {
+        return;
+      }
+    }
+  }
+
+  void output(const ThreadQueue::Record &record)
+  {
+    if (m_settings.console) {
+      (record.level >= Level::WARN ? std::cerr : std::cout) << record.text << '\n';
+    }
+    if (!m_file.is_open()) {
+      return;
+    }
+    const std::string line = formatTime(record.timeNs) + " " + toString(record.level) + " " + record.text + "\n";
+    if (m_fileBytes + line.size() > m_settings.maxFileBytes && m_fileBytes > 0) {
+      rotate();
+    }
+    m_file << line;
+    m_fileBytes += line.size();
+  }
+
+  void openFile()
+  {
+    m_file.open(m_settings.file, std::ios::app);
+    if (!m_file) {
+      std::cerr << "[Log] Cannot open " << m_settings.file << '\n';
+      return;
+    }
+    std::error_code error;
+    const auto size = std::filesystem::file_size(m_settings.file, error);
+    m_fileBytes = error ? 0 : static_cast<std::size_t>(size);
+  }
+
+  /** @brief file -> file.1 -> ... -> file.N, the oldest one is removed. */
+  void rotate()
+  {
+    m_file.close();
+    std::error_code error;
+    const std::string &path = m_settings.file;
+    if (m_settings.maxFiles == 0) {
+      std::filesystem::remove(path, error);
+    } else {
+      std::filesystem::remove(path + "." + std::to_string(m_settings.maxFiles), error);
+      for (std::size_t index = m_settings.maxFiles; index > 1; --index) {
+        std::filesystem::rename(path + "." + std::to_string(index - 1), path + "." + std::to_string(index), error);
+      }
+      std::filesystem::rename(path, path + ".1", error);
+    }
+    m_fileBytes = 0;
+    openFile();
+  }
+
+  static std::string formatTime(std::int64_t timeNs)
+  {
+    const std::time_t seconds = static_cast<std::time_t>(timeNs / 1000000000);
+    std::tm local{};
+#if defined(_WIN32)
+    localtime_s(&local, &seconds);
+#else
+    localtime_r(&seconds, &local);
+#endif
+    char buffer[32];
+    const std::size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &local);
+    std::snprintf(buffer + length, sizeof(buffer) - length, ".%03d", static_cast<int>(timeNs / 1000000 % 1000));
+    return buffer;
+  }
+
+  std::mutex m_mutex; // Settings, file and queue list; never taken by write()
+  std::condition_variable m_wake;
+  std::condition_variable m_flushed;
+  std::vector<std::shared_ptr<ThreadQueue>> m_queues;
+  LogSettings m_settings;
+  std::ofstream m_file;
+  std::size_t m_fileBytes = 0;
+  std::uint64_t m_flushRequested = 0;
+  std::uint64_t m_flushDone = 0;
+  bool m_stopping = false;
+  std::atomic<int> m_level{static_cast<int>(Level::INFO)};
+  std::atomic<std::uint64_t> m_dropped{0};
+  std::thread m_writer; // Last: started once everything above is constructed
+};
+
+/** @brief Formats one line into a per-thread stream, then hands it to the logger */
+class LineBuilder
+{
+public:
+  explicit LineBuilder(Level level) : m_level(level)
+  {
+    stream().str({});
+    stream().clear();
+  }
+
+  ~LineBuilder() { Logger::instance().write(m_level, stream().view()); }
+
+  LineBuilder(const LineBuilder &) = delete;
+  LineBuilder &operator=(const LineBuilder &) = delete;
+
+  static std::ostringstream &stream()
+  {
+    thread_local std::ostringstream threadStream;
+    return threadStream;
+  }
+
+private:
+  Level m_level;
+};
+
+/**
+ * @brief Lets one line through per period, counting the ones it held back
+ *
+ * One per call site (RTYPE_LOG_EVERY declares it static), shared by every
+ * thread and lobby that reaches it.
+ */
+class RateLimiter
+{
+public:
+  /** @return Lines suppressed since the last allowed one, or -1 to suppress this one. */
+  std::int64_t allow(double periodSeconds)
+  {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    const std::int64_t nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    const auto periodNs = static_cast<std::int64_t>(periodSeconds * 1e9);
+    std::int64_t last = m_lastNs.load(std::memory_order_relaxed);
+    if ((last != 0 && nowNs - last < periodNs) ||
+        !m_lastNs.compare_exchange_strong(last, nowNs, std::memory_order_relaxed)) {
+      m_suppressed.fetch_add(1, std::memory_order_relaxed);
+      return -1;
+    }
+    return m_suppressed.exchange(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<std::int64_t> m_lastNs{0};
+  std::atomic<std::int64_t> m_suppressed{0};
+};
+} // namespace logging
+
+/** @brief Log a streamed message: RTYPE_LOG(::logging::Level::INFO, "[Tag] x=" << x). */
+#define RTYPE_LOG(level, message)                                                                                      \
+  do {                                                                                                                 \
+    if constexpr (static_cast<int>(level) >= RTYPE_LOG_LEVEL) {                                                        \
+      if (::logging::Logger::instance().isEnabled(level)) {                                                            \
+        ::logging::LineBuilder rtypeLogLine(level);                                                                    \
+        ::logging::LineBuilder::stream() << message;                                                                   \
+      }                                                                                                                \
+    }                                                                                                                  \
+  } while (false)
+
+/** @brief Log at most once per periodSeconds from this call site, noting how many lines were skipped. */
+#define RTYPE_LOG_EVERY(level, periodSeconds, message)                                                                 \
+  do {                                                                                                                 \
+    if constexpr (static_cast<int>(level) >= RTYPE_LOG_LEVEL) {                                                        \
+      static ::logging::RateLimiter rtypeLogLimiter;                                                                   \
+      if (::logging::Logger::instance().isEnabled(level)) {                                                            \
+        if (const std::int64_t rtypeLogSkipped = rtypeLogLimiter.allow(periodSeconds); rtypeLogSkipped >= 0) {         \
+          ::logging::LineBuilder rtypeLogLine(level);                                                                  \
+          ::logging::LineBuilder::stream() << message;                                                                 \
+          if (rtypeLogSkipped > 0) {                                                                                   \
+            ::logging::LineBuilder::stream() << " (+" << rtypeLogSkipped << " suppressed)";                            \
+          }                                                                                                            \
+        }                                                                                                              \
+      }                                                                                                                \
+    }                                                                                                                  \
+  } while (false)
+
+#define RTYPE_LOG_TRACE(message) RTYPE_LOG(::logging::Level::TRACE, message)
+#define RTYPE_LOG_DEBUG(message) RTYPE_LOG(::logging::Level::DEBUG, message)
+#define RTYPE_LOG_INFO(message) RTYPE_LOG(::logging::Level::INFO, message)
+#define RTYPE_LOG_WARN(message) RTYPE_LOG(::logging::Level::WARN, message)
+#define RTYPE_LOG_ERROR(message) RTYPE_LOG(::logging::Level::ERR, message)
+
+#endif // UTILS_LOG_HPP_
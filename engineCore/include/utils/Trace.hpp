@@ -0,0 +1,339 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Trace.hpp - Scoped trace events dumped as a Chrome trace
+*/
+
+#ifndef UTILS_TRACE_HPP_
+#define UTILS_TRACE_HPP_
+
+/**
+ * @file Trace.hpp
+ * @brief Scoped trace macros, compiled out unless RTYPE_ENABLE_TRACING is defined
+ *
+ * Each RTYPE_TRACE_SCOPE records one complete event ("ph":"X") into a ring
+ * buffer owned by the calling thread, so recording takes no lock. The last
+ * trace::ThreadBuffer::CAPACITY events of every thread are written on demand
+ * to a Chrome trace JSON file, to open in chrome://tracing or ui.perfetto.dev.
+ *
+ * Configure with -DRTYPE_TRACING=ON to compile the macros in. When it is off
+ * they expand to nothing and their arguments are not evaluated.
+ */
+
+#if defined(RTYPE_ENABLE_TRACING)
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace trace
+{
+using Clock = std::chrono::steady_clock;
+
+/** @brief One finished scope */
+struct Event {
+  static constexpr std::size_t DETAIL_SIZE = 24;
+
+  const char *name = nullptr; // Static string, or a mangled type name when typeName is set
+  std::uint64_t startNs = 0; // Since the process trace epoch
+  std::uint64_t durationNs = 0;
+  std::array<char, DETAIL_SIZE> detail{}; // Optional argument (lobby code...), truncated, NUL-terminated
+  bool typeName = false;
+};
+
+/**
+ * @brief Fixed-size event ring of one thread
+ *
+ * Only the owning thread records; snapshot() may run from any thread at the
+ * same time. Each slot carries a sequence number (odd while being written),
+ * so a reader skips the slots overwritten under it instead of tearing them.
+ */
+class ThreadBuffer
+{
+public:
+  static constexpr std::size_t CAPACITY = std::size_t{1} << 15;
+
+  explicit ThreadBuffer(std::uint32_t tid) : m_slots(std::make_unique<Slot[]>(CAPACITY)), m_tid(tid) {}
+
+  void record(const Event &event)
+  {
+    const std::uint64_t index = m_head.load(std::memory_order_relaxed);
+    Slot &slot = m_slots[index % CAPACITY];
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = event;
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    m_head.store(index + 1, std::memory_order_release);
+  }
+
+  /** @brief Events still in the ring, oldest first. */
+  [[nodiscard]] std::vector<Event> snapshot() const
+  {
+    const std::uint64_t head = m_head.load(std::memory_order_acquire);
+    const std::uint64_t first = head > CAPACITY ? head - CAPACITY : 0;
+    std::vector<Event> events;
+    events.reserve(static_cast<std::size_t>(head - first));
+    for (std::uint64_t index = first; index < head; ++index) {
+      const Slot &slot = m_slots[index % CAPACITY];
+      if (slot.sequence.load(std::memory_order_acquire) != 2 * index + 2) {
+        continue;
+      }
+      Event event = slot.event;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) == 2 * index + 2) {
+        events.push_back(event);
+      }
+    }
+    return events;
+  }
+
+  void setName(const char *name) { m_name.store(name, std::memory_order_release); }
+  [[nodiscard]] const char *getName() const { return m_name.load(std::memory_order_acquire); }
+  [[nodiscard]] std::uint32_t getTid() const { return m_tid; }
+
+private:
+  struct Slot {
+    std::atomic<std::uint64_t> sequence{0};
+    Event event;
+  };
+
+  std::unique_ptr<Slot[]> m_slots;
+  std::atomic<std::uint64_t> m_head{0};
+  std::atomic<const char *> m_name{nullptr};
+  std::uint32_t m_tid;
+};
+
+/**
+ * @brief Owns the buffers of every thread that ever traced
+ *
+ * Buffers outlive their thread so that a dump still shows threads that
+ * already exited.
+ */
+class Registry
+{
+public:
+  static Registry &instance()
+  {
+    static Registry registry;
+    return registry;
+  }
+
+  ThreadBuffer &createBuffer()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<std::uint32_t>(m_buffers.size() + 1)));
+    return *m_buffers.back();
+  }
+
+  [[nodiscard]] std::uint64_t now() const
+  {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_epoch);
+    return static_cast<std::uint64_t>(elapsed.count());
+  }
+
+  /**
+   * @brief Write every buffered event as a Chrome trace JSON file
+   * @return Number of events written, -1 if the file could not be opened
+   */
+  long writeChromeTrace(const std::string &path)
+  {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+      return -1;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unordered_map<const char *, std::string> typeNames;
+    long written = 0;
+    bool first = true;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (const auto &buffer : m_buffers) {
+      const char *threadName = buffer->getName();
+      if (threadName != nullptr) {
+        out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->getTid()
+            << ",\"args\":{\"name\":";
+        writeString(out, threadName);
+        out << "}}";
+        first = false;
+      }
+      for (const Event &event : buffer->snapshot()) {
+        out << (first ? "" : ",") << "\n{\"name\":";
+        if (event.typeName) {
+          auto iter = typeNames.find(event.name);
+          if (iter == typeNames.end()) {
+            iter = typeNames.emplace(event.name, demangle(event.name)).first;
+          }
+          writeString(out, iter->second);
+        } else {
+          writeString(out, event.name);
+        }
+        out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->getTid() << ",\"ts\":" << event.startNs / 1000 << "."
+            << (event.startNs % 1000) / 100 << ",\"dur\":" << event.durationNs / 1000 << "."
+            << (event.durationNs % 1000) / 100;
+        if (event.detail[0] != '\0') {
+          out << ",\"args\":{\"detail\":";
+          writeString(out, event.detail.data());
+          out << "}";
+        }
+        out << "}";
+        first = false;
+        ++written;
+      }
+    }
+    out << "\n]}\n";
+    return out ? written : -1;
+  }
+
+private:
+  Registry() = default;
+
+  static std::string demangle(const char *name)
+  {
+#if defined(__GNUG__)
+    int status = 0;
+    std::unique_ptr<char, decltype(&std::free)> result(abi::__cxa_demangle(name, nullptr, nullptr, &status),
+                                                        &std::free);
+    if (status == 0 && result) {
+      return result.get();
+    }
+#endif
+    return name;
+  }
+
+  static void writeString(std::ostream &out, std::string_view text)
+  {
+    out << '"';
+    for (const char character : text) {
+      if (character == '"' || character == '\\') {
+        out << '\\' << character;
+      } else if (static_cast<unsigned char>(character) >= 0x20) {
+        out << character;
+      }
+    }
+    out << '"';
+  }
+
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+  Clock::time_point m_epoch = Clock::now();
+};
+
+/** @brief Set from the SIGUSR1 handler (a lock-free store is async-signal-safe), polled by pollDump(). */
+inline std::atomic<bool> dumpRequested{false};
+
+/** @brief The calling thread's buffer, created on its first event. */
+inline ThreadBuffer &threadBuffer()
+{
+  thread_local ThreadBuffer &buffer = Registry::instance().createBuffer();
+  return buffer;
+}
+
+/** @brief Records the lifetime of the enclosing scope */
+class Scope
+{
+public:
+  explicit Scope(const char *name, std::string_view detail = {}, bool typeName = false)
+  {
+    m_event.name = name;
+    m_event.typeName = typeName;
+    const std::size_t length = std::min(detail.size(), Event::DETAIL_SIZE - 1);
+    std::memcpy(m_event.detail.data(), detail.data(), length);
+    m_event.startNs = Registry::instance().now();
+  }
+
+  ~Scope()
+  {
+    m_event.durationNs = Registry::instance().now() - m_event.startNs;
+    threadBuffer().record(m_event);
+  }
+
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+
+private:
+  Event m_event;
+};
+
+/** @brief Dump destination: $RTYPE_TRACE_FILE, else the given default. */
+inline std::string outputPath(const char *defaultPath)
+{
+  const char *path = std::getenv("RTYPE_TRACE_FILE");
+  return path != nullptr && *path != '\0' ? path : defaultPath;
+}
+
+inline void dump(const char *defaultPath)
+{
+  const std::string path = outputPath(defaultPath);
+  const long written = Registry::instance().writeChromeTrace(path);
+  if (written < 0) {
+    std::cerr << "[Trace] Could not write " << path << '\n';
+    return;
+  }
+  std::cout << "[Trace] Wrote " << written << " events to " << path << '\n';
+}
+
+/** @brief Dump if requested (SIGUSR1) since the last call. */
+inline void pollDump(const char *defaultPath)
+{
+  if (dumpRequested.exchange(false, std::memory_order_relaxed)) {
+    dump(defaultPath);
+  }
+}
+
+/** @brief Request a dump on SIGUSR1 (no-op where the signal does not exist). */
+inline void installDumpSignal()
+{
+#if defined(SIGUSR1)
+  std::signal(SIGUSR1, [](int) { dumpRequested.store(true, std::memory_order_relaxed); });
+#endif
+}
+} // namespace trace
+
+#define RTYPE_TRACE_CONCAT_INNER(a, b) a##b
+#define RTYPE_TRACE_CONCAT(a, b) RTYPE_TRACE_CONCAT_INNER(a, b)
+
+/** @brief Trace the enclosing scope; name must be a string literal (or otherwise static). */
+#define RTYPE_TRACE_SCOPE(name) ::trace::Scope RTYPE_TRACE_CONCAT(rtypeTraceScope, __LINE__)(name)
+/** @brief Same, with a short argument copied into the event (shown as args.detail). */
+#define RTYPE_TRACE_SCOPE_DETAIL(name, detail)                                                                         \
+  ::trace::Scope RTYPE_TRACE_CONCAT(rtypeTraceScope, __LINE__)(name, detail)
+/** @brief Trace the enclosing scope under the dynamic type name of object. */
+#define RTYPE_TRACE_SCOPE_TYPE(object)                                                                                 \
+  ::trace::Scope RTYPE_TRACE_CONCAT(rtypeTraceScope, __LINE__)(typeid(object).name(), {}, true)
+/** @brief Name the calling thread in the trace viewer. */
+#define RTYPE_TRACE_THREAD(name) ::trace::threadBuffer().setName(name)
+#define RTYPE_TRACE_INSTALL_DUMP_SIGNAL() ::trace::installDumpSignal()
+#define RTYPE_TRACE_POLL_DUMP(defaultPath) ::trace::pollDump(defaultPath)
+#define RTYPE_TRACE_DUMP(defaultPath) ::trace::dump(defaultPath)
+
+#else
+
+#define RTYPE_TRACE_SCOPE(name) ((void)0)
+#define RTYPE_TRACE_SCOPE_DETAIL(name, detail) ((void)0)
+#define RTYPE_TRACE_SCOPE_TYPE(object) ((void)0)
+#define RTYPE_TRACE_THREAD(name) ((void)0)
+#define RTYPE_TRACE_INSTALL_DUMP_SIGNAL() ((void)0)
+#define RTYPE_TRACE_POLL_DUMP(defaultPath) ((void)0)
+#define RTYPE_TRACE_DUMP(defaultPath) ((void)0)
+
+#endif // RTYPE_ENABLE_TRACING
+
+#endif // UTILS_TRACE_HPP_
@@ -0,0 +1,176 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BulletPool Unit Tests and bullet-hell benchmark with doctest
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ecs/BulletPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <doctest/doctest.h>
+#include <iostream>
+#include <string>
+
+namespace
+{
+constexpr int BENCH_TICKS = 600;
+constexpr float TICK = 1.0F / 60.0F;
+
+ecs::BulletVolley makeRing(std::uint16_t count, float x = 960.0F, float y = 540.0F)
+{
+  ecs::BulletVolley volley;
+  volley.x = x;
+  volley.y = y;
+  volley.angle = 0.0F;
+  volley.arc = 360.0F;
+  volley.count = count;
+  volley.speed = 100.0F;
+  volley.lifetime = 4.0F;
+  volley.radius = 8.0F;
+  return volley;
+}
+} // namespace
+
+TEST_SUITE("BulletPool")
+{
+  TEST_CASE("Ring and fan directions")
+  {
+    float dirX = 0.0F;
+    float dirY = 0.0F;
+    const ecs::BulletVolley ring = makeRing(4);
+    ring.direction(1, dirX, dirY);
+    CHECK(dirX == doctest::Approx(0.0F));
+    CHECK(dirY == doctest::Approx(1.0F));
+    ring.direction(2, dirX, dirY);
+    CHECK(dirX == doctest::Approx(-1.0F));
+
+    ecs::BulletVolley fan = makeRing(3);
+    fan.angle = 180.0F;
+    fan.arc = 90.0F;
+    fan.direction(0, dirX, dirY);
+    CHECK(std::atan2(dirY, dirX) == doctest::Approx(135.0F * 3.14159265F / 180.0F));
+    fan.direction(1, dirX, dirY);
+    CHECK(dirX == doctest::Approx(-1.0F));
+  }
+
+  TEST_CASE("Emit on the server, receive the same bullets on the client")
+  {
+    ecs::BulletPool server;
+    const std::uint32_t first = server.emit(makeRing(8));
+    const std::uint32_t second = server.emit(makeRing(8, 100.0F, 100.0F));
+    CHECK(first == 1);
+    CHECK(second == 2);
+    CHECK(server.size() == 16);
+    server.update(0.5F);
+
+    // The client gets the volley half a second late, with its age
+    ecs::BulletPool client;
+    float age = 0.0F;
+    const auto &record = server.getVolleys().front();
+    const ecs::BulletVolley copy =
+      ecs::BulletVolley::fromJson(record.volley.toJson(server.getClock() - record.firedAt), age);
+    CHECK(age == doctest::Approx(0.5F));
+    CHECK(client.receive(copy, age));
+    CHECK_FALSE(client.receive(copy, age));
+    REQUIRE(client.size() == 8);
+    for (std::size_t i = 0; i < client.size(); ++i) {
+      CHECK(client.x(i) == doctest::Approx(server.x(i)));
+      CHECK(client.y(i) == doctest::Approx(server.y(i)));
+      CHECK(client.age(i) == doctest::Approx(0.5F));
+    }
+  }
+
+  TEST_CASE("Bullets expire and leave the screen")
+  {
+    ecs::BulletPool pool;
+    pool.emit(makeRing(16));
+    ecs::BulletVolley edge = makeRing(1, ecs::BulletPool::SCREEN_WIDTH, 10.0F);
+    edge.speed = 1000.0F;
+    pool.emit(edge);
+    CHECK(pool.size() == 17);
+
+    pool.update(0.1F);
+    CHECK(pool.size() == 16);
+    CHECK(pool.getVolleys().back().alive == 0);
+    pool.update(4.0F);
+    CHECK(pool.empty());
+    CHECK(pool.getVolleys().size() == 2);
+    pool.forget(1.0F);
+    CHECK(pool.getVolleys().empty());
+  }
+
+  TEST_CASE("Hits are recorded and replayed by volley and slot")
+  {
+    ecs::BulletPool server;
+    ecs::BulletPool client;
+    const std::uint32_t id = server.emit(makeRing(4));
+    client.receive(server.getVolleys().front().volley, 0.0F);
+
+    server.kill(1);
+    CHECK(server.size() == 3);
+    REQUIRE(server.getHits().size() == 1);
+    const auto hit = server.getHits().front();
+    CHECK(hit.volley == id);
+    CHECK(hit.slot == 1);
+    CHECK(server.getVolleys().front().alive == 3);
+
+    CHECK(client.kill(hit.volley, hit.slot));
+    CHECK_FALSE(client.kill(hit.volley, hit.slot));
+    CHECK(client.size() == 3);
+
+    server.update(0.5F);
+    server.forget(0.25F);
+    CHECK(server.getHits().empty());
+    CHECK(server.getVolleys().size() == 1);
+  }
+
+  TEST_CASE("Pool is bounded")
+  {
+    ecs::BulletPool pool;
+    while (pool.emit(makeRing(1000)) != 0) {
+    }
+    CHECK(pool.size() <= ecs::BulletPool::MAX_BULLETS);
+    CHECK(pool.size() > ecs::BulletPool::MAX_BULLETS - 1000);
+    pool.clear();
+    CHECK(pool.empty());
+    CHECK(pool.emit(makeRing(1)) == 1);
+  }
+
+  TEST_CASE("Bullet-hell phase throughput")
+  {
+    // Spirals of 50 bullets every 2 ticks keep about 5000 bullets on screen
+    ecs::BulletPool pool;
+    std::size_t peak = 0;
+    std::size_t volleyBytes = 0;
+    std::size_t volleys = 0;
+    double seconds = 0.0;
+    for (int tick = 0; tick < BENCH_TICKS; ++tick) {
+      const auto start = std::chrono::steady_clock::now();
+      if (tick % 2 == 0) {
+        ecs::BulletVolley volley = makeRing(50);
+        volley.angle = static_cast<float>(tick * 7 % 360);
+        volley.speed = 220.0F;
+        volley.lifetime = 8.0F;
+        pool.emit(volley);
+      }
+      pool.update(TICK);
+      seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      peak = std::max(peak, pool.size());
+      if (tick % 2 == 0) {
+        const auto &record = pool.getVolleys().back();
+        volleyBytes += record.volley.toJson(0.0F).dump().size();
+        ++volleys;
+      }
+      pool.forget(0.25F);
+    }
+
+    std::cout << "[Bench] bullet pool, " << BENCH_TICKS << " ticks, peak " << peak << " bullets: "
+              << seconds * 1e6 / BENCH_TICKS << " us/tick, " << volleyBytes / volleys << " bytes per 50-bullet volley"
+              << std::endl;
+    CHECK(peak >= 4000);
+    CHECK(peak <= ecs::BulletPool::MAX_BULLETS);
+  }
+}
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Log Unit Tests with doctest
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "utils/Log.hpp"
+#include <doctest/doctest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::string readFile(const std::string &path)
+{
+  std::ifstream in(path);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+void removeLogs(const std::string &path)
+{
+  for (const char *suffix : {"", ".1", ".2", ".3"}) {
+    std::filesystem::remove(path + suffix);
+  }
+}
+} // namespace
+
+TEST_CASE("ThreadQueue wraps around and refuses lines when full")
+{
+  logging::ThreadQueue queue;
+  std::vector<logging::ThreadQueue::Record> records;
+  const std::string line(1000, 'x');
+
+  // Several laps of the ring, drained as they go
+  for (int i = 0; i < 300; ++i) {
+    REQUIRE(queue.push(logging::Level::INFO, i, line + std::to_string(i)));
+    if (i % 10 == 9) {
+      queue.drain(records);
+    }
+  }
+  queue.drain(records);
+  REQUIRE(records.size() == 300);
+  CHECK(records.front().text == line + "0");
+  CHECK(records.back().text == line + "299");
+  CHECK(records.back().timeNs == 299);
+
+  // Without a consumer the ring fills up instead of overwriting
+  int accepted = 0;
+  while (queue.push(logging::Level::WARN, 0, line)) {
+    ++accepted;
+  }
+  CHECK(accepted > 0);
+  CHECK(accepted < static_cast<int>(logging::ThreadQueue::CAPACITY / line.size()) + 1);
+  records.clear();
+  queue.drain(records);
+  CHECK(records.size() == static_cast<std::size_t>(accepted));
+  CHECK(records.front().level == logging::Level::WARN);
+}
+
+TEST_CASE("RateLimiter lets one line through per period and counts the rest")
+{
+  logging::RateLimiter limiter;
+  CHECK(limiter.allow(60.0) == 0);
+  CHECK(limiter.allow(60.0) == -1);
+  CHECK(limiter.allow(60.0) == -1);
+
+  logging::RateLimiter fast;
+  CHECK(fast.allow(0.0) == 0);
+  CHECK(fast.allow(0.0) == 0);
+}
+
+TEST_CASE("Logger filters levels, writes from every thread and rotates its file")
+{
+  const std::string path = "log_tests_output.log";
+  removeLogs(path);
+  logging::LogSettings settings;
+  settings.level = logging::Level::INFO;
+  settings.console = false;
+  settings.file = path;
+  settings.maxFileBytes = 4096;
+  settings.maxFiles = 2;
+  logging::Logger::instance().configure(settings);
+
+  RTYPE_LOG_DEBUG("[Test] filtered out");
+  RTYPE_LOG_INFO("[Test] value=" << 42);
+  std::thread worker([]() { RTYPE_LOG_ERROR("[Test] from worker"); });
+  worker.join();
+  for (int i = 0; i < 3; ++i) {
+    RTYPE_LOG_EVERY(::logging::Level::WARN, 60.0, "[Test] limited " << i);
+  }
+  logging::Logger::instance().flush();
+
+  const std::string content = readFile(path);
+  CHECK(content.find("filtered out") == std::string::npos);
+  CHECK(content.find(" INFO [Test] value=42\n") != std::string::npos);
+  CHECK(content.find(" ERROR [Test] from worker\n") != std::string::npos);
+  CHECK(content.find("[Test] limited 0") != std::string::npos);
+  CHECK(content.find("[Test] limited 1") == std::string::npos);
+
+  for (int i = 0; i < 200; ++i) {
+    RTYPE_LOG_INFO("[Test] filler line " << i);
+  }
+  logging::Logger::instance().flush();
+  CHECK(std::filesystem::file_size(path) <= settings.maxFileBytes);
+  CHECK(std::filesystem::exists(path + ".1"));
+  CHECK(std::filesystem::exists(path + ".2"));
+  CHECK_FALSE(std::filesystem::exists(path + ".3"));
+  CHECK(readFile(path).find("[Test] filler line 199") != std::string::npos);
+
+  logging::Logger::instance().configure(logging::LogSettings{});
+  removeLogs(path);
+}
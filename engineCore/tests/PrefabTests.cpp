@@ -0,0 +1,275 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Prefab Unit Tests and spawn benchmark with doctest
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ecs/Prefab.hpp"
+#include "ecs/World.hpp"
+#include "ecs/components/Collider.hpp"
+#include "ecs/components/Health.hpp"
+#include "ecs/components/Networked.hpp"
+#include "ecs/components/Pattern.hpp"
+#include "ecs/components/Sprite.hpp"
+#include "ecs/components/Transform.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "ecs/components/Viewport.hpp"
+#include <chrono>
+#include <doctest/doctest.h>
+#include <iostream>
+#include <span>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t BATCH = 4000;
+constexpr int ROUNDS = 25;
+
+ecs::Transform makeTransform(float x, float y, float scale)
+{
+  ecs::Transform transform;
+  transform.x = x;
+  transform.y = y;
+  transform.scale = scale;
+  return transform;
+}
+
+ecs::Velocity makeVelocity(float dx, float dy)
+{
+  ecs::Velocity velocity;
+  velocity.dx = dx;
+  velocity.dy = dy;
+  return velocity;
+}
+
+ecs::Health makeHealth(int hp)
+{
+  ecs::Health health;
+  health.hp = hp;
+  health.maxHp = hp;
+  return health;
+}
+
+// The components SpawnSystem gives an enemy
+ecs::Prefab makeEnemyPrefab()
+{
+  ecs::Sprite sprite;
+  sprite.spriteId = ecs::SpriteId::ENEMY_SHIP;
+  sprite.width = 33;
+  sprite.height = 36;
+  sprite.animated = true;
+  sprite.frameCount = 8;
+
+  ecs::Prefab prefab;
+  prefab.set(ecs::Pattern{"sine_wave", 50.0F, 2.0F})
+    .set(makeTransform(0.0F, 0.0F, 2.0F))
+    .set(makeVelocity(-200.0F, 0.0F))
+    .set(makeHealth(30))
+    .set(sprite)
+    .set(ecs::Collider{66.0F, 72.0F})
+    .set(ecs::Networked{}, [](ecs::Networked &net, ecs::Entity entity) { net.networkId = entity; });
+  return prefab;
+}
+
+// The same enemy one addComponent at a time, as spawnEnemyFromConfig did
+ecs::Entity spawnOneByOne(ecs::World &world, const ecs::Prefab &prefab, float x, float y)
+{
+  const ecs::Entity enemy = world.createEntity();
+  world.addComponent(enemy, *prefab.get<ecs::Pattern>());
+  ecs::Transform transform = *prefab.get<ecs::Transform>();
+  transform.x = x;
+  transform.y = y;
+  world.addComponent(enemy, transform);
+  world.addComponent(enemy, *prefab.get<ecs::Velocity>());
+  world.addComponent(enemy, *prefab.get<ecs::Health>());
+  world.addComponent(enemy, *prefab.get<ecs::Sprite>());
+  world.addComponent(enemy, *prefab.get<ecs::Collider>());
+  ecs::Networked net;
+  net.networkId = enemy;
+  world.addComponent(enemy, net);
+  return enemy;
+}
+
+void destroyAll(ecs::World &world, const std::vector<ecs::Entity> &entities)
+{
+  for (const ecs::Entity entity : entities) {
+    world.destroyEntity(entity);
+  }
+}
+
+template <typename Fn>
+double entitiesPerSecond(Fn &&spawnRound)
+{
+  double seconds = 0.0;
+  for (int round = 0; round < ROUNDS; ++round) {
+    seconds += spawnRound();
+  }
+  return static_cast<double>(BATCH) * ROUNDS / seconds;
+}
+} // namespace
+
+TEST_SUITE("Prefab")
+{
+  TEST_CASE("Prefab holds one value per component")
+  {
+    ecs::Prefab prefab;
+    prefab.set(makeVelocity(1.0F, 2.0F)).set(makeHealth(5));
+
+    CHECK(prefab.has<ecs::Velocity>());
+    CHECK(prefab.has<ecs::Health>());
+    CHECK_FALSE(prefab.has<ecs::Transform>());
+    CHECK(prefab.get<ecs::Transform>() == nullptr);
+    CHECK(prefab.getSignature().count() == 2);
+
+    prefab.set(makeVelocity(3.0F, 4.0F));
+    CHECK(prefab.getSignature().count() == 2);
+    CHECK(prefab.get<ecs::Velocity>()->dx == 3.0F);
+
+    const ecs::Prefab copy = prefab;
+    prefab.set(makeHealth(9));
+    CHECK(copy.get<ecs::Health>()->hp == 5);
+  }
+
+  TEST_CASE("Instantiate sets the full signature")
+  {
+    ecs::World world;
+    const ecs::Prefab prefab = makeEnemyPrefab();
+
+    const ecs::Entity enemy = world.instantiate(prefab);
+    CHECK(world.getEntitySignature(enemy) == prefab.getSignature());
+    CHECK(world.getComponent<ecs::Health>(enemy).hp == 30);
+    CHECK(world.getComponent<ecs::Networked>(enemy).networkId == enemy);
+    CHECK(world.getComponent<ecs::Pattern>(enemy).patternType == "sine_wave");
+    CHECK(world.getComponent<ecs::Pattern>(enemy).kind == ecs::PatternKind::SINE_WAVE);
+  }
+
+  TEST_CASE("Batch instantiate with per-entity transforms")
+  {
+    ecs::World world;
+    ecs::Prefab prefab;
+    prefab.set(makeVelocity(-1.0F, 0.0F))
+      .set(ecs::Networked{}, [](ecs::Networked &net, ecs::Entity entity) { net.networkId = entity; });
+
+    std::vector<ecs::Transform> positions;
+    for (int i = 0; i < 10; ++i) {
+      positions.push_back(makeTransform(static_cast<float>(i), 2.0F, 1.0F));
+    }
+    std::vector<ecs::Entity> entities;
+    world.instantiate(prefab, std::span<const ecs::Transform>(positions), entities);
+
+    REQUIRE(entities.size() == positions.size());
+    CHECK(world.getEntityCount() == positions.size());
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+      CHECK(world.getEntitySignature(entities[i]).test(ecs::getComponentId<ecs::Transform>()));
+      CHECK(world.getComponent<ecs::Transform>(entities[i]).x == static_cast<float>(i));
+      CHECK(world.getComponent<ecs::Networked>(entities[i]).networkId == entities[i]);
+    }
+
+    std::vector<ecs::Entity> moving;
+    ecs::ComponentSignature query;
+    query.set(ecs::getComponentId<ecs::Transform>());
+    query.set(ecs::getComponentId<ecs::Velocity>());
+    world.getEntitiesWithSignature(query, moving);
+    CHECK(moving.size() == entities.size());
+  }
+
+  TEST_CASE("Acquired entities are parked and reused")
+  {
+    ecs::World world;
+    const ecs::Prefab prefab = makeEnemyPrefab();
+
+    world.prewarm(prefab, 4);
+    CHECK(world.getParkedCount(prefab) == 4);
+    CHECK(world.getEntityCount() == 0);
+    CHECK(world.getEntityStats().created == 4);
+
+    const ecs::Entity enemy = world.acquire(prefab, makeTransform(10.0F, 20.0F, 2.0F));
+    CHECK(world.getParkedCount(prefab) == 3);
+    CHECK(world.getEntityStats().reused == 1);
+    CHECK(world.isAlive(enemy));
+    CHECK(world.getComponent<ecs::Networked>(enemy).networkId == enemy);
+    CHECK(world.getComponent<ecs::Transform>(enemy).x == 10.0F);
+
+    // Gameplay changes and extra components are gone once the entity is reused
+    world.getComponent<ecs::Health>(enemy).hp = 1;
+    world.addComponent(enemy, makeVelocity(0.0F, 0.0F));
+    ecs::Viewport viewport{.width = 800, .height = 600};
+    world.addComponent(enemy, viewport);
+    world.destroyEntity(enemy);
+    CHECK_FALSE(world.isAlive(enemy));
+    CHECK_FALSE(world.hasComponent<ecs::Viewport>(enemy));
+    CHECK(world.getEntityStats().parked == 1);
+    CHECK(world.getEntityStats().destroyed == 0);
+
+    const ecs::Entity again = world.acquire(prefab);
+    CHECK(again == enemy);
+    CHECK(world.getComponent<ecs::Health>(again).hp == 30);
+    CHECK(world.getComponent<ecs::Velocity>(again).dx == -200.0F);
+    CHECK(world.getEntitySignature(again) == prefab.getSignature());
+
+    // Plain entities still get destroyed, and parked IDs are not handed out again
+    const ecs::Entity plain = world.createEntity();
+    CHECK(plain != enemy);
+    world.destroyEntity(plain);
+    CHECK(world.getEntityStats().destroyed == 1);
+  }
+
+  TEST_CASE("Prefab spawn throughput")
+  {
+    ecs::World world;
+    const ecs::Prefab prefab = makeEnemyPrefab();
+    std::vector<ecs::Transform> positions;
+    for (std::size_t i = 0; i < BATCH; ++i) {
+      positions.push_back(makeTransform(1920.0F, static_cast<float>(i % 1080), 2.0F));
+    }
+    std::vector<ecs::Entity> entities;
+
+    const double oneByOne = entitiesPerSecond([&]() {
+      entities.clear();
+      const auto start = std::chrono::steady_clock::now();
+      for (const auto &position : positions) {
+        entities.push_back(spawnOneByOne(world, prefab, position.x, position.y));
+      }
+      const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      destroyAll(world, entities);
+      return seconds;
+    });
+
+    const double single = entitiesPerSecond([&]() {
+      entities.clear();
+      const auto start = std::chrono::steady_clock::now();
+      for (const auto &position : positions) {
+        entities.push_back(world.instantiate(prefab, position));
+      }
+      const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      destroyAll(world, entities);
+      return seconds;
+    });
+
+    const double batch = entitiesPerSecond([&]() {
+      const auto start = std::chrono::steady_clock::now();
+      world.instantiate(prefab, std::span<const ecs::Transform>(positions), entities);
+      const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      destroyAll(world, entities);
+      return seconds;
+    });
+
+    world.prewarm(prefab, BATCH);
+    const double pooled = entitiesPerSecond([&]() {
+      entities.clear();
+      const auto start = std::chrono::steady_clock::now();
+      for (const auto &position : positions) {
+        entities.push_back(world.acquire(prefab, position));
+      }
+      destroyAll(world, entities);
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    });
+
+    std::cout << "[Bench] enemy spawn, " << BATCH << " x " << ROUNDS << ": addComponent " << oneByOne / 1e6
+              << " M/s, instantiate " << single / 1e6 << " M/s, batch " << batch / 1e6 << " M/s, pooled spawn+despawn "
+              << pooled / 1e6 << " M/s" << std::endl;
+    CHECK(world.getEntityCount() == 0);
+  }
+}
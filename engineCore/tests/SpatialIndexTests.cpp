@@ -0,0 +1,313 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SpatialIndex Unit Tests and query benchmark with doctest
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ecs/SpatialIndex.hpp"
+#include "ecs/World.hpp"
+#include "ecs/components/Collider.hpp"
+#include "ecs/components/Transform.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "ecs/systems/SpatialIndexSystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t CROWD = 5000;
+constexpr int BENCH_QUERIES = 2000;
+
+ecs::ComponentSignature bit(std::size_t index)
+{
+  ecs::ComponentSignature sig;
+  sig.set(index);
+  return sig;
+}
+
+// Same crowd for every test: a 1920x1080 screen, a third of the entries tagged with bit 1
+std::vector<ecs::SpatialIndex::Entry> makeCrowd(std::size_t count)
+{
+  std::mt19937 random(7);
+  std::uniform_real_distribution<float> width(0.0F, 1920.0F);
+  std::uniform_real_distribution<float> height(0.0F, 1080.0F);
+  std::uniform_real_distribution<float> radius(0.0F, 40.0F);
+  std::vector<ecs::SpatialIndex::Entry> entries(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    auto &entry = entries[i];
+    entry.entity = static_cast<ecs::Entity>(i + 1);
+    entry.x = width(random);
+    entry.y = height(random);
+    entry.radius = radius(random);
+    entry.signature = bit(0);
+    if (i % 3 == 0) {
+      entry.signature.set(1);
+    }
+  }
+  return entries;
+}
+
+ecs::SpatialIndex buildIndex(const std::vector<ecs::SpatialIndex::Entry> &entries)
+{
+  ecs::SpatialIndex index;
+  for (const auto &entry : entries) {
+    index.insert(entry);
+  }
+  index.build(1);
+  return index;
+}
+
+ecs::Transform at(float x, float y)
+{
+  ecs::Transform transform;
+  transform.x = x;
+  transform.y = y;
+  return transform;
+}
+
+float distanceSquared(const ecs::SpatialIndex::Entry &entry, float x, float y)
+{
+  return (entry.x - x) * (entry.x - x) + (entry.y - y) * (entry.y - y);
+}
+
+// Brute force reference: (distance, entity) order of the entries matching the filter
+std::vector<ecs::Entity> sortedByDistance(const std::vector<ecs::SpatialIndex::Entry> &entries, float x, float y,
+                                          const ecs::ComponentSignature &filter)
+{
+  std::vector<const ecs::SpatialIndex::Entry *> matching;
+  for (const auto &entry : entries) {
+    if ((entry.signature & filter) == filter) {
+      matching.push_back(&entry);
+    }
+  }
+  std::sort(matching.begin(), matching.end(), [x, y](const auto *lhs, const auto *rhs) {
+    const float left = distanceSquared(*lhs, x, y);
+    const float right = distanceSquared(*rhs, x, y);
+    return left < right || (left == right && lhs->entity < rhs->entity);
+  });
+  std::vector<ecs::Entity> result;
+  for (const auto *entry : matching) {
+    result.push_back(entry->entity);
+  }
+  return result;
+}
+} // namespace
+
+TEST_SUITE("SpatialIndex")
+{
+  TEST_CASE("Empty index answers nothing")
+  {
+    ecs::SpatialIndex index;
+    index.build(3);
+    std::vector<const ecs::SpatialIndex::Entry *> out;
+    CHECK(index.empty());
+    CHECK(index.getTick() == 3);
+    CHECK(index.nearest(0.0F, 0.0F, bit(0)) == nullptr);
+    index.kNearest(0.0F, 0.0F, 4, bit(0), out);
+    CHECK(out.empty());
+    index.queryRadius(0.0F, 0.0F, 100.0F, bit(0), out);
+    CHECK(out.empty());
+  }
+
+  TEST_CASE("Nearest and k-NN match a brute force scan")
+  {
+    const auto entries = makeCrowd(CROWD);
+    const ecs::SpatialIndex index = buildIndex(entries);
+    CHECK(index.size() == CROWD);
+    std::vector<const ecs::SpatialIndex::Entry *> out;
+    const float points[][2] = {{0.0F, 0.0F}, {960.0F, 540.0F}, {1919.0F, 3.0F}, {-500.0F, 2000.0F}, {5000.0F, 10.0F}};
+    for (const auto &point : points) {
+      for (const auto &filter : {bit(0), bit(1)}) {
+        const auto expected = sortedByDistance(entries, point[0], point[1], filter);
+        const auto *nearest = index.nearest(point[0], point[1], filter);
+        REQUIRE(nearest != nullptr);
+        CHECK(nearest->entity == expected.front());
+
+        index.kNearest(point[0], point[1], 10, filter, out);
+        REQUIRE(out.size() == 10);
+        for (std::size_t i = 0; i < out.size(); ++i) {
+          CHECK(out[i]->entity == expected[i]);
+        }
+      }
+    }
+  }
+
+  TEST_CASE("Max distance and predicates")
+  {
+    const auto entries = makeCrowd(CROWD);
+    const ecs::SpatialIndex index = buildIndex(entries);
+    const auto *first = index.nearest(960.0F, 540.0F, bit(0));
+    REQUIRE(first != nullptr);
+    CHECK(index.nearest(960.0F, 540.0F, bit(0), 0.0F) == nullptr);
+
+    const auto notFirst = [first](const ecs::SpatialIndex::Entry &entry) { return entry.entity != first->entity; };
+    const auto *second = index.nearest(960.0F, 540.0F, bit(0), std::numeric_limits<float>::infinity(), notFirst);
+    REQUIRE(second != nullptr);
+    CHECK(second->entity == sortedByDistance(entries, 960.0F, 540.0F, bit(0))[1]);
+
+    std::vector<const ecs::SpatialIndex::Entry *> out;
+    index.kNearest(960.0F, 540.0F, 1000, bit(0), out, 50.0F);
+    CHECK_FALSE(out.empty());
+    CHECK(out.size() < 1000);
+    for (const auto *entry : out) {
+      CHECK(distanceSquared(*entry, 960.0F, 540.0F) <= 2500.0F);
+    }
+  }
+
+  TEST_CASE("Radius and rectangle queries match a brute force scan")
+  {
+    const auto entries = makeCrowd(CROWD);
+    const ecs::SpatialIndex index = buildIndex(entries);
+    std::vector<const ecs::SpatialIndex::Entry *> out;
+
+    index.queryRadius(400.0F, 300.0F, 120.0F, bit(1), out);
+    std::vector<ecs::Entity> expected;
+    for (const auto &entry : entries) {
+      const float range = 120.0F + entry.radius;
+      if (entry.signature.test(1) && distanceSquared(entry, 400.0F, 300.0F) <= range * range) {
+        expected.push_back(entry.entity);
+      }
+    }
+    REQUIRE(out.size() == expected.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      CHECK(out[i]->entity == expected[i]);
+    }
+
+    index.queryRect(100.0F, 500.0F, 700.0F, 560.0F, bit(0), out);
+    expected.clear();
+    for (const auto &entry : entries) {
+      if (entry.x >= 100.0F && entry.x <= 700.0F && entry.y >= 500.0F && entry.y <= 560.0F) {
+        expected.push_back(entry.entity);
+      }
+    }
+    REQUIRE(out.size() == expected.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      CHECK(out[i]->entity == expected[i]);
+    }
+
+    index.collect(bit(1), out);
+    CHECK(out.size() == (CROWD + 2) / 3);
+  }
+
+  TEST_CASE("Far apart entries keep the grid bounded")
+  {
+    std::vector<ecs::SpatialIndex::Entry> entries(3);
+    entries[0] = {1, -1.0e6F, 0.0F, 0.0F, 0.0F, 0.0F, bit(0)};
+    entries[1] = {2, 1.0e6F, 1.0e6F, 0.0F, 0.0F, 0.0F, bit(0)};
+    entries[2] = {3, 10.0F, 10.0F, 0.0F, 0.0F, 0.0F, bit(0)};
+    ecs::SpatialIndex index = buildIndex(entries);
+    const auto *nearest = index.nearest(9.0e5F, 9.0e5F, bit(0));
+    REQUIRE(nearest != nullptr);
+    CHECK(nearest->entity == 2);
+
+    index.insert({4, std::numeric_limits<float>::quiet_NaN(), 0.0F, 0.0F, 0.0F, 0.0F, bit(0)});
+    index.build(2);
+    CHECK(index.size() == 3);
+  }
+
+  TEST_CASE("SpatialIndexSystem indexes centers, radii and velocities")
+  {
+    ecs::World world;
+    world.registerSystem<ecs::SpatialIndexSystem>();
+
+    const ecs::Entity box = world.createEntity();
+    world.addComponent(box, at(100.0F, 100.0F));
+    world.addComponent(box, ecs::Collider(60.0F, 80.0F));
+    ecs::Velocity velocity;
+    velocity.dx = -300.0F;
+    velocity.dy = 400.0F;
+    world.addComponent(box, velocity);
+    const ecs::Entity circle = world.createEntity();
+    world.addComponent(circle, at(500.0F, 500.0F));
+    ecs::Collider round;
+    round.shape = ecs::Collider::Shape::CIRCLE;
+    round.radius = 12.0F;
+    world.addComponent(circle, round);
+    const ecs::Entity point = world.createEntity();
+    world.addComponent(point, at(900.0F, 100.0F));
+    world.update(0.016F);
+
+    const auto &index = world.getSpatialIndex();
+    CHECK(index.size() == 3);
+    CHECK(index.getMaxSpeed() == doctest::Approx(500.0F));
+
+    ecs::ComponentSignature colliders;
+    colliders.set(ecs::getComponentId<ecs::Collider>());
+    const auto *nearest = index.nearest(0.0F, 0.0F, colliders);
+    REQUIRE(nearest != nullptr);
+    CHECK(nearest->entity == box);
+    CHECK(nearest->x == doctest::Approx(130.0F));
+    CHECK(nearest->y == doctest::Approx(140.0F));
+    CHECK(nearest->radius == doctest::Approx(50.0F));
+
+    nearest = index.nearest(450.0F, 500.0F, colliders, 100.0F);
+    REQUIRE(nearest != nullptr);
+    CHECK(nearest->entity == circle);
+    CHECK(nearest->x == doctest::Approx(500.0F));
+    CHECK(nearest->radius == doctest::Approx(12.0F));
+
+    world.destroyEntity(point);
+    world.update(0.016F);
+    CHECK(index.size() == 2);
+  }
+
+  TEST_CASE("Query throughput against a brute force scan")
+  {
+    const auto entries = makeCrowd(CROWD);
+    ecs::SpatialIndex index;
+    const auto buildStart = std::chrono::steady_clock::now();
+    for (const auto &entry : entries) {
+      index.insert(entry);
+    }
+    index.build(1);
+    const double buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - buildStart).count();
+
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> width(0.0F, 1920.0F);
+    std::uniform_real_distribution<float> height(0.0F, 1080.0F);
+    std::vector<const ecs::SpatialIndex::Entry *> out;
+    std::size_t found = 0;
+    std::size_t foundBrute = 0;
+    double indexSeconds = 0.0;
+    double bruteSeconds = 0.0;
+    for (int i = 0; i < BENCH_QUERIES; ++i) {
+      const float x = width(random);
+      const float y = height(random);
+      auto start = std::chrono::steady_clock::now();
+      index.queryRadius(x, y, 150.0F, bit(1), out);
+      found += out.size();
+      found += index.nearest(x, y, bit(1)) != nullptr ? 1 : 0;
+      indexSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      start = std::chrono::steady_clock::now();
+      const ecs::SpatialIndex::Entry *best = nullptr;
+      for (const auto &entry : entries) {
+        if (!entry.signature.test(1)) {
+          continue;
+        }
+        const float range = 150.0F + entry.radius;
+        if (distanceSquared(entry, x, y) <= range * range) {
+          ++foundBrute;
+        }
+        if (best == nullptr || distanceSquared(entry, x, y) < distanceSquared(*best, x, y)) {
+          best = &entry;
+        }
+      }
+      foundBrute += best != nullptr ? 1 : 0;
+      bruteSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::cout << "[Bench] spatial index, " << CROWD << " entries: build " << buildSeconds * 1e6
+              << " us, radius + nearest " << indexSeconds * 1e6 / BENCH_QUERIES << " us per query, brute force "
+              << bruteSeconds * 1e6 / BENCH_QUERIES << " us per query" << std::endl;
+    CHECK(found == foundBrute);
+  }
+}
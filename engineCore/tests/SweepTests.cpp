@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Swept collision Unit Tests with doctest
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ecs/Sweep.hpp"
+#include "ecs/World.hpp"
+#include "ecs/components/Swept.hpp"
+#include "ecs/components/Transform.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "ecs/systems/MovementSystem.hpp"
+#include <doctest/doctest.h>
+
+namespace
+{
+// A player shot (18x14 collider at 2400 px/s) and a 33x36 enemy, one 30 Hz tick
+constexpr float SHOT_STEP = 2400.0F / 30.0F;
+const ecs::sweep::Box SHOT{100.0F, 500.0F, 18.0F, 14.0F};
+const ecs::sweep::Box ENEMY{150.0F, 490.0F, 33.0F, 36.0F};
+} // namespace
+
+TEST_SUITE("Sweep")
+{
+  TEST_CASE("A shot stepping over a box still hits it")
+  {
+    // Before and after the tick the shot is clear of the enemy
+    const ecs::sweep::Box after{SHOT.x + SHOT_STEP + 60.0F, SHOT.y, SHOT.width, SHOT.height};
+    CHECK(after.x > ENEMY.x + ENEMY.width);
+    CHECK(ecs::sweep::boxBox(SHOT, SHOT_STEP + 60.0F, 0.0F, ENEMY, 0.0F, 0.0F));
+
+    // Passing above, or stopping short of it, misses
+    const ecs::sweep::Box above{SHOT.x, ENEMY.y - SHOT.height - 1.0F, SHOT.width, SHOT.height};
+    CHECK_FALSE(ecs::sweep::boxBox(above, SHOT_STEP + 60.0F, 0.0F, ENEMY, 0.0F, 0.0F));
+    CHECK_FALSE(ecs::sweep::boxBox(SHOT, ENEMY.x - SHOT.x - SHOT.width - 1.0F, 0.0F, ENEMY, 0.0F, 0.0F));
+  }
+
+  TEST_CASE("Relative motion and touching edges")
+  {
+    // Shot and enemy rush toward each other and cross within the tick
+    const ecs::sweep::Box farEnemy{SHOT.x + 200.0F, SHOT.y, 20.0F, 20.0F};
+    CHECK(ecs::sweep::boxBox(SHOT, SHOT_STEP, 0.0F, farEnemy, -(200.0F - SHOT_STEP + 40.0F), 0.0F));
+    // Moving together they never meet
+    CHECK_FALSE(ecs::sweep::boxBox(SHOT, SHOT_STEP, 0.0F, farEnemy, SHOT_STEP, 0.0F));
+    // Ending exactly on the edge is a touch, not a hit, like the discrete test
+    CHECK_FALSE(ecs::sweep::boxBox(SHOT, ENEMY.x - SHOT.x - SHOT.width, 0.0F, ENEMY, 0.0F, 0.0F));
+    // Overlapping without moving is still a hit
+    CHECK(ecs::sweep::boxBox(ENEMY, 0.0F, 0.0F, ENEMY, 0.0F, 0.0F));
+  }
+
+  TEST_CASE("Circles")
+  {
+    CHECK(ecs::sweep::circleCircle(0.0F, 0.0F, 5.0F, 200.0F, 0.0F, 100.0F, 8.0F, 5.0F, 0.0F, 0.0F));
+    CHECK_FALSE(ecs::sweep::circleCircle(0.0F, 0.0F, 5.0F, 200.0F, 0.0F, 100.0F, 12.0F, 5.0F, 0.0F, 0.0F));
+    CHECK_FALSE(ecs::sweep::circleCircle(0.0F, 0.0F, 5.0F, 50.0F, 0.0F, 100.0F, 0.0F, 5.0F, 0.0F, 0.0F));
+
+    // Box against circle: through the side, past a rounded corner, and close to it
+    const ecs::sweep::Box box{100.0F, 100.0F, 40.0F, 40.0F};
+    CHECK(ecs::sweep::boxCircle(box, 0.0F, 0.0F, 0.0F, 120.0F, 10.0F, 300.0F, 0.0F));
+    CHECK_FALSE(ecs::sweep::boxCircle(box, 0.0F, 0.0F, 92.0F, 80.0F, 10.0F, -20.0F, 20.0F));
+    CHECK(ecs::sweep::boxCircle(box, 0.0F, 0.0F, 104.0F, 86.0F, 10.0F, -20.0F, 20.0F));
+  }
+
+  TEST_CASE("MovementSystem keeps the position before the step")
+  {
+    ecs::World world;
+    world.registerSystem<ecs::MovementSystem>();
+
+    ecs::Transform transform;
+    transform.x = 10.0F;
+    transform.y = 20.0F;
+    ecs::Velocity velocity;
+    velocity.dx = 2400.0F;
+    velocity.dy = -300.0F;
+    const ecs::Entity shot = world.createEntity();
+    world.addComponent(shot, transform);
+    world.addComponent(shot, velocity);
+    world.addComponent(shot, ecs::Swept{});
+    const ecs::Entity plain = world.createEntity();
+    world.addComponent(plain, transform);
+    world.addComponent(plain, velocity);
+
+    CHECK_FALSE(world.getComponent<ecs::Swept>(shot).moved);
+    world.update(0.5F);
+    const auto &swept = world.getComponent<ecs::Swept>(shot);
+    CHECK(swept.moved);
+    CHECK(swept.prevX == doctest::Approx(10.0F));
+    CHECK(swept.prevY == doctest::Approx(20.0F));
+    CHECK(world.getComponent<ecs::Transform>(shot).x == doctest::Approx(1210.0F));
+    CHECK(world.getComponent<ecs::Transform>(plain).x == doctest::Approx(1210.0F));
+    CHECK_FALSE(world.hasComponent<ecs::Swept>(plain));
+
+    world.update(0.5F);
+    CHECK(world.getComponent<ecs::Swept>(shot).prevX == doctest::Approx(1210.0F));
+  }
+}
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Trace Unit Tests with doctest
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#ifndef RTYPE_ENABLE_TRACING
+#define RTYPE_ENABLE_TRACING
+#endif
+#include "ecs/ISystem.hpp"
+#include "ecs/SystemManager.hpp"
+#include "ecs/World.hpp"
+#include "utils/Trace.hpp"
+#include <cstdio>
+#include <doctest/doctest.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+namespace
+{
+class TracedSystem : public ecs::ISystem
+{
+public:
+  void update(ecs::World &world, float deltaTime) override
+  {
+    (void)world;
+    (void)deltaTime;
+  }
+
+  [[nodiscard]] ecs::ComponentSignature getSignature() const override { return {}; }
+};
+
+std::string readFile(const std::string &path)
+{
+  std::ifstream in(path);
+  return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST_CASE("ThreadBuffer keeps the most recent events in order")
+{
+  trace::ThreadBuffer buffer(1);
+  const std::size_t total = trace::ThreadBuffer::CAPACITY + 10;
+  for (std::size_t i = 0; i < total; ++i) {
+    trace::Event event;
+    event.name = "event";
+    event.startNs = i;
+    buffer.record(event);
+  }
+
+  const auto events = buffer.snapshot();
+  REQUIRE(events.size() == trace::ThreadBuffer::CAPACITY);
+  CHECK(events.front().startNs == 10);
+  CHECK(events.back().startNs == total - 1);
+}
+
+TEST_CASE("Scopes of every thread are written as a Chrome trace")
+{
+  {
+    RTYPE_TRACE_THREAD("test-main");
+    RTYPE_TRACE_SCOPE_DETAIL("outer", "LOBBY1");
+    RTYPE_TRACE_SCOPE("inner");
+  }
+  std::thread worker([]() {
+    RTYPE_TRACE_THREAD("test-worker");
+    RTYPE_TRACE_SCOPE("worker \"quoted\"");
+  });
+  worker.join();
+
+  ecs::World world;
+  world.registerSystem<TracedSystem>();
+  world.update(0.016f);
+
+  const std::string path = "trace_tests_output.json";
+  REQUIRE(trace::Registry::instance().writeChromeTrace(path) >= 4);
+  const std::string json = readFile(path);
+  std::remove(path.c_str());
+
+  CHECK(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0);
+  CHECK(json.find("\"name\":\"outer\",\"ph\":\"X\"") != std::string::npos);
+  CHECK(json.find("\"args\":{\"detail\":\"LOBBY1\"}") != std::string::npos);
+  CHECK(json.find("\"name\":\"inner\"") != std::string::npos);
+  CHECK(json.find("\"name\":\"worker \\\"quoted\\\"\"") != std::string::npos);
+  CHECK(json.find("\"args\":{\"name\":\"test-worker\"}") != std::string::npos);
+  CHECK(json.find("TracedSystem") != std::string::npos);
+}
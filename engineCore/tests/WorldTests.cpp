@@ -150,6 +150,27 @@ TEST_SUITE("World")
       world.update(0.016F);
       CHECK(sys1.getUpdateCount() == 2);
     }
+
+    SUBCASE("Tick counts completed updates")
+    {
+      ecs::World ticked;
+      CHECK(ticked.getTick() == 0);
+      ticked.update(0.016F);
+      ticked.update(0.016F);
+      CHECK(ticked.getTick() == 2);
+    }
+
+    SUBCASE("Same random seed gives the same sequence")
+    {
+      ecs::World first;
+      ecs::World second;
+      first.seedRandom(0x1234ABCDULL);
+      second.seedRandom(0x1234ABCDULL);
+      CHECK(second.getRandomSeed() == 0x1234ABCDULL);
+      for (int i = 0; i < 16; ++i) {
+        CHECK(first.getRandom()() == second.getRandom()());
+      }
+    }
   }
 
   TEST_CASE("Component management")
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** LoadBot.hpp - Headless client driven by the load generator
+*/
+
+#ifndef LOAD_BOT_HPP_
+#define LOAD_BOT_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../network/include/AsioClient.hpp"
+
+namespace loadgen
+{
+/** @brief How a bot picks its inputs */
+enum class InputMode : std::uint8_t { RANDOM, SCRIPTED };
+
+/**
+ * @brief What one bot measured since the swarm last collected it
+ *
+ * Latencies are one-off samples (set once per bot); counters and gaps
+ * accumulate until Swarm takes them at the end of a ramp step.
+ */
+struct BotSample {
+  std::optional<double> connectMs; // start() -> assign_id
+  std::optional<double> joinMs; // request_lobby -> lobby_joined
+  std::optional<double> startMs; // start_game -> game_started (lobby host only)
+  std::uint64_t snapshots = 0;
+  std::uint64_t snapshotBytes = 0;
+  double playingSeconds = 0.0; // Time spent in a running game, snapshots expected
+  std::vector<double> snapshotGapsMs; // Taken at poll time: coarse if the swarm loop lags
+  std::uint64_t inputsSent = 0;
+  std::uint64_t errors = 0;
+};
+
+/**
+ * @brief One headless player: an AsioClient speaking the game protocol
+ *
+ * Mirrors what the real client sends (PING, viewport, request_lobby,
+ * start_game, player_input at 60 Hz) without any rendering. A bot does not
+ * decide when to join or start on its own; Swarm drives that so lobbies fill
+ * up in groups. update() must be called often (every millisecond or so) so
+ * snapshot arrival times are precise.
+ */
+class LoadBot
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class State : std::uint8_t {
+    CONNECTING, // Waiting for assign_id
+    IDLE, // Connected, not in a lobby
+    JOINING, // request_lobby sent
+    IN_LOBBY,
+    PLAYING,
+    FINISHED, // Dead, kicked or lobby ended
+    FAILED // The server refused a lobby request
+  };
+
+  LoadBot(std::uint32_t index, const std::string &host, const std::string &port, InputMode inputMode,
+          std::uint64_t seed);
+  ~LoadBot();
+
+  LoadBot(const LoadBot &) = delete;
+  LoadBot &operator=(const LoadBot &) = delete;
+
+  void start();
+  void stop();
+
+  /** @brief Create a lobby (empty code) or join an existing one. */
+  void requestLobby(const std::string &code, int difficulty);
+  /** @brief Ask the server to start our lobby's game. */
+  void startGame();
+
+  /** @brief Drain received messages and send the input if its 60 Hz slot is due. */
+  void update(Clock::time_point now);
+
+  /** @brief Hand over what was measured since the last call. */
+  BotSample takeSample();
+
+  [[nodiscard]] State getState() const { return m_state; }
+  [[nodiscard]] const std::string &getLobbyCode() const { return m_lobbyCode; }
+  [[nodiscard]] int getLobbyPlayerCount() const { return m_lobbyPlayerCount; }
+  [[nodiscard]] float getLatency() const { return m_client->getLatency(); }
+  [[nodiscard]] const std::string &getLastError() const { return m_lastError; }
+
+private:
+  struct Input {
+    bool up = false;
+    bool down = false;
+    bool left = false;
+    bool right = false;
+    bool shoot = false;
+  };
+
+  void handleMessage(const std::string &message, std::size_t size, Clock::time_point now);
+  void sendJson(const nlohmann::json &json, Channel channel);
+  void sendInput();
+  Input nextInput();
+
+  std::uint32_t m_index;
+  InputMode m_inputMode;
+  std::mt19937 m_rng;
+  std::shared_ptr<AsioClient> m_client;
+  std::vector<std::uint8_t> m_sendBuffer;
+
+  State m_state{State::CONNECTING};
+  std::uint32_t m_clientId{0};
+  std::string m_lobbyCode;
+  int m_lobbyPlayerCount{0};
+  std::string m_lastError;
+
+  Clock::time_point m_startTime;
+  Clock::time_point m_lastUpdateTime;
+  Clock::time_point m_joinRequestTime;
+  Clock::time_point m_startRequestTime;
+  std::optional<Clock::time_point> m_lastSnapshotTime;
+  Clock::time_point m_nextInputTime;
+  Clock::time_point m_nextPingTime;
+  std::uint64_t m_inputTick{0};
+  int m_randomHoldTicks{0};
+  Input m_input;
+
+  BotSample m_sample;
+};
+} // namespace loadgen
+
+#endif // LOAD_BOT_HPP_
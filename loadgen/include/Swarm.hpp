@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Swarm.hpp - Ramps up bots in lobbies and reports what the server sustains
+*/
+
+#ifndef SWARM_HPP_
+#define SWARM_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "LoadBot.hpp"
+
+namespace loadgen
+{
+struct SwarmSettings {
+  std::string host = "127.0.0.1";
+  std::string port = "4242";
+  std::size_t clients = 1000; // Final bot count
+  std::size_t step = 50; // Bots added per ramp step
+  std::chrono::seconds stepDuration{10};
+  std::size_t lobbySize = 4;
+  int difficulty = 0; // EASY: bots survive longer, so the load stays up
+  InputMode inputMode = InputMode::RANDOM;
+  std::uint64_t seed = 1;
+  // A lobby starts once full, or after this long with whoever joined
+  std::chrono::milliseconds lobbyFillTimeout{5000};
+};
+
+/** @brief Samples with the few statistics the reports need */
+struct Series {
+  std::vector<double> samples;
+
+  void add(double value) { samples.push_back(value); }
+  [[nodiscard]] double mean() const;
+  [[nodiscard]] double percentile(double ratio) const;
+};
+
+/** @brief What the server sustained during one ramp step */
+struct StepReport {
+  std::size_t clients = 0;
+  std::size_t connected = 0;
+  std::size_t playing = 0;
+  std::size_t finished = 0;
+  std::size_t failed = 0;
+  Series connectMs;
+  Series joinMs;
+  Series startMs;
+  Series snapshotGapMs;
+  double snapshotHz = 0.0; // Per second of play, per bot
+  double snapshotIntervalMs = 0.0; // 1 / snapshotHz
+  double snapshotBytes = 0.0; // Mean serialized size
+  double downstreamBytesPerSecond = 0.0; // Snapshots, all bots
+  double rttMs = -1.0; // Mean PING/PONG round trip
+  double tickDegradationPercent = 0.0; // Snapshot interval vs the first step's
+  double loopLagMs = 0.0; // Worst late swarm loop: above a few ms the generator itself is saturated
+  std::uint64_t inputsSent = 0;
+  std::uint64_t errors = 0;
+};
+
+/**
+ * @brief Bot swarm ramping from settings.step to settings.clients
+ *
+ * Bots come in groups of lobbySize: the first creates a lobby, the others
+ * join it by code and the creator starts the game once the lobby is full.
+ * Every step adds a batch of groups, runs for stepDuration and reports.
+ *
+ * The server sends a snapshot to each player once per send interval, so the
+ * mean interval between received snapshots is the tick time the clients see
+ * (lost snapshots included). Its growth relative to the first (lightest)
+ * step is reported as the tick degradation. It is computed from counts over
+ * the time spent playing, which stays exact when the swarm loop lags.
+ */
+class Swarm
+{
+public:
+  explicit Swarm(SwarmSettings settings);
+
+  /** @brief Run the ramp until done or until running turns false; one report per step. */
+  std::vector<StepReport> run(const std::atomic<bool> &running);
+
+  static void printStep(const StepReport &report);
+  static void printSummary(const std::vector<StepReport> &reports);
+
+private:
+  struct Group {
+    std::size_t host = 0;
+    std::vector<std::size_t> guests;
+    std::optional<LoadBot::Clock::time_point> hostJoinedAt;
+    bool startRequested = false;
+  };
+
+  void spawn(std::size_t count);
+  void updateGroups(LoadBot::Clock::time_point now);
+  StepReport collect(double seconds);
+
+  SwarmSettings m_settings;
+  std::vector<std::unique_ptr<LoadBot>> m_bots;
+  std::vector<Group> m_groups;
+  double m_baselineIntervalMs{0.0};
+  double m_loopLagMs{0.0};
+};
+} // namespace loadgen
+
+#endif // SWARM_HPP_
@@ -0,0 +1,251 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** LoadBot.cpp
+*/
+
+#include "LoadBot.hpp"
+#include <exception>
+#include <iostream>
+#include <span>
+#include <string_view>
+
+namespace loadgen
+{
+namespace
+{
+using namespace std::chrono_literals;
+
+constexpr auto INPUT_PERIOD =
+  std::chrono::duration_cast<LoadBot::Clock::duration>(std::chrono::duration<double>(1.0 / 60.0));
+constexpr auto PING_PERIOD = 1s;
+// Same size the real client reports on a 1080p screen
+constexpr std::uint32_t VIEWPORT_WIDTH = 1920;
+constexpr std::uint32_t VIEWPORT_HEIGHT = 1080;
+// Scripted bots fly a square: one side per second, shooting every 8th tick
+constexpr std::uint64_t SCRIPT_SIDE_TICKS = 60;
+constexpr std::uint64_t SCRIPT_SHOOT_EVERY = 8;
+// Random bots hold each direction for 0.25 to 1 s
+constexpr int RANDOM_HOLD_MIN_TICKS = 15;
+constexpr int RANDOM_HOLD_MAX_TICKS = 60;
+// Snapshots are by far the most frequent message; they are recognised by
+// prefix (see NetworkSendSystem) so the bots never pay for a full parse.
+constexpr std::string_view SNAPSHOT_PREFIX = R"({"type":"snapshot")";
+
+double elapsedMs(LoadBot::Clock::time_point from, LoadBot::Clock::time_point to)
+{
+  return std::chrono::duration<double, std::milli>(to - from).count();
+}
+} // namespace
+
+LoadBot::LoadBot(std::uint32_t index, const std::string &host, const std::string &port, InputMode inputMode,
+                 std::uint64_t seed)
+    : m_index(index), m_inputMode(inputMode), m_rng(static_cast<std::mt19937::result_type>(seed + index)),
+      m_client(std::make_shared<AsioClient>(host, port))
+{
+}
+
+LoadBot::~LoadBot()
+{
+  stop();
+}
+
+void LoadBot::start()
+{
+  m_startTime = Clock::now();
+  m_lastUpdateTime = m_startTime;
+  // Spread the bots over the 60 Hz period, like real players whose frames are not aligned
+  m_nextInputTime = m_startTime + INPUT_PERIOD * (m_index % 16) / 16;
+  m_nextPingTime = m_startTime;
+  m_client->start();
+
+  sendJson(nlohmann::json{{"type", "viewport"}, {"width", VIEWPORT_WIDTH}, {"height", VIEWPORT_HEIGHT}},
+           Channel::RELIABLE_ORDERED);
+}
+
+void LoadBot::stop()
+{
+  if (m_client) {
+    m_client->stop();
+  }
+}
+
+void LoadBot::requestLobby(const std::string &code, int difficulty)
+{
+  nlohmann::json request;
+  request["type"] = "request_lobby";
+  request["action"] = code.empty() ? "create" : "join";
+  request["lobby_code"] = code;
+  request["difficulty"] = difficulty;
+  request["ai_difficulty"] = 3; // NO_ALLY: only bots load the lobby
+  request["username"] = "bot" + std::to_string(m_index);
+  m_joinRequestTime = Clock::now();
+  m_state = State::JOINING;
+  sendJson(request, Channel::RELIABLE_ORDERED);
+}
+
+void LoadBot::startGame()
+{
+  m_startRequestTime = Clock::now();
+  sendJson(nlohmann::json{{"type", "start_game"}}, Channel::RELIABLE_ORDERED);
+}
+
+void LoadBot::update(Clock::time_point now)
+{
+  NetworkPacket packet;
+  while (m_client->poll(packet)) {
+    const auto payload = packet.getPayload();
+    const auto message = m_client->getPacketHandler()->deserialize(payload);
+    if (message && !message->empty()) {
+      handleMessage(*message, payload.size(), now);
+    }
+  }
+
+  if (m_state == State::PLAYING) {
+    m_sample.playingSeconds += std::chrono::duration<double>(now - m_lastUpdateTime).count();
+  }
+  m_lastUpdateTime = now;
+
+  if (now >= m_nextPingTime) {
+    m_client->sendPing();
+    m_nextPingTime = now + PING_PERIOD;
+  }
+  if (m_state != State::PLAYING) {
+    return;
+  }
+  // A late loop skips the missed slots instead of bursting to catch up
+  if (now >= m_nextInputTime) {
+    sendInput();
+    do {
+      m_nextInputTime += INPUT_PERIOD;
+    } while (m_nextInputTime <= now);
+  }
+}
+
+BotSample LoadBot::takeSample()
+{
+  BotSample sample = std::move(m_sample);
+  m_sample = BotSample{};
+  return sample;
+}
+
+void LoadBot::handleMessage(const std::string &message, std::size_t size, Clock::time_point now)
+{
+  if (std::string_view(message).starts_with(SNAPSHOT_PREFIX)) {
+    ++m_sample.snapshots;
+    m_sample.snapshotBytes += size;
+    if (m_lastSnapshotTime) {
+      m_sample.snapshotGapsMs.push_back(elapsedMs(*m_lastSnapshotTime, now));
+    }
+    m_lastSnapshotTime = now;
+    return;
+  }
+  if (message == "PING" || message == "PONG") {
+    return;
+  }
+
+  try {
+    const auto json = nlohmann::json::parse(message);
+    const std::string type = json.value("type", "");
+
+    if (type == "assign_id") {
+      m_clientId = json.value("client_id", 0U);
+      m_sample.connectMs = elapsedMs(m_startTime, now);
+      m_state = State::IDLE;
+    } else if (type == "lobby_joined") {
+      m_lobbyCode = json.value("code", "");
+      m_sample.joinMs = elapsedMs(m_joinRequestTime, now);
+      m_state = State::IN_LOBBY;
+    } else if (type == "lobby_state") {
+      m_lobbyPlayerCount = json.value("player_count", 0);
+    } else if (type == "game_started") {
+      if (m_startRequestTime != Clock::time_point{}) {
+        m_sample.startMs = elapsedMs(m_startRequestTime, now);
+      }
+      m_state = State::PLAYING;
+    } else if (type == "player_dead" || type == "player_kicked" || type == "lobby_end" || type == "lobby_left") {
+      m_state = State::FINISHED;
+      m_lastSnapshotTime.reset();
+    } else if (type == "error") {
+      ++m_sample.errors;
+      m_lastError = json.value("message", "");
+      if (m_state == State::JOINING) {
+        m_state = State::FAILED;
+      }
+    }
+  } catch (const std::exception &e) {
+    ++m_sample.errors;
+    std::cerr << "[Loadgen] Bot " << m_index << " failed to parse message: " << e.what() << '\n';
+  }
+}
+
+void LoadBot::sendJson(const nlohmann::json &json, Channel channel)
+{
+  m_client->getPacketHandler()->serializeInto(json.dump(), m_sendBuffer);
+  m_client->send(std::span<const std::byte>(reinterpret_cast<const std::byte *>(m_sendBuffer.data()),
+                                            m_sendBuffer.size()),
+                 0, channel);
+}
+
+void LoadBot::sendInput()
+{
+  m_input = nextInput();
+  ++m_inputTick;
+
+  // Same message as the client's NetworkSendSystem
+  nlohmann::json message;
+  message["type"] = "player_input";
+  message["entity_id"] = m_clientId;
+  message["input"]["up"] = m_input.up;
+  message["input"]["down"] = m_input.down;
+  message["input"]["left"] = m_input.left;
+  message["input"]["right"] = m_input.right;
+  message["input"]["shoot"] = m_input.shoot;
+  message["input"]["chargedShoot"] = false;
+  message["input"]["detach"] = false;
+  sendJson(message, Channel::UNRELIABLE_SEQUENCED);
+  ++m_sample.inputsSent;
+}
+
+LoadBot::Input LoadBot::nextInput()
+{
+  Input input;
+  if (m_inputMode == InputMode::SCRIPTED) {
+    switch ((m_inputTick / SCRIPT_SIDE_TICKS) % 4) {
+    case 0:
+      input.up = true;
+      break;
+    case 1:
+      input.right = true;
+      break;
+    case 2:
+      input.down = true;
+      break;
+    default:
+      input.left = true;
+      break;
+    }
+    input.shoot = m_inputTick % SCRIPT_SHOOT_EVERY == 0;
+    return input;
+  }
+
+  // Random: keep the current direction until its hold time runs out
+  if (m_randomHoldTicks > 0) {
+    --m_randomHoldTicks;
+    input = m_input;
+    input.shoot = std::uniform_int_distribution<int>(0, 3)(m_rng) == 0;
+    return input;
+  }
+  m_randomHoldTicks = std::uniform_int_distribution<int>(RANDOM_HOLD_MIN_TICKS, RANDOM_HOLD_MAX_TICKS)(m_rng);
+  std::uniform_int_distribution<int> axis(-1, 1);
+  const int dx = axis(m_rng);
+  const int dy = axis(m_rng);
+  input.left = dx < 0;
+  input.right = dx > 0;
+  input.up = dy < 0;
+  input.down = dy > 0;
+  input.shoot = std::uniform_int_distribution<int>(0, 3)(m_rng) == 0;
+  return input;
+}
+} // namespace loadgen
@@ -0,0 +1,253 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Swarm.cpp
+*/
+
+#include "Swarm.hpp"
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <utility>
+
+namespace loadgen
+{
+namespace
+{
+using namespace std::chrono_literals;
+
+// Bots are polled this often, which bounds the precision of the snapshot gaps
+constexpr auto POLL_PERIOD = 1ms;
+} // namespace
+
+double Series::mean() const
+{
+  double sum = 0.0;
+  for (double value : samples) {
+    sum += value;
+  }
+  return samples.empty() ? 0.0 : sum / static_cast<double>(samples.size());
+}
+
+double Series::percentile(double ratio) const
+{
+  if (samples.empty()) {
+    return 0.0;
+  }
+  auto sorted = samples;
+  std::sort(sorted.begin(), sorted.end());
+  return sorted[static_cast<std::size_t>(ratio * static_cast<double>(sorted.size() - 1))];
+}
+
+Swarm::Swarm(SwarmSettings settings) : m_settings(std::move(settings))
+{
+  // Whole lobbies only: a group started in one step cannot be joined in the next
+  m_settings.lobbySize = std::max<std::size_t>(m_settings.lobbySize, 1);
+  const auto roundUp = [this](std::size_t count) {
+    return (count + m_settings.lobbySize - 1) / m_settings.lobbySize * m_settings.lobbySize;
+  };
+  m_settings.step = roundUp(std::max<std::size_t>(m_settings.step, 1));
+  m_settings.clients = roundUp(std::max(m_settings.clients, m_settings.step));
+}
+
+std::vector<StepReport> Swarm::run(const std::atomic<bool> &running)
+{
+  std::vector<StepReport> reports;
+  spawn(m_settings.step);
+  auto stepStart = LoadBot::Clock::now();
+  auto previous = stepStart;
+
+  while (running) {
+    const auto now = LoadBot::Clock::now();
+    m_loopLagMs =
+      std::max(m_loopLagMs, std::chrono::duration<double, std::milli>(now - previous - POLL_PERIOD).count());
+    previous = now;
+    for (auto &bot : m_bots) {
+      bot->update(now);
+    }
+    updateGroups(now);
+
+    if (now - stepStart >= m_settings.stepDuration) {
+      reports.push_back(collect(std::chrono::duration<double>(now - stepStart).count()));
+      printStep(reports.back());
+      if (m_bots.size() >= m_settings.clients) {
+        break;
+      }
+      spawn(std::min(m_settings.step, m_settings.clients - m_bots.size()));
+      stepStart = LoadBot::Clock::now();
+      previous = stepStart;
+    }
+    std::this_thread::sleep_for(POLL_PERIOD);
+  }
+
+  for (auto &bot : m_bots) {
+    bot->stop();
+  }
+  return reports;
+}
+
+void Swarm::spawn(std::size_t count)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    const std::size_t index = m_bots.size();
+    try {
+      m_bots.push_back(std::make_unique<LoadBot>(static_cast<std::uint32_t>(index), m_settings.host, m_settings.port,
+                                                 m_settings.inputMode, m_settings.seed));
+    } catch (const std::exception &e) {
+      std::cerr << "[Loadgen] Failed to create bot " << index << ": " << e.what() << '\n';
+      return;
+    }
+    m_bots.back()->start();
+
+    if (index % m_settings.lobbySize == 0) {
+      m_groups.push_back(Group{index, {}, std::nullopt, false});
+    } else {
+      m_groups.back().guests.push_back(index);
+    }
+  }
+}
+
+void Swarm::updateGroups(LoadBot::Clock::time_point now)
+{
+  for (auto &group : m_groups) {
+    auto &host = *m_bots[group.host];
+    if (host.getState() == LoadBot::State::IDLE) {
+      host.requestLobby("", m_settings.difficulty);
+      continue;
+    }
+    if (host.getState() != LoadBot::State::IN_LOBBY || group.startRequested) {
+      continue;
+    }
+    if (!group.hostJoinedAt) {
+      group.hostJoinedAt = now;
+    }
+
+    bool allSettled = true;
+    for (const std::size_t guestIndex : group.guests) {
+      auto &guest = *m_bots[guestIndex];
+      if (guest.getState() == LoadBot::State::IDLE) {
+        guest.requestLobby(host.getLobbyCode(), m_settings.difficulty);
+      }
+      if (guest.getState() != LoadBot::State::IN_LOBBY && guest.getState() != LoadBot::State::FAILED) {
+        allSettled = false;
+      }
+    }
+    if (allSettled || now - *group.hostJoinedAt >= m_settings.lobbyFillTimeout) {
+      host.startGame();
+      group.startRequested = true;
+    }
+  }
+}
+
+StepReport Swarm::collect(double seconds)
+{
+  StepReport report;
+  report.clients = m_bots.size();
+  std::uint64_t snapshots = 0;
+  std::uint64_t snapshotBytes = 0;
+  double playingSeconds = 0.0;
+  double rttSum = 0.0;
+  std::size_t rttCount = 0;
+
+  for (auto &bot : m_bots) {
+    switch (bot->getState()) {
+    case LoadBot::State::CONNECTING:
+      break;
+    case LoadBot::State::PLAYING:
+      ++report.playing;
+      ++report.connected;
+      break;
+    case LoadBot::State::FINISHED:
+      ++report.finished;
+      ++report.connected;
+      break;
+    case LoadBot::State::FAILED:
+      ++report.failed;
+      ++report.connected;
+      break;
+    default:
+      ++report.connected;
+      break;
+    }
+    if (bot->getLatency() >= 0.0f) {
+      rttSum += bot->getLatency();
+      ++rttCount;
+    }
+
+    BotSample sample = bot->takeSample();
+    if (sample.connectMs) {
+      report.connectMs.add(*sample.connectMs);
+    }
+    if (sample.joinMs) {
+      report.joinMs.add(*sample.joinMs);
+    }
+    if (sample.startMs) {
+      report.startMs.add(*sample.startMs);
+    }
+    playingSeconds += sample.playingSeconds;
+    snapshots += sample.snapshots;
+    snapshotBytes += sample.snapshotBytes;
+    report.snapshotGapMs.samples.insert(report.snapshotGapMs.samples.end(), sample.snapshotGapsMs.begin(),
+                                        sample.snapshotGapsMs.end());
+    report.inputsSent += sample.inputsSent;
+    report.errors += sample.errors;
+  }
+
+  if (playingSeconds > 0.0 && snapshots > 0) {
+    report.snapshotHz = static_cast<double>(snapshots) / playingSeconds;
+    report.snapshotIntervalMs = 1000.0 / report.snapshotHz;
+  }
+  if (snapshots > 0) {
+    report.snapshotBytes = static_cast<double>(snapshotBytes) / static_cast<double>(snapshots);
+  }
+  if (seconds > 0.0) {
+    report.downstreamBytesPerSecond = static_cast<double>(snapshotBytes) / seconds;
+  }
+  if (rttCount > 0) {
+    report.rttMs = rttSum / static_cast<double>(rttCount);
+  }
+
+  if (m_baselineIntervalMs <= 0.0) {
+    m_baselineIntervalMs = report.snapshotIntervalMs;
+  }
+  if (m_baselineIntervalMs > 0.0 && report.snapshotIntervalMs > 0.0) {
+    report.tickDegradationPercent = (report.snapshotIntervalMs / m_baselineIntervalMs - 1.0) * 100.0;
+  }
+  report.loopLagMs = std::exchange(m_loopLagMs, 0.0);
+  return report;
+}
+
+void Swarm::printStep(const StepReport &report)
+{
+  std::cout << std::fixed << std::setprecision(1) << "[Loadgen] clients=" << report.clients
+            << " connected=" << report.connected << " playing=" << report.playing << " finished=" << report.finished
+            << " failed=" << report.failed << " connect_ms p50/p99=" << report.connectMs.percentile(0.5) << "/"
+            << report.connectMs.percentile(0.99) << " join_ms p50/p99=" << report.joinMs.percentile(0.5) << "/"
+            << report.joinMs.percentile(0.99) << " start_ms p50/p99=" << report.startMs.percentile(0.5) << "/"
+            << report.startMs.percentile(0.99) << " snapshot_hz=" << report.snapshotHz
+            << " snapshot_bytes=" << report.snapshotBytes
+            << " down_kib_s=" << report.downstreamBytesPerSecond / 1024.0
+            << " interval_ms=" << report.snapshotIntervalMs << " gap_p99_ms=" << report.snapshotGapMs.percentile(0.99)
+            << " tick_degradation=" << report.tickDegradationPercent << "%" << " rtt_ms=" << report.rttMs
+            << " inputs=" << report.inputsSent << " errors=" << report.errors << " loop_lag_ms=" << report.loopLagMs
+            << '\n';
+}
+
+void Swarm::printSummary(const std::vector<StepReport> &reports)
+{
+  std::cout << "[Loadgen] Summary" << '\n';
+  std::cout << std::setw(8) << "clients" << std::setw(9) << "playing" << std::setw(12) << "join p99" << std::setw(13)
+            << "snapshot Hz" << std::setw(12) << "interval" << std::setw(11) << "gap p99" << std::setw(12)
+            << "tick degr." << '\n';
+  for (const auto &report : reports) {
+    std::cout << std::fixed << std::setprecision(1) << std::setw(8) << report.clients << std::setw(9) << report.playing
+              << std::setw(10) << report.joinMs.percentile(0.99) << "ms" << std::setw(13) << report.snapshotHz
+              << std::setw(10) << report.snapshotIntervalMs << "ms" << std::setw(9)
+              << report.snapshotGapMs.percentile(0.99) << "ms" << std::setw(11) << report.tickDegradationPercent << "%"
+              << '\n';
+  }
+}
+} // namespace loadgen
@@ -0,0 +1,141 @@
+/**
+ * @file main.cpp
+ * @brief rtype_loadgen entry point: headless bot swarm against a running server.
+ */
+
+#include "Swarm.hpp"
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+std::atomic<bool> g_running{true};
+
+void handleSignal(int /*signal*/)
+{
+  g_running = false;
+}
+
+void printUsage(const char *programName)
+{
+  std::cout << "Usage: " << programName << " [OPTIONS] [HOST] [PORT]\n"
+            << "\n"
+            << "Arguments:\n"
+            << "  HOST    Server hostname or IP address (default: 127.0.0.1)\n"
+            << "  PORT    Server port number (default: 4242)\n"
+            << "\n"
+            << "Options:\n"
+            << "  -h, --help            Display this help message and exit\n"
+            << "  --clients N           Final number of bots (default: 1000)\n"
+            << "  --step N              Bots added per ramp step (default: 50)\n"
+            << "  --step-seconds S      Duration of each step (default: 10)\n"
+            << "  --lobby-size N        Bots per lobby (default: 4)\n"
+            << "  --inputs MODE         random or scripted (default: random)\n"
+            << "  --difficulty D        0 (easy) to 2 (expert) (default: 0)\n"
+            << "  --seed S              Seed of the random inputs (default: 1)\n";
+}
+
+/** @brief Every bot owns a socket: lift the soft descriptor limit to the hard one. */
+void raiseFileLimit(std::size_t clients)
+{
+#ifndef _WIN32
+  rlimit limit{};
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0) {
+    return;
+  }
+  limit.rlim_cur = limit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &limit);
+  if (limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < clients + 64) {
+    std::cerr << "[Loadgen] Warning: open file limit " << limit.rlim_cur << " is low for " << clients << " bots"
+              << '\n';
+  }
+#else
+  (void)clients;
+#endif
+}
+
+bool isNumber(const std::string &value)
+{
+  return !value.empty() && std::all_of(value.begin(), value.end(), ::isdigit);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  loadgen::SwarmSettings settings;
+  bool hostSet = false;
+  bool portSet = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      printUsage(argv[0]);
+      return EXIT_SUCCESS;
+    }
+    const bool hasValue = i + 1 < argc;
+    if (arg.starts_with("--") && !hasValue) {
+      std::cerr << "Error: " << arg << " requires a value" << '\n';
+      return EXIT_FAILURE;
+    }
+    try {
+      if (arg == "--clients") {
+        settings.clients = std::stoul(argv[++i]);
+      } else if (arg == "--step") {
+        settings.step = std::stoul(argv[++i]);
+      } else if (arg == "--step-seconds") {
+        settings.stepDuration = std::chrono::seconds(std::stoul(argv[++i]));
+      } else if (arg == "--lobby-size") {
+        settings.lobbySize = std::stoul(argv[++i]);
+      } else if (arg == "--difficulty") {
+        settings.difficulty = std::clamp(std::stoi(argv[++i]), 0, 2);
+      } else if (arg == "--seed") {
+        settings.seed = std::stoull(argv[++i]);
+      } else if (arg == "--inputs") {
+        const std::string mode = argv[++i];
+        if (mode != "random" && mode != "scripted") {
+          std::cerr << "Error: Invalid input mode '" << mode << "'. Must be 'random' or 'scripted'." << '\n';
+          return EXIT_FAILURE;
+        }
+        settings.inputMode = mode == "random" ? loadgen::InputMode::RANDOM : loadgen::InputMode::SCRIPTED;
+      } else if (!portSet && hostSet && isNumber(arg)) {
+        settings.port = arg;
+        portSet = true;
+      } else if (!hostSet && !arg.starts_with("--")) {
+        settings.host = arg;
+        hostSet = true;
+      } else {
+        std::cerr << "Error: Unknown argument '" << arg << "'" << '\n';
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } catch (const std::exception &e) {
+      std::cerr << "Error: Invalid value for " << arg << ": " << e.what() << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::signal(SIGINT, handleSignal);
+  std::signal(SIGTERM, handleSignal);
+  raiseFileLimit(settings.clients);
+
+  std::cout << "[Loadgen] " << settings.clients << " bots against " << settings.host << ":" << settings.port << ", "
+            << settings.step << " every " << settings.stepDuration.count() << "s, " << settings.lobbySize
+            << " per lobby" << '\n';
+  try {
+    loadgen::Swarm swarm(settings);
+    const auto reports = swarm.run(g_running);
+    loadgen::Swarm::printSummary(reports);
+  } catch (const std::exception &e) {
+    std::cerr << "[Loadgen] Error: " << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
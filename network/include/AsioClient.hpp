@@ -15,19 +15,31 @@
 #endif
 
 #include <asio.hpp>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "../../common/include/network/NetworkPacket.hpp"
 #include "../../common/include/network/SafeQueue.hpp"
 #include "ANetworkManager.hpp"
+#include "Handshake.hpp"
+#include "NetworkLink.hpp"
+#include "NetworkStats.hpp"
 
 /**
  * @brief Asynchronous UDP client using ASIO
  *
- * Connects to a remote server for game communication.
+ * Connects to a remote server for game communication. start() runs the
+ * cookie handshake (see Handshake.hpp); messages sent before the server
+ * admits the client wait in the link and leave on the first flush after.
+ * The server's keepalive PING is answered on the network thread.
  */
 class AsioClient : public ANetworkManager
 {
@@ -42,6 +54,8 @@ public:
   ~AsioClient();
 
   void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId) override;
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel) override;
+  void flush() override;
   void start() override;
   void stop() override;
   bool poll(NetworkPacket &msg) override;
@@ -53,17 +67,24 @@ public:
   int getPacketsPerSecond() const override;
   int getUploadBytesPerSecond() const override;
   int getDownloadBytesPerSecond() const override;
+  [[nodiscard]] NetworkStats getNetworkStats() const override;
 
   /**
    * @brief Send a ping to measure latency
    */
   void sendPing();
 
+  /** @brief Whether the server completed the handshake and accepts our traffic. */
+  [[nodiscard]] bool isAdmitted() const { return m_admitted; }
+
   // Client always talks to a single server endpoint.
   [[nodiscard]] asio::ip::udp::endpoint getServerEndpoint() const { return m_serverEndpoint; }
 
 private:
   void receive();
+  void sendDatagram(std::shared_ptr<std::vector<std::byte>> datagram);
+  void scheduleLinkFlush();
+  void sendHandshake();
 
   SafeQueue<NetworkPacket> m_incomingMessages;
   asio::io_context m_ioContext;
@@ -72,20 +93,27 @@ private:
   asio::ip::udp::endpoint m_serverEndpoint;
   asio::executor_work_guard<asio::io_context::executor_type> m_workGuard;
   std::thread m_recvThread;
+  asio::steady_timer m_linkFlushTimer;
+
+  // Framing and channel state towards the server, shared by send() callers,
+  // the receive handler and the flush timer.
+  mutable std::mutex m_linkMutex;
+  NetworkLink m_link;
+
+  // Handshake progress; the cookie and timestamps are only touched on the strand
+  std::atomic<bool> m_admitted{false};
+  std::optional<Handshake::Cookie> m_cookie;
+  std::chrono::steady_clock::time_point m_cookieReceivedTime;
+  std::chrono::steady_clock::time_point m_lastHandshakeTime;
 
   // Network stats
   mutable float m_latency = -1.0f;
   mutable bool m_connected = false;
-  mutable int m_packetsPerSecond = 0;
-  mutable int m_uploadBytesPerSecond = 0;
-  mutable int m_downloadBytesPerSecond = 0;
-  mutable std::chrono::steady_clock::time_point m_lastPingTime;
   mutable std::chrono::steady_clock::time_point m_pingStartTime;
   mutable bool m_pingPending = false;
-  mutable int m_packetCount = 0;
-  mutable int m_uploadByteCount = 0;
-  mutable int m_downloadByteCount = 0;
-  mutable std::chrono::steady_clock::time_point m_statsResetTime;
+  KeepaliveMessages m_keepalive;
+  TrafficCounters m_traffic;
+  TrafficRateMeter m_rates;
 };
 
 #endif // ASIO_CLIENT_HPP_
@@ -21,9 +21,12 @@
 #include <asio/executor_work_guard.hpp>
 #include <asio/ip/udp.hpp>
 #include <asio/socket_base.hpp>
-#include <asio/strand.hpp>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <thread>
 #include <unordered_map>
@@ -33,6 +36,11 @@
 #include "../../common/include/network/NetworkPacket.hpp"
 #include "../../common/include/network/SafeQueue.hpp"
 #include "ANetworkManager.hpp"
+#include "Common.hpp"
+#include "Handshake.hpp"
+#include "NetworkConfig.hpp"
+#include "NetworkLink.hpp"
+#include "NetworkStats.hpp"
 
 namespace ecs
 {
@@ -42,7 +50,23 @@ class World;
 /**
  * @brief Asynchronous UDP server using ASIO
  *
- * Handles multiple clients with a thread pool.
+ * Receives on one or more shards. Each shard owns a UDP socket bound to the
+ * same port with SO_REUSEPORT, its own io_context, thread and incoming
+ * queue, so the kernel spreads client flows across cores. A client is owned
+ * by the shard that first received from it; replies leave from that shard's
+ * socket. poll() drains all shard queues from the game thread.
+ *
+ * Each shard keeps the endpoints of its own clients, so a datagram and the
+ * per-tick flush() only lock their shard. The registry shared by all shards
+ * is only taken on connect, disconnect and send().
+ *
+ * Endpoints are admitted through the cookie handshake (see Handshake.hpp);
+ * any other datagram from an unknown endpoint is dropped on the shard
+ * thread without allocating anything.
+ *
+ * Traffic is counted per client and in total on the shard threads (see
+ * NetworkStats.hpp); flush() also pings each client once per
+ * NetworkConfig::STATS_PING_INTERVAL_MS and the PONG is timed on receipt.
  */
 class AsioServer : public ANetworkManager
 {
@@ -51,40 +75,95 @@ public:
    * @brief Construct a UDP server
    *
    * @param port The port to listen on
+   * @param shardCount Number of receive shards (clamped to 1 where
+   *        SO_REUSEPORT is unavailable)
    */
-  explicit AsioServer(std::uint16_t port);
+  explicit AsioServer(std::uint16_t port, std::size_t shardCount = NetworkConfig::DEFAULT_RECEIVE_SHARDS);
   ~AsioServer();
 
   void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId) override;
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel) override;
+  void flush() override;
   void start() override;
   void stop() override;
   bool poll(NetworkPacket &msg) override;
   [[nodiscard]] std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> getClients() const override;
   void disconnect(std::uint32_t clientId) override;
-  float getLatency() const override { return -1.0f; } // Server doesn't measure latency
+  float getLatency() const override; // Mean RTT over the clients
   bool isConnected() const override { return true; } // Server is always "connected"
-  int getPacketsPerSecond() const override { return 0; } // Not implemented for server
-  int getUploadBytesPerSecond() const override { return 0; }
-  int getDownloadBytesPerSecond() const override { return 0; }
+  int getPacketsPerSecond() const override;
+  int getUploadBytesPerSecond() const override;
+  int getDownloadBytesPerSecond() const override;
+  [[nodiscard]] NetworkStats getNetworkStats() const override;
   void setWorld(const std::shared_ptr<ecs::World> &world);
   [[nodiscard]] std::size_t getConnectedPlayersCount() const;
+  [[nodiscard]] std::size_t getShardCount() const { return m_shards.size(); }
+  [[nodiscard]] HandshakeStats getHandshakeStats() const { return m_gate.getStats(); }
 
 private:
-  void receive();
-  std::pair<std::uint32_t, bool> getOrCreateClientId(const asio::ip::udp::endpoint &endpoint);
+  /**
+   * @brief One receive socket with its own event loop
+   *
+   * Handlers of a shard all run on its single thread, so the receive buffer
+   * is reused across reads. Links and the client table are locked because
+   * send()/flush() come from the game thread and a rebalanced flow can reach
+   * the client from another shard.
+   */
+  struct Shard {
+    Shard(std::size_t shardIndex, std::uint16_t port, bool reusePort);
+
+    std::size_t index;
+    asio::io_context ioContext;
+    asio::ip::udp::socket socket;
+    asio::executor_work_guard<asio::io_context::executor_type> workGuard;
+    std::thread thread;
+    std::array<char, BUFFER_SIZE> receiveBuffer{};
+    asio::ip::udp::endpoint senderEndpoint;
+    SafeQueue<NetworkPacket> incomingMessages;
+    std::mutex linksMutex;
+    std::unordered_map<std::uint32_t, NetworkLink> links;
+    std::unordered_map<std::uint32_t, std::shared_ptr<ClientCounters>> counters;
+    std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> clients; // Owned by this shard
+    std::unordered_map<asio::ip::udp::endpoint, std::uint32_t, EndpointHash> endpointIds;
+  };
+
+  /** @brief Datagrams ready for one endpoint, and whom to charge for them */
+  struct PendingSend {
+    asio::ip::udp::endpoint endpoint;
+    std::vector<std::vector<std::byte>> datagrams;
+    std::shared_ptr<ClientCounters> counters;
+  };
+
+  void receive(Shard &shard);
+  void handleHandshake(Shard &shard, std::span<const std::byte> datagram);
+  void admitClient(const asio::ip::udp::endpoint &endpoint, std::size_t shardIndex);
+  void onClientDatagram(Shard &owner, std::uint32_t clientId, std::span<const std::byte> datagram);
+  [[nodiscard]] std::optional<std::pair<std::uint32_t, Shard *>> findClient(const asio::ip::udp::endpoint &endpoint,
+                                                                           Shard &first) const;
+  std::pair<std::uint32_t, bool> getOrCreateClientId(const asio::ip::udp::endpoint &endpoint, std::size_t shardIndex);
+  [[nodiscard]] Shard *findClientShard(std::uint32_t clientId) const;
   void createPlayerEntity(std::uint32_t clientId);
+  void flushClient(Shard &shard, std::uint32_t clientId);
+  void sendDatagram(Shard &shard, std::shared_ptr<std::vector<std::byte>> datagram,
+                    const asio::ip::udp::endpoint &endpoint, std::shared_ptr<ClientCounters> counters);
 
-  SafeQueue<NetworkPacket> m_incomingMessages;
-  asio::io_context m_ioContext;
-  asio::strand<asio::io_context::executor_type> m_strand;
-  asio::ip::udp::socket m_socket;
-  std::vector<std::thread> m_threadPool;
+  std::vector<std::unique_ptr<Shard>> m_shards;
+  std::size_t m_pollCursor{0}; // Game thread only
+
+  // Client registry, shared by all shards and the game thread; locked before a shard's linksMutex
+  mutable std::mutex m_clientsMutex;
   std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> m_clients;
+  std::unordered_map<std::uint32_t, std::size_t> m_clientShards;
+  std::unordered_map<asio::ip::udp::endpoint, std::uint32_t, EndpointHash> m_endpointIds;
   std::uint32_t m_nextClientId;
-  asio::executor_work_guard<asio::io_context::executor_type> m_workGuard;
-  asio::ip::udp::endpoint m_remoteEndpoint;
-  std::shared_ptr<ecs::World> m_world;
   std::size_t m_connectedPlayersCount{0};
+
+  ConnectionGate m_gate;
+  std::shared_ptr<ecs::World> m_world;
+
+  KeepaliveMessages m_keepalive;
+  TrafficCounters m_traffic; // Every datagram, handshakes and unknown senders included
+  TrafficRateMeter m_rates;
 };
 
 #endif // ASIO_SERVER_HPP_
@@ -10,20 +10,29 @@
 
 #include <array>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "IPacketHandler.hpp"
+#include "NetworkConfig.hpp"
 
 /**
  * @brief Cap'n Proto implementation of packet serialization
  *
  * Handles serialization and deserialization using Cap'n Proto format.
+ * Messages are built in a per-thread scratch segment and written straight
+ * into the destination buffer; received bytes are read in place with a
+ * flat-array reader (copied to aligned scratch only when misaligned).
+ * Packed encoding trades a little CPU for smaller datagrams.
  */
 class CapnpHandler : public IPacketHandler
 {
 public:
-  CapnpHandler() = default;
+  /**
+   * @param packed Use Cap'n Proto packed encoding (must match the peer)
+   */
+  explicit CapnpHandler(bool packed = NetworkConfig::CAPNP_PACKED_ENCODING) : m_packed(packed) {}
   ~CapnpHandler() override = default;
 
   /**
@@ -34,6 +43,15 @@ public:
    */
   std::vector<std::uint8_t> serialize(const std::string &data) const override;
 
+  /**
+   * @brief Serialize a message string into a reusable buffer
+   *
+   * @param data The message string
+   * @param out Destination buffer, overwritten
+   * @return Number of serialized bytes
+   */
+  std::size_t serializeInto(const std::string &data, std::vector<std::uint8_t> &out) const override;
+
   /**
    * @brief Deserialize bytes to string
    *
@@ -44,6 +62,17 @@ public:
   std::optional<std::string> deserialize(const std::array<char, BUFFER_SIZE> &buffer,
                                          std::size_t bytesTransferred) const override;
 
+  /**
+   * @brief Deserialize received bytes without copying them
+   *
+   * @param bytes The received bytes
+   * @return Deserialized message string
+   */
+  std::optional<std::string> deserialize(std::span<const std::byte> bytes) const override;
+
+  /** @brief Whether packed encoding is used. */
+  [[nodiscard]] bool isPacked() const { return m_packed; }
+
   /**
    * @brief Convert string to byte vector
    *
@@ -51,6 +80,9 @@ public:
    * @return Vector of bytes
    */
   static std::vector<std::byte> stringToBytes(const std::string &str);
+
+private:
+  bool m_packed;
 };
 
 #endif // CAPNP_HANDLER_HPP_
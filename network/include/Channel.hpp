@@ -0,0 +1,132 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Channel.hpp - Unreliable-sequenced and reliable-ordered message channels
+*/
+
+#ifndef CHANNEL_HPP_
+#define CHANNEL_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class PacketFramer;
+
+/**
+ * @brief Delivery guarantee of a message
+ */
+enum class Channel : std::uint8_t {
+  UNRELIABLE_SEQUENCED = 0, ///< Snapshots, inputs: newest wins, stale ones dropped
+  RELIABLE_ORDERED = 1 ///< Lobby/control messages: resent until acked, delivered in order
+};
+
+/**
+ * @brief Channel state shared with one remote peer
+ *
+ * Wire format of a channel message (inside a framed datagram):
+ * - data: [u8 channel][u16 sequence][payload]
+ * - ack:  [u8 ACK][u16 nextExpected][u32 receivedBits]
+ *   where bit i acknowledges reliable sequence nextExpected + 1 + i.
+ *
+ * Reliable messages stay queued until acked and are selectively resent after
+ * the retransmission timeout. Acks are emitted by flush() so they ride in the
+ * same datagram as the outgoing traffic. Unreliable messages never wait for
+ * reliable ones. Not thread-safe: callers serialize access.
+ */
+class ChannelEndpoint
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  ChannelEndpoint();
+
+  /**
+   * @brief Queue a message on a channel
+   * @param payload Message bytes
+   * @param channel Delivery guarantee
+   * @param now Current time
+   * @param out Framer of the peer
+   * @return false if the framer rejected the message
+   */
+  bool send(std::span<const std::byte> payload, Channel channel, Clock::time_point now, PacketFramer &out);
+
+  /**
+   * @brief Queue due retransmissions and the pending ack
+   * @param now Current time
+   * @param out Framer of the peer
+   */
+  void flush(Clock::time_point now, PacketFramer &out);
+
+  /**
+   * @brief Process one channel message received from the peer
+   * @param message Channel message (framing already removed)
+   * @param now Reception time
+   * @param delivered Payloads ready for the application are appended here
+   * @return false if the message is malformed
+   */
+  bool onMessage(std::span<const std::byte> message, Clock::time_point now,
+                 std::vector<std::vector<std::byte>> &delivered);
+
+  /** @brief Smoothed round-trip time in ms, or -1 before the first sample. */
+  [[nodiscard]] float getRttMs() const;
+
+  /** @brief Reliable messages sent but not acked yet. */
+  [[nodiscard]] std::size_t getUnackedCount() const;
+
+  /** @brief Whether received reliable messages still need to be acked. */
+  [[nodiscard]] bool hasPendingAck() const;
+
+  /** @brief Reliable retransmissions since creation. */
+  [[nodiscard]] std::uint64_t getResendCount() const;
+
+  /** @brief Reliable messages sent since creation, retransmissions excluded. */
+  [[nodiscard]] std::uint64_t getReliableSentCount() const { return m_reliableSentCount; }
+
+  /** @brief Unreliable messages received, and sequence numbers skipped (lost or late). */
+  [[nodiscard]] std::uint64_t getUnreliableReceivedCount() const { return m_unreliableReceivedCount; }
+  [[nodiscard]] std::uint64_t getUnreliableMissedCount() const { return m_unreliableMissedCount; }
+
+private:
+  struct SentMessage {
+    std::uint16_t sequence = 0;
+    std::vector<std::byte> framed;
+    Clock::time_point firstSent;
+    Clock::time_point lastSent;
+    std::uint32_t sendCount = 1;
+  };
+
+  void onAck(std::uint16_t nextExpected, std::uint32_t receivedBits, Clock::time_point now);
+  void onReliable(std::uint16_t sequence, std::span<const std::byte> payload,
+                  std::vector<std::vector<std::byte>> &delivered);
+  void addRttSample(float sampleMs);
+
+  // Send side
+  std::uint16_t m_nextUnreliableSequence = 0;
+  std::uint16_t m_nextReliableSequence = 0;
+  std::deque<SentMessage> m_unacked;
+  std::uint64_t m_resendCount = 0;
+  std::uint64_t m_reliableSentCount = 0;
+
+  // Receive side
+  bool m_hasUnreliable = false;
+  std::uint16_t m_lastUnreliableSequence = 0;
+  std::uint64_t m_unreliableReceivedCount = 0;
+  std::uint64_t m_unreliableMissedCount = 0;
+  std::uint16_t m_nextExpected = 0;
+  std::unordered_map<std::uint16_t, std::vector<std::byte>> m_outOfOrder;
+  bool m_ackPending = false;
+
+  // RTT estimation (RFC 6298 style)
+  bool m_hasRtt = false;
+  float m_srttMs = 0.0f;
+  float m_rttVarMs = 0.0f;
+  float m_rtoMs;
+};
+
+#endif // CHANNEL_HPP_
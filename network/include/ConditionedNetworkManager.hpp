@@ -0,0 +1,81 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** ConditionedNetworkManager.hpp - Impairment shim around a real network manager
+*/
+
+#ifndef CONDITIONED_NETWORK_MANAGER_HPP_
+#define CONDITIONED_NETWORK_MANAGER_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+
+#include "INetworkManager.hpp"
+#include "NetworkConditioner.hpp"
+
+/**
+ * @brief Wraps AsioServer/AsioClient (or any manager) and impairs its traffic
+ *
+ * Outgoing messages wait in the outbound conditioner before reaching the
+ * wrapped manager; incoming ones wait in the inbound conditioner after
+ * poll(). Channels are honoured on the outbound side (see
+ * NetworkConditioner). Inbound messages arrive without their channel, so
+ * they are all treated as reliable: latency, jitter and bandwidth apply and
+ * losses become retransmission delays. To lose unreliable traffic in both
+ * directions, wrap both ends.
+ *
+ * Delayed messages are released by send(), flush() and poll(), so the
+ * effective resolution is the caller's tick.
+ */
+class ConditionedNetworkManager : public INetworkManager
+{
+public:
+  /**
+   * @param inner The real manager, owned by the shim
+   * @param outbound Conditions for what this side sends
+   * @param inbound Conditions for what this side receives
+   * @param seed Seed of both directions (the inbound one is derived)
+   */
+  ConditionedNetworkManager(std::shared_ptr<INetworkManager> inner, const LinkConditions &outbound,
+                            const LinkConditions &inbound, std::uint64_t seed);
+
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId) override;
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel) override;
+  void flush() override;
+  void start() override { m_inner->start(); }
+  void stop() override { m_inner->stop(); }
+  bool poll(NetworkPacket &msg) override;
+  [[nodiscard]] std::shared_ptr<IPacketHandler> getPacketHandler() const override
+  {
+    return m_inner->getPacketHandler();
+  }
+  [[nodiscard]] std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> getClients() const override
+  {
+    return m_inner->getClients();
+  }
+  void disconnect(std::uint32_t clientId) override { m_inner->disconnect(clientId); }
+  float getLatency() const override { return m_inner->getLatency(); }
+  bool isConnected() const override { return m_inner->isConnected(); }
+  int getPacketsPerSecond() const override { return m_inner->getPacketsPerSecond(); }
+  int getUploadBytesPerSecond() const override { return m_inner->getUploadBytesPerSecond(); }
+  int getDownloadBytesPerSecond() const override { return m_inner->getDownloadBytesPerSecond(); }
+  [[nodiscard]] NetworkStats getNetworkStats() const override { return m_inner->getNetworkStats(); }
+
+  [[nodiscard]] const std::shared_ptr<INetworkManager> &getInner() const { return m_inner; }
+  [[nodiscard]] ConditionerStats getOutboundStats() const;
+  [[nodiscard]] ConditionerStats getInboundStats() const;
+
+private:
+  void releaseOutbound(NetworkConditioner::Clock::time_point now);
+
+  std::shared_ptr<INetworkManager> m_inner;
+  mutable std::mutex m_mutex;
+  NetworkConditioner m_outbound;
+  NetworkConditioner m_inbound;
+};
+
+#endif // CONDITIONED_NETWORK_MANAGER_HPP_
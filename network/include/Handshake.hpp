@@ -0,0 +1,141 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Handshake.hpp - Stateless cookie handshake before a client is admitted
+*/
+
+#ifndef HANDSHAKE_HPP_
+#define HANDSHAKE_HPP_
+
+#include <array>
+#include <asio/ip/udp.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Wire format of handshake datagrams
+ *
+ * They sit beside framed datagrams and start with HANDSHAKE_MAGIC, then the
+ * kind and the protocol version:
+ * - CONNECT   (client): [magic][kind][version] padded to CONNECT_SIZE
+ * - CHALLENGE (server): [magic][kind][version][cookie]
+ * - RESPONSE  (client): [magic][kind][version][cookie]
+ * The cookie is [u64 issue time][u64 MAC], big-endian. CONNECT is padded so
+ * the challenge is never larger than what a spoofed sender paid for.
+ */
+namespace Handshake
+{
+constexpr std::uint8_t HANDSHAKE_MAGIC = 0xA8;
+constexpr std::uint8_t KIND_CONNECT = 0x01;
+constexpr std::uint8_t KIND_CHALLENGE = 0x02;
+constexpr std::uint8_t KIND_RESPONSE = 0x03;
+constexpr std::uint8_t PROTOCOL_VERSION = 1;
+constexpr std::size_t HEADER_SIZE = 3;
+constexpr std::size_t COOKIE_SIZE = 16;
+constexpr std::size_t CONNECT_SIZE = 64;
+constexpr std::size_t CHALLENGE_SIZE = HEADER_SIZE + COOKIE_SIZE;
+constexpr std::size_t RESPONSE_SIZE = HEADER_SIZE + COOKIE_SIZE;
+
+using Cookie = std::array<std::byte, COOKIE_SIZE>;
+
+/** @brief Whether the datagram belongs to the handshake rather than the framing layer. */
+[[nodiscard]] bool isHandshake(std::span<const std::byte> datagram) noexcept;
+
+/** @brief CONNECT datagram sent by a client until it gets a challenge. */
+[[nodiscard]] std::vector<std::byte> makeConnect();
+
+/** @brief Cookie carried by a CHALLENGE, nullopt for anything else. */
+[[nodiscard]] std::optional<Cookie> parseChallenge(std::span<const std::byte> datagram) noexcept;
+
+/** @brief RESPONSE datagram echoing the cookie back to the server. */
+[[nodiscard]] std::vector<std::byte> makeResponse(const Cookie &cookie);
+} // namespace Handshake
+
+/**
+ * @brief Hash of a UDP endpoint, to index admitted clients by sender address
+ */
+struct EndpointHash {
+  std::size_t operator()(const asio::ip::udp::endpoint &endpoint) const noexcept
+  {
+    std::size_t seed = std::hash<unsigned short>{}(endpoint.port());
+    const auto address = endpoint.address();
+    if (address.is_v4()) {
+      seed ^= std::hash<std::uint32_t>{}(address.to_v4().to_uint()) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    } else {
+      for (const auto byte : address.to_v6().to_bytes()) {
+        seed ^= std::hash<unsigned char>{}(byte) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
+    }
+    return seed;
+  }
+};
+
+/**
+ * @brief Counters of the server-side handshake (plain values, see ConnectionGate::getStats)
+ */
+struct HandshakeStats {
+  std::uint64_t challengesSent = 0;
+  std::uint64_t accepted = 0;
+  std::uint64_t droppedUnauthenticated = 0; // Non-handshake traffic from unknown endpoints
+  std::uint64_t droppedBadCookie = 0;       // Forged, expired or foreign cookies
+  std::uint64_t droppedMalformed = 0;       // Truncated handshake or wrong version
+};
+
+/**
+ * @brief Server side of the handshake
+ *
+ * Keeps no per-endpoint state: a CONNECT is answered with a cookie that is
+ * a keyed MAC (SipHash-2-4) of the sender address, port and issue time. A
+ * RESPONSE is accepted only if the MAC matches for the sender it came from
+ * and the cookie is younger than HANDSHAKE_COOKIE_LIFETIME_MS, which proves the
+ * client can receive at that address. Only then does the server allocate a
+ * client. The secret is drawn at construction, so cookies do not survive a
+ * restart. Thread-safe: shards share one gate.
+ */
+class ConnectionGate
+{
+public:
+  using Clock = std::chrono::steady_clock;
+  using Key = std::array<std::uint64_t, 2>;
+
+  enum class Verdict : std::uint8_t {
+    DROP,      // Nothing to do
+    CHALLENGE, // Send `reply` back to the sender
+    ACCEPT     // The sender proved its address: admit it
+  };
+
+  ConnectionGate();
+  explicit ConnectionGate(const Key &secret);
+
+  /**
+   * @brief Handle a datagram for which Handshake::isHandshake() holds
+   *
+   * @param reply Filled with the CHALLENGE when the verdict asks for it
+   */
+  Verdict onHandshake(std::span<const std::byte> datagram, const asio::ip::udp::endpoint &sender,
+                      Clock::time_point now, std::vector<std::byte> &reply);
+
+  /** @brief Account for a non-handshake datagram from an unknown endpoint. */
+  void countUnauthenticated() noexcept { m_droppedUnauthenticated.fetch_add(1, std::memory_order_relaxed); }
+
+  [[nodiscard]] HandshakeStats getStats() const noexcept;
+
+private:
+  [[nodiscard]] std::uint64_t mac(const asio::ip::udp::endpoint &sender, std::uint64_t issuedMs) const noexcept;
+
+  Key m_secret;
+  std::atomic<std::uint64_t> m_challengesSent{0};
+  std::atomic<std::uint64_t> m_accepted{0};
+  std::atomic<std::uint64_t> m_droppedUnauthenticated{0};
+  std::atomic<std::uint64_t> m_droppedBadCookie{0};
+  std::atomic<std::uint64_t> m_droppedMalformed{0};
+};
+
+#endif // HANDSHAKE_HPP_
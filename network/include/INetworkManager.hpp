@@ -14,7 +14,9 @@
 #include <vector>
 
 #include "../../common/include/network/NetworkPacket.hpp"
+#include "Channel.hpp"
 #include "IPacketHandler.hpp"
+#include "NetworkStats.hpp"
 #include <asio.hpp>
 
 /**
@@ -42,13 +44,33 @@ public:
   virtual ~INetworkManager() = default;
 
   /**
-   * @brief Send data to a target endpoint
+   * @brief Send data to a target endpoint on the reliable-ordered channel
    *
    * @param data The data to send
    * @param targetEndpointId The target endpoint ID
    */
   virtual void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId) = 0;
 
+  /**
+   * @brief Send data to a target endpoint on a given channel
+   *
+   * Use Channel::UNRELIABLE_SEQUENCED for state that is resent anyway
+   * (snapshots, inputs, pings) so it never waits behind retransmissions.
+   *
+   * @param data The data to send
+   * @param targetEndpointId The target endpoint ID
+   * @param channel Delivery guarantee
+   */
+  virtual void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel) = 0;
+
+  /**
+   * @brief Put every message queued by send() on the wire
+   *
+   * Messages are aggregated into MTU-sized datagrams per endpoint until the
+   * next flush, so callers flush once per tick after all their sends.
+   */
+  virtual void flush() = 0;
+
   /**
    * @brief Start the network manager
    */
@@ -111,6 +133,15 @@ public:
    * @return Download bytes per second
    */
   virtual int getDownloadBytesPerSecond() const = 0;
+
+  /**
+   * @brief Cumulative traffic counters, in total and per connection
+   *
+   * Servers report one connection per admitted client, clients a single one
+   * for the server.
+   * @return A snapshot of the counters
+   */
+  [[nodiscard]] virtual NetworkStats getNetworkStats() const = 0;
 };
 
 #endif // I_NETWORK_MANAGER_HPP_
@@ -18,6 +18,7 @@
 #include <capnp/serialize.h>
 #include <kj/std/iostream.h>
 #include <optional>
+#include <span>
 
 /**
  * @brief Interface for packet serialization/deserialization
@@ -37,6 +38,18 @@ public:
    */
   virtual std::vector<std::uint8_t> serialize(const std::string &data) const = 0;
 
+  /**
+   * @brief Serialize a message string into a caller-owned buffer
+   *
+   * The buffer is overwritten; keeping it alive between calls lets its
+   * capacity be reused instead of allocating per message.
+   *
+   * @param data The message string
+   * @param out Destination buffer
+   * @return Number of serialized bytes (out.size())
+   */
+  virtual std::size_t serializeInto(const std::string &data, std::vector<std::uint8_t> &out) const = 0;
+
   /**
    * @brief Deserialize bytes to a message string
    *
@@ -46,6 +59,14 @@ public:
    */
   virtual std::optional<std::string> deserialize(const std::array<char, BUFFER_SIZE> &buffer,
                                                  std::size_t bytesTransferred) const = 0;
+
+  /**
+   * @brief Deserialize bytes to a message string, reading them in place
+   *
+   * @param bytes The received bytes
+   * @return Deserialized message string
+   */
+  virtual std::optional<std::string> deserialize(std::span<const std::byte> bytes) const = 0;
 };
 
 #endif // I_PACKET_HANDLER_HPP_
@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** NetworkConditioner.hpp - Seeded latency/loss/bandwidth impairment queue
+*/
+
+#ifndef NETWORK_CONDITIONER_HPP_
+#define NETWORK_CONDITIONER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "Channel.hpp"
+
+/**
+ * @brief Impairments of one direction of a link
+ *
+ * Zero everywhere is a perfect link.
+ */
+struct LinkConditions {
+  int latencyMs = 0; // One-way base delay
+  int jitterMs = 0; // Uniform extra delay in [-jitterMs, +jitterMs]
+  double lossRate = 0.0; // [0, 1]
+  double duplicateRate = 0.0; // [0, 1]
+  double reorderRate = 0.0; // [0, 1], chosen items are held back reorderDelayMs
+  int reorderDelayMs = 20;
+  std::size_t bandwidthBytesPerSecond = 0; // 0 = unlimited
+
+  [[nodiscard]] bool isPerfect() const
+  {
+    return latencyMs == 0 && jitterMs == 0 && lossRate <= 0.0 && duplicateRate <= 0.0 && reorderRate <= 0.0 &&
+      bandwidthBytesPerSecond == 0;
+  }
+};
+
+/**
+ * @brief Counters of a NetworkConditioner
+ */
+struct ConditionerStats {
+  std::uint64_t sent = 0;
+  std::uint64_t delivered = 0;
+  std::uint64_t lost = 0;
+  std::uint64_t overflowed = 0; // Dropped because the bandwidth queue was full
+  std::uint64_t duplicated = 0;
+  std::uint64_t reordered = 0;
+  std::uint64_t retransmitted = 0; // Reliable losses turned into resend delays
+  std::uint64_t bytesDelivered = 0;
+};
+
+/**
+ * @brief Delays, drops, duplicates and reorders items of one link direction
+ *
+ * Items are released by pop() once their delivery time is reached. Every
+ * random decision comes from one seeded mt19937_64 mapped to [0, 1) by hand
+ * (std distributions differ between standard libraries), so a given seed
+ * and traffic give the same decisions on every platform.
+ *
+ * Items pushed on Channel::RELIABLE_ORDERED are never dropped, duplicated
+ * or reordered: each loss instead adds one retransmission timeout, and they
+ * leave in order per endpoint, which is what the reliable channel would make
+ * of a lossy path. Items on the unreliable channel get the raw impairments.
+ * A bandwidth cap serializes items one after the other; items that would
+ * wait longer than NetworkConfig::SIMULATION_MAX_QUEUE_DELAY_MS are dropped
+ * like a full router queue.
+ *
+ * Not thread-safe: callers serialize access.
+ */
+class NetworkConditioner
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Item {
+    std::vector<std::byte> data;
+    std::uint32_t endpointId = 0;
+    Channel channel = Channel::UNRELIABLE_SEQUENCED;
+  };
+
+  NetworkConditioner(const LinkConditions &conditions, std::uint64_t seed);
+
+  /** @brief Submit an item sent at `now`. */
+  void push(std::vector<std::byte> data, std::uint32_t endpointId, Channel channel, Clock::time_point now);
+
+  /**
+   * @brief Take the next item whose delivery time is reached
+   * @return false if nothing is due at `now`
+   */
+  bool pop(Clock::time_point now, Item &item);
+
+  [[nodiscard]] std::size_t getPendingCount() const { return m_queue.size(); }
+  [[nodiscard]] const ConditionerStats &getStats() const { return m_stats; }
+  [[nodiscard]] const LinkConditions &getConditions() const { return m_conditions; }
+
+private:
+  struct Scheduled {
+    Clock::time_point deliverAt;
+    std::uint64_t order;
+    Item item;
+  };
+  struct Later {
+    bool operator()(const Scheduled &lhs, const Scheduled &rhs) const
+    {
+      return lhs.deliverAt != rhs.deliverAt ? lhs.deliverAt > rhs.deliverAt : lhs.order > rhs.order;
+    }
+  };
+
+  double uniform();
+  bool chance(double probability);
+  Clock::duration jitter();
+  void schedule(Clock::time_point deliverAt, Item item);
+
+  LinkConditions m_conditions;
+  std::mt19937_64 m_random;
+  std::priority_queue<Scheduled, std::vector<Scheduled>, Later> m_queue;
+  std::uint64_t m_nextOrder = 0;
+  Clock::time_point m_linkBusyUntil{};
+  std::unordered_map<std::uint32_t, Clock::time_point> m_lastReliableDelivery;
+  ConditionerStats m_stats;
+};
+
+#endif // NETWORK_CONDITIONER_HPP_
@@ -8,6 +8,9 @@
 #ifndef NETWORKCONFIG_HPP_
 #define NETWORKCONFIG_HPP_
 
+#include <cstddef>
+#include <cstdint>
+
 namespace NetworkConfig
 {
 // Buffer configuration
@@ -15,6 +18,61 @@ constexpr int RECEIVE_BUFFER_SIZE = 1024;
 constexpr int RECEIVE_BUFFER_SIZE_KB = 1024;
 constexpr int RECEIVE_BUFFER_MULTIPLIER = 8;
 
+// Cap'n Proto serialization (see CapnpHandler.hpp)
+// Both peers must agree on the encoding. Scratch words are allocated once
+// per thread and reused for every message that fits.
+constexpr bool CAPNP_PACKED_ENCODING = false;
+constexpr std::size_t CAPNP_SCRATCH_WORDS = 8192;
+
+// Datagram framing (see PacketFramer.hpp)
+// Every datagram stays under a conservative path MTU: small messages are
+// bundled together, larger ones are split into numbered fragments.
+constexpr std::size_t MAX_DATAGRAM_SIZE = 1200;
+constexpr int FRAGMENT_TIMEOUT_MS = 1000;
+constexpr std::size_t MAX_PENDING_FRAGMENTED_MESSAGES = 32;
+
+// Receive shards: sockets sharing the port through SO_REUSEPORT, each with
+// its own thread (see AsioServer.hpp)
+constexpr std::size_t DEFAULT_RECEIVE_SHARDS = 1;
+constexpr std::size_t MAX_RECEIVE_SHARDS = 64;
+
+// io_uring backend (see UringServer.hpp): ring depth and provided receive
+// buffers. A buffer holds the recvmsg header, the sender address and the
+// datagram; larger datagrams are dropped (clients never exceed
+// MAX_DATAGRAM_SIZE).
+constexpr unsigned URING_QUEUE_DEPTH = 4096;
+constexpr unsigned URING_RECEIVE_BUFFER_COUNT = 1024; // Power of two
+constexpr unsigned URING_RECEIVE_BUFFER_SIZE = 2048;
+
+// Channels (see Channel.hpp)
+// Reliable messages are resent after the retransmission timeout derived
+// from the smoothed RTT, clamped to [MIN_RTO_MS, MAX_RTO_MS].
+constexpr int INITIAL_RTO_MS = 200;
+constexpr int MIN_RTO_MS = 50;
+constexpr int MAX_RTO_MS = 1000;
+constexpr std::uint16_t RELIABLE_RECEIVE_WINDOW = 256;
+// The client has no game-loop flush: a timer pushes acks and resends
+constexpr int CLIENT_LINK_FLUSH_INTERVAL_MS = 20;
+
+// Connection handshake (see Handshake.hpp)
+// A cookie must come back within its lifetime; the client repeats CONNECT
+// or RESPONSE every retry interval until the server admits it.
+constexpr std::uint64_t HANDSHAKE_COOKIE_LIFETIME_MS = 5000;
+constexpr int HANDSHAKE_RETRY_MS = 250;
+
+// Connection statistics (see NetworkStats.hpp)
+// Servers ping every client this often and time the PONG on the network
+// thread; rates returned by the getters are refreshed at most this often.
+constexpr int STATS_PING_INTERVAL_MS = 1000;
+constexpr int STATS_RATE_WINDOW_MS = 1000;
+
+// Network simulation (see NetworkConditioner.hpp): a bandwidth-capped link
+// drops what would queue longer than this, and reliable losses cost about
+// one retransmission timeout each, at most SIMULATION_MAX_RETRANSMITS times.
+constexpr int SIMULATION_MAX_QUEUE_DELAY_MS = 500;
+constexpr int SIMULATION_MAX_RETRANSMITS = 8;
+constexpr std::uint16_t SIMULATION_CLIENT_PORT_BASE = 20000;
+
 // Player spawn configuration (reuse from GameConfig if possible, or define here)
 constexpr float PLAYER_GUN_OFFSET = 20.0F;
 constexpr float PLAYER_SPAWN_X = 100.0F;
@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** NetworkLink.hpp - Per-peer framing and channel state
+*/
+
+#ifndef NETWORK_LINK_HPP_
+#define NETWORK_LINK_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Channel.hpp"
+#include "PacketFramer.hpp"
+
+/**
+ * @brief Everything a network manager keeps about one remote peer
+ *
+ * Stacks the channel layer on top of the framing layer:
+ * send() -> channel header -> outbox, flush() -> resends + ack -> datagrams,
+ * onDatagram() -> reassembly -> channel ordering -> application payloads.
+ * Not thread-safe: callers serialize access.
+ */
+class NetworkLink
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  NetworkLink();
+
+  /**
+   * @brief Queue an application message for the next flush
+   * @return false if the message is too large
+   */
+  bool send(std::span<const std::byte> payload, Channel channel, Clock::time_point now);
+
+  /**
+   * @brief Build the datagrams to put on the wire (traffic, resends, ack)
+   */
+  std::vector<std::vector<std::byte>> flush(Clock::time_point now);
+
+  /**
+   * @brief Process a datagram received from the peer
+   * @param datagram Raw datagram bytes
+   * @param now Reception time
+   * @param delivered Application payloads are appended here
+   * @return false if (part of) the datagram was malformed
+   */
+  bool onDatagram(std::span<const std::byte> datagram, Clock::time_point now,
+                  std::vector<std::vector<std::byte>> &delivered);
+
+  /** @brief Whether a flush would emit something. */
+  [[nodiscard]] bool hasPending() const;
+
+  /** @brief Access the channel state (RTT, resend counters). */
+  [[nodiscard]] const ChannelEndpoint &getChannels() const { return m_channels; }
+
+private:
+  PacketFramer m_outbox;
+  PacketReassembler m_inbox;
+  ChannelEndpoint m_channels;
+};
+
+#endif // NETWORK_LINK_HPP_
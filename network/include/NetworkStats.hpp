@@ -0,0 +1,169 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** NetworkStats.hpp - Traffic counters and connection statistics
+*/
+
+#ifndef NETWORK_STATS_HPP_
+#define NETWORK_STATS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <span>
+#include <vector>
+
+#include "IPacketHandler.hpp"
+
+class ChannelEndpoint;
+
+/** @brief Cumulative traffic of one peer, or of a whole manager */
+struct TrafficStats {
+  std::uint64_t packetsIn = 0; // Datagrams received
+  std::uint64_t bytesIn = 0;
+  std::uint64_t packetsOut = 0; // Datagrams whose send completed
+  std::uint64_t bytesOut = 0;
+  std::uint64_t sendErrors = 0;
+  std::uint64_t sendQueueDepth = 0; // Datagrams handed to the socket, not completed yet
+};
+
+/** @brief Statistics of one connection, as seen by the local side */
+struct ConnectionStats {
+  std::uint32_t clientId = 0; // 0 on a client: the server
+  TrafficStats traffic;
+  std::size_t unackedReliable = 0; // Reliable messages waiting for an ack
+  float rttMs = -1.0f; // PING/PONG round trip, else the channel's smoothed RTT, -1 if unknown
+  float lossIn = 0.0f; // Estimated share of the peer's unreliable messages that never arrived
+  float lossOut = 0.0f; // Reliable retransmissions per reliable message sent
+};
+
+/** @brief Everything a network manager counts */
+struct NetworkStats {
+  TrafficStats traffic; // All peers, handshake traffic included
+  std::size_t incomingQueueDepth = 0; // Messages received, not polled yet
+  std::uint64_t droppedIn = 0; // Datagrams refused by the handshake gate (unauthenticated, bad cookie, malformed)
+  std::vector<ConnectionStats> connections;
+};
+
+/**
+ * @brief Lock-free traffic counters
+ *
+ * Updated from the network threads (receive handlers, send completions)
+ * with relaxed atomics; load() may run concurrently from any thread.
+ */
+class TrafficCounters
+{
+public:
+  void onReceived(std::size_t bytes)
+  {
+    m_packetsIn.fetch_add(1, std::memory_order_relaxed);
+    m_bytesIn.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  void onSendQueued() { m_sendQueueDepth.fetch_add(1, std::memory_order_relaxed); }
+
+  void onSendCompleted(std::size_t bytes, bool success)
+  {
+    m_sendQueueDepth.fetch_sub(1, std::memory_order_relaxed);
+    if (!success) {
+      m_sendErrors.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    m_packetsOut.fetch_add(1, std::memory_order_relaxed);
+    m_bytesOut.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] TrafficStats load() const;
+
+private:
+  std::atomic<std::uint64_t> m_packetsIn{0};
+  std::atomic<std::uint64_t> m_bytesIn{0};
+  std::atomic<std::uint64_t> m_packetsOut{0};
+  std::atomic<std::uint64_t> m_bytesOut{0};
+  std::atomic<std::uint64_t> m_sendErrors{0};
+  std::atomic<std::uint64_t> m_sendQueueDepth{0};
+};
+
+/**
+ * @brief Counters of one admitted client, shared with in-flight sends
+ *
+ * Besides its traffic it times the server's PING: the game thread marks the
+ * send in flush(), the network thread that receives the PONG stores the
+ * round trip.
+ */
+class ClientCounters
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  TrafficCounters traffic;
+
+  /** @brief Whether a PING should go out now (none in flight, or the last one was lost). */
+  [[nodiscard]] bool isPingDue(Clock::time_point now) const;
+  void onPingSent(Clock::time_point now);
+  void onPong(Clock::time_point now);
+  /** @brief Last PING/PONG round trip in ms, -1 before the first PONG. */
+  [[nodiscard]] float getRttMs() const;
+
+private:
+  std::atomic<std::int64_t> m_pingSentNs{0}; // 0: no PING in flight
+  std::atomic<std::int64_t> m_lastPingNs{0};
+  std::atomic<std::int64_t> m_rttUs{-1};
+};
+
+/**
+ * @brief The serialized PING and PONG keepalive messages
+ *
+ * Serializing a fixed string always gives the same bytes, so the network
+ * threads recognise them with a compare instead of a deserialization.
+ */
+struct KeepaliveMessages {
+  explicit KeepaliveMessages(const IPacketHandler &handler);
+
+  [[nodiscard]] bool isPing(std::span<const std::byte> payload) const { return matches(payload, ping); }
+  [[nodiscard]] bool isPong(std::span<const std::byte> payload) const { return matches(payload, pong); }
+  static bool matches(std::span<const std::byte> payload, const std::vector<std::byte> &message);
+
+  std::vector<std::byte> ping;
+  std::vector<std::byte> pong;
+};
+
+/**
+ * @brief Per-second rates from the cumulative counters
+ *
+ * Backs getPacketsPerSecond() and the bandwidth getters: the rates are
+ * recomputed once per NetworkConfig::STATS_RATE_WINDOW_MS, in between the
+ * last ones are returned. Thread-safe.
+ */
+class TrafficRateMeter
+{
+public:
+  struct Rates {
+    int packetsInPerSecond = 0;
+    int packetsOutPerSecond = 0;
+    int bytesInPerSecond = 0;
+    int bytesOutPerSecond = 0;
+  };
+
+  Rates update(const TrafficStats &totals, std::chrono::steady_clock::time_point now) const;
+
+private:
+  mutable std::mutex m_mutex;
+  mutable bool m_hasSample = false;
+  mutable TrafficStats m_lastTotals;
+  mutable std::chrono::steady_clock::time_point m_lastTime;
+  mutable Rates m_rates;
+};
+
+/** @brief Fill the channel-derived fields (unacked, loss, fallback RTT) of a connection. */
+void fillChannelStats(ConnectionStats &stats, const ChannelEndpoint &channels);
+
+/** @brief Machine-readable forms, used by the periodic stats line. */
+nlohmann::json toJson(const TrafficStats &stats);
+nlohmann::json toJson(const ConnectionStats &stats);
+
+#endif // NETWORK_STATS_HPP_
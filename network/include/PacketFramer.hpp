@@ -0,0 +1,132 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** PacketFramer.hpp - MTU-aware datagram aggregation and fragmentation
+*/
+
+#ifndef PACKET_FRAMER_HPP_
+#define PACKET_FRAMER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Wire format of framed datagrams
+ *
+ * Every datagram starts with a 2-byte header: FRAME_MAGIC then the kind.
+ * - BUNDLE:   [magic][kind] then N x ([u16 length][payload])
+ * - FRAGMENT: [magic][kind][u16 messageId][u8 index][u8 count][chunk]
+ * Integers are big-endian.
+ */
+namespace Framing
+{
+constexpr std::uint8_t FRAME_MAGIC = 0xA7;
+constexpr std::uint8_t KIND_BUNDLE = 0x01;
+constexpr std::uint8_t KIND_FRAGMENT = 0x02;
+constexpr std::size_t HEADER_SIZE = 2;
+constexpr std::size_t LENGTH_PREFIX_SIZE = 2;
+constexpr std::size_t FRAGMENT_HEADER_SIZE = HEADER_SIZE + 4;
+constexpr std::size_t MAX_FRAGMENTS = 255;
+} // namespace Framing
+
+/**
+ * @brief Send side of the framing layer (one per destination)
+ *
+ * Messages are appended to the current bundle until it would exceed the
+ * datagram size; messages too large for a bundle are split into fragments.
+ * Not thread-safe: callers serialize access.
+ */
+class PacketFramer
+{
+public:
+  explicit PacketFramer(std::size_t maxDatagramSize);
+
+  /**
+   * @brief Queue a message for the next flush
+   * @param message Serialized message (empty messages are ignored)
+   * @return false if the message is too large to be fragmented
+   */
+  bool enqueue(std::span<const std::byte> message);
+
+  /**
+   * @brief Close the current bundle and hand out every ready datagram
+   * @return Datagrams to put on the wire, in order
+   */
+  std::vector<std::vector<std::byte>> flush();
+
+  /** @brief Whether some data waits for a flush. */
+  [[nodiscard]] bool hasPending() const;
+
+  /** @brief Largest message accepted by enqueue(). */
+  [[nodiscard]] std::size_t getMaxMessageSize() const;
+
+private:
+  void closeBundle();
+  void fragment(std::span<const std::byte> message);
+
+  std::size_t m_maxDatagramSize;
+  std::vector<std::byte> m_bundle;
+  std::vector<std::vector<std::byte>> m_ready;
+  std::uint16_t m_nextMessageId = 0;
+};
+
+/**
+ * @brief Receive side of the framing layer (one per source)
+ *
+ * Unpacks bundles and reassembles fragmented messages. Incomplete messages
+ * are dropped after a timeout, and at most a bounded number are kept.
+ * Not thread-safe: callers serialize access.
+ */
+class PacketReassembler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  PacketReassembler(std::chrono::milliseconds timeout, std::size_t maxPendingMessages);
+
+  /**
+   * @brief Process one received datagram
+   * @param datagram Raw datagram bytes
+   * @param now Reception time
+   * @param out Complete messages are appended here
+   * @return false if the datagram is malformed (it is then ignored)
+   */
+  bool onDatagram(std::span<const std::byte> datagram, Clock::time_point now,
+                  std::vector<std::vector<std::byte>> &out);
+
+  /**
+   * @brief Drop incomplete messages older than the timeout
+   * @param now Current time
+   * @return Number of messages dropped
+   */
+  std::size_t purgeExpired(Clock::time_point now);
+
+  /** @brief Number of messages waiting for missing fragments. */
+  [[nodiscard]] std::size_t getPendingCount() const;
+
+private:
+  struct PartialMessage {
+    std::uint8_t count = 0;
+    std::uint8_t received = 0;
+    std::size_t totalSize = 0;
+    std::vector<std::vector<std::byte>> chunks;
+    Clock::time_point firstSeen;
+  };
+
+  bool onBundle(std::span<const std::byte> body, std::vector<std::vector<std::byte>> &out);
+  bool onFragment(std::span<const std::byte> datagram, Clock::time_point now,
+                  std::vector<std::vector<std::byte>> &out);
+
+  std::chrono::milliseconds m_timeout;
+  std::size_t m_maxPendingMessages;
+  std::unordered_map<std::uint16_t, PartialMessage> m_partials;
+  std::deque<std::uint16_t> m_recentlyCompleted; ///< Late duplicates of these are ignored
+};
+
+#endif // PACKET_FRAMER_HPP_
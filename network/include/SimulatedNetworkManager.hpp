@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** SimulatedNetworkManager.hpp - In-process network with emulated impairments
+*/
+
+#ifndef SIMULATED_NETWORK_MANAGER_HPP_
+#define SIMULATED_NETWORK_MANAGER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ANetworkManager.hpp"
+#include "NetworkConditioner.hpp"
+#include "NetworkLink.hpp"
+
+class SimulatedNetworkManager;
+
+/**
+ * @brief A server and its clients wired together in memory
+ *
+ * Datagrams produced by the managers' links go through one conditioner per
+ * client and direction, so the real framing and channel layers (acks,
+ * resends, fragment reassembly) run against the emulated loss and delay.
+ * With a manual clock, time only moves through advance() and a run is fully
+ * reproducible from the seed.
+ *
+ * Create it with std::make_shared.
+ */
+class SimulatedNetwork : public std::enable_shared_from_this<SimulatedNetwork>
+{
+public:
+  using Clock = NetworkLink::Clock;
+
+  struct Settings {
+    LinkConditions upstream; // Client -> server
+    LinkConditions downstream; // Server -> client
+    std::uint64_t seed = 1;
+    bool manualClock = false;
+  };
+
+  explicit SimulatedNetwork(const Settings &settings);
+
+  /** @brief The server side (one per network). */
+  std::shared_ptr<SimulatedNetworkManager> createServer();
+
+  /** @brief A new client; it is admitted once started and the server polls. */
+  std::shared_ptr<SimulatedNetworkManager> createClient();
+
+  [[nodiscard]] Clock::time_point now() const;
+
+  /** @brief Move the manual clock forward (no-op on the real clock). */
+  void advance(Clock::duration duration);
+
+  [[nodiscard]] ConditionerStats getUpstreamStats() const;
+  [[nodiscard]] ConditionerStats getDownstreamStats() const;
+
+private:
+  friend class SimulatedNetworkManager;
+
+  struct Path {
+    Path(const Settings &settings, std::uint64_t seed);
+
+    NetworkConditioner upstream;
+    NetworkConditioner downstream;
+  };
+
+  void connect(std::uint32_t clientId);
+  std::vector<std::uint32_t> takeConnections();
+  void transmit(std::uint32_t clientId, bool toServer, std::vector<std::vector<std::byte>> &datagrams);
+  /** @brief Datagrams due for the server (client id, bytes) or for one client. */
+  std::vector<std::pair<std::uint32_t, std::vector<std::byte>>> deliverToServer();
+  std::vector<std::vector<std::byte>> deliverToClient(std::uint32_t clientId);
+
+  Settings m_settings;
+  mutable std::mutex m_mutex;
+  Clock::time_point m_manualNow;
+  std::uint32_t m_nextClientId{0};
+  bool m_hasServer{false};
+  std::unordered_map<std::uint32_t, Path> m_paths;
+  std::vector<std::uint32_t> m_pendingConnections;
+};
+
+/**
+ * @brief INetworkManager endpoint of a SimulatedNetwork
+ *
+ * Behaves like AsioServer or AsioClient without sockets or threads: the
+ * server sends assign_id to each new client, flush() hands datagrams to the
+ * network and poll() takes the due ones. A client has no flush timer, so
+ * its poll() also sends pending acks and resends, like the timer would.
+ */
+class SimulatedNetworkManager : public ANetworkManager
+{
+public:
+  enum class Role : std::uint8_t { SERVER, CLIENT };
+
+  SimulatedNetworkManager(std::shared_ptr<SimulatedNetwork> network, Role role, std::uint32_t clientId);
+
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId) override;
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel) override;
+  void flush() override;
+  void start() override;
+  void stop() override;
+  bool poll(NetworkPacket &msg) override;
+  [[nodiscard]] std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> getClients() const override;
+  void disconnect(std::uint32_t clientId) override;
+  float getLatency() const override;
+  bool isConnected() const override;
+  int getPacketsPerSecond() const override { return 0; }
+  int getUploadBytesPerSecond() const override { return 0; }
+  int getDownloadBytesPerSecond() const override { return 0; }
+  /** @brief Channel state only: nothing crosses a socket, so the traffic stays zero. */
+  [[nodiscard]] NetworkStats getNetworkStats() const override;
+
+  [[nodiscard]] Role getRole() const { return m_role; }
+  /** @brief Client side: the id the server will assign. */
+  [[nodiscard]] std::uint32_t getClientId() const { return m_clientId; }
+
+private:
+  void admitPending();
+  void receiveDue();
+  void flushLinks(SimulatedNetwork::Clock::time_point now);
+
+  std::shared_ptr<SimulatedNetwork> m_network;
+  Role m_role;
+  std::uint32_t m_clientId;
+  bool m_started{false};
+
+  mutable std::mutex m_mutex;
+  // Server: one link per admitted client. Client: a single link keyed by its id.
+  std::unordered_map<std::uint32_t, NetworkLink> m_links;
+  std::deque<std::pair<std::uint32_t, std::vector<std::byte>>> m_inbox;
+};
+
+#endif // SIMULATED_NETWORK_MANAGER_HPP_
@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** UringServer.hpp - UDP server using Linux io_uring
+*/
+
+#ifndef URING_SERVER_HPP_
+#define URING_SERVER_HPP_
+
+#include <asio.hpp>
+#include <asio/ip/udp.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../common/include/network/NetworkPacket.hpp"
+#include "../../common/include/network/SafeQueue.hpp"
+#include "ANetworkManager.hpp"
+#include "Handshake.hpp"
+#include "NetworkLink.hpp"
+#include "NetworkStats.hpp"
+
+/**
+ * @brief UDP server driven by io_uring (Linux only)
+ *
+ * Drop-in alternative to AsioServer speaking the same wire protocol:
+ * - a single multishot recvmsg stays armed on the socket and the kernel
+ *   picks receive buffers from a registered provided-buffer ring, so no
+ *   allocation or re-arm happens per datagram;
+ * - flush() turns every pending datagram into a sendmsg SQE and submits
+ *   them with one io_uring_enter call.
+ * Completions are reaped by one network thread, which also runs the cookie
+ * handshake and drops traffic from endpoints it has not admitted, and
+ * charges send completions to the traffic counters.
+ * Use isSupported() before
+ * constructing it and fall back to AsioServer otherwise.
+ */
+class UringServer : public ANetworkManager
+{
+public:
+  /**
+   * @brief Construct the server and bind the socket
+   *
+   * @param port The port to listen on
+   * @throws std::system_error if io_uring cannot be set up
+   */
+  explicit UringServer(std::uint16_t port);
+  ~UringServer();
+
+  UringServer(const UringServer &) = delete;
+  UringServer &operator=(const UringServer &) = delete;
+
+  /**
+   * @brief Whether the running kernel provides everything this backend uses
+   * (multishot recvmsg, provided buffer rings, sendmsg)
+   */
+  [[nodiscard]] static bool isSupported();
+
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId) override;
+  void send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel) override;
+  void flush() override;
+  void start() override;
+  void stop() override;
+  bool poll(NetworkPacket &msg) override;
+  [[nodiscard]] std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> getClients() const override;
+  void disconnect(std::uint32_t clientId) override;
+  float getLatency() const override; // Mean RTT over the clients
+  bool isConnected() const override { return true; } // Server is always "connected"
+  int getPacketsPerSecond() const override;
+  int getUploadBytesPerSecond() const override;
+  int getDownloadBytesPerSecond() const override;
+  [[nodiscard]] NetworkStats getNetworkStats() const override;
+  [[nodiscard]] std::size_t getConnectedPlayersCount() const;
+  [[nodiscard]] HandshakeStats getHandshakeStats() const { return m_gate.getStats(); }
+
+private:
+  struct Ring; // io_uring mappings and send slots, see UringServer.cpp
+
+  /** @brief Datagrams ready for one endpoint, and whom to charge for them */
+  struct PendingSend {
+    asio::ip::udp::endpoint endpoint;
+    std::vector<std::vector<std::byte>> datagrams;
+    std::shared_ptr<ClientCounters> counters;
+  };
+
+  void run();
+  void armReceive();
+  void onDatagram(const asio::ip::udp::endpoint &sender, std::span<const std::byte> datagram);
+  void handleHandshake(const asio::ip::udp::endpoint &sender, std::span<const std::byte> datagram);
+  void admitClient(const asio::ip::udp::endpoint &endpoint);
+  [[nodiscard]] std::optional<std::uint32_t> findClientId(const asio::ip::udp::endpoint &endpoint) const;
+  std::pair<std::uint32_t, bool> getOrCreateClientId(const asio::ip::udp::endpoint &endpoint);
+  void flushClient(std::uint32_t clientId);
+  void submitSends(std::vector<PendingSend> &pending);
+
+  int m_socket{-1};
+  std::unique_ptr<Ring> m_ring;
+  std::thread m_thread;
+  std::atomic<bool> m_running{false};
+  SafeQueue<NetworkPacket> m_incomingMessages;
+
+  mutable std::mutex m_clientsMutex;
+  std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> m_clients;
+  std::unordered_map<asio::ip::udp::endpoint, std::uint32_t, EndpointHash> m_endpointIds;
+  std::uint32_t m_nextClientId{0};
+  std::size_t m_connectedPlayersCount{0};
+  ConnectionGate m_gate;
+
+  mutable std::mutex m_linksMutex;
+  std::unordered_map<std::uint32_t, NetworkLink> m_links;
+  std::unordered_map<std::uint32_t, std::shared_ptr<ClientCounters>> m_counters;
+
+  KeepaliveMessages m_keepalive;
+  TrafficCounters m_traffic; // Every datagram, handshakes and unknown senders included
+  TrafficRateMeter m_rates;
+};
+
+#endif // URING_SERVER_HPP_
@@ -7,8 +7,10 @@
 
 #include "../include/AsioClient.hpp"
 #include "../include/CapnpHandler.hpp"
+#include "../include/NetworkConfig.hpp"
 #include "ANetworkManager.hpp"
 #include "Common.hpp"
+#include "Handshake.hpp"
 #include "network/NetworkPacket.hpp"
 #include <array>
 #include <asio/bind_executor.hpp>
@@ -16,6 +18,8 @@
 #include <asio/error.hpp>
 #include <asio/executor_work_guard.hpp>
 #include <asio/ip/udp.hpp>
+#include <asio/post.hpp>
+#include <asio/steady_timer.hpp>
 #include <asio/strand.hpp>
 #include <chrono>
 #include <cstddef>
@@ -23,16 +27,19 @@
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <span>
 #include <string>
 #include <system_error>
 #include <thread>
+#include <utility>
+#include <vector>
 
 AsioClient::AsioClient(const std::string &host, const std::string &port)
     : ANetworkManager(std::make_shared<CapnpHandler>()), m_strand(asio::make_strand(m_ioContext)),
-      m_socket(m_ioContext), m_workGuard(asio::make_work_guard(m_ioContext)),
-      m_statsResetTime(std::chrono::steady_clock::now())
+      m_socket(m_ioContext), m_workGuard(asio::make_work_guard(m_ioContext)), m_linkFlushTimer(m_ioContext),
+      m_keepalive(*getPacketHandler())
 {
   try {
     asio::ip::udp::resolver resolver(m_ioContext);
@@ -55,6 +62,8 @@ AsioClient::~AsioClient()
 void AsioClient::start()
 {
   receive();
+  asio::post(m_strand, [this]() { sendHandshake(); });
+  scheduleLinkFlush();
   m_recvThread = std::thread([this]() { m_ioContext.run(); });
 }
 
@@ -67,18 +76,83 @@ void AsioClient::stop()
   }
 }
 
-void AsioClient::send(std::span<const std::byte> data, UNUSED const std::uint32_t &targetEndpointId)
+void AsioClient::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId)
 {
-  m_uploadByteCount += data.size();
-  m_packetCount++;
+  send(data, targetEndpointId, Channel::RELIABLE_ORDERED);
+}
+
+void AsioClient::send(std::span<const std::byte> data, UNUSED const std::uint32_t &targetEndpointId, Channel channel)
+{
+  // The client talks to a single endpoint at a low rate (inputs, pings):
+  // each message is framed and put on the wire right away.
+  {
+    std::lock_guard<std::mutex> lock(m_linkMutex);
+    if (!m_link.send(data, channel, NetworkLink::Clock::now())) {
+      std::cerr << "[Client] Message too large (" << data.size() << " bytes)" << std::endl;
+      return;
+    }
+  }
+  flush();
+}
+
+void AsioClient::flush()
+{
+  // The server drops everything from us until the handshake completes
+  if (!m_admitted) {
+    return;
+  }
+  std::vector<std::vector<std::byte>> datagrams;
+  {
+    std::lock_guard<std::mutex> lock(m_linkMutex);
+    if (!m_link.hasPending()) {
+      return;
+    }
+    datagrams = m_link.flush(NetworkLink::Clock::now());
+  }
+  for (auto &datagram : datagrams) {
+    sendDatagram(std::make_shared<std::vector<std::byte>>(std::move(datagram)));
+  }
+}
+
+void AsioClient::scheduleLinkFlush()
+{
+  m_linkFlushTimer.expires_after(std::chrono::milliseconds(NetworkConfig::CLIENT_LINK_FLUSH_INTERVAL_MS));
+  m_linkFlushTimer.async_wait(asio::bind_executor(m_strand, [this](const std::error_code &error) {
+    if (error) {
+      return;
+    }
+    if (!m_admitted && std::chrono::steady_clock::now() - m_lastHandshakeTime >=
+                         std::chrono::milliseconds(NetworkConfig::HANDSHAKE_RETRY_MS)) {
+      sendHandshake();
+    }
+    flush();
+    scheduleLinkFlush();
+  }));
+}
+
+void AsioClient::sendHandshake()
+{
+  const auto now = std::chrono::steady_clock::now();
+  // Ask for a fresh cookie well before the server would reject this one
+  if (m_cookie && now - m_cookieReceivedTime >=
+                    std::chrono::milliseconds(NetworkConfig::HANDSHAKE_COOKIE_LIFETIME_MS / 2)) {
+    m_cookie.reset();
+  }
+  m_lastHandshakeTime = now;
+  sendDatagram(std::make_shared<std::vector<std::byte>>(m_cookie ? Handshake::makeResponse(*m_cookie)
+                                                                 : Handshake::makeConnect()));
+}
+
+void AsioClient::sendDatagram(std::shared_ptr<std::vector<std::byte>> datagram)
+{
+  m_traffic.onSendQueued();
   m_socket.async_send_to(
-    asio::buffer(data.data(), data.size()), m_serverEndpoint,
-    asio::bind_executor(m_strand, [](const std::error_code &error, UNUSED std::size_t bytesTransferred) {
+    asio::buffer(datagram->data(), datagram->size()), m_serverEndpoint,
+    asio::bind_executor(m_strand, [this, datagram](const std::error_code &error, std::size_t bytesTransferred) {
       if (error) {
         std::cerr << "[Client] Send error: " << error.message() << std::endl;
-      } else {
-        // std::cout << "[Client] Sent " << bytesTransferred << " bytes" << std::endl;
       }
+      m_traffic.onSendCompleted(bytesTransferred, !error);
     }));
 }
 
@@ -95,20 +169,57 @@ void AsioClient::receive()
           receive();
         }
         if (!error && bytesTransferred > 0) {
-          // Track download stats
-          m_downloadByteCount += bytesTransferred;
-          m_packetCount++; // Assuming each receive is a packet
+          m_traffic.onReceived(bytesTransferred);
+
+          const std::span<const std::byte> datagram(reinterpret_cast<const std::byte *>(buffer->data()),
+                                                    bytesTransferred);
+          if (Handshake::isHandshake(datagram)) {
+            auto cookie = Handshake::parseChallenge(datagram);
+            if (cookie && !m_admitted) {
+              m_cookie = *cookie;
+              m_cookieReceivedTime = std::chrono::steady_clock::now();
+              sendHandshake();
+            }
+            return;
+          }
 
           try {
-            NetworkPacket message(*buffer, 0, bytesTransferred);
-            m_incomingMessages.push(message);
-
-            // Check for pong response
-            auto deserialized = getPacketHandler()->deserialize(*buffer, bytesTransferred);
-            if (deserialized && *deserialized == "PONG" && m_pingPending) {
-              auto now = std::chrono::steady_clock::now();
-              m_latency = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_pingStartTime).count();
-              m_pingPending = false;
+            std::vector<std::vector<std::byte>> messages;
+            bool wellFormed = false;
+            {
+              std::lock_guard<std::mutex> lock(m_linkMutex);
+              wellFormed = m_link.onDatagram(datagram, NetworkLink::Clock::now(), messages);
+              if (!wellFormed) {
+                std::cerr << "[Client] Dropped malformed datagram" << std::endl;
+              }
+            }
+
+            // The server only frames traffic to admitted clients
+            if (wellFormed && !m_admitted && *senderEndpoint == m_serverEndpoint) {
+              m_admitted = true;
+              m_cookie.reset();
+              flush();
+            }
+
+            for (const auto &payload : messages) {
+              if (m_keepalive.isPing(payload)) {
+                // The server times this round trip, the game never sees it
+                send(m_keepalive.pong, 0, Channel::UNRELIABLE_SEQUENCED);
+                continue;
+              }
+              NetworkPacket message(payload, 0);
+              m_incomingMessages.push(message);
+
+              // Check for pong response
+              if (!m_pingPending) {
+                continue;
+              }
+              auto deserialized = getPacketHandler()->deserialize(message.getPayload());
+              if (deserialized && *deserialized == "PONG") {
+                auto pongTime = std::chrono::steady_clock::now();
+                m_latency = std::chrono::duration_cast<std::chrono::milliseconds>(pongTime - m_pingStartTime).count();
+                m_pingPending = false;
+              }
             }
           } catch (const std::exception &e) {
             std::cerr << "[Client] Deserialization error: " << e.what() << std::endl;
@@ -142,32 +253,34 @@ bool AsioClient::isConnected() const
 
 int AsioClient::getPacketsPerSecond() const
 {
-  auto now = std::chrono::steady_clock::now();
-  auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - m_statsResetTime).count();
-  if (elapsed >= 1) {
-    m_packetsPerSecond = m_packetCount / elapsed;
-    m_uploadBytesPerSecond = m_uploadByteCount / elapsed;
-    m_downloadBytesPerSecond = m_downloadByteCount / elapsed;
-    m_packetCount = 0;
-    m_uploadByteCount = 0;
-    m_downloadByteCount = 0;
-    m_statsResetTime = now;
-  }
-  return m_packetsPerSecond;
+  const auto rates = m_rates.update(m_traffic.load(), std::chrono::steady_clock::now());
+  return rates.packetsInPerSecond + rates.packetsOutPerSecond;
 }
 
 int AsioClient::getUploadBytesPerSecond() const
 {
-  // Already updated in getPacketsPerSecond
-  getPacketsPerSecond();
-  return m_uploadBytesPerSecond;
+  return m_rates.update(m_traffic.load(), std::chrono::steady_clock::now()).bytesOutPerSecond;
 }
 
 int AsioClient::getDownloadBytesPerSecond() const
 {
-  // Already updated in getPacketsPerSecond
-  getPacketsPerSecond();
-  return m_downloadBytesPerSecond;
+  return m_rates.update(m_traffic.load(), std::chrono::steady_clock::now()).bytesInPerSecond;
+}
+
+NetworkStats AsioClient::getNetworkStats() const
+{
+  NetworkStats stats;
+  stats.traffic = m_traffic.load();
+  stats.incomingQueueDepth = m_incomingMessages.size();
+  ConnectionStats server;
+  server.traffic = stats.traffic;
+  server.rttMs = m_latency;
+  {
+    std::lock_guard<std::mutex> lock(m_linkMutex);
+    fillChannelStats(server, m_link.getChannels());
+  }
+  stats.connections.push_back(server);
+  return stats;
 }
 
 void AsioClient::sendPing()
@@ -176,6 +289,7 @@ void AsioClient::sendPing()
     m_pingStartTime = std::chrono::steady_clock::now();
     m_pingPending = true;
     auto serialized = getPacketHandler()->serialize("PING");
-    send(std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()), 0);
+    send(std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()), 0,
+         Channel::UNRELIABLE_SEQUENCED);
   }
 }
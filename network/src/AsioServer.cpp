@@ -7,26 +7,68 @@
 
 #include "../include/AsioServer.hpp"
 #include "../../engineCore/include/ecs/EngineComponents.hpp"
+#include "../../engineCore/include/utils/Log.hpp"
+#include "../../engineCore/include/utils/Trace.hpp"
 #include "../include/CapnpHandler.hpp"
 #include "../include/NetworkConfig.hpp"
 #include "ANetworkManager.hpp"
 #include "Common.hpp"
+#include "Handshake.hpp"
 #include "network/NetworkPacket.hpp"
+#include "NetworkLink.hpp"
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <iostream>
+#include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <span>
 #include <system_error>
 
-AsioServer::AsioServer(std::uint16_t port)
-    : ANetworkManager(std::make_shared<CapnpHandler>()), m_strand(asio::make_strand(m_ioContext)),
-      m_socket(m_ioContext, asio::ip::udp::endpoint(asio::ip::udp::v4(), port)), m_nextClientId(0),
-      m_workGuard(asio::make_work_guard(m_ioContext))
+namespace
 {
+#if defined(SO_REUSEPORT)
+using ReusePortOption = asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+constexpr bool REUSE_PORT_SUPPORTED = true;
+#else
+constexpr bool REUSE_PORT_SUPPORTED = false;
+#endif
+} // namespace
+
+AsioServer::Shard::Shard(std::size_t shardIndex, std::uint16_t port, bool reusePort)
+    : index(shardIndex), socket(ioContext), workGuard(asio::make_work_guard(ioContext))
+{
+  const asio::ip::udp::endpoint endpoint(asio::ip::udp::v4(), port);
+  socket.open(endpoint.protocol());
+#if defined(SO_REUSEPORT)
+  // Must be set on every socket before bind for the kernel to balance them
+  if (reusePort) {
+    socket.set_option(ReusePortOption(true));
+  }
+#else
+  (void)reusePort;
+#endif
   asio::socket_base::receive_buffer_size option(NetworkConfig::RECEIVE_BUFFER_SIZE_KB *
                                                 NetworkConfig::RECEIVE_BUFFER_SIZE_KB *
                                                 NetworkConfig::RECEIVE_BUFFER_MULTIPLIER);
-  m_socket.set_option(option);
+  socket.set_option(option);
+  socket.bind(endpoint);
+}
+
+AsioServer::AsioServer(std::uint16_t port, std::size_t shardCount)
+    : ANetworkManager(std::make_shared<CapnpHandler>()), m_nextClientId(0), m_keepalive(*getPacketHandler())
+{
+  shardCount = std::clamp<std::size_t>(shardCount, 1, NetworkConfig::MAX_RECEIVE_SHARDS);
+  if (shardCount > 1 && !REUSE_PORT_SUPPORTED) {
+    std::cerr << "[Server] SO_REUSEPORT unavailable, using a single receive shard" << '\n';
+    shardCount = 1;
+  }
+  for (std::size_t i = 0; i < shardCount; ++i) {
+    m_shards.push_back(std::make_unique<Shard>(i, port, shardCount > 1));
+  }
+  std::cout << "[Server] Listening on port " << port << " with " << shardCount << " receive shard(s)" << '\n';
 }
 
 AsioServer::~AsioServer()
@@ -36,21 +78,24 @@ AsioServer::~AsioServer()
 
 void AsioServer::start()
 {
-  std::size_t nbOfThreads = std::thread::hardware_concurrency();
-  receive();
-
-  for (std::size_t i = 0; i < nbOfThreads; ++i) {
-    m_threadPool.emplace_back([this]() { m_ioContext.run(); });
+  for (auto &shard : m_shards) {
+    receive(*shard);
+    shard->thread = std::thread([&ioContext = shard->ioContext]() {
+      RTYPE_TRACE_THREAD("net-receive");
+      ioContext.run();
+    });
   }
 }
 
 void AsioServer::stop()
 {
-  m_ioContext.stop();
-  m_workGuard.reset();
-  for (auto &thread : m_threadPool) {
-    if (thread.joinable()) {
-      thread.join();
+  for (auto &shard : m_shards) {
+    shard->ioContext.stop();
+    shard->workGuard.reset();
+  }
+  for (auto &shard : m_shards) {
+    if (shard->thread.joinable()) {
+      shard->thread.join();
     }
   }
 }
@@ -63,113 +108,389 @@ void AsioServer::setWorld(const std::shared_ptr<ecs::World> &world)
 
 std::size_t AsioServer::getConnectedPlayersCount() const
 {
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
   return m_connectedPlayersCount;
 }
 
-std::pair<std::uint32_t, bool> AsioServer::getOrCreateClientId(const asio::ip::udp::endpoint &endpoint)
+std::pair<std::uint32_t, bool> AsioServer::getOrCreateClientId(const asio::ip::udp::endpoint &endpoint,
+                                                               std::size_t shardIndex)
 {
-  for (const auto &[id, ep] : m_clients) {
-    if (ep == endpoint) {
-      return {id, false};
-    }
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
+  auto it = m_endpointIds.find(endpoint);
+  if (it != m_endpointIds.end()) {
+    return {it->second, false};
   }
   std::uint32_t clientId = m_nextClientId++;
   m_clients[clientId] = endpoint;
-  std::cout << "[Server] New client connected: " << clientId << '\n';
+  m_clientShards[clientId] = shardIndex;
+  m_endpointIds[endpoint] = clientId;
+  ++m_connectedPlayersCount;
+  {
+    // Published to the owning shard before any other thread can learn the id
+    Shard &shard = *m_shards[shardIndex];
+    std::lock_guard<std::mutex> shardLock(shard.linksMutex);
+    shard.clients[clientId] = endpoint;
+    shard.endpointIds[endpoint] = clientId;
+    shard.counters[clientId] = std::make_shared<ClientCounters>();
+  }
+  RTYPE_LOG_INFO("[Server] New client connected: " << clientId);
   return {clientId, true};
 }
 
+std::optional<std::pair<std::uint32_t, AsioServer::Shard *>>
+AsioServer::findClient(const asio::ip::udp::endpoint &endpoint, Shard &first) const
+{
+  // The receiving shard owns the flow unless the kernel rebalanced it, so
+  // the others are only searched on a miss
+  auto lookup = [&endpoint](Shard &shard) -> std::optional<std::pair<std::uint32_t, Shard *>> {
+    std::lock_guard<std::mutex> lock(shard.linksMutex);
+    auto it = shard.endpointIds.find(endpoint);
+    if (it == shard.endpointIds.end()) {
+      return std::nullopt;
+    }
+    return std::make_pair(it->second, &shard);
+  };
+  if (auto found = lookup(first)) {
+    return found;
+  }
+  for (const auto &shard : m_shards) {
+    if (shard.get() != &first) {
+      if (auto found = lookup(*shard)) {
+        return found;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+AsioServer::Shard *AsioServer::findClientShard(std::uint32_t clientId) const
+{
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
+  auto it = m_clientShards.find(clientId);
+  if (it == m_clientShards.end()) {
+    return nullptr;
+  }
+  return m_shards[it->second].get();
+}
+
 void AsioServer::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId)
 {
-  auto targetEndpointIt = m_clients.find(targetEndpointId);
+  send(data, targetEndpointId, Channel::RELIABLE_ORDERED);
+}
 
-  if (targetEndpointIt == m_clients.end()) {
+void AsioServer::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel)
+{
+  Shard *shard = findClientShard(targetEndpointId);
+
+  if (shard == nullptr) {
     std::cerr << "[Server] Client ID not found: " << targetEndpointId << '\n';
     return;
   }
-  m_socket.async_send_to(
-    asio::buffer(data.data(), data.size()), targetEndpointIt->second,
-    asio::bind_executor(m_strand, [](const std::error_code &error, UNUSED std::size_t bytesTransferred) {
+
+  // Queue into the client's link; datagrams go out on flush()
+  std::lock_guard<std::mutex> lock(shard->linksMutex);
+  if (!shard->links[targetEndpointId].send(data, channel, NetworkLink::Clock::now())) {
+    std::cerr << "[Server] Message too large (" << data.size() << " bytes) for client " << targetEndpointId << '\n';
+  }
+}
+
+void AsioServer::flush()
+{
+  const auto now = NetworkLink::Clock::now();
+  std::vector<PendingSend> pending;
+
+  for (auto &shard : m_shards) {
+    pending.clear();
+    {
+      std::lock_guard<std::mutex> lock(shard->linksMutex);
+      for (auto &[clientId, link] : shard->links) {
+        auto clientIt = shard->clients.find(clientId);
+        if (clientIt == shard->clients.end()) {
+          continue;
+        }
+        std::shared_ptr<ClientCounters> counters;
+        if (auto countersIt = shard->counters.find(clientId); countersIt != shard->counters.end()) {
+          counters = countersIt->second;
+          if (counters->isPingDue(now)) {
+            link.send(m_keepalive.ping, Channel::UNRELIABLE_SEQUENCED, now);
+            counters->onPingSent(now);
+          }
+        }
+        if (!link.hasPending()) {
+          continue;
+        }
+        auto datagrams = link.flush(now);
+        if (!datagrams.empty()) {
+          pending.push_back(PendingSend{clientIt->second, std::move(datagrams), std::move(counters)});
+        }
+      }
+    }
+
+    for (auto &send : pending) {
+      for (auto &datagram : send.datagrams) {
+        sendDatagram(*shard, std::make_shared<std::vector<std::byte>>(std::move(datagram)), send.endpoint,
+                     send.counters);
+      }
+    }
+  }
+}
+
+void AsioServer::flushClient(Shard &shard, std::uint32_t clientId)
+{
+  asio::ip::udp::endpoint endpoint;
+  std::vector<std::vector<std::byte>> datagrams;
+  std::shared_ptr<ClientCounters> counters;
+  {
+    std::lock_guard<std::mutex> lock(shard.linksMutex);
+    auto clientIt = shard.clients.find(clientId);
+    auto linkIt = shard.links.find(clientId);
+    if (clientIt == shard.clients.end() || linkIt == shard.links.end()) {
+      return;
+    }
+    endpoint = clientIt->second;
+    datagrams = linkIt->second.flush(NetworkLink::Clock::now());
+    if (auto countersIt = shard.counters.find(clientId); countersIt != shard.counters.end()) {
+      counters = countersIt->second;
+    }
+  }
+  for (auto &datagram : datagrams) {
+    sendDatagram(shard, std::make_shared<std::vector<std::byte>>(std::move(datagram)), endpoint, counters);
+  }
+}
+
+void AsioServer::sendDatagram(Shard &shard, std::shared_ptr<std::vector<std::byte>> datagram,
+                              const asio::ip::udp::endpoint &endpoint, std::shared_ptr<ClientCounters> counters)
+{
+  m_traffic.onSendQueued();
+  if (counters) {
+    counters->traffic.onSendQueued();
+  }
+  // The shared buffer is kept alive by the handler until the send completes,
+  // the counters until they are charged even if the client left meanwhile
+  shard.socket.async_send_to(
+    asio::buffer(datagram->data(), datagram->size()), endpoint,
+    [this, datagram, counters = std::move(counters)](const std::error_code &error, std::size_t bytesTransferred) {
       if (error) {
         std::cerr << "[Server] Send error: " << error.message() << '\n';
-      } else {
-        // std::cout << "[Server] Sent " << bytesTransferred << " bytes to client " <<
-        // targetEndpointId << std::endl;
       }
-    }));
+      m_traffic.onSendCompleted(bytesTransferred, !error);
+      if (counters) {
+        counters->traffic.onSendCompleted(bytesTransferred, !error);
+      }
+    });
 }
 
-void AsioServer::receive()
+void AsioServer::receive(Shard &shard)
 {
-  auto buffer = std::make_shared<std::array<char, BUFFER_SIZE>>();
-  auto senderEndpoint = std::make_shared<asio::ip::udp::endpoint>();
-
-  m_socket.async_receive_from(
-    asio::buffer(*buffer), *senderEndpoint,
-    asio::bind_executor(
-      m_strand, [this, buffer, senderEndpoint](const std::error_code &error, std::size_t bytesTransferred) {
-        if (error) {
-          if (error != asio::error::operation_aborted) {
-            std::cerr << "[Server] Receive error: " << error.message() << '\n';
-            receive();
-          }
-          return;
+  shard.socket.async_receive_from(
+    asio::buffer(shard.receiveBuffer), shard.senderEndpoint,
+    [this, &shard](const std::error_code &error, std::size_t bytesTransferred) {
+      RTYPE_TRACE_SCOPE("AsioServer::receive");
+      if (error) {
+        if (error != asio::error::operation_aborted) {
+          RTYPE_LOG_EVERY(::logging::Level::WARN, 1.0, "[Server] Receive error: " << error.message());
+          receive(shard);
         }
+        return;
+      }
 
-        if (bytesTransferred == 0) {
-          receive();
-          return;
-        }
+      if (bytesTransferred == 0) {
+        receive(shard);
+        return;
+      }
 
-        auto [clientId, isNewClient] = getOrCreateClientId(*senderEndpoint);
-
-        if (isNewClient) {
-          ++m_connectedPlayersCount;
-          // Don't create player entity here - wait for lobby start
-          // Just send the client its assigned ID
-
-          // Handshake: tell the client its assigned id.
-          try {
-            nlohmann::json hello;
-            hello["type"] = "assign_id";
-            hello["client_id"] = clientId;
-            const std::string jsonStr = hello.dump();
-            const auto serialized = getPacketHandler()->serialize(jsonStr);
-            send(std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()),
-                 clientId);
-            std::cout << "[Server] New client " << clientId << " connected, assigned ID sent" << '\n';
-          } catch ([[maybe_unused]] const std::exception &e) { // NOLINT(bugprone-empty-catch)
-            // Best-effort handshake - silent failure acceptable for non-critical handshake
-          }
-        }
+      const std::span<const std::byte> datagram(reinterpret_cast<const std::byte *>(shard.receiveBuffer.data()),
+                                                bytesTransferred);
+      m_traffic.onReceived(bytesTransferred);
+      if (Handshake::isHandshake(datagram)) {
+        handleHandshake(shard, datagram);
+        receive(shard);
+        return;
+      }
+
+      const auto client = findClient(shard.senderEndpoint, shard);
+      if (!client) {
+        // Not admitted: dropped before touching any link or queue
+        m_gate.countUnauthenticated();
+        receive(shard);
+        return;
+      }
+      onClientDatagram(*client->second, client->first, datagram);
+
+      receive(shard);
+    });
+}
+
+void AsioServer::onClientDatagram(Shard &owner, std::uint32_t clientId, std::span<const std::byte> datagram)
+{
+  // Unpack bundled messages, reassemble fragments and apply channel
+  // ordering/acks on the link of the client's owning shard
+  const auto now = NetworkLink::Clock::now();
+  std::vector<std::vector<std::byte>> messages;
+  std::shared_ptr<ClientCounters> counters;
+  {
+    std::lock_guard<std::mutex> lock(owner.linksMutex);
+    if (!owner.clients.contains(clientId)) {
+      return; // Disconnected since it was looked up
+    }
+    if (auto countersIt = owner.counters.find(clientId); countersIt != owner.counters.end()) {
+      counters = countersIt->second;
+      counters->traffic.onReceived(datagram.size());
+    }
+    if (!owner.links[clientId].onDatagram(datagram, now, messages)) {
+      RTYPE_LOG_EVERY(::logging::Level::WARN, 1.0, "[Server] Dropped malformed datagram from client " << clientId);
+    }
+  }
+  for (const auto &payload : messages) {
+    // Answers to flush()'s PING stay in the network layer
+    if (counters && m_keepalive.isPong(payload)) {
+      counters->onPong(now);
+      continue;
+    }
+    owner.incomingMessages.push(NetworkPacket(payload, clientId));
+  }
+}
 
-        NetworkPacket message(*buffer, clientId, bytesTransferred);
-        m_incomingMessages.push(message);
+void AsioServer::handleHandshake(Shard &shard, std::span<const std::byte> datagram)
+{
+  // Late CONNECT/RESPONSE retries from an admitted client: its assign_id is
+  // already on the reliable channel
+  if (findClient(shard.senderEndpoint, shard)) {
+    return;
+  }
 
-        receive();
-      }));
+  std::vector<std::byte> reply;
+  switch (m_gate.onHandshake(datagram, shard.senderEndpoint, NetworkLink::Clock::now(), reply)) {
+    case ConnectionGate::Verdict::CHALLENGE:
+      sendDatagram(shard, std::make_shared<std::vector<std::byte>>(std::move(reply)), shard.senderEndpoint, nullptr);
+      break;
+    case ConnectionGate::Verdict::ACCEPT:
+      admitClient(shard.senderEndpoint, shard.index);
+      break;
+    case ConnectionGate::Verdict::DROP:
+      break;
+  }
+}
+
+void AsioServer::admitClient(const asio::ip::udp::endpoint &endpoint, std::size_t shardIndex)
+{
+  auto [clientId, isNewClient] = getOrCreateClientId(endpoint, shardIndex);
+  if (!isNewClient) {
+    return;
+  }
+
+  // Don't create player entity here - wait for lobby start
+  // Just send the client its assigned ID
+  try {
+    nlohmann::json hello;
+    hello["type"] = "assign_id";
+    hello["client_id"] = clientId;
+    const std::string jsonStr = hello.dump();
+    const auto serialized = getPacketHandler()->serialize(jsonStr);
+    send(std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()),
+         clientId);
+    flushClient(*m_shards[shardIndex], clientId);
+    RTYPE_LOG_INFO("[Server] New client " << clientId << " connected, assigned ID sent");
+  } catch ([[maybe_unused]] const std::exception &e) { // NOLINT(bugprone-empty-catch)
+    // Best-effort handshake - silent failure acceptable for non-critical handshake
+  }
 }
 
 bool AsioServer::poll(NetworkPacket &msg)
 {
-  return m_incomingMessages.pop(msg);
+  // Round-robin so one busy shard cannot starve the others
+  for (std::size_t i = 0; i < m_shards.size(); ++i) {
+    auto &shard = *m_shards[(m_pollCursor + i) % m_shards.size()];
+    if (shard.incomingMessages.pop(msg)) {
+      m_pollCursor = (m_pollCursor + i + 1) % m_shards.size();
+      return true;
+    }
+  }
+  return false;
 }
 
 std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> AsioServer::getClients() const
 {
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
   return m_clients;
 }
 
 void AsioServer::disconnect(std::uint32_t clientId)
 {
-  auto it = m_clients.find(clientId);
-  if (it != m_clients.end()) {
+  {
+    std::lock_guard<std::mutex> lock(m_clientsMutex);
+    auto it = m_clients.find(clientId);
+    if (it == m_clients.end()) {
+      return;
+    }
+    Shard &shard = *m_shards[m_clientShards.at(clientId)];
+    {
+      std::lock_guard<std::mutex> shardLock(shard.linksMutex);
+      shard.links.erase(clientId);
+      shard.counters.erase(clientId);
+      shard.clients.erase(clientId);
+      shard.endpointIds.erase(it->second);
+    }
+    m_endpointIds.erase(it->second);
     m_clients.erase(it);
+    m_clientShards.erase(clientId);
     if (m_connectedPlayersCount > 0) {
       --m_connectedPlayersCount;
     }
-    std::cout << "[Server] Client " << clientId << " disconnected (kicked)" << '\n';
   }
+  std::cout << "[Server] Client " << clientId << " disconnected (kicked)" << '\n';
+}
+
+float AsioServer::getLatency() const
+{
+  float sum = 0.0f;
+  int count = 0;
+  for (const auto &connection : getNetworkStats().connections) {
+    if (connection.rttMs >= 0.0f) {
+      sum += connection.rttMs;
+      ++count;
+    }
+  }
+  return count == 0 ? -1.0f : sum / static_cast<float>(count);
+}
+
+int AsioServer::getPacketsPerSecond() const
+{
+  const auto rates = m_rates.update(m_traffic.load(), NetworkLink::Clock::now());
+  return rates.packetsInPerSecond + rates.packetsOutPerSecond;
+}
+
+int AsioServer::getUploadBytesPerSecond() const
+{
+  return m_rates.update(m_traffic.load(), NetworkLink::Clock::now()).bytesOutPerSecond;
+}
+
+int AsioServer::getDownloadBytesPerSecond() const
+{
+  return m_rates.update(m_traffic.load(), NetworkLink::Clock::now()).bytesInPerSecond;
+}
+
+NetworkStats AsioServer::getNetworkStats() const
+{
+  NetworkStats stats;
+  stats.traffic = m_traffic.load();
+  const HandshakeStats gate = m_gate.getStats();
+  stats.droppedIn = gate.droppedUnauthenticated + gate.droppedBadCookie + gate.droppedMalformed;
+  for (const auto &shard : m_shards) {
+    stats.incomingQueueDepth += shard->incomingMessages.size();
+    std::lock_guard<std::mutex> lock(shard->linksMutex);
+    for (const auto &[clientId, counters] : shard->counters) {
+      ConnectionStats connection;
+      connection.clientId = clientId;
+      connection.traffic = counters->traffic.load();
+      connection.rttMs = counters->getRttMs();
+      if (auto linkIt = shard->links.find(clientId); linkIt != shard->links.end()) {
+        fillChannelStats(connection, linkIt->second.getChannels());
+      }
+      stats.connections.push_back(connection);
+    }
+  }
+  return stats;
 }
 
 void AsioServer::createPlayerEntity(std::uint32_t clientId)
@@ -6,36 +6,119 @@
 */
 
 #include "../include/CapnpHandler.hpp"
+#include "../include/NetworkConfig.hpp"
 #include "GameMessage.capnp.h"
+#include <algorithm>
+#include <capnp/serialize-packed.h>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <kj/io.h>
+
+namespace
+{
+/**
+ * @brief Per-thread scratch memory reused by every message of that thread
+ *
+ * The builder segment must be zeroed before use; MallocMessageBuilder
+ * zeroes it again when it is destroyed, so it stays ready for the next one.
+ */
+struct ThreadArena {
+  ThreadArena()
+      : builderSegment(kj::heapArray<capnp::word>(NetworkConfig::CAPNP_SCRATCH_WORDS)),
+        readerScratch(kj::heapArray<capnp::word>(NetworkConfig::CAPNP_SCRATCH_WORDS))
+  {
+    std::memset(builderSegment.begin(), 0, builderSegment.size() * sizeof(capnp::word));
+  }
+
+  /** @brief Aligned scratch of at least `words` words */
+  kj::ArrayPtr<capnp::word> reader(std::size_t words)
+  {
+    if (readerScratch.size() < words) {
+      readerScratch = kj::heapArray<capnp::word>(words);
+    }
+    return readerScratch.asPtr();
+  }
+
+  kj::Array<capnp::word> builderSegment;
+  kj::Array<capnp::word> readerScratch;
+};
+
+ThreadArena &threadArena()
+{
+  thread_local ThreadArena arena;
+  return arena;
+}
+
+// Worst case of the packed encoding: one tag byte per word plus the run
+// length bytes of the first/last tags.
+constexpr std::size_t packedBound(std::size_t words)
+{
+  return words * (sizeof(capnp::word) + 1) + 2;
+}
+} // namespace
 
 std::vector<std::uint8_t> CapnpHandler::serialize(const std::string &data) const
 {
-  capnp::MallocMessageBuilder message;
+  std::vector<std::uint8_t> out;
+  serializeInto(data, out);
+  return out;
+}
+
+std::size_t CapnpHandler::serializeInto(const std::string &data, std::vector<std::uint8_t> &out) const
+{
+  capnp::MallocMessageBuilder message(threadArena().builderSegment.asPtr());
   auto netMsg = message.initRoot<NetworkMessage>();
   netMsg.setMessageType(data);
 
-  kj::VectorOutputStream output;
-  capnp::writeMessage(output, message);
+  const std::size_t words = capnp::computeSerializedSizeInWords(message);
+  out.resize(m_packed ? packedBound(words) : words * sizeof(capnp::word));
 
-  auto arr = output.getArray();
-  return std::vector<std::uint8_t>(arr.begin(), arr.end());
+  kj::ArrayOutputStream output(kj::arrayPtr(reinterpret_cast<kj::byte *>(out.data()), out.size()));
+  if (m_packed) {
+    capnp::writePackedMessage(output, message);
+  } else {
+    capnp::writeMessage(output, message);
+  }
+  out.resize(output.getArray().size());
+  return out.size();
 }
 
 std::optional<std::string> CapnpHandler::deserialize(const std::array<char, BUFFER_SIZE> &buffer,
                                                      std::size_t bytesTransferred) const
 {
-  if (bytesTransferred == 0) {
+  return deserialize(std::span<const std::byte>(reinterpret_cast<const std::byte *>(buffer.data()),
+                                                std::min(bytesTransferred, BUFFER_SIZE)));
+}
+
+std::optional<std::string> CapnpHandler::deserialize(std::span<const std::byte> bytes) const
+{
+  if (bytes.empty()) {
     return std::nullopt;
   }
 
-  kj::ArrayPtr<const kj::byte> bytes(reinterpret_cast<const kj::byte *>(buffer.data()), bytesTransferred);
-  kj::ArrayInputStream stream(bytes);
-
   try {
-    capnp::InputStreamMessageReader reader(stream);
-    auto netMsg = reader.getRoot<NetworkMessage>();
-    auto type = netMsg.getMessageType();
+    if (m_packed) {
+      kj::ArrayInputStream stream(kj::arrayPtr(reinterpret_cast<const kj::byte *>(bytes.data()), bytes.size()));
+      capnp::PackedMessageReader reader(stream, capnp::ReaderOptions(),
+                                        threadArena().reader(NetworkConfig::CAPNP_SCRATCH_WORDS));
+      auto type = reader.getRoot<NetworkMessage>().getMessageType();
+      return std::string(type.cStr(), type.size());
+    }
+
+    if (bytes.size() % sizeof(capnp::word) != 0) {
+      std::cerr << "[CapnpHandler] Deserialize error: " << bytes.size() << " bytes is not a whole message" << '\n';
+      return std::nullopt;
+    }
+    const std::size_t words = bytes.size() / sizeof(capnp::word);
+    const auto *aligned = reinterpret_cast<const capnp::word *>(bytes.data());
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(capnp::word) != 0) {
+      auto scratch = threadArena().reader(words);
+      std::memcpy(scratch.begin(), bytes.data(), bytes.size());
+      aligned = scratch.begin();
+    }
+    capnp::FlatArrayMessageReader reader(kj::arrayPtr(aligned, words));
+    auto type = reader.getRoot<NetworkMessage>().getMessageType();
     return std::string(type.cStr(), type.size());
   } catch (const kj::Exception &e) {
     std::cerr << "[CapnpHandler] Deserialize error: " << e.getDescription().cStr() << '\n';
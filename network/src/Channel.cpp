@@ -0,0 +1,248 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Channel.cpp
+*/
+
+#include "../include/Channel.hpp"
+#include "../include/NetworkConfig.hpp"
+#include "../include/PacketFramer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr std::uint8_t MESSAGE_ACK = 2;
+constexpr std::size_t DATA_HEADER_SIZE = 3;
+constexpr std::size_t ACK_SIZE = 7;
+constexpr std::uint16_t ACK_BITS = 32;
+constexpr std::uint32_t MAX_BACKOFF_SHIFT = 3;
+
+void writeU16(std::vector<std::byte> &out, std::uint16_t value)
+{
+  out.push_back(static_cast<std::byte>(value >> 8));
+  out.push_back(static_cast<std::byte>(value & 0xFF));
+}
+
+void writeU32(std::vector<std::byte> &out, std::uint32_t value)
+{
+  writeU16(out, static_cast<std::uint16_t>(value >> 16));
+  writeU16(out, static_cast<std::uint16_t>(value & 0xFFFF));
+}
+
+std::uint16_t readU16(std::span<const std::byte> data, std::size_t offset)
+{
+  return static_cast<std::uint16_t>((std::to_integer<std::uint16_t>(data[offset]) << 8) |
+                                    std::to_integer<std::uint16_t>(data[offset + 1]));
+}
+
+std::uint32_t readU32(std::span<const std::byte> data, std::size_t offset)
+{
+  return (static_cast<std::uint32_t>(readU16(data, offset)) << 16) | readU16(data, offset + 2);
+}
+
+// Distance from 'from' to 'to' on the 16-bit sequence circle
+std::uint16_t sequenceDistance(std::uint16_t from, std::uint16_t to)
+{
+  return static_cast<std::uint16_t>(to - from);
+}
+
+// True when 'a' comes after 'b' (with wrap-around)
+bool sequenceNewer(std::uint16_t a, std::uint16_t b)
+{
+  const std::uint16_t distance = sequenceDistance(b, a);
+  return distance != 0 && distance < 0x8000;
+}
+
+float toMs(ChannelEndpoint::Clock::duration duration)
+{
+  return std::chrono::duration<float, std::milli>(duration).count();
+}
+} // namespace
+
+ChannelEndpoint::ChannelEndpoint() : m_rtoMs(static_cast<float>(NetworkConfig::INITIAL_RTO_MS)) {}
+
+bool ChannelEndpoint::send(std::span<const std::byte> payload, Channel channel, Clock::time_point now,
+                           PacketFramer &out)
+{
+  const bool reliable = channel == Channel::RELIABLE_ORDERED;
+  const std::uint16_t sequence = reliable ? m_nextReliableSequence++ : m_nextUnreliableSequence++;
+
+  std::vector<std::byte> message;
+  message.reserve(DATA_HEADER_SIZE + payload.size());
+  message.push_back(static_cast<std::byte>(channel));
+  writeU16(message, sequence);
+  message.insert(message.end(), payload.begin(), payload.end());
+
+  if (!out.enqueue(message)) {
+    return false;
+  }
+  if (reliable) {
+    m_unacked.push_back(SentMessage{sequence, std::move(message), now, now, 1});
+    ++m_reliableSentCount;
+  }
+  return true;
+}
+
+void ChannelEndpoint::flush(Clock::time_point now, PacketFramer &out)
+{
+  // Selective resend: only messages whose own timeout expired go out again
+  for (auto &sent : m_unacked) {
+    const std::uint32_t shift = std::min(sent.sendCount - 1, MAX_BACKOFF_SHIFT);
+    const float timeoutMs = std::min(m_rtoMs * static_cast<float>(1U << shift),
+                                     static_cast<float>(NetworkConfig::MAX_RTO_MS));
+    if (toMs(now - sent.lastSent) < timeoutMs) {
+      continue;
+    }
+    out.enqueue(sent.framed);
+    sent.lastSent = now;
+    ++sent.sendCount;
+    ++m_resendCount;
+  }
+
+  if (m_ackPending) {
+    std::uint32_t receivedBits = 0;
+    for (std::uint16_t i = 0; i < ACK_BITS; ++i) {
+      if (m_outOfOrder.count(static_cast<std::uint16_t>(m_nextExpected + 1 + i)) != 0) {
+        receivedBits |= (1U << i);
+      }
+    }
+    std::vector<std::byte> ack;
+    ack.reserve(ACK_SIZE);
+    ack.push_back(static_cast<std::byte>(MESSAGE_ACK));
+    writeU16(ack, m_nextExpected);
+    writeU32(ack, receivedBits);
+    out.enqueue(ack);
+    m_ackPending = false;
+  }
+}
+
+bool ChannelEndpoint::onMessage(std::span<const std::byte> message, Clock::time_point now,
+                                std::vector<std::vector<std::byte>> &delivered)
+{
+  if (message.size() < DATA_HEADER_SIZE) {
+    return false;
+  }
+  const auto type = std::to_integer<std::uint8_t>(message[0]);
+  const std::uint16_t sequence = readU16(message, 1);
+
+  switch (type) {
+    case static_cast<std::uint8_t>(Channel::UNRELIABLE_SEQUENCED): {
+      // Sequenced: anything older than the newest seen is stale
+      if (m_hasUnreliable && !sequenceNewer(sequence, m_lastUnreliableSequence)) {
+        return true;
+      }
+      // Skipped sequence numbers were lost, or arrive late and are dropped above
+      if (m_hasUnreliable) {
+        m_unreliableMissedCount += sequenceDistance(m_lastUnreliableSequence, sequence) - 1U;
+      }
+      ++m_unreliableReceivedCount;
+      m_hasUnreliable = true;
+      m_lastUnreliableSequence = sequence;
+      const auto payload = message.subspan(DATA_HEADER_SIZE);
+      delivered.emplace_back(payload.begin(), payload.end());
+      return true;
+    }
+    case static_cast<std::uint8_t>(Channel::RELIABLE_ORDERED):
+      onReliable(sequence, message.subspan(DATA_HEADER_SIZE), delivered);
+      return true;
+    case MESSAGE_ACK:
+      if (message.size() != ACK_SIZE) {
+        return false;
+      }
+      onAck(sequence, readU32(message, DATA_HEADER_SIZE), now);
+      return true;
+    default:
+      return false;
+  }
+}
+
+void ChannelEndpoint::onReliable(std::uint16_t sequence, std::span<const std::byte> payload,
+                                 std::vector<std::vector<std::byte>> &delivered)
+{
+  // Always (re-)ack, the peer may have missed our previous ack
+  m_ackPending = true;
+
+  const std::uint16_t distance = sequenceDistance(m_nextExpected, sequence);
+  if (distance >= 0x8000 || distance >= NetworkConfig::RELIABLE_RECEIVE_WINDOW) {
+    return; // Duplicate of a delivered message, or too far ahead
+  }
+  if (distance != 0) {
+    m_outOfOrder.try_emplace(sequence, payload.begin(), payload.end());
+    return;
+  }
+
+  delivered.emplace_back(payload.begin(), payload.end());
+  ++m_nextExpected;
+  for (auto it = m_outOfOrder.find(m_nextExpected); it != m_outOfOrder.end();
+       it = m_outOfOrder.find(m_nextExpected)) {
+    delivered.push_back(std::move(it->second));
+    m_outOfOrder.erase(it);
+    ++m_nextExpected;
+  }
+}
+
+void ChannelEndpoint::onAck(std::uint16_t nextExpected, std::uint32_t receivedBits, Clock::time_point now)
+{
+  auto isAcked = [nextExpected, receivedBits](std::uint16_t sequence) {
+    if (sequenceNewer(nextExpected, sequence)) {
+      return true; // Cumulative part
+    }
+    const std::uint16_t distance = sequenceDistance(nextExpected, sequence);
+    return distance >= 1 && distance <= ACK_BITS && (receivedBits & (1U << (distance - 1))) != 0;
+  };
+
+  for (auto it = m_unacked.begin(); it != m_unacked.end();) {
+    if (!isAcked(it->sequence)) {
+      ++it;
+      continue;
+    }
+    // Karn's rule: only messages sent once give an unambiguous sample
+    if (it->sendCount == 1) {
+      addRttSample(toMs(now - it->firstSent));
+    }
+    it = m_unacked.erase(it);
+  }
+}
+
+void ChannelEndpoint::addRttSample(float sampleMs)
+{
+  constexpr float ALPHA = 0.125f;
+  constexpr float BETA = 0.25f;
+  if (!m_hasRtt) {
+    m_srttMs = sampleMs;
+    m_rttVarMs = sampleMs / 2.0f;
+    m_hasRtt = true;
+  } else {
+    m_rttVarMs = (1.0f - BETA) * m_rttVarMs + BETA * std::abs(m_srttMs - sampleMs);
+    m_srttMs = (1.0f - ALPHA) * m_srttMs + ALPHA * sampleMs;
+  }
+  m_rtoMs = std::clamp(m_srttMs + 4.0f * m_rttVarMs, static_cast<float>(NetworkConfig::MIN_RTO_MS),
+                       static_cast<float>(NetworkConfig::MAX_RTO_MS));
+}
+
+float ChannelEndpoint::getRttMs() const
+{
+  return m_hasRtt ? m_srttMs : -1.0f;
+}
+
+std::size_t ChannelEndpoint::getUnackedCount() const
+{
+  return m_unacked.size();
+}
+
+bool ChannelEndpoint::hasPendingAck() const
+{
+  return m_ackPending;
+}
+
+std::uint64_t ChannelEndpoint::getResendCount() const
+{
+  return m_resendCount;
+}
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** ConditionedNetworkManager.cpp
+*/
+
+#include "../include/ConditionedNetworkManager.hpp"
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Keeps the two directions on unrelated streams for the same seed
+constexpr std::uint64_t INBOUND_SEED_SALT = 0x9e3779b97f4a7c15ULL;
+} // namespace
+
+ConditionedNetworkManager::ConditionedNetworkManager(std::shared_ptr<INetworkManager> inner,
+                                                     const LinkConditions &outbound, const LinkConditions &inbound,
+                                                     std::uint64_t seed)
+    : m_inner(std::move(inner)), m_outbound(outbound, seed), m_inbound(inbound, seed ^ INBOUND_SEED_SALT)
+{
+}
+
+void ConditionedNetworkManager::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId)
+{
+  send(data, targetEndpointId, Channel::RELIABLE_ORDERED);
+}
+
+void ConditionedNetworkManager::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId,
+                                     Channel channel)
+{
+  const auto now = NetworkConditioner::Clock::now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_outbound.push(std::vector<std::byte>(data.begin(), data.end()), targetEndpointId, channel, now);
+  releaseOutbound(now);
+}
+
+void ConditionedNetworkManager::flush()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    releaseOutbound(NetworkConditioner::Clock::now());
+  }
+  m_inner->flush();
+}
+
+void ConditionedNetworkManager::releaseOutbound(NetworkConditioner::Clock::time_point now)
+{
+  NetworkConditioner::Item item;
+  while (m_outbound.pop(now, item)) {
+    m_inner->send(item.data, item.endpointId, item.channel);
+  }
+}
+
+bool ConditionedNetworkManager::poll(NetworkPacket &msg)
+{
+  const auto now = NetworkConditioner::Clock::now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  releaseOutbound(now);
+
+  NetworkPacket received;
+  while (m_inner->poll(received)) {
+    const auto payload = received.getPayload();
+    m_inbound.push(std::vector<std::byte>(payload.begin(), payload.end()), received.getSenderEndpointId(),
+                   Channel::RELIABLE_ORDERED, now);
+  }
+
+  NetworkConditioner::Item item;
+  if (!m_inbound.pop(now, item)) {
+    return false;
+  }
+  msg = NetworkPacket(item.data, item.endpointId);
+  return true;
+}
+
+ConditionerStats ConditionedNetworkManager::getOutboundStats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_outbound.getStats();
+}
+
+ConditionerStats ConditionedNetworkManager::getInboundStats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_inbound.getStats();
+}
@@ -0,0 +1,216 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Handshake.cpp
+*/
+
+#include "../include/Handshake.hpp"
+#include "../include/NetworkConfig.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+constexpr std::size_t MAX_MAC_INPUT = 16 + 2 + 8; // IPv6 address, port, issue time
+
+void writeU64(std::byte *out, std::uint64_t value) noexcept
+{
+  for (std::size_t i = 0; i < sizeof(value); ++i) {
+    out[i] = static_cast<std::byte>(value >> (56 - 8 * i));
+  }
+}
+
+std::uint64_t readU64(const std::byte *in) noexcept
+{
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(value); ++i) {
+    value = (value << 8) | std::to_integer<std::uint64_t>(in[i]);
+  }
+  return value;
+}
+
+std::uint64_t readU64Le(const std::uint8_t *in) noexcept
+{
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(value); ++i) {
+    value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+/** @brief SipHash-2-4: keyed PRF built for short inputs (reference algorithm by Aumasson and Bernstein). */
+std::uint64_t sipHash24(const ConnectionGate::Key &key, const std::uint8_t *data, std::size_t size) noexcept
+{
+  std::uint64_t v0 = 0x736f6d6570736575ULL ^ key[0];
+  std::uint64_t v1 = 0x646f72616e646f6dULL ^ key[1];
+  std::uint64_t v2 = 0x6c7967656e657261ULL ^ key[0];
+  std::uint64_t v3 = 0x7465646279746573ULL ^ key[1];
+
+  auto round = [&]() {
+    v0 += v1;
+    v1 = std::rotl(v1, 13);
+    v1 ^= v0;
+    v0 = std::rotl(v0, 32);
+    v2 += v3;
+    v3 = std::rotl(v3, 16);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = std::rotl(v3, 21);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = std::rotl(v1, 17);
+    v1 ^= v2;
+    v2 = std::rotl(v2, 32);
+  };
+
+  const std::size_t blocks = size / 8;
+  for (std::size_t i = 0; i < blocks; ++i) {
+    const std::uint64_t m = readU64Le(data + i * 8);
+    v3 ^= m;
+    round();
+    round();
+    v0 ^= m;
+  }
+
+  std::uint64_t last = static_cast<std::uint64_t>(size & 0xFF) << 56;
+  for (std::size_t i = 0; i < size % 8; ++i) {
+    last |= static_cast<std::uint64_t>(data[blocks * 8 + i]) << (8 * i);
+  }
+  v3 ^= last;
+  round();
+  round();
+  v0 ^= last;
+
+  v2 ^= 0xFF;
+  for (int i = 0; i < 4; ++i) {
+    round();
+  }
+  return v0 ^ v1 ^ v2 ^ v3;
+}
+
+std::uint64_t toMillis(ConnectionGate::Clock::time_point now) noexcept
+{
+  return static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count());
+}
+
+bool hasHeader(std::span<const std::byte> datagram, std::uint8_t kind) noexcept
+{
+  return datagram.size() >= Handshake::HEADER_SIZE &&
+    std::to_integer<std::uint8_t>(datagram[0]) == Handshake::HANDSHAKE_MAGIC &&
+    std::to_integer<std::uint8_t>(datagram[1]) == kind &&
+    std::to_integer<std::uint8_t>(datagram[2]) == Handshake::PROTOCOL_VERSION;
+}
+
+std::vector<std::byte> makeHeader(std::uint8_t kind, std::size_t size)
+{
+  std::vector<std::byte> datagram(size, std::byte{0});
+  datagram[0] = static_cast<std::byte>(Handshake::HANDSHAKE_MAGIC);
+  datagram[1] = static_cast<std::byte>(kind);
+  datagram[2] = static_cast<std::byte>(Handshake::PROTOCOL_VERSION);
+  return datagram;
+}
+} // namespace
+
+bool Handshake::isHandshake(std::span<const std::byte> datagram) noexcept
+{
+  return !datagram.empty() && std::to_integer<std::uint8_t>(datagram[0]) == HANDSHAKE_MAGIC;
+}
+
+std::vector<std::byte> Handshake::makeConnect()
+{
+  return makeHeader(KIND_CONNECT, CONNECT_SIZE);
+}
+
+std::optional<Handshake::Cookie> Handshake::parseChallenge(std::span<const std::byte> datagram) noexcept
+{
+  if (datagram.size() != CHALLENGE_SIZE || !hasHeader(datagram, KIND_CHALLENGE)) {
+    return std::nullopt;
+  }
+  Cookie cookie{};
+  std::copy_n(datagram.begin() + HEADER_SIZE, COOKIE_SIZE, cookie.begin());
+  return cookie;
+}
+
+std::vector<std::byte> Handshake::makeResponse(const Cookie &cookie)
+{
+  auto datagram = makeHeader(KIND_RESPONSE, RESPONSE_SIZE);
+  std::copy(cookie.begin(), cookie.end(), datagram.begin() + HEADER_SIZE);
+  return datagram;
+}
+
+ConnectionGate::ConnectionGate()
+{
+  std::random_device device;
+  for (auto &word : m_secret) {
+    word = (static_cast<std::uint64_t>(device()) << 32) | device();
+  }
+}
+
+ConnectionGate::ConnectionGate(const Key &secret) : m_secret(secret) {}
+
+std::uint64_t ConnectionGate::mac(const asio::ip::udp::endpoint &sender, std::uint64_t issuedMs) const noexcept
+{
+  std::array<std::uint8_t, MAX_MAC_INPUT> input{};
+  std::size_t size = 0;
+  const auto address = sender.address();
+  if (address.is_v4()) {
+    const auto bytes = address.to_v4().to_bytes();
+    size = std::copy(bytes.begin(), bytes.end(), input.begin()) - input.begin();
+  } else {
+    const auto bytes = address.to_v6().to_bytes();
+    size = std::copy(bytes.begin(), bytes.end(), input.begin()) - input.begin();
+  }
+  input[size++] = static_cast<std::uint8_t>(sender.port() >> 8);
+  input[size++] = static_cast<std::uint8_t>(sender.port() & 0xFF);
+  for (std::size_t i = 0; i < sizeof(issuedMs); ++i) {
+    input[size++] = static_cast<std::uint8_t>(issuedMs >> (56 - 8 * i));
+  }
+  return sipHash24(m_secret, input.data(), size);
+}
+
+ConnectionGate::Verdict ConnectionGate::onHandshake(std::span<const std::byte> datagram,
+                                                    const asio::ip::udp::endpoint &sender, Clock::time_point now,
+                                                    std::vector<std::byte> &reply)
+{
+  const std::uint64_t nowMs = toMillis(now);
+
+  if (datagram.size() == Handshake::CONNECT_SIZE && hasHeader(datagram, Handshake::KIND_CONNECT)) {
+    reply = makeHeader(Handshake::KIND_CHALLENGE, Handshake::CHALLENGE_SIZE);
+    writeU64(reply.data() + Handshake::HEADER_SIZE, nowMs);
+    writeU64(reply.data() + Handshake::HEADER_SIZE + sizeof(std::uint64_t), mac(sender, nowMs));
+    m_challengesSent.fetch_add(1, std::memory_order_relaxed);
+    return Verdict::CHALLENGE;
+  }
+
+  if (datagram.size() != Handshake::RESPONSE_SIZE || !hasHeader(datagram, Handshake::KIND_RESPONSE)) {
+    m_droppedMalformed.fetch_add(1, std::memory_order_relaxed);
+    return Verdict::DROP;
+  }
+
+  const std::uint64_t issuedMs = readU64(datagram.data() + Handshake::HEADER_SIZE);
+  const std::uint64_t receivedMac = readU64(datagram.data() + Handshake::HEADER_SIZE + sizeof(std::uint64_t));
+  const bool fresh = issuedMs <= nowMs && nowMs - issuedMs <= NetworkConfig::HANDSHAKE_COOKIE_LIFETIME_MS;
+  if (!fresh || mac(sender, issuedMs) != receivedMac) {
+    m_droppedBadCookie.fetch_add(1, std::memory_order_relaxed);
+    return Verdict::DROP;
+  }
+  m_accepted.fetch_add(1, std::memory_order_relaxed);
+  return Verdict::ACCEPT;
+}
+
+HandshakeStats ConnectionGate::getStats() const noexcept
+{
+  HandshakeStats stats;
+  stats.challengesSent = m_challengesSent.load(std::memory_order_relaxed);
+  stats.accepted = m_accepted.load(std::memory_order_relaxed);
+  stats.droppedUnauthenticated = m_droppedUnauthenticated.load(std::memory_order_relaxed);
+  stats.droppedBadCookie = m_droppedBadCookie.load(std::memory_order_relaxed);
+  stats.droppedMalformed = m_droppedMalformed.load(std::memory_order_relaxed);
+  return stats;
+}
@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** NetworkConditioner.cpp
+*/
+
+#include "../include/NetworkConditioner.hpp"
+#include "../include/NetworkConfig.hpp"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+NetworkConditioner::NetworkConditioner(const LinkConditions &conditions, std::uint64_t seed)
+    : m_conditions(conditions), m_random(seed)
+{
+}
+
+double NetworkConditioner::uniform()
+{
+  // 53 high bits into the mantissa: [0, 1) with the same result everywhere
+  return static_cast<double>(m_random() >> 11) * 0x1.0p-53;
+}
+
+bool NetworkConditioner::chance(double probability)
+{
+  return probability > 0.0 && uniform() < probability;
+}
+
+NetworkConditioner::Clock::duration NetworkConditioner::jitter()
+{
+  if (m_conditions.jitterMs <= 0) {
+    return Clock::duration::zero();
+  }
+  const double spreadUs = static_cast<double>(m_conditions.jitterMs) * 1000.0;
+  const auto offsetUs = static_cast<std::int64_t>((uniform() * 2.0 - 1.0) * spreadUs);
+  return std::chrono::duration_cast<Clock::duration>(std::chrono::microseconds(offsetUs));
+}
+
+void NetworkConditioner::schedule(Clock::time_point deliverAt, Item item)
+{
+  m_queue.push(Scheduled{deliverAt, m_nextOrder++, std::move(item)});
+}
+
+void NetworkConditioner::push(std::vector<std::byte> data, std::uint32_t endpointId, Channel channel,
+                              Clock::time_point now)
+{
+  const bool reliable = channel == Channel::RELIABLE_ORDERED;
+  ++m_stats.sent;
+
+  Clock::duration retransmitDelay = Clock::duration::zero();
+  if (reliable) {
+    // What the channel would pay to get it through: one RTO per lost attempt
+    const int rtoMs = std::clamp(2 * m_conditions.latencyMs + 4 * m_conditions.jitterMs, NetworkConfig::MIN_RTO_MS,
+                                 NetworkConfig::MAX_RTO_MS);
+    for (int attempt = 0; attempt < NetworkConfig::SIMULATION_MAX_RETRANSMITS && chance(m_conditions.lossRate);
+         ++attempt) {
+      retransmitDelay += std::chrono::milliseconds(rtoMs);
+      ++m_stats.retransmitted;
+    }
+  } else if (chance(m_conditions.lossRate)) {
+    ++m_stats.lost;
+    return;
+  }
+
+  Clock::time_point departure = now;
+  if (m_conditions.bandwidthBytesPerSecond > 0) {
+    const auto start = std::max(now, m_linkBusyUntil);
+    if (!reliable && start - now > std::chrono::milliseconds(NetworkConfig::SIMULATION_MAX_QUEUE_DELAY_MS)) {
+      ++m_stats.overflowed;
+      return;
+    }
+    const auto transmitUs = static_cast<std::int64_t>(data.size() * 1'000'000 / m_conditions.bandwidthBytesPerSecond);
+    departure = start + std::chrono::microseconds(transmitUs);
+    m_linkBusyUntil = departure;
+  }
+
+  auto deliverAt = departure + std::chrono::milliseconds(m_conditions.latencyMs) + retransmitDelay;
+  deliverAt = std::max(departure, deliverAt + jitter());
+
+  if (reliable) {
+    auto &last = m_lastReliableDelivery[endpointId];
+    deliverAt = std::max(deliverAt, last);
+    last = deliverAt;
+    schedule(deliverAt, Item{std::move(data), endpointId, channel});
+    return;
+  }
+
+  if (chance(m_conditions.reorderRate)) {
+    deliverAt += std::chrono::milliseconds(m_conditions.reorderDelayMs);
+    ++m_stats.reordered;
+  }
+  if (chance(m_conditions.duplicateRate)) {
+    const auto copyAt = std::max(departure, deliverAt + jitter());
+    schedule(copyAt, Item{data, endpointId, channel});
+    ++m_stats.duplicated;
+  }
+  schedule(deliverAt, Item{std::move(data), endpointId, channel});
+}
+
+bool NetworkConditioner::pop(Clock::time_point now, Item &item)
+{
+  if (m_queue.empty() || m_queue.top().deliverAt > now) {
+    return false;
+  }
+  // priority_queue::top() is const: the item is moved out before pop()
+  item = std::move(const_cast<Scheduled &>(m_queue.top()).item);
+  m_queue.pop();
+  ++m_stats.delivered;
+  m_stats.bytesDelivered += item.data.size();
+  return true;
+}
@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** NetworkLink.cpp
+*/
+
+#include "../include/NetworkLink.hpp"
+#include "../include/NetworkConfig.hpp"
+#include <chrono>
+#include <span>
+#include <vector>
+
+NetworkLink::NetworkLink()
+    : m_outbox(NetworkConfig::MAX_DATAGRAM_SIZE),
+      m_inbox(std::chrono::milliseconds(NetworkConfig::FRAGMENT_TIMEOUT_MS),
+              NetworkConfig::MAX_PENDING_FRAGMENTED_MESSAGES)
+{
+}
+
+bool NetworkLink::send(std::span<const std::byte> payload, Channel channel, Clock::time_point now)
+{
+  if (payload.empty()) {
+    return true;
+  }
+  return m_channels.send(payload, channel, now, m_outbox);
+}
+
+std::vector<std::vector<std::byte>> NetworkLink::flush(Clock::time_point now)
+{
+  m_channels.flush(now, m_outbox);
+  return m_outbox.flush();
+}
+
+bool NetworkLink::onDatagram(std::span<const std::byte> datagram, Clock::time_point now,
+                             std::vector<std::vector<std::byte>> &delivered)
+{
+  m_inbox.purgeExpired(now);
+
+  std::vector<std::vector<std::byte>> messages;
+  bool valid = m_inbox.onDatagram(datagram, now, messages);
+  for (const auto &message : messages) {
+    valid = m_channels.onMessage(message, now, delivered) && valid;
+  }
+  return valid;
+}
+
+bool NetworkLink::hasPending() const
+{
+  return m_outbox.hasPending() || m_channels.hasPendingAck() || m_channels.getUnackedCount() > 0;
+}
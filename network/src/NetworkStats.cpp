@@ -0,0 +1,141 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** NetworkStats.cpp
+*/
+
+#include "../include/NetworkStats.hpp"
+#include "../include/Channel.hpp"
+#include "../include/NetworkConfig.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace
+{
+std::int64_t toNs(ClientCounters::Clock::time_point time)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+std::vector<std::byte> toBytes(const std::vector<std::uint8_t> &serialized)
+{
+  std::vector<std::byte> bytes(serialized.size());
+  std::memcpy(bytes.data(), serialized.data(), serialized.size());
+  return bytes;
+}
+
+int perSecond(std::uint64_t delta, double seconds)
+{
+  return static_cast<int>(static_cast<double>(delta) / seconds);
+}
+} // namespace
+
+TrafficStats TrafficCounters::load() const
+{
+  TrafficStats stats;
+  stats.packetsIn = m_packetsIn.load(std::memory_order_relaxed);
+  stats.bytesIn = m_bytesIn.load(std::memory_order_relaxed);
+  stats.packetsOut = m_packetsOut.load(std::memory_order_relaxed);
+  stats.bytesOut = m_bytesOut.load(std::memory_order_relaxed);
+  stats.sendErrors = m_sendErrors.load(std::memory_order_relaxed);
+  stats.sendQueueDepth = m_sendQueueDepth.load(std::memory_order_relaxed);
+  return stats;
+}
+
+bool ClientCounters::isPingDue(Clock::time_point now) const
+{
+  // A PING still unanswered after an interval is taken as lost and replaced
+  const std::int64_t last = m_lastPingNs.load(std::memory_order_relaxed);
+  return last == 0 || toNs(now) - last >= std::int64_t{NetworkConfig::STATS_PING_INTERVAL_MS} * 1000000;
+}
+
+void ClientCounters::onPingSent(Clock::time_point now)
+{
+  m_lastPingNs.store(toNs(now), std::memory_order_relaxed);
+  m_pingSentNs.store(toNs(now), std::memory_order_release);
+}
+
+void ClientCounters::onPong(Clock::time_point now)
+{
+  const std::int64_t sent = m_pingSentNs.exchange(0, std::memory_order_acq_rel);
+  if (sent == 0) {
+    return; // Unsolicited or duplicated
+  }
+  m_rttUs.store((toNs(now) - sent) / 1000, std::memory_order_relaxed);
+}
+
+float ClientCounters::getRttMs() const
+{
+  const std::int64_t rttUs = m_rttUs.load(std::memory_order_relaxed);
+  return rttUs < 0 ? -1.0f : static_cast<float>(rttUs) / 1000.0f;
+}
+
+KeepaliveMessages::KeepaliveMessages(const IPacketHandler &handler)
+    : ping(toBytes(handler.serialize("PING"))), pong(toBytes(handler.serialize("PONG")))
+{
+}
+
+bool KeepaliveMessages::matches(std::span<const std::byte> payload, const std::vector<std::byte> &message)
+{
+  return payload.size() == message.size() && std::memcmp(payload.data(), message.data(), message.size()) == 0;
+}
+
+TrafficRateMeter::Rates TrafficRateMeter::update(const TrafficStats &totals,
+                                                 std::chrono::steady_clock::time_point now) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_hasSample) {
+    m_hasSample = true;
+    m_lastTotals = totals;
+    m_lastTime = now;
+    return m_rates;
+  }
+  const double seconds = std::chrono::duration<double>(now - m_lastTime).count();
+  if (seconds * 1000.0 < NetworkConfig::STATS_RATE_WINDOW_MS) {
+    return m_rates;
+  }
+  m_rates.packetsInPerSecond = perSecond(totals.packetsIn - m_lastTotals.packetsIn, seconds);
+  m_rates.packetsOutPerSecond = perSecond(totals.packetsOut - m_lastTotals.packetsOut, seconds);
+  m_rates.bytesInPerSecond = perSecond(totals.bytesIn - m_lastTotals.bytesIn, seconds);
+  m_rates.bytesOutPerSecond = perSecond(totals.bytesOut - m_lastTotals.bytesOut, seconds);
+  m_lastTotals = totals;
+  m_lastTime = now;
+  return m_rates;
+}
+
+void fillChannelStats(ConnectionStats &stats, const ChannelEndpoint &channels)
+{
+  stats.unackedReliable = channels.getUnackedCount();
+  if (stats.rttMs < 0.0f) {
+    stats.rttMs = channels.getRttMs();
+  }
+  const std::uint64_t received = channels.getUnreliableReceivedCount();
+  const std::uint64_t missed = channels.getUnreliableMissedCount();
+  if (received + missed > 0) {
+    stats.lossIn = static_cast<float>(missed) / static_cast<float>(received + missed);
+  }
+  if (channels.getReliableSentCount() > 0) {
+    stats.lossOut = std::min(1.0f, static_cast<float>(channels.getResendCount()) /
+                                     static_cast<float>(channels.getReliableSentCount()));
+  }
+}
+
+nlohmann::json toJson(const TrafficStats &stats)
+{
+  return nlohmann::json{{"pkts_in", stats.packetsIn},       {"bytes_in", stats.bytesIn},
+                        {"pkts_out", stats.packetsOut},     {"bytes_out", stats.bytesOut},
+                        {"send_errors", stats.sendErrors}, {"send_queue", stats.sendQueueDepth}};
+}
+
+nlohmann::json toJson(const ConnectionStats &stats)
+{
+  nlohmann::json json = toJson(stats.traffic);
+  json["id"] = stats.clientId;
+  json["unacked"] = stats.unackedReliable;
+  json["rtt_ms"] = stats.rttMs;
+  json["loss_in"] = stats.lossIn;
+  json["loss_out"] = stats.lossOut;
+  return json;
+}
@@ -0,0 +1,263 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** PacketFramer.cpp
+*/
+
+#include "../include/PacketFramer.hpp"
+#include "Common.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+void writeU16(std::vector<std::byte> &out, std::uint16_t value)
+{
+  out.push_back(static_cast<std::byte>(value >> 8));
+  out.push_back(static_cast<std::byte>(value & 0xFF));
+}
+
+std::uint16_t readU16(std::span<const std::byte> data, std::size_t offset)
+{
+  return static_cast<std::uint16_t>((std::to_integer<std::uint16_t>(data[offset]) << 8) |
+                                    std::to_integer<std::uint16_t>(data[offset + 1]));
+}
+} // namespace
+
+// ============================================================================
+// PacketFramer
+// ============================================================================
+
+PacketFramer::PacketFramer(std::size_t maxDatagramSize) : m_maxDatagramSize(maxDatagramSize) {}
+
+std::size_t PacketFramer::getMaxMessageSize() const
+{
+  const std::size_t chunkSize = m_maxDatagramSize - Framing::FRAGMENT_HEADER_SIZE;
+  return std::min(chunkSize * Framing::MAX_FRAGMENTS, static_cast<std::size_t>(BUFFER_SIZE));
+}
+
+bool PacketFramer::enqueue(std::span<const std::byte> message)
+{
+  if (message.empty()) {
+    return true;
+  }
+  if (message.size() > getMaxMessageSize()) {
+    return false;
+  }
+
+  const std::size_t framedSize = Framing::LENGTH_PREFIX_SIZE + message.size();
+  if (Framing::HEADER_SIZE + framedSize > m_maxDatagramSize) {
+    fragment(message);
+    return true;
+  }
+
+  if (!m_bundle.empty() && m_bundle.size() + framedSize > m_maxDatagramSize) {
+    closeBundle();
+  }
+  if (m_bundle.empty()) {
+    m_bundle.reserve(m_maxDatagramSize);
+    m_bundle.push_back(static_cast<std::byte>(Framing::FRAME_MAGIC));
+    m_bundle.push_back(static_cast<std::byte>(Framing::KIND_BUNDLE));
+  }
+  writeU16(m_bundle, static_cast<std::uint16_t>(message.size()));
+  m_bundle.insert(m_bundle.end(), message.begin(), message.end());
+  return true;
+}
+
+void PacketFramer::fragment(std::span<const std::byte> message)
+{
+  const std::size_t chunkSize = m_maxDatagramSize - Framing::FRAGMENT_HEADER_SIZE;
+  const std::size_t count = (message.size() + chunkSize - 1) / chunkSize;
+  const std::uint16_t messageId = m_nextMessageId++;
+
+  // Keep ordering with already queued bundled messages
+  closeBundle();
+
+  for (std::size_t index = 0; index < count; ++index) {
+    const std::size_t offset = index * chunkSize;
+    const std::size_t length = std::min(chunkSize, message.size() - offset);
+
+    std::vector<std::byte> datagram;
+    datagram.reserve(Framing::FRAGMENT_HEADER_SIZE + length);
+    datagram.push_back(static_cast<std::byte>(Framing::FRAME_MAGIC));
+    datagram.push_back(static_cast<std::byte>(Framing::KIND_FRAGMENT));
+    writeU16(datagram, messageId);
+    datagram.push_back(static_cast<std::byte>(index));
+    datagram.push_back(static_cast<std::byte>(count));
+    datagram.insert(datagram.end(), message.begin() + static_cast<std::ptrdiff_t>(offset),
+                    message.begin() + static_cast<std::ptrdiff_t>(offset + length));
+    m_ready.push_back(std::move(datagram));
+  }
+}
+
+void PacketFramer::closeBundle()
+{
+  if (!m_bundle.empty()) {
+    m_ready.push_back(std::move(m_bundle));
+    m_bundle.clear();
+  }
+}
+
+std::vector<std::vector<std::byte>> PacketFramer::flush()
+{
+  closeBundle();
+  std::vector<std::vector<std::byte>> datagrams;
+  datagrams.swap(m_ready);
+  return datagrams;
+}
+
+bool PacketFramer::hasPending() const
+{
+  return !m_bundle.empty() || !m_ready.empty();
+}
+
+// ============================================================================
+// PacketReassembler
+// ============================================================================
+
+PacketReassembler::PacketReassembler(std::chrono::milliseconds timeout, std::size_t maxPendingMessages)
+    : m_timeout(timeout), m_maxPendingMessages(maxPendingMessages)
+{
+}
+
+bool PacketReassembler::onDatagram(std::span<const std::byte> datagram, Clock::time_point now,
+                                   std::vector<std::vector<std::byte>> &out)
+{
+  if (datagram.size() < Framing::HEADER_SIZE ||
+      std::to_integer<std::uint8_t>(datagram[0]) != Framing::FRAME_MAGIC) {
+    return false;
+  }
+
+  switch (std::to_integer<std::uint8_t>(datagram[1])) {
+    case Framing::KIND_BUNDLE:
+      return onBundle(datagram.subspan(Framing::HEADER_SIZE), out);
+    case Framing::KIND_FRAGMENT:
+      return onFragment(datagram, now, out);
+    default:
+      return false;
+  }
+}
+
+bool PacketReassembler::onBundle(std::span<const std::byte> body, std::vector<std::vector<std::byte>> &out)
+{
+  // Validate the whole bundle first so a truncated datagram yields nothing
+  std::size_t offset = 0;
+  std::size_t messages = 0;
+  while (offset < body.size()) {
+    if (offset + Framing::LENGTH_PREFIX_SIZE > body.size()) {
+      return false;
+    }
+    const std::size_t length = readU16(body, offset);
+    offset += Framing::LENGTH_PREFIX_SIZE;
+    if (length == 0 || offset + length > body.size()) {
+      return false;
+    }
+    offset += length;
+    ++messages;
+  }
+  if (messages == 0) {
+    return false;
+  }
+
+  offset = 0;
+  while (offset < body.size()) {
+    const std::size_t length = readU16(body, offset);
+    offset += Framing::LENGTH_PREFIX_SIZE;
+    const auto message = body.subspan(offset, length);
+    out.emplace_back(message.begin(), message.end());
+    offset += length;
+  }
+  return true;
+}
+
+bool PacketReassembler::onFragment(std::span<const std::byte> datagram, Clock::time_point now,
+                                   std::vector<std::vector<std::byte>> &out)
+{
+  if (datagram.size() <= Framing::FRAGMENT_HEADER_SIZE) {
+    return false;
+  }
+  const std::uint16_t messageId = readU16(datagram, Framing::HEADER_SIZE);
+  const auto index = std::to_integer<std::uint8_t>(datagram[Framing::HEADER_SIZE + 2]);
+  const auto count = std::to_integer<std::uint8_t>(datagram[Framing::HEADER_SIZE + 3]);
+  if (count < 2 || index >= count) {
+    return false;
+  }
+
+  auto it = m_partials.find(messageId);
+  if (it == m_partials.end()) {
+    if (std::find(m_recentlyCompleted.begin(), m_recentlyCompleted.end(), messageId) != m_recentlyCompleted.end()) {
+      return true; // Late duplicate of a message already delivered
+    }
+    // Bound memory: evict the oldest incomplete message
+    if (m_partials.size() >= m_maxPendingMessages) {
+      auto oldest = std::min_element(m_partials.begin(), m_partials.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.second.firstSeen < rhs.second.firstSeen;
+      });
+      m_partials.erase(oldest);
+    }
+    PartialMessage partial;
+    partial.count = count;
+    partial.chunks.resize(count);
+    partial.firstSeen = now;
+    it = m_partials.emplace(messageId, std::move(partial)).first;
+  }
+
+  auto &partial = it->second;
+  if (partial.count != count) {
+    // Message id reused with a different layout: restart
+    m_partials.erase(it);
+    return false;
+  }
+  auto &chunk = partial.chunks[index];
+  if (!chunk.empty()) {
+    return true; // Duplicate fragment
+  }
+
+  const auto payload = datagram.subspan(Framing::FRAGMENT_HEADER_SIZE);
+  if (partial.totalSize + payload.size() > static_cast<std::size_t>(BUFFER_SIZE)) {
+    m_partials.erase(it);
+    return false;
+  }
+  chunk.assign(payload.begin(), payload.end());
+  partial.totalSize += payload.size();
+  ++partial.received;
+
+  if (partial.received == partial.count) {
+    std::vector<std::byte> message;
+    message.reserve(partial.totalSize);
+    for (const auto &part : partial.chunks) {
+      message.insert(message.end(), part.begin(), part.end());
+    }
+    out.push_back(std::move(message));
+    m_partials.erase(it);
+    m_recentlyCompleted.push_back(messageId);
+    if (m_recentlyCompleted.size() > m_maxPendingMessages) {
+      m_recentlyCompleted.pop_front();
+    }
+  }
+  return true;
+}
+
+std::size_t PacketReassembler::purgeExpired(Clock::time_point now)
+{
+  std::size_t dropped = 0;
+  for (auto it = m_partials.begin(); it != m_partials.end();) {
+    if (now - it->second.firstSeen > m_timeout) {
+      it = m_partials.erase(it);
+      ++dropped;
+    } else {
+      ++it;
+    }
+  }
+  return dropped;
+}
+
+std::size_t PacketReassembler::getPendingCount() const
+{
+  return m_partials.size();
+}
@@ -0,0 +1,367 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** SimulatedNetworkManager.cpp
+*/
+
+#include "../include/SimulatedNetworkManager.hpp"
+#include "../include/CapnpHandler.hpp"
+#include "../include/NetworkConfig.hpp"
+#include <exception>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+/** @brief SplitMix64 step: spreads (seed, client, direction) into unrelated stream seeds */
+std::uint64_t mixSeed(std::uint64_t value)
+{
+  value += 0x9e3779b97f4a7c15ULL;
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+  return value ^ (value >> 31);
+}
+} // namespace
+
+SimulatedNetwork::Path::Path(const Settings &settings, std::uint64_t seed)
+    : upstream(settings.upstream, mixSeed(seed)), downstream(settings.downstream, mixSeed(seed + 1))
+{
+}
+
+SimulatedNetwork::SimulatedNetwork(const Settings &settings) : m_settings(settings), m_manualNow(Clock::now()) {}
+
+std::shared_ptr<SimulatedNetworkManager> SimulatedNetwork::createServer()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_hasServer) {
+      throw std::logic_error("SimulatedNetwork already has a server");
+    }
+    m_hasServer = true;
+  }
+  return std::make_shared<SimulatedNetworkManager>(shared_from_this(), SimulatedNetworkManager::Role::SERVER, 0);
+}
+
+std::shared_ptr<SimulatedNetworkManager> SimulatedNetwork::createClient()
+{
+  std::uint32_t clientId = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    clientId = m_nextClientId++;
+    m_paths.try_emplace(clientId, m_settings, m_settings.seed + 2 * static_cast<std::uint64_t>(clientId));
+  }
+  return std::make_shared<SimulatedNetworkManager>(shared_from_this(), SimulatedNetworkManager::Role::CLIENT,
+                                                   clientId);
+}
+
+SimulatedNetwork::Clock::time_point SimulatedNetwork::now() const
+{
+  if (!m_settings.manualClock) {
+    return Clock::now();
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_manualNow;
+}
+
+void SimulatedNetwork::advance(Clock::duration duration)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_manualNow += duration;
+}
+
+ConditionerStats SimulatedNetwork::getUpstreamStats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ConditionerStats total;
+  for (const auto &[clientId, path] : m_paths) {
+    const auto &stats = path.upstream.getStats();
+    total.sent += stats.sent;
+    total.delivered += stats.delivered;
+    total.lost += stats.lost;
+    total.overflowed += stats.overflowed;
+    total.duplicated += stats.duplicated;
+    total.reordered += stats.reordered;
+    total.retransmitted += stats.retransmitted;
+    total.bytesDelivered += stats.bytesDelivered;
+  }
+  return total;
+}
+
+ConditionerStats SimulatedNetwork::getDownstreamStats() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ConditionerStats total;
+  for (const auto &[clientId, path] : m_paths) {
+    const auto &stats = path.downstream.getStats();
+    total.sent += stats.sent;
+    total.delivered += stats.delivered;
+    total.lost += stats.lost;
+    total.overflowed += stats.overflowed;
+    total.duplicated += stats.duplicated;
+    total.reordered += stats.reordered;
+    total.retransmitted += stats.retransmitted;
+    total.bytesDelivered += stats.bytesDelivered;
+  }
+  return total;
+}
+
+void SimulatedNetwork::connect(std::uint32_t clientId)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_pendingConnections.push_back(clientId);
+}
+
+std::vector<std::uint32_t> SimulatedNetwork::takeConnections()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return std::exchange(m_pendingConnections, {});
+}
+
+void SimulatedNetwork::transmit(std::uint32_t clientId, bool toServer, std::vector<std::vector<std::byte>> &datagrams)
+{
+  const auto sentAt = now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_paths.find(clientId);
+  if (it == m_paths.end()) {
+    return;
+  }
+  // Datagrams carry no delivery guarantee: the links above resend what is lost
+  NetworkConditioner &conditioner = toServer ? it->second.upstream : it->second.downstream;
+  for (auto &datagram : datagrams) {
+    conditioner.push(std::move(datagram), clientId, Channel::UNRELIABLE_SEQUENCED, sentAt);
+  }
+}
+
+std::vector<std::pair<std::uint32_t, std::vector<std::byte>>> SimulatedNetwork::deliverToServer()
+{
+  const auto at = now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<std::pair<std::uint32_t, std::vector<std::byte>>> due;
+  NetworkConditioner::Item item;
+  for (auto &[clientId, path] : m_paths) {
+    while (path.upstream.pop(at, item)) {
+      due.emplace_back(clientId, std::move(item.data));
+    }
+  }
+  return due;
+}
+
+std::vector<std::vector<std::byte>> SimulatedNetwork::deliverToClient(std::uint32_t clientId)
+{
+  const auto at = now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<std::vector<std::byte>> due;
+  auto it = m_paths.find(clientId);
+  if (it == m_paths.end()) {
+    return due;
+  }
+  NetworkConditioner::Item item;
+  while (it->second.downstream.pop(at, item)) {
+    due.push_back(std::move(item.data));
+  }
+  return due;
+}
+
+SimulatedNetworkManager::SimulatedNetworkManager(std::shared_ptr<SimulatedNetwork> network, Role role,
+                                                 std::uint32_t clientId)
+    : ANetworkManager(std::make_shared<CapnpHandler>()), m_network(std::move(network)), m_role(role),
+      m_clientId(clientId)
+{
+}
+
+void SimulatedNetworkManager::start()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_started = true;
+  if (m_role == Role::CLIENT) {
+    m_links.try_emplace(m_clientId);
+    m_network->connect(m_clientId);
+  }
+}
+
+void SimulatedNetworkManager::stop()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_started = false;
+}
+
+void SimulatedNetworkManager::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId)
+{
+  send(data, targetEndpointId, Channel::RELIABLE_ORDERED);
+}
+
+void SimulatedNetworkManager::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId,
+                                   Channel channel)
+{
+  const auto now = m_network->now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const std::uint32_t linkId = m_role == Role::CLIENT ? m_clientId : targetEndpointId;
+  auto it = m_links.find(linkId);
+  if (it == m_links.end()) {
+    std::cerr << "[SimulatedNetwork] Endpoint not connected: " << linkId << '\n';
+    return;
+  }
+  if (!it->second.send(data, channel, now)) {
+    std::cerr << "[SimulatedNetwork] Message too large (" << data.size() << " bytes)" << '\n';
+    return;
+  }
+  // Like AsioClient, a client puts each message on the wire right away
+  if (m_role == Role::CLIENT) {
+    flushLinks(now);
+  }
+}
+
+void SimulatedNetworkManager::flush()
+{
+  const auto now = m_network->now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  flushLinks(now);
+}
+
+void SimulatedNetworkManager::flushLinks(SimulatedNetwork::Clock::time_point now)
+{
+  for (auto &[linkId, link] : m_links) {
+    if (!link.hasPending()) {
+      continue;
+    }
+    auto datagrams = link.flush(now);
+    m_network->transmit(linkId, m_role == Role::CLIENT, datagrams);
+  }
+}
+
+void SimulatedNetworkManager::admitPending()
+{
+  for (const std::uint32_t clientId : m_network->takeConnections()) {
+    if (!m_links.try_emplace(clientId).second) {
+      continue;
+    }
+    try {
+      nlohmann::json hello;
+      hello["type"] = "assign_id";
+      hello["client_id"] = clientId;
+      const auto serialized = getPacketHandler()->serialize(hello.dump());
+      m_links[clientId].send(
+        std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()),
+        Channel::RELIABLE_ORDERED, m_network->now());
+    } catch ([[maybe_unused]] const std::exception &e) { // NOLINT(bugprone-empty-catch)
+      // Best-effort, like the real servers
+    }
+  }
+}
+
+void SimulatedNetworkManager::receiveDue()
+{
+  const auto now = m_network->now();
+  std::vector<std::vector<std::byte>> messages;
+
+  if (m_role == Role::SERVER) {
+    for (auto &[clientId, datagram] : m_network->deliverToServer()) {
+      auto it = m_links.find(clientId);
+      if (it == m_links.end()) {
+        continue; // Not admitted or disconnected: dropped like on a real server
+      }
+      messages.clear();
+      it->second.onDatagram(datagram, now, messages);
+      for (auto &payload : messages) {
+        m_inbox.emplace_back(clientId, std::move(payload));
+      }
+    }
+    return;
+  }
+
+  auto it = m_links.find(m_clientId);
+  if (it == m_links.end()) {
+    return;
+  }
+  for (const auto &datagram : m_network->deliverToClient(m_clientId)) {
+    messages.clear();
+    it->second.onDatagram(datagram, now, messages);
+    for (auto &payload : messages) {
+      m_inbox.emplace_back(0, std::move(payload)); // The server is endpoint 0, as for AsioClient
+    }
+  }
+}
+
+bool SimulatedNetworkManager::poll(NetworkPacket &msg)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_started) {
+    return false;
+  }
+  if (m_inbox.empty()) {
+    if (m_role == Role::SERVER) {
+      admitPending();
+    }
+    receiveDue();
+    // Acks, resends and a new client's assign_id leave without waiting for the next flush()
+    flushLinks(m_network->now());
+  }
+  if (m_inbox.empty()) {
+    return false;
+  }
+  auto &[senderId, payload] = m_inbox.front();
+  msg = NetworkPacket(payload, senderId);
+  m_inbox.pop_front();
+  return true;
+}
+
+std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> SimulatedNetworkManager::getClients() const
+{
+  std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> clients;
+  if (m_role != Role::SERVER) {
+    return clients;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const auto &[clientId, link] : m_links) {
+    // Synthetic addresses: nothing is bound, they only tell clients apart
+    clients.emplace(clientId, asio::ip::udp::endpoint(asio::ip::address_v4::loopback(),
+                                                      static_cast<unsigned short>(
+                                                        NetworkConfig::SIMULATION_CLIENT_PORT_BASE + clientId)));
+  }
+  return clients;
+}
+
+void SimulatedNetworkManager::disconnect(std::uint32_t clientId)
+{
+  if (m_role != Role::SERVER) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_links.erase(clientId);
+}
+
+float SimulatedNetworkManager::getLatency() const
+{
+  if (m_role != Role::CLIENT) {
+    return -1.0f;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_links.find(m_clientId);
+  if (it == m_links.end() || it->second.getChannels().getRttMs() <= 0.0f) {
+    return -1.0f;
+  }
+  return it->second.getChannels().getRttMs();
+}
+
+NetworkStats SimulatedNetworkManager::getNetworkStats() const
+{
+  NetworkStats stats;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  stats.incomingQueueDepth = m_inbox.size();
+  for (const auto &[clientId, link] : m_links) {
+    ConnectionStats connection;
+    connection.clientId = m_role == Role::SERVER ? clientId : 0;
+    fillChannelStats(connection, link.getChannels());
+    stats.connections.push_back(connection);
+  }
+  return stats;
+}
+
+bool SimulatedNetworkManager::isConnected() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_role == Role::SERVER || m_started;
+}
@@ -0,0 +1,860 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** UringServer.cpp
+*/
+
+#include "../include/UringServer.hpp"
+#include "../../engineCore/include/utils/Log.hpp"
+#include "../../engineCore/include/utils/Trace.hpp"
+#include "../include/CapnpHandler.hpp"
+#include "../include/NetworkConfig.hpp"
+#include "ANetworkManager.hpp"
+#include "Common.hpp"
+#include "Handshake.hpp"
+#include "network/NetworkPacket.hpp"
+#include "NetworkLink.hpp"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <initializer_list>
+#include <iostream>
+#include <linux/io_uring.h>
+#include <mutex>
+#include <netinet/in.h>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/utsname.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace
+{
+constexpr std::uint64_t RECEIVE_TAG = 1ULL << 62;
+constexpr std::uint64_t STOP_TAG = 1ULL << 61;
+constexpr std::uint64_t SEND_TAG = 1ULL << 60; // Low bits: send slot index
+constexpr std::uint16_t RECEIVE_BUFFER_GROUP = 0;
+
+int ioUringSetup(unsigned entries, io_uring_params *params)
+{
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+{
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+int ioUringRegister(int fd, unsigned opcode, void *arg, unsigned nrArgs)
+{
+  return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs));
+}
+
+std::uint32_t loadAcquire(const std::uint32_t *value)
+{
+  return std::atomic_ref<const std::uint32_t>(*value).load(std::memory_order_acquire);
+}
+
+void storeRelease(std::uint32_t *value, std::uint32_t newValue)
+{
+  std::atomic_ref<std::uint32_t>(*value).store(newValue, std::memory_order_release);
+}
+
+void *mapRing(int fd, std::size_t size, std::uint64_t offset)
+{
+  void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, static_cast<off_t>(offset));
+  if (ptr == MAP_FAILED) {
+    throw std::system_error(errno, std::generic_category(), "io_uring mmap");
+  }
+  return ptr;
+}
+
+asio::ip::udp::endpoint toEndpoint(const sockaddr_in &address)
+{
+  return {asio::ip::address_v4(ntohl(address.sin_addr.s_addr)), ntohs(address.sin_port)};
+}
+} // namespace
+
+/**
+ * @brief Raw io_uring state: SQ/CQ mappings, provided buffer ring, send slots
+ *
+ * The SQ and the send slots are shared by the game thread (sends) and the
+ * network thread (re-arming the receive), so they are guarded by mutex.
+ * The CQ and the buffer ring are only touched by the network thread.
+ */
+struct UringServer::Ring {
+  struct SendSlot {
+    sockaddr_in address{};
+    iovec iov{};
+    msghdr header{};
+    std::vector<std::byte> payload;
+    std::shared_ptr<ClientCounters> counters; // Charged on completion, null for handshake replies
+  };
+
+  explicit Ring(unsigned entries)
+  {
+    fd = ioUringSetup(entries, &params);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(), "io_uring_setup");
+    }
+    try {
+      sqMapSize = params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+      cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+      if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0U) {
+        sqMapSize = std::max(sqMapSize, cqMapSize);
+        cqMapSize = sqMapSize;
+      }
+      sqMap = mapRing(fd, sqMapSize, IORING_OFF_SQ_RING);
+      cqMap = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0U) ? sqMap : mapRing(fd, cqMapSize, IORING_OFF_CQ_RING);
+      sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+      sqes = static_cast<io_uring_sqe *>(mapRing(fd, sqesSize, IORING_OFF_SQES));
+    } catch (...) {
+      release();
+      throw;
+    }
+
+    auto *sq = static_cast<std::byte *>(sqMap);
+    sqHead = reinterpret_cast<std::uint32_t *>(sq + params.sq_off.head);
+    sqTail = reinterpret_cast<std::uint32_t *>(sq + params.sq_off.tail);
+    sqMask = *reinterpret_cast<std::uint32_t *>(sq + params.sq_off.ring_mask);
+    sqArray = reinterpret_cast<std::uint32_t *>(sq + params.sq_off.array);
+    localSqTail = *sqTail;
+
+    auto *cq = static_cast<std::byte *>(cqMap);
+    cqHead = reinterpret_cast<std::uint32_t *>(cq + params.cq_off.head);
+    cqTail = reinterpret_cast<std::uint32_t *>(cq + params.cq_off.tail);
+    cqMask = *reinterpret_cast<std::uint32_t *>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+  }
+
+  ~Ring() { release(); }
+
+  Ring(const Ring &) = delete;
+  Ring &operator=(const Ring &) = delete;
+
+  void release()
+  {
+    if (bufferRing != nullptr) {
+      munmap(bufferRing, bufferRingSize);
+      bufferRing = nullptr;
+      bufferRingTail = nullptr;
+    }
+    if (sqes != nullptr) {
+      munmap(sqes, sqesSize);
+      sqes = nullptr;
+    }
+    if (cqMap != nullptr && cqMap != sqMap) {
+      munmap(cqMap, cqMapSize);
+    }
+    cqMap = nullptr;
+    if (sqMap != nullptr) {
+      munmap(sqMap, sqMapSize);
+      sqMap = nullptr;
+    }
+    if (fd >= 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+
+  [[nodiscard]] bool supportsOps(std::initializer_list<std::uint8_t> ops) const
+  {
+    constexpr unsigned PROBE_OPS = 256;
+    std::vector<std::byte> storage(sizeof(io_uring_probe) + PROBE_OPS * sizeof(io_uring_probe_op));
+    auto *probe = reinterpret_cast<io_uring_probe *>(storage.data());
+    if (ioUringRegister(fd, IORING_REGISTER_PROBE, probe, PROBE_OPS) < 0) {
+      return false;
+    }
+    for (std::uint8_t op : ops) {
+      if (op > probe->last_op || (probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** @brief Register a provided buffer ring of count buffers of size bytes */
+  void registerBuffers(unsigned count, unsigned size)
+  {
+    bufferCount = count;
+    bufferSize = size;
+    bufferRingSize = count * sizeof(io_uring_buf);
+    void *ringMemory = mmap(nullptr, bufferRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ringMemory == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category(), "buffer ring mmap");
+    }
+    // Index the ring as a plain io_uring_buf array: in C++ the flexible
+    // `bufs` member of io_uring_buf_ring is not at offset 0. The tail
+    // overlays the resv field of the first entry.
+    bufferRing = static_cast<io_uring_buf *>(ringMemory);
+    bufferRingTail =
+      reinterpret_cast<std::uint16_t *>(static_cast<std::byte *>(ringMemory) + offsetof(io_uring_buf, resv));
+
+    io_uring_buf_reg registration{};
+    registration.ring_addr = reinterpret_cast<std::uint64_t>(bufferRing);
+    registration.ring_entries = count;
+    registration.bgid = RECEIVE_BUFFER_GROUP;
+    if (ioUringRegister(fd, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+      throw std::system_error(errno, std::generic_category(), "IORING_REGISTER_PBUF_RING");
+    }
+
+    bufferPool.resize(static_cast<std::size_t>(count) * size);
+    for (unsigned bid = 0; bid < count; ++bid) {
+      recycleBuffer(static_cast<std::uint16_t>(bid));
+    }
+    publishBuffers();
+  }
+
+  std::byte *buffer(std::uint16_t bid) { return bufferPool.data() + static_cast<std::size_t>(bid) * bufferSize; }
+
+  void recycleBuffer(std::uint16_t bid)
+  {
+    io_uring_buf &entry = bufferRing[localBufferTail & (bufferCount - 1)];
+    entry.addr = reinterpret_cast<std::uint64_t>(buffer(bid));
+    entry.len = bufferSize;
+    entry.bid = bid;
+    ++localBufferTail;
+  }
+
+  void publishBuffers()
+  {
+    std::atomic_ref<std::uint16_t>(*bufferRingTail).store(localBufferTail, std::memory_order_release);
+  }
+
+  /** @brief Next free SQE, or nullptr when the SQ is full (caller holds the mutex) */
+  io_uring_sqe *nextSqe()
+  {
+    if (localSqTail - loadAcquire(sqHead) >= params.sq_entries) {
+      return nullptr;
+    }
+    const std::uint32_t index = localSqTail & sqMask;
+    io_uring_sqe *sqe = &sqes[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqArray[index] = index;
+    ++localSqTail;
+    ++unsubmitted;
+    return sqe;
+  }
+
+  /** @brief Hand every prepared SQE to the kernel (caller holds the mutex) */
+  void submit()
+  {
+    if (unsubmitted == 0) {
+      return;
+    }
+    storeRelease(sqTail, localSqTail);
+    int submitted = 0;
+    do {
+      submitted = ioUringEnter(fd, unsubmitted, 0, 0);
+    } while (submitted < 0 && errno == EINTR);
+    if (submitted < 0) {
+      std::cerr << "[Server] io_uring submit error: " << std::strerror(errno) << '\n';
+      return;
+    }
+    unsubmitted -= std::min<unsigned>(unsubmitted, static_cast<unsigned>(submitted));
+  }
+
+  /** @brief Free send slot index, growing the pool if needed (caller holds the mutex) */
+  std::uint32_t acquireSlot()
+  {
+    if (freeSlots.empty()) {
+      sendSlots.emplace_back();
+      return static_cast<std::uint32_t>(sendSlots.size() - 1);
+    }
+    const std::uint32_t slot = freeSlots.back();
+    freeSlots.pop_back();
+    return slot;
+  }
+
+  int fd{-1};
+  io_uring_params params{};
+  void *sqMap{nullptr};
+  std::size_t sqMapSize{0};
+  void *cqMap{nullptr};
+  std::size_t cqMapSize{0};
+  io_uring_sqe *sqes{nullptr};
+  std::size_t sqesSize{0};
+
+  std::uint32_t *sqHead{nullptr};
+  std::uint32_t *sqTail{nullptr};
+  std::uint32_t sqMask{0};
+  std::uint32_t *sqArray{nullptr};
+  std::uint32_t localSqTail{0};
+  unsigned unsubmitted{0};
+
+  std::uint32_t *cqHead{nullptr};
+  std::uint32_t *cqTail{nullptr};
+  std::uint32_t cqMask{0};
+  io_uring_cqe *cqes{nullptr};
+
+  io_uring_buf *bufferRing{nullptr};
+  std::uint16_t *bufferRingTail{nullptr};
+  std::size_t bufferRingSize{0};
+  unsigned bufferCount{0};
+  unsigned bufferSize{0};
+  std::uint16_t localBufferTail{0};
+  std::vector<std::byte> bufferPool;
+
+  // Receive request, must outlive the multishot recvmsg
+  msghdr receiveHeader{};
+
+  std::mutex submitMutex;
+  std::deque<SendSlot> sendSlots; // Deque: slots never move while in flight
+  std::vector<std::uint32_t> freeSlots;
+};
+
+bool UringServer::isSupported()
+{
+  // Multishot recvmsg landed in 6.0, provided buffer rings in 5.19
+  utsname info{};
+  if (uname(&info) != 0) {
+    return false;
+  }
+  int major = 0;
+  int minor = 0;
+  if (std::sscanf(info.release, "%d.%d", &major, &minor) != 2 || major < 6) {
+    return false;
+  }
+
+  try {
+    Ring probe(8);
+    if (!probe.supportsOps({IORING_OP_RECVMSG, IORING_OP_SENDMSG, IORING_OP_NOP})) {
+      return false;
+    }
+    probe.registerBuffers(1, NetworkConfig::URING_RECEIVE_BUFFER_SIZE);
+  } catch (const std::system_error &) {
+    return false;
+  }
+  return true;
+}
+
+UringServer::UringServer(std::uint16_t port)
+    : ANetworkManager(std::make_shared<CapnpHandler>()), m_keepalive(*getPacketHandler())
+{
+  m_socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  if (m_socket < 0) {
+    throw std::system_error(errno, std::generic_category(), "socket");
+  }
+
+  const int receiveBufferSize = NetworkConfig::RECEIVE_BUFFER_SIZE_KB * NetworkConfig::RECEIVE_BUFFER_SIZE_KB *
+                                NetworkConfig::RECEIVE_BUFFER_MULTIPLIER;
+  setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &receiveBufferSize, sizeof(receiveBufferSize));
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  if (bind(m_socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+    const int error = errno;
+    close(m_socket);
+    throw std::system_error(error, std::generic_category(), "bind");
+  }
+
+  try {
+    m_ring = std::make_unique<Ring>(NetworkConfig::URING_QUEUE_DEPTH);
+    m_ring->registerBuffers(NetworkConfig::URING_RECEIVE_BUFFER_COUNT, NetworkConfig::URING_RECEIVE_BUFFER_SIZE);
+  } catch (...) {
+    m_ring.reset();
+    close(m_socket);
+    throw;
+  }
+  std::cout << "[Server] Listening on port " << port << " (io_uring backend)" << '\n';
+}
+
+UringServer::~UringServer()
+{
+  stop();
+  m_ring.reset();
+  if (m_socket >= 0) {
+    close(m_socket);
+  }
+}
+
+void UringServer::start()
+{
+  if (m_running.exchange(true)) {
+    return;
+  }
+  armReceive();
+  m_thread = std::thread([this]() {
+    RTYPE_TRACE_THREAD("net-uring");
+    run();
+  });
+}
+
+void UringServer::stop()
+{
+  if (!m_running.exchange(false)) {
+    return;
+  }
+  {
+    // Wake the network thread out of io_uring_enter
+    std::lock_guard<std::mutex> lock(m_ring->submitMutex);
+    io_uring_sqe *sqe = m_ring->nextSqe();
+    if (sqe != nullptr) {
+      sqe->opcode = IORING_OP_NOP;
+      sqe->user_data = STOP_TAG;
+    }
+    m_ring->submit();
+  }
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void UringServer::armReceive()
+{
+  std::lock_guard<std::mutex> lock(m_ring->submitMutex);
+  io_uring_sqe *sqe = m_ring->nextSqe();
+  if (sqe == nullptr) {
+    m_ring->submit();
+    sqe = m_ring->nextSqe();
+  }
+  if (sqe == nullptr) {
+    std::cerr << "[Server] io_uring submission queue full, receive not armed" << '\n';
+    return;
+  }
+  m_ring->receiveHeader = msghdr{};
+  m_ring->receiveHeader.msg_namelen = sizeof(sockaddr_in);
+  sqe->opcode = IORING_OP_RECVMSG;
+  sqe->fd = m_socket;
+  sqe->addr = reinterpret_cast<std::uint64_t>(&m_ring->receiveHeader);
+  sqe->len = 1;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = RECEIVE_BUFFER_GROUP;
+  sqe->user_data = RECEIVE_TAG;
+  m_ring->submit();
+}
+
+void UringServer::run()
+{
+  Ring &ring = *m_ring;
+  std::vector<std::pair<std::uint32_t, int>> completedSlots; // Slot index, result
+  bool stopping = false;
+
+  while (!stopping) {
+    if (ioUringEnter(ring.fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR && errno != EBUSY) {
+      std::cerr << "[Server] io_uring wait error: " << std::strerror(errno) << '\n';
+      break;
+    }
+
+    bool rearm = false;
+    bool recycled = false;
+    std::uint32_t head = *ring.cqHead;
+    const std::uint32_t tail = loadAcquire(ring.cqTail);
+    for (; head != tail; ++head) {
+      const io_uring_cqe cqe = ring.cqes[head & ring.cqMask];
+
+      if (cqe.user_data == STOP_TAG) {
+        stopping = true;
+        continue;
+      }
+      if ((cqe.user_data & SEND_TAG) != 0U) {
+        if (cqe.res < 0) {
+          std::cerr << "[Server] Send error: " << std::strerror(-cqe.res) << '\n';
+        }
+        completedSlots.emplace_back(static_cast<std::uint32_t>(cqe.user_data & ~SEND_TAG), cqe.res);
+        continue;
+      }
+
+      // Receive completion
+      if ((cqe.flags & IORING_CQE_F_MORE) == 0U) {
+        rearm = true;
+      }
+      if (cqe.res < 0) {
+        if (cqe.res != -ENOBUFS) {
+          RTYPE_LOG_EVERY(::logging::Level::WARN, 1.0, "[Server] Receive error: " << std::strerror(-cqe.res));
+        }
+        continue;
+      }
+      if ((cqe.flags & IORING_CQE_F_BUFFER) == 0U) {
+        continue;
+      }
+      const auto bid = static_cast<std::uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+      std::byte *buffer = ring.buffer(bid);
+      const auto *out = reinterpret_cast<const io_uring_recvmsg_out *>(buffer);
+      const std::byte *name = buffer + sizeof(io_uring_recvmsg_out);
+      const std::byte *payload = name + ring.receiveHeader.msg_namelen + ring.receiveHeader.msg_controllen;
+
+      if ((out->flags & MSG_TRUNC) != 0U) {
+        RTYPE_LOG_EVERY(::logging::Level::WARN, 1.0, "[Server] Dropped oversized datagram");
+      } else if (out->payloadlen > 0 && out->namelen >= sizeof(sockaddr_in)) {
+        sockaddr_in sender{};
+        std::memcpy(&sender, name, sizeof(sender));
+        try {
+          onDatagram(toEndpoint(sender), std::span<const std::byte>(payload, out->payloadlen));
+        } catch (const std::exception &e) {
+          std::cerr << "[Server] Receive handling error: " << e.what() << '\n';
+        }
+      }
+      ring.recycleBuffer(bid);
+      recycled = true;
+    }
+    storeRelease(ring.cqHead, head);
+
+    if (recycled) {
+      ring.publishBuffers();
+    }
+    if (!completedSlots.empty()) {
+      std::lock_guard<std::mutex> lock(ring.submitMutex);
+      for (const auto &[slotIndex, result] : completedSlots) {
+        Ring::SendSlot &slot = ring.sendSlots[slotIndex];
+        const auto bytes = static_cast<std::size_t>(std::max(result, 0));
+        m_traffic.onSendCompleted(bytes, result >= 0);
+        if (slot.counters) {
+          slot.counters->traffic.onSendCompleted(bytes, result >= 0);
+          slot.counters.reset();
+        }
+        ring.freeSlots.push_back(slotIndex);
+      }
+      completedSlots.clear();
+    }
+    if (rearm && !stopping && m_running) {
+      armReceive();
+    }
+  }
+}
+
+std::pair<std::uint32_t, bool> UringServer::getOrCreateClientId(const asio::ip::udp::endpoint &endpoint)
+{
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
+  auto it = m_endpointIds.find(endpoint);
+  if (it != m_endpointIds.end()) {
+    return {it->second, false};
+  }
+  std::uint32_t clientId = m_nextClientId++;
+  m_clients[clientId] = endpoint;
+  m_endpointIds[endpoint] = clientId;
+  ++m_connectedPlayersCount;
+  RTYPE_LOG_INFO("[Server] New client connected: " << clientId);
+  return {clientId, true};
+}
+
+std::optional<std::uint32_t> UringServer::findClientId(const asio::ip::udp::endpoint &endpoint) const
+{
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
+  auto it = m_endpointIds.find(endpoint);
+  if (it == m_endpointIds.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+void UringServer::onDatagram(const asio::ip::udp::endpoint &sender, std::span<const std::byte> datagram)
+{
+  RTYPE_TRACE_SCOPE("UringServer::onDatagram");
+  m_traffic.onReceived(datagram.size());
+  if (Handshake::isHandshake(datagram)) {
+    handleHandshake(sender, datagram);
+    return;
+  }
+
+  const auto clientId = findClientId(sender);
+  if (!clientId) {
+    // Not admitted: dropped before touching any link or queue
+    m_gate.countUnauthenticated();
+    return;
+  }
+
+  const auto now = NetworkLink::Clock::now();
+  std::vector<std::vector<std::byte>> messages;
+  std::shared_ptr<ClientCounters> counters;
+  {
+    std::lock_guard<std::mutex> lock(m_linksMutex);
+    if (auto countersIt = m_counters.find(*clientId); countersIt != m_counters.end()) {
+      counters = countersIt->second;
+      counters->traffic.onReceived(datagram.size());
+    }
+    if (!m_links[*clientId].onDatagram(datagram, now, messages)) {
+      RTYPE_LOG_EVERY(::logging::Level::WARN, 1.0, "[Server] Dropped malformed datagram from client " << *clientId);
+    }
+  }
+  for (const auto &payload : messages) {
+    // Answers to flush()'s PING stay in the network layer
+    if (counters && m_keepalive.isPong(payload)) {
+      counters->onPong(now);
+      continue;
+    }
+    m_incomingMessages.push(NetworkPacket(payload, *clientId));
+  }
+}
+
+void UringServer::handleHandshake(const asio::ip::udp::endpoint &sender, std::span<const std::byte> datagram)
+{
+  // Late CONNECT/RESPONSE retries from an admitted client: its assign_id is
+  // already on the reliable channel
+  if (findClientId(sender)) {
+    return;
+  }
+
+  std::vector<std::byte> reply;
+  switch (m_gate.onHandshake(datagram, sender, NetworkLink::Clock::now(), reply)) {
+    case ConnectionGate::Verdict::CHALLENGE: {
+      std::vector<PendingSend> pending(1);
+      pending.front().endpoint = sender;
+      pending.front().datagrams.push_back(std::move(reply));
+      submitSends(pending);
+      break;
+    }
+    case ConnectionGate::Verdict::ACCEPT:
+      admitClient(sender);
+      break;
+    case ConnectionGate::Verdict::DROP:
+      break;
+  }
+}
+
+void UringServer::admitClient(const asio::ip::udp::endpoint &endpoint)
+{
+  auto [clientId, isNewClient] = getOrCreateClientId(endpoint);
+  if (!isNewClient) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_linksMutex);
+    m_counters[clientId] = std::make_shared<ClientCounters>();
+  }
+
+  // Tell the client its assigned id.
+  try {
+    nlohmann::json hello;
+    hello["type"] = "assign_id";
+    hello["client_id"] = clientId;
+    const std::string jsonStr = hello.dump();
+    const auto serialized = getPacketHandler()->serialize(jsonStr);
+    send(std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()),
+         clientId);
+    flushClient(clientId);
+    RTYPE_LOG_INFO("[Server] New client " << clientId << " connected, assigned ID sent");
+  } catch ([[maybe_unused]] const std::exception &e) { // NOLINT(bugprone-empty-catch)
+    // Best-effort handshake - silent failure acceptable for non-critical handshake
+  }
+}
+
+void UringServer::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId)
+{
+  send(data, targetEndpointId, Channel::RELIABLE_ORDERED);
+}
+
+void UringServer::send(std::span<const std::byte> data, const std::uint32_t &targetEndpointId, Channel channel)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_clientsMutex);
+    if (m_clients.find(targetEndpointId) == m_clients.end()) {
+      std::cerr << "[Server] Client ID not found: " << targetEndpointId << '\n';
+      return;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_linksMutex);
+  if (!m_links[targetEndpointId].send(data, channel, NetworkLink::Clock::now())) {
+    std::cerr << "[Server] Message too large (" << data.size() << " bytes) for client " << targetEndpointId << '\n';
+  }
+}
+
+void UringServer::flush()
+{
+  const auto now = NetworkLink::Clock::now();
+  const auto clients = getClients();
+  std::vector<PendingSend> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_linksMutex);
+    for (auto &[clientId, link] : m_links) {
+      auto clientIt = clients.find(clientId);
+      if (clientIt == clients.end()) {
+        continue;
+      }
+      std::shared_ptr<ClientCounters> counters;
+      if (auto countersIt = m_counters.find(clientId); countersIt != m_counters.end()) {
+        counters = countersIt->second;
+        if (counters->isPingDue(now)) {
+          link.send(m_keepalive.ping, Channel::UNRELIABLE_SEQUENCED, now);
+          counters->onPingSent(now);
+        }
+      }
+      if (!link.hasPending()) {
+        continue;
+      }
+      auto datagrams = link.flush(now);
+      if (!datagrams.empty()) {
+        pending.push_back(PendingSend{clientIt->second, std::move(datagrams), std::move(counters)});
+      }
+    }
+  }
+  submitSends(pending);
+}
+
+void UringServer::flushClient(std::uint32_t clientId)
+{
+  std::vector<PendingSend> pending(1);
+  {
+    std::lock_guard<std::mutex> lock(m_clientsMutex);
+    auto clientIt = m_clients.find(clientId);
+    if (clientIt == m_clients.end()) {
+      return;
+    }
+    pending.front().endpoint = clientIt->second;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_linksMutex);
+    auto linkIt = m_links.find(clientId);
+    if (linkIt == m_links.end()) {
+      return;
+    }
+    pending.front().datagrams = linkIt->second.flush(NetworkLink::Clock::now());
+    if (auto countersIt = m_counters.find(clientId); countersIt != m_counters.end()) {
+      pending.front().counters = countersIt->second;
+    }
+  }
+  submitSends(pending);
+}
+
+void UringServer::submitSends(std::vector<PendingSend> &pending)
+{
+  if (pending.empty() || !m_running) {
+    return;
+  }
+
+  // One SQE per datagram, all handed to the kernel in a single enter
+  std::lock_guard<std::mutex> lock(m_ring->submitMutex);
+  for (auto &[endpoint, datagrams, counters] : pending) {
+    for (auto &datagram : datagrams) {
+      m_traffic.onSendQueued();
+      if (counters) {
+        counters->traffic.onSendQueued();
+      }
+      io_uring_sqe *sqe = m_ring->nextSqe();
+      if (sqe == nullptr) {
+        m_ring->submit();
+        sqe = m_ring->nextSqe();
+        if (sqe == nullptr) {
+          std::cerr << "[Server] io_uring submission queue full, datagram dropped" << '\n';
+          m_traffic.onSendCompleted(0, false);
+          if (counters) {
+            counters->traffic.onSendCompleted(0, false);
+          }
+          continue;
+        }
+      }
+      const std::uint32_t slotIndex = m_ring->acquireSlot();
+      Ring::SendSlot &slot = m_ring->sendSlots[slotIndex];
+      slot.payload = std::move(datagram);
+      slot.counters = counters;
+      std::memcpy(&slot.address, endpoint.data(), sizeof(slot.address));
+      slot.iov.iov_base = slot.payload.data();
+      slot.iov.iov_len = slot.payload.size();
+      slot.header = msghdr{};
+      slot.header.msg_name = &slot.address;
+      slot.header.msg_namelen = sizeof(slot.address);
+      slot.header.msg_iov = &slot.iov;
+      slot.header.msg_iovlen = 1;
+
+      sqe->opcode = IORING_OP_SENDMSG;
+      sqe->fd = m_socket;
+      sqe->addr = reinterpret_cast<std::uint64_t>(&slot.header);
+      sqe->len = 1;
+      sqe->user_data = SEND_TAG | slotIndex;
+    }
+  }
+  m_ring->submit();
+}
+
+bool UringServer::poll(NetworkPacket &msg)
+{
+  return m_incomingMessages.pop(msg);
+}
+
+std::unordered_map<std::uint32_t, asio::ip::udp::endpoint> UringServer::getClients() const
+{
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
+  return m_clients;
+}
+
+std::size_t UringServer::getConnectedPlayersCount() const
+{
+  std::lock_guard<std::mutex> lock(m_clientsMutex);
+  return m_connectedPlayersCount;
+}
+
+void UringServer::disconnect(std::uint32_t clientId)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_clientsMutex);
+    auto it = m_clients.find(clientId);
+    if (it == m_clients.end()) {
+      return;
+    }
+    m_endpointIds.erase(it->second);
+    m_clients.erase(it);
+    if (m_connectedPlayersCount > 0) {
+      --m_connectedPlayersCount;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_linksMutex);
+    m_links.erase(clientId);
+    m_counters.erase(clientId);
+  }
+  std::cout << "[Server] Client " << clientId << " disconnected (kicked)" << '\n';
+}
+
+float UringServer::getLatency() const
+{
+  float sum = 0.0f;
+  int count = 0;
+  for (const auto &connection : getNetworkStats().connections) {
+    if (connection.rttMs >= 0.0f) {
+      sum += connection.rttMs;
+      ++count;
+    }
+  }
+  return count == 0 ? -1.0f : sum / static_cast<float>(count);
+}
+
+int UringServer::getPacketsPerSecond() const
+{
+  const auto rates = m_rates.update(m_traffic.load(), NetworkLink::Clock::now());
+  return rates.packetsInPerSecond + rates.packetsOutPerSecond;
+}
+
+int UringServer::getUploadBytesPerSecond() const
+{
+  return m_rates.update(m_traffic.load(), NetworkLink::Clock::now()).bytesOutPerSecond;
+}
+
+int UringServer::getDownloadBytesPerSecond() const
+{
+  return m_rates.update(m_traffic.load(), NetworkLink::Clock::now()).bytesInPerSecond;
+}
+
+NetworkStats UringServer::getNetworkStats() const
+{
+  NetworkStats stats;
+  stats.traffic = m_traffic.load();
+  const HandshakeStats gate = m_gate.getStats();
+  stats.droppedIn = gate.droppedUnauthenticated + gate.droppedBadCookie + gate.droppedMalformed;
+  stats.incomingQueueDepth = m_incomingMessages.size();
+  std::lock_guard<std::mutex> lock(m_linksMutex);
+  for (const auto &[clientId, counters] : m_counters) {
+    ConnectionStats connection;
+    connection.clientId = clientId;
+    connection.traffic = counters->traffic.load();
+    connection.rttMs = counters->getRttMs();
+    if (auto linkIt = m_links.find(clientId); linkIt != m_links.end()) {
+      fillChannelStats(connection, linkIt->second.getChannels());
+    }
+    stats.connections.push_back(connection);
+  }
+  return stats;
+}
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_capnp_handler.cpp
+*/
+
+#include "CapnpHandler.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string makeSnapshotLikeMessage()
+{
+  std::string message = R"({"type":"snapshot","entities":[)";
+  for (int i = 0; i < 40; ++i) {
+    message += R"({"id":)" + std::to_string(i) + R"(,"x":12.5,"y":300.0,"hp":100,"sprite":3},)";
+  }
+  message += "{}]}";
+  return message;
+}
+
+std::span<const std::byte> asBytes(const std::vector<std::uint8_t> &buffer, std::size_t offset = 0)
+{
+  return {reinterpret_cast<const std::byte *>(buffer.data()) + offset, buffer.size() - offset};
+}
+} // namespace
+
+TEST_CASE("CapnpHandler round-trips through a reused buffer")
+{
+  for (bool packed : {false, true}) {
+    CapnpHandler handler(packed);
+    std::vector<std::uint8_t> buffer;
+    for (const std::string &message : {std::string("PING"), makeSnapshotLikeMessage(), std::string("PONG")}) {
+      CHECK(handler.serializeInto(message, buffer) == buffer.size());
+      CHECK(handler.deserialize(asBytes(buffer)) == message);
+      CHECK(buffer == handler.serialize(message));
+    }
+  }
+}
+
+TEST_CASE("CapnpHandler packed encoding is smaller for snapshots")
+{
+  const std::string message = makeSnapshotLikeMessage();
+  CHECK(CapnpHandler(true).serialize(message).size() < CapnpHandler(false).serialize(message).size());
+}
+
+TEST_CASE("CapnpHandler reads misaligned input")
+{
+  CapnpHandler handler(false);
+  const std::string message = makeSnapshotLikeMessage();
+  const auto serialized = handler.serialize(message);
+
+  std::vector<std::uint8_t> shifted(serialized.size() + 1);
+  std::copy(serialized.begin(), serialized.end(), shifted.begin() + 1);
+  CHECK(handler.deserialize(asBytes(shifted, 1)) == message);
+}
+
+TEST_CASE("CapnpHandler rejects garbage")
+{
+  CapnpHandler handler(false);
+  const std::vector<std::uint8_t> notAMessage = {'{', '"', 't', 'y', 'p', 'e', '"', '}', 'x'};
+  CHECK_FALSE(handler.deserialize(asBytes(notAMessage)).has_value());
+  CHECK_FALSE(handler.deserialize(std::span<const std::byte>{}).has_value());
+}
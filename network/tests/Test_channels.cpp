@@ -0,0 +1,134 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_channels.cpp
+*/
+
+#include "Channel.hpp"
+#include "NetworkConfig.hpp"
+#include "NetworkLink.hpp"
+#include <chrono>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <vector>
+
+namespace
+{
+using Datagrams = std::vector<std::vector<std::byte>>;
+
+std::vector<std::byte> makeMessage(std::uint8_t tag)
+{
+  return std::vector<std::byte>(8, static_cast<std::byte>(tag));
+}
+
+Datagrams deliver(NetworkLink &to, const Datagrams &datagrams, NetworkLink::Clock::time_point now)
+{
+  Datagrams received;
+  for (const auto &datagram : datagrams) {
+    CHECK(to.onDatagram(datagram, now, received));
+  }
+  return received;
+}
+} // namespace
+
+TEST_CASE("Reliable channel delivers in order and stops resending once acked")
+{
+  NetworkLink sender;
+  NetworkLink receiver;
+  auto now = NetworkLink::Clock::now();
+
+  for (std::uint8_t i = 0; i < 3; ++i) {
+    CHECK(sender.send(makeMessage(i), Channel::RELIABLE_ORDERED, now));
+  }
+  const auto received = deliver(receiver, sender.flush(now), now);
+  REQUIRE(received.size() == 3);
+  for (std::uint8_t i = 0; i < 3; ++i) {
+    CHECK(received[i] == makeMessage(i));
+  }
+  CHECK(sender.getChannels().getUnackedCount() == 3);
+
+  now += std::chrono::milliseconds(30);
+  deliver(sender, receiver.flush(now), now);
+  CHECK(sender.getChannels().getUnackedCount() == 0);
+  CHECK(sender.getChannels().getRttMs() > 0.0f);
+
+  now += std::chrono::milliseconds(NetworkConfig::MAX_RTO_MS * 2);
+  CHECK(sender.flush(now).empty());
+  CHECK(sender.getChannels().getResendCount() == 0);
+}
+
+TEST_CASE("Reliable channel resends only lost messages and reorders on arrival")
+{
+  NetworkLink sender;
+  NetworkLink receiver;
+  auto now = NetworkLink::Clock::now();
+
+  // One datagram per message so a single one can be dropped
+  Datagrams wire;
+  for (std::uint8_t i = 0; i < 3; ++i) {
+    CHECK(sender.send(makeMessage(i), Channel::RELIABLE_ORDERED, now));
+    for (auto &datagram : sender.flush(now)) {
+      wire.push_back(std::move(datagram));
+    }
+  }
+  REQUIRE(wire.size() == 3);
+
+  auto received = deliver(receiver, {wire[0], wire[2]}, now);
+  REQUIRE(received.size() == 1);
+  CHECK(received[0] == makeMessage(0));
+
+  // The ack reports 0 and 2: only 1 must come back after the timeout
+  deliver(sender, receiver.flush(now), now);
+  CHECK(sender.getChannels().getUnackedCount() == 1);
+
+  now += std::chrono::milliseconds(NetworkConfig::MAX_RTO_MS + 1);
+  received = deliver(receiver, sender.flush(now), now);
+  CHECK(sender.getChannels().getResendCount() == 1);
+  REQUIRE(received.size() == 2);
+  CHECK(received[0] == makeMessage(1));
+  CHECK(received[1] == makeMessage(2));
+}
+
+TEST_CASE("Unreliable sequenced channel drops stale and duplicate messages")
+{
+  NetworkLink sender;
+  NetworkLink receiver;
+  const auto now = NetworkLink::Clock::now();
+
+  Datagrams wire;
+  for (std::uint8_t i = 0; i < 3; ++i) {
+    CHECK(sender.send(makeMessage(i), Channel::UNRELIABLE_SEQUENCED, now));
+    for (auto &datagram : sender.flush(now)) {
+      wire.push_back(std::move(datagram));
+    }
+  }
+  REQUIRE(wire.size() == 3);
+  CHECK(sender.getChannels().getUnackedCount() == 0);
+
+  const auto received = deliver(receiver, {wire[0], wire[2], wire[1], wire[2]}, now);
+  REQUIRE(received.size() == 2);
+  CHECK(received[0] == makeMessage(0));
+  CHECK(received[1] == makeMessage(2));
+  CHECK_FALSE(receiver.hasPending());
+}
+
+TEST_CASE("Unreliable traffic is not blocked by a missing reliable message")
+{
+  NetworkLink sender;
+  NetworkLink receiver;
+  const auto now = NetworkLink::Clock::now();
+
+  CHECK(sender.send(makeMessage(1), Channel::RELIABLE_ORDERED, now));
+  const auto lost = sender.flush(now);
+  CHECK(sender.send(makeMessage(2), Channel::RELIABLE_ORDERED, now));
+  const auto reliable = sender.flush(now);
+  CHECK(sender.send(makeMessage(3), Channel::UNRELIABLE_SEQUENCED, now));
+  const auto unreliable = sender.flush(now);
+  REQUIRE_FALSE(lost.empty());
+
+  CHECK(deliver(receiver, reliable, now).empty());
+  const auto received = deliver(receiver, unreliable, now);
+  REQUIRE(received.size() == 1);
+  CHECK(received[0] == makeMessage(3));
+}
@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_handshake.cpp
+*/
+
+#include "Handshake.hpp"
+#include "NetworkConfig.hpp"
+#include <asio/ip/udp.hpp>
+#include <chrono>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <vector>
+
+namespace
+{
+const asio::ip::udp::endpoint CLIENT(asio::ip::make_address_v4("10.0.0.1"), 40000);
+const ConnectionGate::Key SECRET{0x0123456789abcdefULL, 0xfedcba9876543210ULL};
+
+Handshake::Cookie challenge(ConnectionGate &gate, const asio::ip::udp::endpoint &sender,
+                            ConnectionGate::Clock::time_point now)
+{
+  std::vector<std::byte> reply;
+  REQUIRE(gate.onHandshake(Handshake::makeConnect(), sender, now, reply) == ConnectionGate::Verdict::CHALLENGE);
+  CHECK(reply.size() <= Handshake::CONNECT_SIZE);
+  auto cookie = Handshake::parseChallenge(reply);
+  REQUIRE(cookie.has_value());
+  return *cookie;
+}
+} // namespace
+
+TEST_CASE("Handshake admits a client that echoes its cookie")
+{
+  ConnectionGate gate(SECRET);
+  const auto now = ConnectionGate::Clock::now();
+  const auto cookie = challenge(gate, CLIENT, now);
+
+  std::vector<std::byte> reply;
+  CHECK(gate.onHandshake(Handshake::makeResponse(cookie), CLIENT, now + std::chrono::milliseconds(20), reply) ==
+        ConnectionGate::Verdict::ACCEPT);
+  const auto stats = gate.getStats();
+  CHECK(stats.challengesSent == 1);
+  CHECK(stats.accepted == 1);
+}
+
+TEST_CASE("Handshake rejects cookies from another address, port or server")
+{
+  ConnectionGate gate(SECRET);
+  const auto now = ConnectionGate::Clock::now();
+  const auto cookie = challenge(gate, CLIENT, now);
+  std::vector<std::byte> reply;
+
+  const asio::ip::udp::endpoint otherPort(CLIENT.address(), CLIENT.port() + 1);
+  const asio::ip::udp::endpoint otherHost(asio::ip::make_address_v4("10.0.0.2"), CLIENT.port());
+  CHECK(gate.onHandshake(Handshake::makeResponse(cookie), otherPort, now, reply) == ConnectionGate::Verdict::DROP);
+  CHECK(gate.onHandshake(Handshake::makeResponse(cookie), otherHost, now, reply) == ConnectionGate::Verdict::DROP);
+
+  ConnectionGate restarted(ConnectionGate::Key{SECRET[1], SECRET[0]});
+  CHECK(restarted.onHandshake(Handshake::makeResponse(cookie), CLIENT, now, reply) == ConnectionGate::Verdict::DROP);
+
+  auto forged = cookie;
+  forged.back() ^= std::byte{0x01};
+  CHECK(gate.onHandshake(Handshake::makeResponse(forged), CLIENT, now, reply) == ConnectionGate::Verdict::DROP);
+  CHECK(gate.getStats().droppedBadCookie == 3);
+  CHECK(gate.getStats().accepted == 0);
+}
+
+TEST_CASE("Handshake rejects expired cookies")
+{
+  ConnectionGate gate(SECRET);
+  const auto now = ConnectionGate::Clock::now();
+  const auto cookie = challenge(gate, CLIENT, now);
+  std::vector<std::byte> reply;
+
+  const auto late = now + std::chrono::milliseconds(NetworkConfig::HANDSHAKE_COOKIE_LIFETIME_MS + 1);
+  CHECK(gate.onHandshake(Handshake::makeResponse(cookie), CLIENT, late, reply) == ConnectionGate::Verdict::DROP);
+  CHECK(gate.getStats().droppedBadCookie == 1);
+}
+
+TEST_CASE("Handshake drops malformed and unpadded datagrams")
+{
+  ConnectionGate gate(SECRET);
+  const auto now = ConnectionGate::Clock::now();
+  std::vector<std::byte> reply;
+
+  // An unpadded CONNECT would let a spoofer get more bytes back than it sent
+  auto shortConnect = Handshake::makeConnect();
+  shortConnect.resize(Handshake::HEADER_SIZE);
+  CHECK(gate.onHandshake(shortConnect, CLIENT, now, reply) == ConnectionGate::Verdict::DROP);
+
+  auto wrongVersion = Handshake::makeConnect();
+  wrongVersion[2] = std::byte{Handshake::PROTOCOL_VERSION + 1};
+  CHECK(gate.onHandshake(wrongVersion, CLIENT, now, reply) == ConnectionGate::Verdict::DROP);
+
+  const std::vector<std::byte> magicOnly{std::byte{Handshake::HANDSHAKE_MAGIC}};
+  CHECK(Handshake::isHandshake(magicOnly));
+  CHECK(gate.onHandshake(magicOnly, CLIENT, now, reply) == ConnectionGate::Verdict::DROP);
+
+  CHECK_FALSE(Handshake::parseChallenge(Handshake::makeConnect()).has_value());
+  CHECK(gate.getStats().droppedMalformed == 3);
+  CHECK(gate.getStats().challengesSent == 0);
+}
@@ -0,0 +1,246 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_network_simulation.cpp
+*/
+
+#include "ConditionedNetworkManager.hpp"
+#include "NetworkConditioner.hpp"
+#include "SimulatedNetworkManager.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace std::chrono_literals;
+using Clock = NetworkConditioner::Clock;
+
+std::vector<std::byte> makeMessage(std::uint32_t index, std::size_t size = 8)
+{
+  std::vector<std::byte> message(size, std::byte{0});
+  for (std::size_t i = 0; i < 4 && i < size; ++i) {
+    message[i] = static_cast<std::byte>(index >> (8 * i));
+  }
+  return message;
+}
+
+std::uint32_t messageIndex(std::span<const std::byte> message)
+{
+  std::uint32_t index = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    index |= std::to_integer<std::uint32_t>(message[i]) << (8 * i);
+  }
+  return index;
+}
+
+/** @brief Indices delivered by a conditioner fed one item per millisecond */
+std::vector<std::uint32_t> runConditioner(const LinkConditions &conditions, std::uint64_t seed, std::uint32_t count,
+                                          Channel channel)
+{
+  NetworkConditioner conditioner(conditions, seed);
+  const auto start = Clock::time_point{} + 1h;
+  for (std::uint32_t i = 0; i < count; ++i) {
+    conditioner.push(makeMessage(i), 0, channel, start + std::chrono::milliseconds(i));
+  }
+  std::vector<std::uint32_t> delivered;
+  NetworkConditioner::Item item;
+  while (conditioner.pop(start + 1h, item)) {
+    delivered.push_back(messageIndex(item.data));
+  }
+  return delivered;
+}
+
+/** @brief Step a manual-clock network, polling both sides every millisecond */
+void pump(SimulatedNetwork &network, SimulatedNetworkManager &server, SimulatedNetworkManager &client,
+          std::chrono::milliseconds duration, std::vector<NetworkPacket> *serverInbox = nullptr,
+          std::vector<NetworkPacket> *clientInbox = nullptr)
+{
+  NetworkPacket packet;
+  for (auto elapsed = 0ms; elapsed < duration; elapsed += 1ms) {
+    network.advance(1ms);
+    while (server.poll(packet)) {
+      if (serverInbox != nullptr) {
+        serverInbox->push_back(packet);
+      }
+    }
+    server.flush();
+    while (client.poll(packet)) {
+      if (clientInbox != nullptr) {
+        clientInbox->push_back(packet);
+      }
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("Conditioner decisions are reproducible from the seed")
+{
+  LinkConditions conditions;
+  conditions.latencyMs = 50;
+  conditions.jitterMs = 20;
+  conditions.lossRate = 0.1;
+  conditions.duplicateRate = 0.05;
+  conditions.reorderRate = 0.05;
+
+  const auto first = runConditioner(conditions, 42, 2000, Channel::UNRELIABLE_SEQUENCED);
+  CHECK(first == runConditioner(conditions, 42, 2000, Channel::UNRELIABLE_SEQUENCED));
+  CHECK(first != runConditioner(conditions, 43, 2000, Channel::UNRELIABLE_SEQUENCED));
+}
+
+TEST_CASE("Conditioner loss rate and delay stay within the configured bounds")
+{
+  LinkConditions conditions;
+  conditions.latencyMs = 100;
+  conditions.jitterMs = 10;
+  conditions.lossRate = 0.05;
+  NetworkConditioner conditioner(conditions, 7);
+
+  const auto start = Clock::time_point{} + 1h;
+  constexpr std::uint32_t COUNT = 20000;
+  for (std::uint32_t i = 0; i < COUNT; ++i) {
+    conditioner.push(makeMessage(i), 0, Channel::UNRELIABLE_SEQUENCED, start);
+  }
+  NetworkConditioner::Item item;
+  CHECK_FALSE(conditioner.pop(start + 89ms, item));
+
+  std::uint32_t delivered = 0;
+  while (conditioner.pop(start + 111ms, item)) {
+    ++delivered;
+  }
+  CHECK(conditioner.getPendingCount() == 0);
+  const double lossRate = 1.0 - static_cast<double>(delivered) / COUNT;
+  CHECK(lossRate > 0.04);
+  CHECK(lossRate < 0.06);
+  CHECK(conditioner.getStats().lost == COUNT - delivered);
+}
+
+TEST_CASE("Conditioner bandwidth cap serializes items and drops on queue overflow")
+{
+  LinkConditions conditions;
+  conditions.bandwidthBytesPerSecond = 10000;
+  NetworkConditioner conditioner(conditions, 1);
+
+  const auto start = Clock::time_point{} + 1h;
+  for (std::uint32_t i = 0; i < 10; ++i) {
+    conditioner.push(makeMessage(i, 1000), 0, Channel::UNRELIABLE_SEQUENCED, start);
+  }
+  // 100 ms per item: the queue accepts items starting within 500 ms
+  CHECK(conditioner.getStats().overflowed == 4);
+
+  NetworkConditioner::Item item;
+  CHECK(conditioner.pop(start + 100ms, item));
+  CHECK_FALSE(conditioner.pop(start + 150ms, item));
+  CHECK(conditioner.pop(start + 200ms, item));
+  CHECK(messageIndex(item.data) == 1);
+}
+
+TEST_CASE("Conditioner keeps reliable items, in order, under heavy loss")
+{
+  LinkConditions conditions;
+  conditions.latencyMs = 20;
+  conditions.jitterMs = 15;
+  conditions.lossRate = 0.5;
+  conditions.duplicateRate = 0.5;
+  conditions.reorderRate = 0.5;
+
+  const auto delivered = runConditioner(conditions, 3, 500, Channel::RELIABLE_ORDERED);
+  REQUIRE(delivered.size() == 500);
+  for (std::uint32_t i = 0; i < delivered.size(); ++i) {
+    CHECK(delivered[i] == i);
+  }
+}
+
+TEST_CASE("Simulated network admits clients and delivers reliable traffic through loss")
+{
+  SimulatedNetwork::Settings settings;
+  settings.upstream.latencyMs = 100;
+  settings.upstream.lossRate = 0.05;
+  settings.downstream = settings.upstream;
+  settings.seed = 2025;
+  settings.manualClock = true;
+  auto network = std::make_shared<SimulatedNetwork>(settings);
+  auto server = network->createServer();
+  auto client = network->createClient();
+  server->start();
+  client->start();
+
+  std::vector<NetworkPacket> clientInbox;
+  pump(*network, *server, *client, 500ms, nullptr, &clientInbox);
+  REQUIRE(server->getClients().size() == 1);
+  CHECK(clientInbox.size() == 1); // assign_id
+
+  constexpr std::uint32_t COUNT = 200;
+  for (std::uint32_t i = 0; i < COUNT; ++i) {
+    client->send(makeMessage(i), 0);
+  }
+  std::vector<NetworkPacket> serverInbox;
+  pump(*network, *server, *client, 5000ms, &serverInbox);
+
+  REQUIRE(serverInbox.size() == COUNT);
+  for (std::uint32_t i = 0; i < COUNT; ++i) {
+    CHECK(messageIndex(serverInbox[i].getPayload()) == i);
+    CHECK(serverInbox[i].getSenderEndpointId() == client->getClientId());
+  }
+  CHECK(network->getUpstreamStats().lost > 0);
+  CHECK(client->getLatency() >= 200.0f);
+}
+
+TEST_CASE("Simulated network drops unreliable traffic at the configured rate")
+{
+  SimulatedNetwork::Settings settings;
+  settings.downstream.latencyMs = 30;
+  settings.downstream.lossRate = 0.2;
+  settings.seed = 9;
+  settings.manualClock = true;
+  auto network = std::make_shared<SimulatedNetwork>(settings);
+  auto server = network->createServer();
+  auto client = network->createClient();
+  server->start();
+  client->start();
+  pump(*network, *server, *client, 100ms);
+
+  constexpr std::uint32_t COUNT = 1000;
+  std::vector<NetworkPacket> clientInbox;
+  for (std::uint32_t i = 0; i < COUNT; ++i) {
+    server->send(makeMessage(i), client->getClientId(), Channel::UNRELIABLE_SEQUENCED);
+    pump(*network, *server, *client, 16ms, nullptr, &clientInbox);
+  }
+  pump(*network, *server, *client, 100ms, nullptr, &clientInbox);
+
+  const double received = static_cast<double>(clientInbox.size()) / COUNT;
+  CHECK(received > 0.75);
+  CHECK(received < 0.85);
+}
+
+TEST_CASE("Conditioned shim delays the wrapped manager's traffic")
+{
+  SimulatedNetwork::Settings settings; // Perfect, real clock
+  auto network = std::make_shared<SimulatedNetwork>(settings);
+  auto server = network->createServer();
+  auto client = network->createClient();
+  LinkConditions outbound;
+  outbound.latencyMs = 40;
+  ConditionedNetworkManager conditioned(client, outbound, LinkConditions{}, 1);
+  server->start();
+  conditioned.start();
+
+  NetworkPacket packet;
+  for (int i = 0; i < 10; ++i) {
+    server->poll(packet);
+    conditioned.poll(packet);
+  }
+  conditioned.send(makeMessage(7), 0);
+  CHECK_FALSE(server->poll(packet));
+
+  std::this_thread::sleep_for(60ms);
+  conditioned.flush();
+  REQUIRE(server->poll(packet));
+  CHECK(messageIndex(packet.getPayload()) == 7);
+  CHECK(conditioned.getOutboundStats().delivered == 1);
+}
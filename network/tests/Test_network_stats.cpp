@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_network_stats.cpp
+*/
+
+#include "Channel.hpp"
+#include "NetworkConfig.hpp"
+#include "NetworkLink.hpp"
+#include "NetworkStats.hpp"
+#include <chrono>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Unreliable loss is estimated from sequence gaps")
+{
+  NetworkLink sender;
+  NetworkLink receiver;
+  const auto now = NetworkLink::Clock::now();
+
+  std::vector<std::vector<std::byte>> wire;
+  for (std::uint8_t i = 0; i < 5; ++i) {
+    CHECK(sender.send(std::vector<std::byte>(8, std::byte{i}), Channel::UNRELIABLE_SEQUENCED, now));
+    for (auto &datagram : sender.flush(now)) {
+      wire.push_back(std::move(datagram));
+    }
+  }
+  REQUIRE(wire.size() == 5);
+
+  std::vector<std::vector<std::byte>> received;
+  for (std::size_t i : {0, 1, 3, 4}) {
+    CHECK(receiver.onDatagram(wire[i], now, received));
+  }
+  CHECK(receiver.getChannels().getUnreliableReceivedCount() == 4);
+  CHECK(receiver.getChannels().getUnreliableMissedCount() == 1);
+
+  ConnectionStats stats;
+  fillChannelStats(stats, receiver.getChannels());
+  CHECK(stats.lossIn == doctest::Approx(0.2f));
+  CHECK(stats.lossOut == 0.0f);
+}
+
+TEST_CASE("Client counters time one keepalive round trip at a time")
+{
+  ClientCounters counters;
+  const auto now = ClientCounters::Clock::now();
+  CHECK(counters.isPingDue(now));
+  CHECK(counters.getRttMs() < 0.0f);
+
+  counters.onPingSent(now);
+  CHECK_FALSE(counters.isPingDue(now + 10ms));
+  counters.onPong(now + 25ms);
+  CHECK(counters.getRttMs() == doctest::Approx(25.0f));
+
+  // A duplicated PONG must not be timed against the same PING again
+  counters.onPong(now + 80ms);
+  CHECK(counters.getRttMs() == doctest::Approx(25.0f));
+  CHECK(counters.isPingDue(now + std::chrono::milliseconds(NetworkConfig::STATS_PING_INTERVAL_MS)));
+}
+
+TEST_CASE("Traffic counters track sends in flight and errors")
+{
+  TrafficCounters counters;
+  counters.onReceived(100);
+  counters.onSendQueued();
+  counters.onSendQueued();
+  CHECK(counters.load().sendQueueDepth == 2);
+
+  counters.onSendCompleted(40, true);
+  counters.onSendCompleted(0, false);
+  const auto stats = counters.load();
+  CHECK(stats.packetsIn == 1);
+  CHECK(stats.bytesIn == 100);
+  CHECK(stats.packetsOut == 1);
+  CHECK(stats.bytesOut == 40);
+  CHECK(stats.sendErrors == 1);
+  CHECK(stats.sendQueueDepth == 0);
+}
+
+TEST_CASE("Rate meter recomputes once per window")
+{
+  TrafficRateMeter meter;
+  const auto start = std::chrono::steady_clock::now();
+  TrafficStats totals;
+  meter.update(totals, start);
+
+  totals.packetsIn = 50;
+  totals.bytesOut = 4000;
+  CHECK(meter.update(totals, start + 100ms).packetsInPerSecond == 0);
+
+  const auto rates = meter.update(totals, start + 2s);
+  CHECK(rates.packetsInPerSecond == 25);
+  CHECK(rates.bytesOutPerSecond == 2000);
+}
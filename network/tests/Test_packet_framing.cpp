@@ -0,0 +1,123 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_packet_framing.cpp
+*/
+
+#include "NetworkConfig.hpp"
+#include "PacketFramer.hpp"
+#include <chrono>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <vector>
+
+namespace
+{
+std::vector<std::byte> makeMessage(std::size_t size, std::uint8_t seed)
+{
+  std::vector<std::byte> message(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    message[i] = static_cast<std::byte>((seed + i) & 0xFF);
+  }
+  return message;
+}
+
+PacketReassembler makeReassembler()
+{
+  return PacketReassembler(std::chrono::milliseconds(NetworkConfig::FRAGMENT_TIMEOUT_MS),
+                           NetworkConfig::MAX_PENDING_FRAGMENTED_MESSAGES);
+}
+} // namespace
+
+TEST_CASE("Framing aggregates small messages into MTU-sized datagrams")
+{
+  PacketFramer framer(NetworkConfig::MAX_DATAGRAM_SIZE);
+  std::vector<std::vector<std::byte>> sent;
+  for (std::uint8_t i = 0; i < 50; ++i) {
+    sent.push_back(makeMessage(100, i));
+    CHECK(framer.enqueue(sent.back()));
+  }
+
+  const auto datagrams = framer.flush();
+  CHECK(datagrams.size() < sent.size());
+  CHECK_FALSE(framer.hasPending());
+
+  auto reassembler = makeReassembler();
+  std::vector<std::vector<std::byte>> received;
+  for (const auto &datagram : datagrams) {
+    CHECK(datagram.size() <= NetworkConfig::MAX_DATAGRAM_SIZE);
+    CHECK(reassembler.onDatagram(datagram, PacketReassembler::Clock::now(), received));
+  }
+  CHECK(received == sent);
+}
+
+TEST_CASE("Framing fragments oversized messages and reassembles them")
+{
+  PacketFramer framer(NetworkConfig::MAX_DATAGRAM_SIZE);
+  const auto big = makeMessage(20000, 7);
+  const auto small = makeMessage(10, 3);
+  CHECK(framer.enqueue(small));
+  CHECK(framer.enqueue(big));
+
+  auto datagrams = framer.flush();
+  REQUIRE(datagrams.size() > 2);
+
+  // Deliver fragments out of order and duplicated
+  auto reassembler = makeReassembler();
+  std::vector<std::vector<std::byte>> received;
+  const auto now = PacketReassembler::Clock::now();
+  CHECK(reassembler.onDatagram(datagrams.front(), now, received));
+  for (auto it = datagrams.rbegin(); it != datagrams.rend() - 1; ++it) {
+    CHECK(it->size() <= NetworkConfig::MAX_DATAGRAM_SIZE);
+    CHECK(reassembler.onDatagram(*it, now, received));
+    CHECK(reassembler.onDatagram(*it, now, received));
+  }
+
+  REQUIRE(received.size() == 2);
+  CHECK(received[0] == small);
+  CHECK(received[1] == big);
+  CHECK(reassembler.getPendingCount() == 0);
+}
+
+TEST_CASE("Framing drops incomplete messages after the timeout")
+{
+  PacketFramer framer(NetworkConfig::MAX_DATAGRAM_SIZE);
+  CHECK(framer.enqueue(makeMessage(5000, 1)));
+  auto datagrams = framer.flush();
+  datagrams.pop_back();
+
+  auto reassembler = makeReassembler();
+  std::vector<std::vector<std::byte>> received;
+  const auto now = PacketReassembler::Clock::now();
+  for (const auto &datagram : datagrams) {
+    CHECK(reassembler.onDatagram(datagram, now, received));
+  }
+  CHECK(received.empty());
+  CHECK(reassembler.getPendingCount() == 1);
+
+  CHECK(reassembler.purgeExpired(now) == 0);
+  const auto later = now + std::chrono::milliseconds(NetworkConfig::FRAGMENT_TIMEOUT_MS + 1);
+  CHECK(reassembler.purgeExpired(later) == 1);
+  CHECK(reassembler.getPendingCount() == 0);
+}
+
+TEST_CASE("Framing rejects malformed datagrams")
+{
+  auto reassembler = makeReassembler();
+  std::vector<std::vector<std::byte>> received;
+  const auto now = PacketReassembler::Clock::now();
+
+  const std::vector<std::byte> garbage = makeMessage(100, 42);
+  CHECK_FALSE(reassembler.onDatagram(garbage, now, received));
+  CHECK_FALSE(reassembler.onDatagram(std::vector<std::byte>{}, now, received));
+
+  // Bundle whose length prefix overflows the datagram
+  const std::vector<std::byte> truncated{std::byte{Framing::FRAME_MAGIC}, std::byte{Framing::KIND_BUNDLE},
+                                         std::byte{0x04}, std::byte{0x00}, std::byte{0x01}};
+  CHECK_FALSE(reassembler.onDatagram(truncated, now, received));
+  CHECK(received.empty());
+
+  PacketFramer framer(NetworkConfig::MAX_DATAGRAM_SIZE);
+  CHECK_FALSE(framer.enqueue(makeMessage(framer.getMaxMessageSize() + 1, 0)));
+}
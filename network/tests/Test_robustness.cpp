@@ -128,6 +128,7 @@ TEST_CASE("Client Robustness Test - Garbage Data from Server")
     b = static_cast<std::byte>(rand() % 255);
 
   CHECK_NOTHROW(server->send(garbage, clientId));
+  server->flush();
 
   std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
@@ -139,6 +140,7 @@ TEST_CASE("Client Robustness Test - Garbage Data from Server")
     validBytesVec.push_back(static_cast<std::byte>(c));
 
   server->send(validBytesVec, clientId);
+  server->flush();
 
   std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
@@ -157,3 +159,82 @@ TEST_CASE("Client Robustness Test - Garbage Data from Server")
   server->stop();
   client->stop();
 }
+
+TEST_CASE("Server Robustness Test - Unauthenticated Datagrams Are Dropped")
+{
+  short port = 5005;
+  std::shared_ptr<AsioServer> server = std::make_shared<AsioServer>(port);
+  server->start();
+
+  // A raw socket that never runs the handshake
+  asio::io_context ioContext;
+  asio::ip::udp::socket spoofer(ioContext, asio::ip::udp::endpoint(asio::ip::udp::v4(), 0));
+  const asio::ip::udp::endpoint serverEndpoint(asio::ip::make_address("127.0.0.1"), port);
+  std::vector<char> junk(100, 'x');
+  for (int i = 0; i < 50; ++i) {
+    spoofer.send_to(asio::buffer(junk), serverEndpoint);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  NetworkPacket msg;
+  CHECK_FALSE(server->poll(msg));
+  CHECK(server->getConnectedPlayersCount() == 0);
+  CHECK(server->getHandshakeStats().droppedUnauthenticated == 50);
+
+  // A real client still gets in
+  auto client = std::make_shared<AsioClient>("127.0.0.1", std::to_string(port));
+  client->start();
+  for (int i = 0; i < 50 && !client->isAdmitted(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  CHECK(client->isAdmitted());
+  CHECK(server->getConnectedPlayersCount() == 1);
+  CHECK(server->getHandshakeStats().accepted == 1);
+
+  server->stop();
+  client->stop();
+}
+
+TEST_CASE("Server Robustness Test - Keepalive Stays In The Network Layer")
+{
+  short port = 5006;
+  std::shared_ptr<AsioServer> server = std::make_shared<AsioServer>(port);
+  server->start();
+
+  auto client = std::make_shared<AsioClient>("127.0.0.1", std::to_string(port));
+  client->start();
+  for (int i = 0; i < 50 && !client->isAdmitted(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  REQUIRE(client->isAdmitted());
+  NetworkPacket msg;
+  while (client->poll(msg)) {
+    // assign_id
+  }
+
+  // The first flush pings the new client; its PONG is timed, not queued
+  server->flush();
+  float rttMs = -1.0f;
+  for (int i = 0; i < 50 && rttMs < 0.0f; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const auto stats = server->getNetworkStats();
+    if (!stats.connections.empty()) {
+      rttMs = stats.connections.front().rttMs;
+    }
+  }
+  CHECK(rttMs >= 0.0f);
+  CHECK_FALSE(server->poll(msg));
+  CHECK_FALSE(client->poll(msg));
+
+  const auto stats = server->getNetworkStats();
+  REQUIRE(stats.connections.size() == 1);
+  CHECK(stats.connections.front().traffic.packetsIn >= 1); // PONG
+  CHECK(stats.connections.front().traffic.packetsOut >= 2); // assign_id, PING
+  CHECK(stats.traffic.packetsIn >= 3); // CONNECT as well
+  CHECK(stats.traffic.sendErrors == 0);
+  CHECK(client->getNetworkStats().traffic.packetsIn >= 3); // CHALLENGE, assign_id, PING
+
+  server->stop();
+  client->stop();
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_serialization_bench.cpp
+*/
+
+#include "CapnpHandler.hpp"
+#include "GameMessage.capnp.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int ITERATIONS = 100000;
+
+std::string makeMessage(int entities)
+{
+  std::string message = R"({"type":"snapshot","entities":[)";
+  for (int i = 0; i < entities; ++i) {
+    message += R"({"id":)" + std::to_string(i) + R"(,"x":12.5,"y":300.0,"hp":100,"sprite":3},)";
+  }
+  message += "{}]}";
+  return message;
+}
+
+// The handler as it was before scratch arenas: fresh builder, vector
+// stream and copy on every serialize, stream reader on every deserialize.
+std::vector<std::uint8_t> legacySerialize(const std::string &data)
+{
+  capnp::MallocMessageBuilder message;
+  message.initRoot<NetworkMessage>().setMessageType(data);
+  kj::VectorOutputStream output;
+  capnp::writeMessage(output, message);
+  auto arr = output.getArray();
+  return {arr.begin(), arr.end()};
+}
+
+std::size_t legacyDeserialize(const std::vector<std::uint8_t> &bytes)
+{
+  kj::ArrayInputStream stream(kj::ArrayPtr<const kj::byte>(bytes.data(), bytes.size()));
+  capnp::InputStreamMessageReader reader(stream);
+  return std::string(reader.getRoot<NetworkMessage>().getMessageType().cStr()).size();
+}
+
+template <typename Fn>
+double nanosPerOp(Fn &&fn)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; ++i) {
+    fn();
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+}
+} // namespace
+
+TEST_CASE("Serialization Micro Benchmark")
+{
+  for (int entities : {0, 10, 60}) {
+    const std::string message = makeMessage(entities);
+    std::size_t sink = 0;
+
+    const auto legacyBytes = legacySerialize(message);
+    const double legacyWrite = nanosPerOp([&]() { sink += legacySerialize(message).size(); });
+    const double legacyRead = nanosPerOp([&]() { sink += legacyDeserialize(legacyBytes); });
+    std::cout << "[Bench] legacy  json=" << message.size() << "B wire=" << legacyBytes.size()
+              << "B serialize=" << legacyWrite << "ns deserialize=" << legacyRead << "ns" << std::endl;
+
+    for (bool packed : {false, true}) {
+      CapnpHandler handler(packed);
+      std::vector<std::uint8_t> buffer;
+      handler.serializeInto(message, buffer);
+      const std::vector<std::uint8_t> wire = buffer;
+      const std::span<const std::byte> wireBytes(reinterpret_cast<const std::byte *>(wire.data()), wire.size());
+
+      const double write = nanosPerOp([&]() { sink += handler.serializeInto(message, buffer); });
+      const double read = nanosPerOp([&]() { sink += handler.deserialize(wireBytes)->size(); });
+      std::cout << "[Bench] " << (packed ? "packed" : "flat  ") << "  json=" << message.size()
+                << "B wire=" << wire.size() << "B serialize=" << write << "ns deserialize=" << read << "ns"
+                << std::endl;
+
+      CHECK(handler.deserialize(wireBytes) == message);
+    }
+    CHECK(sink > 0);
+  }
+}
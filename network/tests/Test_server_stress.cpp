@@ -12,8 +12,13 @@
 #include <chrono>
 #include <doctest/doctest.h>
 #include <iostream>
+#include <string>
+#include <sys/resource.h>
 #include <thread>
 #include <vector>
+#if defined(RTYPE_HAS_IO_URING)
+#include "UringServer.hpp"
+#endif
 
 TEST_CASE("Server Stress Test")
 {
@@ -111,3 +116,165 @@ TEST_CASE("Server Stress Test")
   // 6. Assertions
   CHECK(received_count >= total_expected);
 }
+
+namespace
+{
+struct BenchResult {
+  int received = 0;
+  int expected = 0;
+  double seconds = 0.0;
+  double cpuMicrosPerPacket = 0.0;
+};
+
+double processCpuSeconds()
+{
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+         static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+/**
+ * Blast unreliable messages from many clients at an already started server
+ * and drain it from a single thread, like the game loop does. CPU time is
+ * process-wide (clients included): compare runs, not absolute values.
+ */
+BenchResult runThroughputBench(const std::shared_ptr<INetworkManager> &server, short port)
+{
+  const int num_threads = 32;
+  const int msgs_per_thread = 2000;
+  BenchResult result;
+  result.expected = num_threads * msgs_per_thread;
+
+  std::atomic<int> ready_count(0);
+  std::atomic<bool> start_flag(false);
+  std::vector<std::thread> client_threads;
+
+  for (int i = 0; i < num_threads; ++i) {
+    client_threads.emplace_back([port, msgs_per_thread, &start_flag, &ready_count]() {
+      try {
+        auto client = std::make_shared<AsioClient>("127.0.0.1", std::to_string(port));
+        client->start();
+        ++ready_count;
+
+        while (!start_flag) {
+          std::this_thread::yield();
+        }
+
+        auto serialized = client->getPacketHandler()->serialize("BENCH");
+        for (int j = 0; j < msgs_per_thread; ++j) {
+          client->send(
+            std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()), 0,
+            Channel::UNRELIABLE_SEQUENCED);
+          // Pace lightly so the benchmark measures the server, not socket buffer overflow
+          if (j % 100 == 99) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+          }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        client->stop();
+      } catch (const std::exception &e) {
+        std::cerr << "Client thread error: " << e.what() << std::endl;
+      }
+    });
+  }
+
+  while (ready_count < num_threads) {
+    std::this_thread::yield();
+  }
+  const double cpu_start = processCpuSeconds();
+  start_flag = true;
+
+  auto start_time = std::chrono::steady_clock::now();
+  auto last_receive = start_time;
+  while (std::chrono::steady_clock::now() - start_time < std::chrono::seconds(10)) {
+    NetworkPacket msg;
+    bool drained_any = false;
+    while (server->poll(msg)) {
+      result.received++;
+      drained_any = true;
+    }
+    if (drained_any) {
+      last_receive = std::chrono::steady_clock::now();
+    }
+    if (result.received >= result.expected ||
+        std::chrono::steady_clock::now() - last_receive > std::chrono::milliseconds(500)) {
+      break;
+    }
+    std::this_thread::yield();
+  }
+  result.seconds = std::chrono::duration<double>(last_receive - start_time).count();
+  const double cpu_used = processCpuSeconds() - cpu_start;
+
+  for (auto &t : client_threads) {
+    if (t.joinable())
+      t.join();
+  }
+  server->stop();
+
+  if (result.received > 0) {
+    result.cpuMicrosPerPacket = cpu_used * 1e6 / result.received;
+  }
+  return result;
+}
+
+void printBench(const std::string &label, const BenchResult &result)
+{
+  const double rate = result.seconds > 0.0 ? result.received / result.seconds : 0.0;
+  std::cout << "[Bench] " << label << " received=" << result.received << "/" << result.expected
+            << " elapsed=" << result.seconds << "s rate=" << static_cast<long>(rate)
+            << " msg/s cpu=" << result.cpuMicrosPerPacket << " us/msg" << std::endl;
+}
+} // namespace
+
+TEST_CASE("Server Receive Shard Throughput Benchmark")
+{
+  // Same load against 1, 2, 4 and 8 SO_REUSEPORT shards. Messages go on the
+  // unreliable channel so resends don't inflate the numbers.
+  const std::vector<std::size_t> shard_counts = {1, 2, 4, 8};
+  short port = 5010;
+
+  for (std::size_t shards : shard_counts) {
+    std::shared_ptr<AsioServer> server;
+    try {
+      server = std::make_shared<AsioServer>(port, shards);
+      server->start();
+    } catch (const std::exception &e) {
+      FAIL("Could not start server: " << e.what());
+    }
+
+    const BenchResult result = runThroughputBench(server, port);
+    printBench("asio shards=" + std::to_string(server->getShardCount()), result);
+    CHECK(result.received > 0);
+    ++port;
+  }
+}
+
+TEST_CASE("Server Backend Throughput Benchmark")
+{
+  // Same load against the Asio and io_uring backends
+  short port = 5020;
+  {
+    auto server = std::make_shared<AsioServer>(port);
+    server->start();
+    const BenchResult result = runThroughputBench(server, port);
+    printBench("asio", result);
+    CHECK(result.received > 0);
+  }
+
+#if defined(RTYPE_HAS_IO_URING)
+  if (!UringServer::isSupported()) {
+    std::cout << "[Bench] io_uring not supported by this kernel, skipped" << std::endl;
+    return;
+  }
+  ++port;
+  auto server = std::make_shared<UringServer>(port);
+  server->start();
+  const BenchResult result = runThroughputBench(server, port);
+  printBench("io_uring", result);
+  CHECK(result.received > 0);
+#else
+  std::cout << "[Bench] io_uring backend not built, skipped" << std::endl;
+#endif
+}
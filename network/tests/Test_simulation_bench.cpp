@@ -0,0 +1,196 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Test_simulation_bench.cpp
+*/
+
+#include "SimulatedNetworkManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace std::chrono_literals;
+
+constexpr int CLIENTS = 4;
+constexpr int TICK_MS = 16;
+constexpr int DURATION_MS = 10000;
+constexpr int COMMAND_INTERVAL_MS = 500;
+constexpr std::size_t SNAPSHOT_SIZE = 700;
+constexpr std::size_t INPUT_SIZE = 16;
+
+enum class Kind : std::uint8_t { SNAPSHOT, INPUT, COMMAND };
+
+std::vector<std::byte> makeMessage(Kind kind, std::uint32_t sentAtMs, std::size_t size)
+{
+  std::vector<std::byte> message(size, std::byte{0});
+  message[0] = static_cast<std::byte>(kind);
+  for (std::size_t i = 0; i < 4; ++i) {
+    message[1 + i] = static_cast<std::byte>(sentAtMs >> (8 * i));
+  }
+  return message;
+}
+
+std::uint32_t sentAt(std::span<const std::byte> message)
+{
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    value |= std::to_integer<std::uint32_t>(message[1 + i]) << (8 * i);
+  }
+  return value;
+}
+
+struct Series {
+  std::vector<double> samples;
+
+  void add(double value) { samples.push_back(value); }
+  [[nodiscard]] double mean() const
+  {
+    double sum = 0.0;
+    for (double value : samples) {
+      sum += value;
+    }
+    return samples.empty() ? 0.0 : sum / static_cast<double>(samples.size());
+  }
+  [[nodiscard]] double percentile(double ratio) const
+  {
+    if (samples.empty()) {
+      return 0.0;
+    }
+    auto sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[static_cast<std::size_t>(ratio * static_cast<double>(sorted.size() - 1))];
+  }
+};
+
+struct GameTrafficResult {
+  Series snapshotGapMs; // Client-side interval between snapshots
+  Series inputLatencyMs; // Client -> server, unreliable
+  Series commandLatencyMs; // Client -> server, reliable
+  double snapshotDeliveryRatio = 0.0;
+  double downstreamBytesPerSecond = 0.0;
+};
+
+/**
+ * @brief Server at 60 Hz sending unreliable snapshots, clients sending
+ * inputs every tick and a reliable command twice a second, all on a manual
+ * clock so each run is reproducible.
+ */
+GameTrafficResult runGameTraffic(const LinkConditions &conditions, std::uint64_t seed)
+{
+  SimulatedNetwork::Settings settings;
+  settings.upstream = conditions;
+  settings.downstream = conditions;
+  settings.seed = seed;
+  settings.manualClock = true;
+  auto network = std::make_shared<SimulatedNetwork>(settings);
+  auto server = network->createServer();
+  server->start();
+  std::vector<std::shared_ptr<SimulatedNetworkManager>> clients;
+  for (int i = 0; i < CLIENTS; ++i) {
+    clients.push_back(network->createClient());
+    clients.back()->start();
+  }
+
+  GameTrafficResult result;
+  std::vector<std::int64_t> lastSnapshotMs(CLIENTS, -1);
+  std::size_t snapshotsSent = 0;
+  std::size_t snapshotsReceived = 0;
+  NetworkPacket packet;
+
+  for (std::uint32_t nowMs = 0; nowMs < DURATION_MS; ++nowMs) {
+    network->advance(1ms);
+    const bool tick = nowMs % TICK_MS == 0;
+
+    while (server->poll(packet)) {
+      const auto payload = packet.getPayload();
+      if (payload.size() < 5) {
+        continue;
+      }
+      const double latency = static_cast<double>(nowMs - sentAt(payload));
+      if (static_cast<Kind>(payload[0]) == Kind::INPUT) {
+        result.inputLatencyMs.add(latency);
+      } else if (static_cast<Kind>(payload[0]) == Kind::COMMAND) {
+        result.commandLatencyMs.add(latency);
+      }
+    }
+    if (tick) {
+      for (const auto &client : clients) {
+        server->send(makeMessage(Kind::SNAPSHOT, nowMs, SNAPSHOT_SIZE), client->getClientId(),
+                     Channel::UNRELIABLE_SEQUENCED);
+        ++snapshotsSent;
+      }
+    }
+    server->flush();
+
+    for (std::size_t i = 0; i < clients.size(); ++i) {
+      auto &client = *clients[i];
+      while (client.poll(packet)) {
+        const auto payload = packet.getPayload();
+        if (payload.size() != SNAPSHOT_SIZE) {
+          continue;
+        }
+        ++snapshotsReceived;
+        if (lastSnapshotMs[i] >= 0) {
+          result.snapshotGapMs.add(static_cast<double>(nowMs - lastSnapshotMs[i]));
+        }
+        lastSnapshotMs[i] = nowMs;
+      }
+      if (tick) {
+        client.send(makeMessage(Kind::INPUT, nowMs, INPUT_SIZE), 0, Channel::UNRELIABLE_SEQUENCED);
+      }
+      if (nowMs % COMMAND_INTERVAL_MS == 0) {
+        client.send(makeMessage(Kind::COMMAND, nowMs, INPUT_SIZE), 0, Channel::RELIABLE_ORDERED);
+      }
+    }
+  }
+
+  result.snapshotDeliveryRatio =
+    snapshotsSent == 0 ? 0.0 : static_cast<double>(snapshotsReceived) / static_cast<double>(snapshotsSent);
+  result.downstreamBytesPerSecond =
+    static_cast<double>(network->getDownstreamStats().bytesDelivered) * 1000.0 / DURATION_MS;
+  return result;
+}
+
+void printResult(const std::string &label, const GameTrafficResult &result)
+{
+  std::cout << "[Bench] " << label << " snapshots=" << result.snapshotDeliveryRatio * 100.0 << "%"
+            << " gap mean/p99=" << result.snapshotGapMs.mean() << "/" << result.snapshotGapMs.percentile(0.99)
+            << "ms input mean/p99=" << result.inputLatencyMs.mean() << "/" << result.inputLatencyMs.percentile(0.99)
+            << "ms command mean/p99=" << result.commandLatencyMs.mean() << "/"
+            << result.commandLatencyMs.percentile(0.99) << "ms down=" << result.downstreamBytesPerSecond / 1024.0
+            << " KiB/s" << '\n';
+}
+} // namespace
+
+TEST_CASE("Game Traffic Under Simulated Network Conditions")
+{
+  const auto perfect = runGameTraffic(LinkConditions{}, 1);
+  printResult("perfect", perfect);
+
+  LinkConditions degraded;
+  degraded.latencyMs = 100;
+  degraded.jitterMs = 10;
+  degraded.lossRate = 0.05;
+  const auto lossy = runGameTraffic(degraded, 1);
+  printResult("100ms/5%", lossy);
+
+  CHECK(perfect.snapshotDeliveryRatio > 0.99);
+  CHECK(lossy.snapshotDeliveryRatio > 0.9);
+  CHECK(lossy.snapshotDeliveryRatio < 0.99);
+  CHECK(lossy.inputLatencyMs.mean() >= 90.0);
+  // Every reliable command still gets through
+  CHECK(lossy.commandLatencyMs.samples.size() == perfect.commandLatencyMs.samples.size());
+
+  // Same seed, same run
+  const auto again = runGameTraffic(degraded, 1);
+  CHECK(again.snapshotGapMs.samples == lossy.snapshotGapMs.samples);
+}
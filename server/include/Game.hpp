@@ -10,6 +10,8 @@
 #include "Difficulty.hpp"
 #include "LobbyManager.hpp"
 #include "ServerSystems.hpp"
+#include "ai/AIBudget.hpp"
+#include "config/ServerConfig.hpp"
 #include <chrono>
 #include <cstdint>
 #include <memory>
@@ -19,6 +21,9 @@ namespace server
 {
 class EnemyConfigManager;
 class LevelConfigManager;
+class NetworkStatsReporter;
+class ServerMetrics;
+class MetricsServer;
 } // namespace server
 
 // Game configuration constants
@@ -89,6 +94,8 @@ public:
   void spawnPlayer(std::uint32_t networkId);
   /** @brief Get the server ECS world. */
   std::shared_ptr<ecs::World> getWorld();
+  /** @brief Runtime configuration loaded from server.json. */
+  [[nodiscard]] const server::ServerConfig &getServerConfig() const { return m_serverConfig; }
   /** @brief Start the game for the current lobby. */
   void startGame();
   /** @brief Check if the game has started. */
@@ -111,6 +118,9 @@ public:
 private:
   // Map collision initialization removed (feature temporarily disabled)
 
+  /** @brief Feed the tick duration and lobby table to the metrics. */
+  void updateMetrics(std::chrono::steady_clock::time_point tickStart);
+
   std::shared_ptr<ecs::World> world;
 
   std::shared_ptr<INetworkManager> m_networkManager;
@@ -120,7 +130,7 @@ private:
   bool gameStarted = false;
   std::chrono::steady_clock::time_point currentTime;
   std::chrono::steady_clock::time_point nextTick;
-  std::chrono::milliseconds tickRate{GameConfig::TICK_RATE_MS};
+  std::chrono::nanoseconds m_tickStep{std::chrono::milliseconds(GameConfig::TICK_RATE_MS)}; // Fixed simulation step
 
   // System pointers for initialization
   server::DamageSystem *damageSystem = nullptr;
@@ -132,8 +142,14 @@ private:
 
   std::shared_ptr<server::EnemyConfigManager> m_enemyConfigManager;
   std::shared_ptr<server::LevelConfigManager> m_levelConfigManager;
+  server::ServerConfig m_serverConfig;
+  std::unique_ptr<server::NetworkStatsReporter> m_statsReporter; // Null when statsIntervalMs is 0
+  std::unique_ptr<server::ServerMetrics> m_metrics; // Null unless metrics are enabled
+  std::unique_ptr<server::MetricsServer> m_metricsServer;
+  std::chrono::steady_clock::time_point m_lastLobbyMetrics;
 
   std::unordered_set<std::uint32_t> m_lobbyClients;
+  server::ai::AIBudget m_aiBudget; // Shared by the allies of every lobby, declared before the lobbies using it
   LobbyManager m_lobbyManager;
   // ecs::Entity m_mapEntity = 0; // Entity holding map collision data (removed)
 };
@@ -8,7 +8,10 @@
 
 #include "../../common/include/Common.hpp"
 #include "../../engineCore/include/ecs/World.hpp"
+#include "../../engineCore/include/ecs/components/Input.hpp"
 #include "Difficulty.hpp"
+#include "ai/AIBudget.hpp"
+#include "replay/LobbyRecorder.hpp"
 #include <nlohmann/json.hpp>
 
 // Forward declarations
@@ -20,6 +23,7 @@ class LevelConfigManager;
 } // namespace server
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -118,6 +122,12 @@ public:
    */
   void startGame();
 
+  /**
+   * @brief Start the game with a given world random seed
+   * @param seed Seed of the world RNG, recorded so a replay can start the same game
+   */
+  void startGame(std::uint64_t seed);
+
   /**
    * @brief Stop the game for this lobby - clears the world
    */
@@ -141,12 +151,46 @@ public:
    */
   void update(float deltaTime);
 
+  /**
+   * @brief Set a client's player input (recorded when it changes)
+   * @param clientId The client identifier
+   * @param input The new input state
+   */
+  void applyInput(std::uint32_t clientId, const ecs::Input &input);
+
+  /**
+   * @brief Set a client's viewport (recorded, it drives spawning and culling)
+   * @param clientId The client identifier
+   * @param width Viewport width
+   * @param height Viewport height
+   */
+  void applyViewport(std::uint32_t clientId, std::uint32_t width, std::uint32_t height);
+
+  /**
+   * @brief Switch a client between player and spectator on request (recorded)
+   * @param clientId The client identifier
+   * @param spectator Whether the client should become a spectator
+   */
+  void setSpectator(std::uint32_t clientId, bool spectator);
+
+  /**
+   * @brief Set how games of this lobby are recorded
+   * @param options Recording options; disabled by default
+   */
+  void setRecordingOptions(const server::replay::RecordingOptions &options);
+
+  /**
+   * @brief Set how the ally AI of this lobby is scheduled
+   * @param schedule Decision rate and shared budget; a recorded game never defers a decision
+   */
+  void setAISchedule(const server::ai::AISchedule &schedule);
+
   /**
    * @brief Get the player entity for a client
    * @param clientId The client identifier
-   * @return Entity ID or 0 if not found
+   * @return Entity ID, or nullopt if the client has no player entity (entity 0 is a valid player)
    */
-  [[nodiscard]] ecs::Entity getPlayerEntity(std::uint32_t clientId) const;
+  [[nodiscard]] std::optional<ecs::Entity> getPlayerEntity(std::uint32_t clientId) const;
 
   /**
    * @brief Send a JSON message to a specific client in this lobby.
@@ -277,6 +321,13 @@ private:
   // AI difficulty setting
   AIDifficulty m_aiDifficulty = AIDifficulty::MEDIUM;
 
+  // Replay recording of the running game
+  server::replay::RecordingOptions m_recordingOptions;
+  server::replay::LobbyRecorder m_recorder;
+
+  // Ally AI decision rate and shared budget
+  server::ai::AISchedule m_aiSchedule;
+
   // Event listener handles (must be kept alive for the duration of the lobby)
   ecs::EventListenerHandle m_levelCompleteListener;
 
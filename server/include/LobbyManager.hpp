@@ -62,6 +62,18 @@ public:
     m_levelConfigManager = configManager;
   }
 
+  /**
+   * @brief Set how the games of new lobbies are recorded.
+   * @param options Replay recording options.
+   */
+  void setRecordingOptions(const server::replay::RecordingOptions &options) { m_recordingOptions = options; }
+
+  /**
+   * @brief Set how the ally AI of new lobbies is scheduled.
+   * @param schedule Decision rate and the budget shared by all lobbies.
+   */
+  void setAISchedule(const server::ai::AISchedule &schedule) { m_aiSchedule = schedule; }
+
   /**
    * @brief Create a new lobby with a unique code and specified difficulty
    * @param code The lobby code
@@ -123,6 +135,8 @@ private:
   std::shared_ptr<INetworkManager> m_networkManager;
   std::shared_ptr<server::EnemyConfigManager> m_enemyConfigManager;
   std::shared_ptr<server::LevelConfigManager> m_levelConfigManager;
+  server::replay::RecordingOptions m_recordingOptions;
+  server::ai::AISchedule m_aiSchedule;
 };
 
 #endif /* !LOBBY_MANAGER_HPP_ */
@@ -0,0 +1,51 @@
+/**
+ * @file NetworkStatsReporter.hpp
+ * @brief Periodic machine-readable dump of the network counters.
+ */
+
+#ifndef SERVER_NETWORK_STATS_REPORTER_HPP_
+#define SERVER_NETWORK_STATS_REPORTER_HPP_
+
+#include "../../network/include/NetworkStats.hpp"
+#include <chrono>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <unordered_map>
+
+class INetworkManager;
+class LobbyManager;
+
+namespace server
+{
+
+/**
+ * @brief Prints one `[NetStats] {json}` line per interval from the game thread
+ *
+ * The line holds the cumulative totals, per-second rates over the interval,
+ * per-lobby aggregates and one entry per client tagged with its lobby code,
+ * so it can be grepped out of the log and fed to any JSON tool.
+ */
+class NetworkStatsReporter
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit NetworkStatsReporter(std::chrono::milliseconds interval);
+
+  /** @brief Print a line if the interval elapsed since the previous one. */
+  void update(const INetworkManager &network, const LobbyManager &lobbies, Clock::time_point now);
+
+  /** @brief The line update() would print, covering the given number of seconds. */
+  nlohmann::json buildReport(const NetworkStats &stats, const LobbyManager &lobbies, double seconds);
+
+private:
+  std::chrono::milliseconds m_interval;
+  Clock::time_point m_lastReport;
+  bool m_started = false;
+  TrafficStats m_lastTotals;
+  std::unordered_map<std::uint32_t, TrafficStats> m_lastClients; // Clients gone since are dropped
+};
+
+} // namespace server
+
+#endif // SERVER_NETWORK_STATS_REPORTER_HPP_
@@ -9,6 +9,7 @@
 // IWYU pragma: begin_exports
 #include "systems/AllySystem.hpp"
 #include "systems/AttractionSystem.hpp"
+#include "systems/BulletPatternSystem.hpp"
 #include "systems/CollisionSystem.hpp"
 #include "systems/DamageSystem.hpp"
 #include "systems/DeathSystem.hpp"
@@ -0,0 +1,49 @@
+/**
+ * @file TickScheduler.hpp
+ * @brief Precise wake-ups on the game loop tick deadlines.
+ */
+
+#ifndef SERVER_TICK_SCHEDULER_HPP_
+#define SERVER_TICK_SCHEDULER_HPP_
+
+#include <chrono>
+
+namespace server
+{
+
+/**
+ * @brief Sleeps the game thread until an absolute deadline
+ *
+ * A relative sleep_for() drifts by its own overshoot every tick and Linux
+ * routinely oversleeps by 50-1000 us. The scheduler instead sleeps with
+ * clock_nanosleep(TIMER_ABSTIME) until spin before the deadline, then
+ * busy-waits the rest, so tick starts land within a few microseconds.
+ * Elsewhere it falls back to sleep_until() plus the same spin.
+ */
+class TickScheduler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /** @param spin Time busy-waited before each deadline, 0 to only sleep */
+  explicit TickScheduler(std::chrono::nanoseconds spin);
+
+  /**
+   * @brief Block until the deadline
+   * @return The wake-up time, never before the deadline
+   */
+  Clock::time_point waitUntil(Clock::time_point deadline) const;
+
+  /**
+   * @brief Pin the calling thread to one CPU core
+   * @return false if the core does not exist or pinning is unsupported
+   */
+  static bool pinCurrentThread(int core);
+
+private:
+  std::chrono::nanoseconds m_spin;
+};
+
+} // namespace server
+
+#endif // SERVER_TICK_SCHEDULER_HPP_
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** AIBudget.hpp - Per-step time budget shared by the AI of every lobby
+*/
+
+#ifndef SERVER_AI_BUDGET_HPP_
+#define SERVER_AI_BUDGET_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+namespace server::ai
+{
+
+/**
+ * @brief Time the ally decisions of all lobbies may take in one simulation step
+ *
+ * The Game owns one budget and resets it before stepping the lobbies, which
+ * all run on the game thread. AllySystem charges each decision it runs and
+ * defers the next ones to a later step once the budget is spent. The
+ * counters only grow; the Game exposes them as metrics.
+ */
+class AIBudget
+{
+public:
+  explicit AIBudget(std::chrono::nanoseconds perStep = std::chrono::nanoseconds{0}) : m_perStep(perStep) {}
+
+  /** @brief 0 disables the limit, decisions are still counted */
+  void setPerStep(std::chrono::nanoseconds perStep) { m_perStep = perStep; }
+  [[nodiscard]] std::chrono::nanoseconds getPerStep() const noexcept { return m_perStep; }
+
+  /** @brief Start a simulation step with the whole budget */
+  void beginStep() { m_spent = std::chrono::nanoseconds{0}; }
+
+  [[nodiscard]] bool exhausted() const noexcept { return m_perStep.count() > 0 && m_spent >= m_perStep; }
+
+  /** @brief Charge one decision that ran for elapsed */
+  void charge(std::chrono::nanoseconds elapsed)
+  {
+    m_spent += elapsed;
+    m_totalTime += elapsed;
+    ++m_decisions;
+  }
+
+  /** @brief Count one decision moved to a later step */
+  void defer() { ++m_deferred; }
+
+  [[nodiscard]] std::uint64_t getDecisions() const noexcept { return m_decisions; }
+  [[nodiscard]] std::uint64_t getDeferred() const noexcept { return m_deferred; }
+  [[nodiscard]] std::chrono::nanoseconds getTotalTime() const noexcept { return m_totalTime; }
+
+private:
+  std::chrono::nanoseconds m_perStep;
+  std::chrono::nanoseconds m_spent{0};
+  std::chrono::nanoseconds m_totalTime{0};
+  std::uint64_t m_decisions = 0;
+  std::uint64_t m_deferred = 0;
+};
+
+/**
+ * @brief How AllySystem schedules the decisions of its allies
+ *
+ * Perception and decisions run decisionRateHz times per second, each ally at
+ * its own phase so the allies of a lobby do not all decide on the same step;
+ * the velocity is interpolated toward the last decision on every step.
+ */
+struct AISchedule {
+  float decisionRateHz = 15.0F; ///< 0 decides on every step
+  AIBudget *budget = nullptr; ///< Shared budget, null for none
+  bool deferrable = true; ///< False runs every due decision, e.g. for a recorded game that must replay the same
+};
+
+} // namespace server::ai
+
+#endif // SERVER_AI_BUDGET_HPP_
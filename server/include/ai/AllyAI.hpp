@@ -37,7 +37,7 @@ public:
   ~AllyAI() = default;
 
   /**
-   * @brief Update the ally AI for one frame
+   * @brief Update the ally AI for one frame, deciding and steering on the same step
    *
    * This orchestrates all AI behaviors:
    * 1. Perceive nearest enemy
@@ -49,9 +49,28 @@ public:
    *
    * @param world The ECS world
    * @param allyEntity The entity controlled by this AI
+   * @param playerEntity The solo player, found once per tick by AllySystem
    * @param deltaTime The time step in seconds
    */
-  void update(ecs::World &world, ecs::Entity allyEntity, float deltaTime);
+  void update(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float deltaTime);
+
+  /**
+   * @brief Perceive, move, shoot and avoid (steps 1 to 4), at the decision rate set by AllySystem
+   *
+   * The velocity the behaviors pick becomes the target of steer(); the
+   * ally's Velocity itself is left as it was.
+   *
+   * @param elapsed Seconds since the previous decision, for the behavior timers
+   * @param blendTime Seconds steer() takes to reach the new velocity, 0 to reach it at once
+   */
+  void decide(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float elapsed, float blendTime);
+
+  /**
+   * @brief Interpolate the velocity toward the last decision, animate and apply viewport constraints
+   *
+   * Runs on every step, decision or not.
+   */
+  void steer(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float deltaTime);
 
   /**
    * @brief Reset AI state (for reuse)
@@ -70,10 +89,24 @@ private:
   // Perception and response
   perception::ObstacleAvoidance m_avoidance;
 
+  // Steering between decisions: the velocity goes from (m_fromDx, m_fromDy) to (m_toDx, m_toDy) in m_blendTime
+  float m_fromDx = 0.0f;
+  float m_fromDy = 0.0f;
+  float m_toDx = 0.0f;
+  float m_toDy = 0.0f;
+  float m_blendTime = 0.0f;
+  float m_blendElapsed = 0.0f;
+  bool m_hasDecision = false;
+
+  /**
+   * @brief Check that both entities can be driven
+   */
+  static bool canDrive(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity);
+
   /**
    * @brief Internal update flow
    */
-  void updateBehaviors(ecs::World &world, ecs::Entity allyEntity, float deltaTime);
+  void updateBehaviors(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float deltaTime);
 };
 
 } // namespace server::ai
@@ -57,6 +57,8 @@ constexpr float ENEMY_AVOID_RADIUS = 100.0f;
 constexpr float PROJECTILE_AVOID_RADIUS = 100.0f;
 constexpr float EMERGENCY_RADIUS = 60.0f;
 constexpr float PREDICTION_TIME = 0.5f;
+constexpr float DEFAULT_ENEMY_RADIUS = 20.0f; // Threat radius without a collider
+constexpr float DEFAULT_PROJECTILE_RADIUS = 5.0f;
 constexpr float AVOID_FORCE_MULTIPLIER = 2.0f;
 constexpr float EMERGENCY_MULTIPLIER = 3.0f;
 constexpr float HIGH_THREAT_THRESHOLD = 1.5f;
@@ -13,6 +13,7 @@
 #include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/components/Velocity.hpp"
 #include "AllyAIUtility.hpp"
+#include <random>
 
 namespace server::ai::behavior
 {
@@ -35,7 +36,7 @@ public:
    * @brief Update movement velocities based on target position
    */
   void update(float deltaTime, ecs::Velocity &allyVelocity, const ecs::Transform &allyTransform,
-              const ecs::Transform &targetTransform, AIStrength strength);
+              const ecs::Transform &targetTransform, AIStrength strength, std::mt19937 &rng);
 
   /**
    * @brief Reset movement state
@@ -53,7 +54,7 @@ private:
   /**
    * @brief Update horizontal movement direction randomly
    */
-  void updateHorizontalDirection();
+  void updateHorizontalDirection(std::mt19937 &rng);
 
   /**
    * @brief Calculate vertical velocity to align with target
@@ -69,12 +70,12 @@ private:
   /**
    * @brief Update idle state for weak AI
    */
-  void updateIdleState(float deltaTime, AIStrength strength);
+  void updateIdleState(float deltaTime, AIStrength strength, std::mt19937 &rng);
 
   /**
    * @brief Generate random idle duration
    */
-  float generateIdleDuration() const;
+  static float generateIdleDuration(std::mt19937 &rng);
 };
 
 /**
@@ -139,7 +140,7 @@ private:
   /**
    * @brief Determine if the AI should shoot based on strength level
    */
-  bool shouldShoot(AIStrength strength) const;
+  static bool shouldShoot(AIStrength strength, std::mt19937 &rng);
 };
 
 /**
@@ -9,9 +9,11 @@
 #define SERVER_ALLY_PERCEPTION_HPP_
 
 #include "../../../engineCore/include/ecs/Entity.hpp"
+#include "../../../engineCore/include/ecs/SpatialIndex.hpp"
 #include "../../../engineCore/include/ecs/World.hpp"
 #include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/components/Velocity.hpp"
+#include <vector>
 
 namespace server::ai::perception
 {
@@ -47,7 +49,7 @@ private:
   /**
    * @brief Check if position is within viewport bounds
    */
-  static bool isWithinViewportBounds(float x, float y, const ecs::World &world, ecs::Entity playerEntity);
+  static bool isWithinViewportBounds(float x, float y, float width, float height);
 
   /**
    * @brief Get viewport dimensions
@@ -127,6 +129,8 @@ private:
    */
   void applyCenterPreference(float &avoidX, float &avoidY, float allyX, float allyY, float viewportWidth,
                              float viewportHeight, int threatCount);
+
+  std::vector<const ecs::SpatialIndex::Entry *> m_nearby; ///< Spatial query scratch, reused every update
 };
 
 /**
@@ -0,0 +1,29 @@
+/**
+ * @file EnemyAIBench.hpp
+ * @brief Headless benchmark of the enemy AI system.
+ */
+
+#ifndef SERVER_ENEMY_AI_BENCH_HPP_
+#define SERVER_ENEMY_AI_BENCH_HPP_
+
+#include <cstddef>
+
+namespace server::bench
+{
+
+/**
+ * @brief Step EnemyAISystem over a crowd of mixed enemies and print its tick time
+ *
+ * Spawns enemyCount enemies from the prefabs of server/config/enemies.json,
+ * cycling through every enemy type, around one player, then times the AI
+ * update alone for a fixed number of ticks. Enemies do not move, so the
+ * crowd stays on screen for the whole run.
+ *
+ * @param enemyCount Enemies to spawn
+ * @return 0 on success, 1 if the enemy configs cannot be loaded
+ */
+int runEnemyAIBench(std::size_t enemyCount);
+
+} // namespace server::bench
+
+#endif // SERVER_ENEMY_AI_BENCH_HPP_
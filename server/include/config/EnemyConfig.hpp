@@ -8,6 +8,8 @@
 #ifndef SERVER_ENEMY_CONFIG_HPP_
 #define SERVER_ENEMY_CONFIG_HPP_
 
+#include "../../../engineCore/include/ecs/Prefab.hpp"
+#include "../../../engineCore/include/ecs/components/BulletEmitter.hpp"
 #include <nlohmann/json.hpp>
 #include <string>
 #include <unordered_map>
@@ -74,6 +76,14 @@ struct EnemyConfig {
     float spawnInterval;
   } spawn;
 
+  // Bullet patterns, up to ecs::BulletEmitter::MAX_EMITTERS (see BulletPatternSystem)
+  std::vector<ecs::EmitterConfig> emitters;
+
+  /**
+   * @brief Parse one entry of "emitters": a shape ("ring", "spiral", "fan" or "burst") and overrides
+   */
+  static ecs::EmitterConfig emitterFromJson(const nlohmann::json &json);
+
   /**
    * @brief Parse EnemyConfig from JSON
    */
@@ -138,8 +148,22 @@ struct EnemyConfig {
       config.spawn.spawnInterval = sp.value("spawnInterval", 5.0f);
     }
 
+    if (json.contains("emitters") && json["emitters"].is_array()) {
+      for (const auto &emitter : json["emitters"]) {
+        if (config.emitters.size() < ecs::BulletEmitter::MAX_EMITTERS) {
+          config.emitters.push_back(emitterFromJson(emitter));
+        }
+      }
+    }
+
     return config;
   }
+
+  /**
+   * @brief Compile the config into the prefab every enemy of this type is instantiated from
+   * @note The Transform holds the scale only, the spawn position is set per instance
+   */
+  ecs::Prefab toPrefab() const;
 };
 
 /**
@@ -174,8 +198,17 @@ public:
    */
   std::vector<std::string> getEnemyIds() const;
 
+  /**
+   * @brief Get the prefab compiled from an enemy configuration
+   * @param id Enemy ID
+   * @return Pointer to the prefab or nullptr if not found
+   */
+  const ecs::Prefab *getPrefab(const std::string &id) const;
+
 private:
   std::unordered_map<std::string, EnemyConfig> m_configs;
+  std::unordered_map<std::string, ecs::Prefab> m_prefabs; // Compiled once per load, see EnemyConfig::toPrefab
+
 };
 
 } // namespace server
@@ -8,6 +8,8 @@
 #ifndef SERVER_LEVEL_CONFIG_HPP_
 #define SERVER_LEVEL_CONFIG_HPP_
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <nlohmann/json.hpp>
 #include <string>
@@ -17,6 +19,8 @@
 namespace server
 {
 
+class EnemyConfigManager;
+
 /**
  * @brief Configuration for a single enemy spawn in a wave
  */
@@ -87,6 +91,58 @@ struct MapConfig {
   }
 };
 
+/**
+ * @brief Entities of each pooled kind to create up front when the level starts
+ *
+ * Pools grow on demand past these counts: they only move the allocations
+ * out of the first waves.
+ */
+struct PoolConfig {
+  std::size_t projectiles = 0; // Standard player/ally shots
+  std::size_t chargedProjectiles = 0;
+  std::size_t tripleProjectiles = 0; // Per direction
+  std::size_t rubanProjectiles = 0;
+  std::size_t loadingShots = 0;
+  std::size_t explosions = 0;
+  std::size_t bossBullets = 0; // Per enemy bullet kind
+
+  static PoolConfig fromJson(const nlohmann::json &json)
+  {
+    PoolConfig pool;
+    pool.projectiles = json.value("projectiles", pool.projectiles);
+    pool.chargedProjectiles = json.value("chargedProjectiles", pool.chargedProjectiles);
+    pool.tripleProjectiles = json.value("tripleProjectiles", pool.tripleProjectiles);
+    pool.rubanProjectiles = json.value("rubanProjectiles", pool.rubanProjectiles);
+    pool.loadingShots = json.value("loadingShots", pool.loadingShots);
+    pool.explosions = json.value("explosions", pool.explosions);
+    pool.bossBullets = json.value("bossBullets", pool.bossBullets);
+    return pool;
+  }
+};
+
+/**
+ * @brief One enemy of a level, compiled from a wave's spawn entries
+ */
+struct SpawnEvent {
+  float time; // Seconds after the wave trigger (spawn delay plus the group spacing)
+  float y; // Before the random variation drawn when the enemy spawns
+  std::uint32_t wave; // Index in LevelConfig::waves
+  std::uint32_t enemy; // Index in LevelTimeline::enemyTypes
+};
+
+/**
+ * @brief The waves of a level flattened into spawn events, sorted by wave then time
+ *
+ * Waves are still triggered by the players' distance: the events of wave w are
+ * events[waveBegin[w]] to events[waveBegin[w + 1]], and the spawn system walks
+ * them with a cursor once the wave has triggered.
+ */
+struct LevelTimeline {
+  std::vector<std::string> enemyTypes; // Enemy types used in the level, resolved once per level start
+  std::vector<SpawnEvent> events;
+  std::vector<std::size_t> waveBegin; // waves.size() + 1 offsets into events
+};
+
 /**
  * @brief Configuration for a complete level
  */
@@ -98,6 +154,8 @@ struct LevelConfig {
   MapConfig map; // Map configuration
   std::string collision_map; // Path to the collision map JSON file
   std::vector<WaveConfig> waves;
+  PoolConfig pool; // Entity pools prewarmed when the level starts
+  LevelTimeline timeline; // Compiled from the waves by LevelConfigManager::loadFromFile
 
   static LevelConfig fromJson(const nlohmann::json &json)
   {
@@ -118,6 +176,10 @@ struct LevelConfig {
       level.map = MapConfig::fromJson(json["map"]);
     }
 
+    if (json.contains("pool") && json["pool"].is_object()) {
+      level.pool = PoolConfig::fromJson(json["pool"]);
+    }
+
     return level;
   }
 };
@@ -129,11 +191,12 @@ class LevelConfigManager
 {
 public:
   /**
-   * @brief Load level configurations from JSON file
+   * @brief Load level configurations from JSON file and compile their spawn timelines
    * @param filepath Path to the JSON configuration file
+   * @param enemies Enemy configurations, for the spacing of enemy groups
    * @return true if loaded successfully
    */
-  bool loadFromFile(const std::string &filepath);
+  bool loadFromFile(const std::string &filepath, const EnemyConfigManager &enemies);
 
   /**
    * @brief Get level configuration by ID
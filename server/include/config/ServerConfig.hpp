@@ -0,0 +1,246 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** ServerConfig.hpp - Runtime server tuning loaded from server.json
+*/
+
+#ifndef SERVER_SERVER_CONFIG_HPP_
+#define SERVER_SERVER_CONFIG_HPP_
+
+#include "../../../engineCore/include/utils/Log.hpp"
+#include "../../../network/include/NetworkConditioner.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string>
+
+namespace server
+{
+
+/**
+ * @brief Snapshot replication tuning (bandwidth budget and entity priorities)
+ *
+ * Every send tick each entity relevant to a client accumulates its priority;
+ * the snapshot is then filled in descending accumulated priority until the
+ * byte budget is reached. Entities left out keep accumulating, so they win
+ * a slot within a few ticks.
+ */
+struct ReplicationConfig {
+  std::size_t budgetBytesPerClient = 4096; // Max entity, volley and hit payload per client per send tick
+  float playerPriority = 100.0f;
+  float bossPriority = 50.0f;
+  float enemyPriority = 10.0f;
+  float projectilePriority = 4.0f;
+  float defaultPriority = 6.0f;
+  float falloffDistance = 1500.0f; // Distance (px) at which priority reaches its minimum
+  float minDistanceScale = 0.1f; // Priority scale applied to the farthest entities
+  float starvationThresholdSeconds = 0.25f; // Unsent longer than this counts as starved
+
+  static ReplicationConfig fromJson(const nlohmann::json &json)
+  {
+    ReplicationConfig config;
+    config.budgetBytesPerClient = json.value("budgetBytesPerClient", config.budgetBytesPerClient);
+    config.playerPriority = json.value("playerPriority", config.playerPriority);
+    config.bossPriority = json.value("bossPriority", config.bossPriority);
+    config.enemyPriority = json.value("enemyPriority", config.enemyPriority);
+    config.projectilePriority = json.value("projectilePriority", config.projectilePriority);
+    config.defaultPriority = json.value("defaultPriority", config.defaultPriority);
+    config.falloffDistance = json.value("falloffDistance", config.falloffDistance);
+    config.minDistanceScale = json.value("minDistanceScale", config.minDistanceScale);
+    config.starvationThresholdSeconds = json.value("starvationThresholdSeconds", config.starvationThresholdSeconds);
+    return config;
+  }
+};
+
+/**
+ * @brief Emulated network impairments for local testing (see NetworkConditioner.hpp)
+ *
+ * When enabled the server's network manager is wrapped in a
+ * ConditionedNetworkManager: downstream applies to what the server sends,
+ * upstream to what it receives. Off by default.
+ */
+struct SimulationSettings {
+  bool enabled = false;
+  std::uint64_t seed = 1;
+  LinkConditions upstream;
+  LinkConditions downstream;
+
+  static LinkConditions conditionsFromJson(const nlohmann::json &json)
+  {
+    LinkConditions conditions;
+    conditions.latencyMs = json.value("latencyMs", conditions.latencyMs);
+    conditions.jitterMs = json.value("jitterMs", conditions.jitterMs);
+    conditions.lossRate = json.value("lossRate", conditions.lossRate);
+    conditions.duplicateRate = json.value("duplicateRate", conditions.duplicateRate);
+    conditions.reorderRate = json.value("reorderRate", conditions.reorderRate);
+    conditions.reorderDelayMs = json.value("reorderDelayMs", conditions.reorderDelayMs);
+    conditions.bandwidthBytesPerSecond = json.value("bandwidthBytesPerSecond", conditions.bandwidthBytesPerSecond);
+    return conditions;
+  }
+
+  static SimulationSettings fromJson(const nlohmann::json &json)
+  {
+    SimulationSettings settings;
+    settings.enabled = json.value("enabled", settings.enabled);
+    settings.seed = json.value("seed", settings.seed);
+    if (json.contains("upstream") && json["upstream"].is_object()) {
+      settings.upstream = conditionsFromJson(json["upstream"]);
+    }
+    if (json.contains("downstream") && json["downstream"].is_object()) {
+      settings.downstream = conditionsFromJson(json["downstream"]);
+    }
+    return settings;
+  }
+};
+
+/**
+ * @brief Network transport tuning, applied when the server socket is created
+ */
+struct NetworkSettings {
+  std::string backend = "asio"; // "asio" or "io_uring" (falls back to asio if unsupported)
+  std::size_t receiveShards = 1; // SO_REUSEPORT sockets, one thread each (asio backend)
+  int statsIntervalMs = 10000; // Period of the [NetStats] log line, 0 disables it
+  SimulationSettings simulation;
+
+  static NetworkSettings fromJson(const nlohmann::json &json)
+  {
+    NetworkSettings settings;
+    settings.backend = json.value("backend", settings.backend);
+    settings.receiveShards = json.value("receiveShards", settings.receiveShards);
+    settings.statsIntervalMs = json.value("statsIntervalMs", settings.statsIntervalMs);
+    if (json.contains("simulation") && json["simulation"].is_object()) {
+      settings.simulation = SimulationSettings::fromJson(json["simulation"]);
+    }
+    return settings;
+  }
+};
+
+/**
+ * @brief Fixed simulation step of the lobbies and its scheduling (see Game::runGameLoop)
+ */
+struct TickSettings {
+  double rateHz = 60.0; // Simulation steps per second, fractional rates allowed; a step lasts 1 / rateHz seconds
+  int maxCatchUpSteps = 4; // Steps run at most in one frame after a stall, the rest is dropped
+  int spinUs = 200; // Busy-wait before each deadline after the sleep, 0 to only sleep
+  int pinCore = -1; // CPU core the game thread is pinned to, -1 to let the OS place it
+
+  static TickSettings fromJson(const nlohmann::json &json)
+  {
+    TickSettings settings;
+    settings.rateHz = std::clamp(json.value("rateHz", settings.rateHz), 1.0, 1000.0);
+    settings.maxCatchUpSteps = std::max(1, json.value("maxCatchUpSteps", settings.maxCatchUpSteps));
+    settings.spinUs = std::max(0, json.value("spinUs", settings.spinUs));
+    settings.pinCore = json.value("pinCore", settings.pinCore);
+    return settings;
+  }
+};
+
+/**
+ * @brief Scheduling of the ally AI (see ai/AIBudget.hpp)
+ */
+struct AISettings {
+  double decisionRateHz = 15.0; // Ally perception and decisions per second, 0 on every step
+  int budgetUs = 1000; // AI time of all lobbies per simulation step, over it decisions wait a step; 0 for no limit
+
+  static AISettings fromJson(const nlohmann::json &json)
+  {
+    AISettings settings;
+    settings.decisionRateHz = std::clamp(json.value("decisionRateHz", settings.decisionRateHz), 0.0, 1000.0);
+    settings.budgetUs = std::max(0, json.value("budgetUs", settings.budgetUs));
+    return settings;
+  }
+};
+
+/**
+ * @brief Recording of lobby games for headless replay (see replay/LobbyRecorder.hpp)
+ */
+struct ReplaySettings {
+  bool enabled = false;
+  std::string directory = "replays";
+  int chunkKb = 64; // Size of the mapped file chunks
+  int checksumIntervalTicks = 60; // World checksum every N steps, 0 to disable
+
+  static ReplaySettings fromJson(const nlohmann::json &json)
+  {
+    ReplaySettings settings;
+    settings.enabled = json.value("enabled", settings.enabled);
+    settings.directory = json.value("directory", settings.directory);
+    settings.chunkKb = std::clamp(json.value("chunkKb", settings.chunkKb), 4, 64 * 1024);
+    settings.checksumIntervalTicks = std::max(0, json.value("checksumIntervalTicks", settings.checksumIntervalTicks));
+    return settings;
+  }
+};
+
+/**
+ * @brief Prometheus endpoint, served on 127.0.0.1 only (see MetricsServer.hpp)
+ */
+struct MetricsSettings {
+  bool enabled = false;
+  std::uint16_t port = 9100;
+
+  static MetricsSettings fromJson(const nlohmann::json &json)
+  {
+    MetricsSettings settings;
+    settings.enabled = json.value("enabled", settings.enabled);
+    settings.port = json.value("port", settings.port);
+    return settings;
+  }
+};
+
+/**
+ * @brief Log threshold and optional rotating log file (see utils/Log.hpp)
+ */
+struct LoggingSettings {
+  std::string level = "info"; // trace, debug, info, warn or error
+  std::string file; // Empty: console only
+  std::size_t maxFileMb = 10;
+  std::size_t maxFiles = 3;
+
+  static LoggingSettings fromJson(const nlohmann::json &json)
+  {
+    LoggingSettings settings;
+    settings.level = json.value("level", settings.level);
+    settings.file = json.value("file", settings.file);
+    settings.maxFileMb = json.value("maxFileMb", settings.maxFileMb);
+    settings.maxFiles = json.value("maxFiles", settings.maxFiles);
+    return settings;
+  }
+
+  [[nodiscard]] ::logging::LogSettings toLogSettings() const
+  {
+    ::logging::LogSettings settings;
+    settings.level = ::logging::parseLevel(level, settings.level);
+    settings.file = file;
+    settings.maxFileBytes = maxFileMb * 1024 * 1024;
+    settings.maxFiles = maxFiles;
+    return settings;
+  }
+};
+
+/**
+ * @brief Server-wide runtime configuration
+ *
+ * Missing file or keys keep the built-in defaults.
+ */
+struct ServerConfig {
+  ReplicationConfig replication;
+  TickSettings tick;
+  AISettings ai;
+  NetworkSettings network;
+  MetricsSettings metrics;
+  LoggingSettings logging;
+  ReplaySettings replay;
+
+  /**
+   * @brief Load configuration from a JSON file
+   * @param filepath Path to the JSON file
+   * @return true if the file was loaded, false if defaults are kept
+   */
+  bool loadFromFile(const std::string &filepath);
+};
+
+} // namespace server
+
+#endif // SERVER_SERVER_CONFIG_HPP_
@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** MetricsServer.hpp - Localhost HTTP listener serving the Prometheus page
+*/
+
+#ifndef SERVER_METRICS_SERVER_HPP_
+#define SERVER_METRICS_SERVER_HPP_
+
+#include <asio.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace server
+{
+
+/**
+ * @brief Minimal HTTP/1.0 listener for Prometheus scrapes
+ *
+ * Bound to 127.0.0.1 only and served by its own thread: GET /metrics
+ * answers the page built by the render callback, anything else a 404.
+ * One request per connection, no keep-alive.
+ */
+class MetricsServer
+{
+public:
+  using RenderFunction = std::function<std::string()>;
+
+  /**
+   * @brief Bind the listener
+   * @param port TCP port on the loopback interface
+   * @param render Builds the page; called on the listener thread
+   * @throws std::system_error if the port cannot be bound
+   */
+  MetricsServer(std::uint16_t port, RenderFunction render);
+  ~MetricsServer();
+
+  MetricsServer(const MetricsServer &) = delete;
+  MetricsServer &operator=(const MetricsServer &) = delete;
+
+  void start();
+  void stop();
+
+private:
+  struct Connection;
+
+  void accept();
+  void respond(const std::shared_ptr<Connection> &connection);
+
+  asio::io_context m_ioContext;
+  asio::ip::tcp::acceptor m_acceptor;
+  asio::steady_timer m_retryTimer; // Delays accept() after an error
+  RenderFunction m_render;
+  std::thread m_thread;
+};
+
+} // namespace server
+
+#endif // SERVER_METRICS_SERVER_HPP_
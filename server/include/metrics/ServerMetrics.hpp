@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** ServerMetrics.hpp - Game-thread metrics rendered as a Prometheus page
+*/
+
+#ifndef SERVER_SERVER_METRICS_HPP_
+#define SERVER_SERVER_METRICS_HPP_
+
+#include "../../../network/include/NetworkStats.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace server
+{
+
+/**
+ * @brief Server metrics written by the game thread, read by the metrics listener
+ *
+ * Everything updated per tick or per snapshot is a relaxed atomic, so the
+ * game thread never waits on a scrape. Only the per-lobby table, which
+ * changes size, is published under a mutex, and the game thread does that
+ * once per second.
+ */
+class ServerMetrics
+{
+public:
+  /** @brief Upper bounds (seconds) of the tick duration histogram buckets, +Inf implied. */
+  static constexpr std::array<double, 9> TICK_BUCKETS{0.001, 0.002, 0.004, 0.008, 0.012,
+                                                      0.016, 0.025, 0.05,  0.1};
+  /** @brief Upper bounds (seconds) of the tick start lateness histogram buckets, +Inf implied. */
+  static constexpr std::array<double, 9> JITTER_BUCKETS{0.00001, 0.000025, 0.00005, 0.0001, 0.00025,
+                                                        0.0005,  0.001,    0.002,   0.005};
+  /** @brief Upper bounds (seconds) of the tick overrun histogram buckets, +Inf implied. */
+  static constexpr std::array<double, 8> OVERRUN_BUCKETS{0.0005, 0.001, 0.002, 0.004, 0.008, 0.016, 0.033, 0.1};
+
+  /** @brief Lock-free histogram counters, one bucket per interval (exposed cumulatively) */
+  template <std::size_t Bounds> struct Histogram {
+    std::array<std::atomic<std::uint64_t>, Bounds + 1> buckets{}; // Last one is +Inf
+    std::atomic<std::uint64_t> sumNs{0};
+  };
+
+  struct LobbySample {
+    std::string code;
+    std::size_t entities = 0;
+    std::size_t clients = 0;
+    // Entity lifecycle counters of the lobby world, see ecs::World::EntityStats
+    std::uint64_t entitiesCreated = 0;
+    std::uint64_t entitiesDestroyed = 0;
+    std::uint64_t entitiesReused = 0;
+    std::uint64_t entitiesParked = 0;
+  };
+
+  /** @brief Record the work time of one tick. */
+  void observeTick(double seconds);
+  /** @brief Record how late a tick started after its deadline. */
+  void observeTickJitter(double seconds);
+  /** @brief Record a tick whose work exceeded the tick period, by how much. */
+  void countOverrun(double seconds);
+  /** @brief Record simulation steps run in one frame, besides the first one, to catch up. */
+  void countCatchUpSteps(std::uint64_t steps) { m_catchUpSteps.fetch_add(steps, std::memory_order_relaxed); }
+  /** @brief Record simulation steps skipped because a frame exceeded the catch-up limit. */
+  void countDroppedSteps(std::uint64_t steps) { m_droppedSteps.fetch_add(steps, std::memory_order_relaxed); }
+  /** @brief Record one snapshot handed to the network manager. */
+  void countSnapshot(std::size_t bytes)
+  {
+    m_snapshots.fetch_add(1, std::memory_order_relaxed);
+    m_snapshotBytes.fetch_add(bytes, std::memory_order_relaxed);
+  }
+  void setLobbyCount(std::size_t lobbies) { m_lobbies.store(lobbies, std::memory_order_relaxed); }
+  /** @brief Publish the totals of the AI budget: decisions run, decisions deferred and their run time. */
+  void setAIDecisions(std::uint64_t decisions, std::uint64_t deferred, double seconds)
+  {
+    m_aiDecisions.store(decisions, std::memory_order_relaxed);
+    m_aiDeferred.store(deferred, std::memory_order_relaxed);
+    m_aiSeconds.store(seconds, std::memory_order_relaxed);
+  }
+  /** @brief Replace the per-lobby table (meant to be called about once per second). */
+  void publishLobbies(std::vector<LobbySample> lobbies);
+
+  /**
+   * @brief Render the Prometheus text exposition page
+   * @param network Counters of the network manager, read at scrape time (one connection per client)
+   */
+  [[nodiscard]] std::string render(const NetworkStats &network) const;
+
+private:
+  Histogram<TICK_BUCKETS.size()> m_tickDurations;
+  Histogram<JITTER_BUCKETS.size()> m_tickJitter;
+  Histogram<OVERRUN_BUCKETS.size()> m_tickOverruns;
+  std::atomic<std::uint64_t> m_catchUpSteps{0};
+  std::atomic<std::uint64_t> m_droppedSteps{0};
+  std::atomic<std::uint64_t> m_snapshots{0};
+  std::atomic<std::uint64_t> m_snapshotBytes{0};
+  std::atomic<std::size_t> m_lobbies{0};
+  std::atomic<std::uint64_t> m_aiDecisions{0};
+  std::atomic<std::uint64_t> m_aiDeferred{0};
+  std::atomic<double> m_aiSeconds{0.0};
+
+  mutable std::mutex m_lobbiesMutex;
+  std::vector<LobbySample> m_lobbySamples;
+};
+
+} // namespace server
+
+#endif // SERVER_SERVER_METRICS_HPP_
@@ -0,0 +1,107 @@
+/**
+ * @file LobbyRecorder.hpp
+ * @brief Records what drives a lobby simulation, for a headless replay.
+ */
+
+#ifndef SERVER_LOBBY_RECORDER_HPP_
+#define SERVER_LOBBY_RECORDER_HPP_
+
+#include "../../../engineCore/include/ecs/World.hpp"
+#include "../../../engineCore/include/ecs/components/Input.hpp"
+#include "ReplayFile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace server::replay
+{
+
+/** @brief How lobbies record, filled by the Game from server.json */
+struct RecordingOptions {
+  bool enabled = false;
+  std::string directory = "replays";
+  std::size_t chunkBytes = ReplayWriter::DEFAULT_CHUNK_BYTES;
+  std::uint64_t checksumIntervalTicks = 60; // 0: no checksums
+  double stepSeconds = 1.0 / 60.0;
+  std::uint64_t enemyConfigHash = 0;
+  std::uint64_t levelConfigHash = 0;
+};
+
+/** @brief Everything a lobby needs to start the same game again (START record) */
+struct SessionInfo {
+  struct Player {
+    std::uint32_t clientId = 0;
+    bool spectator = false;
+  };
+
+  std::string lobbyCode;
+  std::uint64_t seed = 0;
+  double stepSeconds = 0.0;
+  std::uint8_t difficulty = 0; // GameConfig::Difficulty
+  std::uint8_t gameMode = 0; // GameMode
+  std::uint8_t aiDifficulty = 0; // AIDifficulty
+  bool solo = false;
+  std::uint64_t enemyConfigHash = 0; // Of enemies.json, to warn when replaying with other spawn configs
+  std::uint64_t levelConfigHash = 0; // Of levels.json
+  std::vector<Player> players; // Clients of the lobby at start, in join order
+  double aiDecisionRateHz = 0.0; // Ally decisions per second, 0 (every step) in files written before it
+
+  void encode(PayloadWriter &out) const;
+  static std::optional<SessionInfo> decode(std::span<const std::uint8_t> payload);
+};
+
+/** @brief FNV-1a of a file's bytes, 0 if it cannot be read */
+std::uint64_t hashFile(const std::string &path);
+
+/**
+ * @brief Hash of the simulation state: entity ids, transforms, velocities and health
+ * @param entityCount Receives the number of alive entities hashed
+ */
+std::uint64_t worldChecksum(const ecs::World &world, std::size_t &entityCount);
+
+std::uint8_t packInput(const ecs::Input &input);
+void unpackInput(std::uint8_t bits, ecs::Input &input);
+
+/**
+ * @brief Streams one game of a lobby to a replay file
+ *
+ * Only what comes from outside the simulation is written: the START
+ * settings and seed, then input/viewport changes, joins, leaves and
+ * spectator switches, each stamped with the world tick it precedes. A
+ * CHECKSUM of the world every checksumIntervalTicks steps lets a replay
+ * report the first tick where it diverges.
+ */
+class LobbyRecorder
+{
+public:
+  /** @brief Open <directory>/<code>-<unix time>.rreplay and write the START record */
+  bool start(const RecordingOptions &options, const SessionInfo &session);
+  /** @brief Write the END record and close the file */
+  void stop(std::uint64_t tick);
+
+  void recordInput(std::uint64_t tick, std::uint32_t clientId, const ecs::Input &input);
+  void recordViewport(std::uint64_t tick, std::uint32_t clientId, std::uint32_t width, std::uint32_t height);
+  void recordJoin(std::uint64_t tick, std::uint32_t clientId, bool spectator);
+  void recordLeave(std::uint64_t tick, std::uint32_t clientId);
+  void recordSpectator(std::uint64_t tick, std::uint32_t clientId, bool spectator);
+  /** @brief Called after every step: writes a CHECKSUM when the interval is reached */
+  void afterStep(const ecs::World &world);
+
+  [[nodiscard]] bool isRecording() const { return m_writer.isOpen(); }
+  [[nodiscard]] const std::string &getPath() const { return m_path; }
+
+private:
+  void write(RecordType type, std::uint64_t tick);
+
+  ReplayWriter m_writer;
+  PayloadWriter m_payload;
+  std::string m_path;
+  std::uint64_t m_checksumInterval = 0;
+};
+
+} // namespace server::replay
+
+#endif // SERVER_LOBBY_RECORDER_HPP_
@@ -0,0 +1,198 @@
+/**
+ * @file ReplayFile.hpp
+ * @brief Append-only, memory-mapped, chunked replay file.
+ */
+
+#ifndef SERVER_REPLAY_FILE_HPP_
+#define SERVER_REPLAY_FILE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace server::replay
+{
+
+/**
+ * File layout (host byte order):
+ *
+ *   FileHeader, padded to dataOffset (one page)
+ *   chunk 0, chunk 1, ...   each chunkBytes long: ChunkHeader then records
+ *   ChunkIndexEntry[count]  written on close
+ *   IndexFooter             last bytes of the file
+ *
+ * A record is [u8 type][varint tick delta][varint payload size][payload];
+ * the tick delta is relative to the previous record of the same chunk, so
+ * every chunk decodes on its own. A file whose writer died has no index:
+ * the reader then walks the chunk headers instead.
+ */
+constexpr std::array<char, 8> FILE_MAGIC{'R', 'T', 'Y', 'P', 'E', 'R', 'P', 'L'};
+constexpr std::uint32_t FORMAT_VERSION = 1;
+constexpr std::uint32_t CHUNK_MAGIC = 0x4B4E4843; // "CHNK"
+constexpr std::uint32_t INDEX_MAGIC = 0x58444E49; // "INDX"
+
+enum class RecordType : std::uint8_t {
+  START = 1, // Session settings, seed and initial players (SessionInfo)
+  INPUT, // Player input changed
+  VIEWPORT, // Player viewport changed
+  JOIN, // Client joined the running game
+  LEAVE, // Client left the running game
+  SPECTATOR, // Client switched between player and spectator
+  CHECKSUM, // World state hash after a step
+  END, // Session over
+};
+
+struct FileHeader {
+  std::array<char, 8> magic = FILE_MAGIC;
+  std::uint32_t version = FORMAT_VERSION;
+  std::uint32_t chunkBytes = 0;
+  std::uint64_t dataOffset = 0; // Offset of chunk 0
+};
+
+struct ChunkHeader {
+  std::uint32_t magic = CHUNK_MAGIC;
+  std::uint32_t usedBytes = 0; // Record bytes after this header
+  std::uint64_t firstTick = 0;
+  std::uint64_t lastTick = 0;
+  std::uint32_t recordCount = 0;
+  std::uint32_t reserved = 0;
+};
+
+struct ChunkIndexEntry {
+  std::uint64_t offset = 0;
+  std::uint64_t firstTick = 0;
+  std::uint64_t lastTick = 0;
+  std::uint32_t recordCount = 0;
+  std::uint32_t usedBytes = 0;
+};
+
+struct IndexFooter {
+  std::uint32_t magic = INDEX_MAGIC;
+  std::uint32_t count = 0;
+  std::uint64_t indexOffset = 0;
+};
+
+/** @brief One decoded record; payload points into the mapped file */
+struct Record {
+  RecordType type = RecordType::END;
+  std::uint64_t tick = 0;
+  std::span<const std::uint8_t> payload;
+};
+
+/** @brief Builds a record payload */
+class PayloadWriter
+{
+public:
+  void clear() { m_bytes.clear(); }
+  void u8(std::uint8_t value) { m_bytes.push_back(value); }
+  void varint(std::uint64_t value);
+  void u64(std::uint64_t value);
+  void f64(double value);
+  void string(std::string_view value);
+  [[nodiscard]] std::span<const std::uint8_t> bytes() const { return m_bytes; }
+
+private:
+  std::vector<std::uint8_t> m_bytes;
+};
+
+/** @brief Reads a record payload; a read past the end returns 0 and clears ok() */
+class PayloadReader
+{
+public:
+  explicit PayloadReader(std::span<const std::uint8_t> bytes) : m_bytes(bytes) {}
+
+  std::uint8_t u8();
+  std::uint64_t varint();
+  std::uint64_t u64();
+  double f64();
+  std::string string();
+  /** @brief Skip size bytes and return them */
+  std::span<const std::uint8_t> bytes(std::size_t size);
+  [[nodiscard]] bool ok() const { return m_ok; }
+  /** @brief Whether every byte was read, for fields appended to a payload after the first files were written */
+  [[nodiscard]] bool atEnd() const { return m_offset >= m_bytes.size(); }
+
+private:
+  std::span<const std::uint8_t> m_bytes;
+  std::size_t m_offset = 0;
+  bool m_ok = true;
+};
+
+/**
+ * @brief Appends records to a replay file through a mapping of its last chunk
+ *
+ * Appending is a memcpy into the mapped chunk, no system call; the kernel
+ * writes the pages back. Disk space of a chunk is reserved before it is
+ * mapped, so a full disk fails open()/append() instead of raising SIGBUS.
+ */
+class ReplayWriter
+{
+public:
+  static constexpr std::size_t DEFAULT_CHUNK_BYTES = 64 * 1024;
+
+  ReplayWriter() = default;
+  ~ReplayWriter();
+
+  ReplayWriter(const ReplayWriter &) = delete;
+  ReplayWriter &operator=(const ReplayWriter &) = delete;
+
+  /** @brief Create (truncate) the file; chunkBytes is rounded up to whole pages */
+  bool open(const std::string &path, std::size_t chunkBytes = DEFAULT_CHUNK_BYTES);
+  /** @brief Append a record; ticks must not decrease. False if the record is too large or the disk is full */
+  bool append(RecordType type, std::uint64_t tick, std::span<const std::uint8_t> payload);
+  /** @brief Seal the last chunk and write the chunk index */
+  void close();
+
+  [[nodiscard]] bool isOpen() const { return m_fd >= 0; }
+
+private:
+  bool mapNextChunk(std::uint64_t tick);
+  void sealChunk();
+
+  int m_fd = -1;
+  std::size_t m_chunkBytes = 0;
+  std::uint64_t m_dataOffset = 0;
+  std::uint8_t *m_chunk = nullptr;
+  ChunkHeader m_header;
+  std::vector<ChunkIndexEntry> m_index;
+};
+
+/**
+ * @brief Maps a whole replay file read-only and walks its records in order
+ */
+class ReplayReader
+{
+public:
+  ReplayReader() = default;
+  ~ReplayReader();
+
+  ReplayReader(const ReplayReader &) = delete;
+  ReplayReader &operator=(const ReplayReader &) = delete;
+
+  bool open(const std::string &path);
+  /** @brief Next record, false at the end of the file or on a corrupt chunk */
+  bool next(Record &record);
+
+  [[nodiscard]] const std::vector<ChunkIndexEntry> &getChunks() const { return m_chunks; }
+  /** @brief Whether the index was missing (writer did not close) and was rebuilt from the chunks */
+  [[nodiscard]] bool isRecovered() const { return m_recovered; }
+
+private:
+  void close();
+
+  const std::uint8_t *m_data = nullptr;
+  std::size_t m_size = 0;
+  std::vector<ChunkIndexEntry> m_chunks;
+  bool m_recovered = false;
+  std::size_t m_chunk = 0;
+  std::size_t m_offset = 0; // In the current chunk, after its header
+  std::uint64_t m_tick = 0;
+};
+
+} // namespace server::replay
+
+#endif // SERVER_REPLAY_FILE_HPP_
@@ -0,0 +1,29 @@
+/**
+ * @file ReplayRunner.hpp
+ * @brief Headless replay of a recorded lobby game.
+ */
+
+#ifndef SERVER_REPLAY_RUNNER_HPP_
+#define SERVER_REPLAY_RUNNER_HPP_
+
+#include <string>
+
+namespace server::replay
+{
+
+/**
+ * @brief Run a recorded game as fast as possible, without network or rendering
+ *
+ * Rebuilds the lobby from the START record with the configs of
+ * server/config, steps it to the tick of each record and applies the
+ * record, then prints the step time distribution and the replay speed.
+ * Every CHECKSUM record is compared with the replayed world.
+ *
+ * @param path Replay file
+ * @return 0 when the replay matched the recording, 1 if the file cannot be read, 2 on a divergence
+ */
+int runReplay(const std::string &path);
+
+} // namespace server::replay
+
+#endif // SERVER_REPLAY_RUNNER_HPP_
@@ -10,14 +10,21 @@
 
 #include "../../../engineCore/include/ecs/Entity.hpp"
 #include "../../../engineCore/include/ecs/ISystem.hpp"
+#include "../../../engineCore/include/ecs/SpatialIndex.hpp"
 #include "../../../engineCore/include/ecs/World.hpp"
 #include "../../../engineCore/include/ecs/components/Ally.hpp"
 #include "../../../engineCore/include/ecs/components/Charging.hpp"
 #include "../../../engineCore/include/ecs/components/PlayerId.hpp"
+#include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/events/GameEvents.hpp"
+#include "../ai/AIBudget.hpp"
 #include "../ai/AllyAI.hpp"
 #include "ecs/ComponentSignature.hpp"
+#include <algorithm>
+#include <chrono>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace server
 {
@@ -26,30 +33,36 @@ namespace server
  * @brief ECS System that controls ally entities
  *
  * This system orchestrates the AI behavior of ally-controlled entities.
- * It manages the lifecycle of AI controllers and updates them each frame.
+ * It manages the lifecycle of AI controllers: each one decides at the
+ * decision rate of the schedule, within the shared AI budget, and steers
+ * toward its last decision every frame.
  */
 class AllySystem : public ecs::ISystem
 {
 public:
   void update(ecs::World &world, float deltaTime) override
   {
-    // Check if solo mode (only one player)
-    std::vector<ecs::Entity> players;
+    // Check if solo mode (only one player), on the spatial index rather than a scan of the world
     ecs::ComponentSignature playerSig;
     playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-    world.getEntitiesWithSignature(playerSig, players);
-    bool isSoloMode = (players.size() == 1);
+    playerSig.set(ecs::getComponentId<ecs::Transform>());
+    world.getSpatialIndex().collect(playerSig, m_players);
+    std::erase_if(m_players, [&world](const ecs::SpatialIndex::Entry *entry) {
+      return !world.isAlive(entry->entity) || !world.hasComponent<ecs::PlayerId>(entry->entity);
+    });
+    bool isSoloMode = (m_players.size() == 1);
 
     if (!isSoloMode) {
       return; // Only process allies in solo mode
     }
+    const ecs::Entity playerEntity = m_players.front()->entity;
 
     // Get all ally entities
-    std::vector<ecs::Entity> allyEntities;
-    world.getEntitiesWithSignature(getSignature(), allyEntities);
+    world.getEntitiesWithSignature(getSignature(), m_allies);
 
     // Update or create AI controllers for each ally
-    for (auto allyEntity : allyEntities) {
+    const float interval = m_schedule.decisionRateHz > 0.0F ? 1.0F / m_schedule.decisionRateHz : 0.0F;
+    for (auto allyEntity : m_allies) {
       if (!world.isAlive(allyEntity))
         continue;
 
@@ -59,11 +72,17 @@ public:
         // Get ally strength from component
         auto &allyComponent = world.getComponent<ecs::Ally>(allyEntity);
         // Create new AI controller
-        m_allyControllers[allyEntity] = std::make_unique<ai::AllyAI>(allyComponent.strength);
+        it = m_allyControllers.emplace(allyEntity, Controller{std::make_unique<ai::AllyAI>(allyComponent.strength)})
+               .first;
       }
 
-      // Update the AI
-      m_allyControllers[allyEntity]->update(world, allyEntity, deltaTime);
+      // Decide at the decision rate, steer on every step
+      auto &controller = it->second;
+      controller.sinceDecision += deltaTime;
+      if (isDecisionDue(controller, interval, deltaTime)) {
+        runDecision(world, controller, allyEntity, playerEntity, interval, deltaTime);
+      }
+      controller.ai->steer(world, allyEntity, playerEntity, deltaTime);
     }
 
     // Update charging for allies
@@ -88,6 +107,12 @@ public:
     return sig;
   }
 
+  /**
+   * @brief Set the decision rate and the shared AI budget, see ai::AISchedule
+   */
+  void setSchedule(const ai::AISchedule &schedule) { m_schedule = schedule; }
+  [[nodiscard]] const ai::AISchedule &getSchedule() const noexcept { return m_schedule; }
+
   /**
    * @brief Update charging state for ally entities
    */
@@ -139,8 +164,53 @@ public:
   }
 
 private:
+  /// Phases a decision rate is split into, so that allies do not all decide on the same step
+  static constexpr unsigned STAGGER_SLOTS = 4;
+
+  struct Controller {
+    std::unique_ptr<ai::AllyAI> ai;
+    float sinceDecision = 0.0F; ///< Seconds since the last decision
+    bool decided = false;
+  };
+
+  // The due step is the one closest to the interval, so 15 Hz over 60 Hz steps decides every 4 steps
+  static bool isDecisionDue(const Controller &controller, float interval, float deltaTime)
+  {
+    return !controller.decided || controller.sinceDecision >= interval - deltaTime * 0.5F;
+  }
+
+  /**
+   * Runs a due decision unless the shared budget is spent, in which case it
+   * waits for a later step. A decision late by a whole interval runs anyway,
+   * so an ally is never starved by the other lobbies.
+   */
+  void runDecision(ecs::World &world, Controller &controller, ecs::Entity allyEntity, ecs::Entity playerEntity,
+                   float interval, float deltaTime)
+  {
+    auto *budget = m_schedule.budget;
+    const bool late = controller.sinceDecision >= 2.0F * std::max(interval, deltaTime);
+    if (budget != nullptr && m_schedule.deferrable && controller.decided && !late && budget->exhausted()) {
+      budget->defer();
+      return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    controller.ai->decide(world, allyEntity, playerEntity, controller.sinceDecision, interval);
+    if (budget != nullptr) {
+      budget->charge(std::chrono::steady_clock::now() - start);
+    }
+
+    // The first decision also sets the ally's phase, from its entity id to stay reproducible
+    controller.sinceDecision =
+      controller.decided ? 0.0F : interval * static_cast<float>(allyEntity % STAGGER_SLOTS) / STAGGER_SLOTS;
+    controller.decided = true;
+  }
+
   // Map of ally entities to their AI controllers
-  std::map<ecs::Entity, std::unique_ptr<ai::AllyAI>> m_allyControllers;
+  std::map<ecs::Entity, Controller> m_allyControllers;
+  ai::AISchedule m_schedule;
+  std::vector<ecs::Entity> m_allies; // Reused every tick
+  std::vector<const ecs::SpatialIndex::Entry *> m_players; // Query scratch, reused every tick
 };
 
 } // namespace server
@@ -10,6 +10,7 @@
 
 #include "../../../engineCore/include/ecs/Entity.hpp"
 #include "../../../engineCore/include/ecs/ISystem.hpp"
+#include "../../../engineCore/include/ecs/SpatialIndex.hpp"
 #include "../../../engineCore/include/ecs/World.hpp"
 #include "../../../engineCore/include/ecs/components/Attraction.hpp"
 #include "../../../engineCore/include/ecs/components/Input.hpp"
@@ -28,35 +29,35 @@ public:
 
   void update(ecs::World &world, float deltaTime) override
   {
-    // Find all entities with Attraction component
-    ecs::ComponentSignature attractionSig;
-    attractionSig.set(ecs::getComponentId<ecs::Attraction>());
-    attractionSig.set(ecs::getComponentId<ecs::Transform>());
+    // Attractors and players both come from the spatial index: no scan of the whole world
+    const auto &index = world.getSpatialIndex();
+    index.collect(getSignature(), m_attractors);
 
-    std::vector<ecs::Entity> attractionEntities;
-    world.getEntitiesWithSignature(attractionSig, attractionEntities);
+    ecs::ComponentSignature inputSig;
+    inputSig.set(ecs::getComponentId<ecs::Input>());
+    inputSig.set(ecs::getComponentId<ecs::Transform>());
 
-    for (auto attractEntity : attractionEntities) {
-      const auto &attraction = world.getComponent<ecs::Attraction>(attractEntity);
-      const auto &attractTransform = world.getComponent<ecs::Transform>(attractEntity);
+    for (const auto *attractor : m_attractors) {
+      if (!world.isAlive(attractor->entity) || !world.hasComponent<ecs::Attraction>(attractor->entity)) {
+        continue;
+      }
+      const auto &attraction = world.getComponent<ecs::Attraction>(attractor->entity);
 
       if (attraction.force <= 0.0F || attraction.radius <= 0.0F) {
         continue; // No attraction to apply
       }
 
-      // Find all entities with Input component (players)
-      ecs::ComponentSignature inputSig;
-      inputSig.set(ecs::getComponentId<ecs::Input>());
-      inputSig.set(ecs::getComponentId<ecs::Transform>());
-
-      std::vector<ecs::Entity> inputEntities;
-      world.getEntitiesWithSignature(inputSig, inputEntities);
+      // Players whose hitbox reaches the attraction radius, measured between centers below
+      index.queryRadius(attractor->x, attractor->y, attraction.radius, inputSig, m_players);
 
-      for (auto inputEntity : inputEntities) {
-        auto &inputTransform = world.getComponent<ecs::Transform>(inputEntity);
+      for (const auto *player : m_players) {
+        if (!world.isAlive(player->entity) || !world.hasComponent<ecs::Transform>(player->entity)) {
+          continue;
+        }
+        auto &inputTransform = world.getComponent<ecs::Transform>(player->entity);
 
-        float dx = attractTransform.x - inputTransform.x;
-        float dy = attractTransform.y - inputTransform.y;
+        float dx = attractor->x - player->x;
+        float dy = attractor->y - player->y;
         float distance = std::sqrt(dx * dx + dy * dy);
 
         if (distance <= attraction.radius && distance > 0.0F) {
@@ -79,6 +80,10 @@ public:
     sig.set(ecs::getComponentId<ecs::Transform>());
     return sig;
   }
+
+private:
+  std::vector<const ecs::SpatialIndex::Entry *> m_attractors; // Query scratch, reused every tick
+  std::vector<const ecs::SpatialIndex::Entry *> m_players;
 };
 } // namespace server
 
@@ -0,0 +1,221 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** BulletPatternSystem.hpp - Data-driven enemy bullet patterns on a pooled bullet store
+*/
+
+#ifndef SERVER_BULLET_PATTERN_SYSTEM_HPP_
+#define SERVER_BULLET_PATTERN_SYSTEM_HPP_
+
+#include "../../../engineCore/include/ecs/BulletPool.hpp"
+#include "../../../engineCore/include/ecs/Entity.hpp"
+#include "../../../engineCore/include/ecs/ISystem.hpp"
+#include "../../../engineCore/include/ecs/World.hpp"
+#include "../../../engineCore/include/ecs/components/BulletEmitter.hpp"
+#include "../../../engineCore/include/ecs/components/Collider.hpp"
+#include "../../../engineCore/include/ecs/components/Health.hpp"
+#include "../../../engineCore/include/ecs/components/PlayerId.hpp"
+#include "../../../engineCore/include/ecs/components/Transform.hpp"
+#include "DamageSystem.hpp"
+#include "ecs/ComponentSignature.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace server
+{
+
+/**
+ * @brief Runs the bullet emitters of enemies (rings, spirals, fans, bursts from enemies.json)
+ *
+ * Emitted bullets live in an ecs::BulletPool instead of the ECS: the system
+ * moves them, expires them and tests them against the players in one pass.
+ * NetworkSendSystem replicates the pool as volleys and hits, never bullet
+ * by bullet, and the client rebuilds the bullets from the volleys.
+ */
+class BulletPatternSystem : public ecs::ISystem
+{
+public:
+  /// Volleys and hits stay in the snapshots this long, so a dropped snapshot does not lose them
+  static constexpr float REPLICATION_WINDOW = 0.25F;
+
+  void update(ecs::World &world, float deltaTime) override
+  {
+    gatherTargets(world);
+
+    world.getEntitiesWithSignature(getSignature(), m_emitters);
+    for (const ecs::Entity entity : m_emitters) {
+      fire(world, entity, deltaTime);
+    }
+
+    m_pool.update(deltaTime);
+    collide(world);
+    m_pool.forget(REPLICATION_WINDOW);
+  }
+
+  [[nodiscard]] ecs::ComponentSignature getSignature() const override
+  {
+    ecs::ComponentSignature sig;
+    sig.set(ecs::getComponentId<ecs::Transform>());
+    sig.set(ecs::getComponentId<ecs::BulletEmitter>());
+    return sig;
+  }
+
+  [[nodiscard]] const ecs::BulletPool &getPool() const noexcept { return m_pool; }
+
+private:
+  /** @brief Player hitbox, gathered once per tick */
+  struct Target {
+    ecs::Entity entity;
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+  };
+
+  void gatherTargets(ecs::World &world)
+  {
+    ecs::ComponentSignature playerSig;
+    playerSig.set(ecs::getComponentId<ecs::PlayerId>());
+    playerSig.set(ecs::getComponentId<ecs::Transform>());
+    playerSig.set(ecs::getComponentId<ecs::Collider>());
+    world.getEntitiesWithSignature(playerSig, m_players);
+
+    m_targets.clear();
+    for (const ecs::Entity player : m_players) {
+      const auto &transform = world.getComponent<ecs::Transform>(player);
+      const auto &collider = world.getComponent<ecs::Collider>(player);
+      m_targets.push_back(
+        {player, transform.x, transform.y, transform.x + collider.width, transform.y + collider.height});
+    }
+  }
+
+  void fire(ecs::World &world, ecs::Entity entity, float deltaTime)
+  {
+    auto &emitter = world.getComponent<ecs::BulletEmitter>(entity);
+    if (!emitter.configs) {
+      return;
+    }
+    const auto &transform = world.getComponent<ecs::Transform>(entity);
+    float centerX = transform.x;
+    float centerY = transform.y;
+    if (world.hasComponent<ecs::Collider>(entity)) {
+      const auto &collider = world.getComponent<ecs::Collider>(entity);
+      centerX += collider.width * 0.5F;
+      centerY += collider.height * 0.5F;
+    }
+    float healthFraction = 1.0F;
+    if (world.hasComponent<ecs::Health>(entity)) {
+      const auto &health = world.getComponent<ecs::Health>(entity);
+      if (health.maxHp > 0) {
+        healthFraction = static_cast<float>(health.hp) / static_cast<float>(health.maxHp);
+      }
+    }
+
+    const auto &configs = *emitter.configs;
+    const std::size_t count = std::min(configs.size(), ecs::BulletEmitter::MAX_EMITTERS);
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto &config = configs[i];
+      auto &state = emitter.states[i];
+      // Boss phases: each emitter only runs within its health range
+      if (healthFraction <= config.minHealth || healthFraction > config.maxHealth) {
+        continue;
+      }
+      state.timer -= deltaTime;
+      if (state.timer > 0.0F) {
+        continue;
+      }
+      if (state.burstLeft == 0) {
+        state.burstLeft = config.burst;
+      }
+      --state.burstLeft;
+      state.timer = std::max(0.0F, state.timer + (state.burstLeft > 0 ? config.burstInterval : config.interval));
+
+      ecs::BulletVolley volley;
+      volley.x = centerX + config.offsetX;
+      volley.y = centerY + config.offsetY;
+      volley.angle = state.angle;
+      if (config.aimed) {
+        aimAtNearest(volley);
+      }
+      state.angle = std::fmod(state.angle + config.spin, 360.0F);
+      volley.arc = config.arc;
+      volley.count = config.count;
+      volley.speed = config.speed;
+      volley.lifetime = config.lifetime;
+      volley.radius = config.radius;
+      volley.spriteId = config.spriteId;
+      volley.width = config.width;
+      volley.height = config.height;
+      volley.frameCount = config.frameCount;
+      volley.frameTime = config.frameTime;
+      volley.scale = config.scale;
+      volley.owner = entity;
+      volley.damage = config.damage;
+      m_pool.emit(volley);
+    }
+  }
+
+  void aimAtNearest(ecs::BulletVolley &volley) const
+  {
+    constexpr float RAD_TO_DEG = 180.0F / 3.14159265F;
+    float best = std::numeric_limits<float>::max();
+    for (const auto &target : m_targets) {
+      const float dx = (target.minX + target.maxX) * 0.5F - volley.x;
+      const float dy = (target.minY + target.maxY) * 0.5F - volley.y;
+      const float distance = dx * dx + dy * dy;
+      if (distance < best) {
+        best = distance;
+        volley.angle = std::atan2(dy, dx) * RAD_TO_DEG;
+      }
+    }
+  }
+
+  // Circle of each bullet against the box of each player; a hit consumes the bullet
+  void collide(ecs::World &world)
+  {
+    if (m_targets.empty()) {
+      return;
+    }
+    for (std::size_t i = 0; i < m_pool.size();) {
+      const float bulletX = m_pool.x(i);
+      const float bulletY = m_pool.y(i);
+      const float radius = m_pool.radius(i);
+      const Target *hit = nullptr;
+      for (const auto &target : m_targets) {
+        const float dx = bulletX - std::clamp(bulletX, target.minX, target.maxX);
+        const float dy = bulletY - std::clamp(bulletY, target.minY, target.maxY);
+        if (dx * dx + dy * dy < radius * radius) {
+          hit = &target;
+          break;
+        }
+      }
+      if (hit == nullptr) {
+        ++i;
+        continue;
+      }
+      ecs::Entity owner = 0;
+      int damage = 0;
+      if (const auto *volley = m_pool.volleyOf(i); volley != nullptr) {
+        damage = volley->damage;
+        if (world.isAlive(volley->owner)) {
+          owner = volley->owner;
+        }
+      }
+      DamageSystem::applyDamage(world, hit->entity, owner, damage);
+      m_pool.kill(i);
+    }
+  }
+
+  ecs::BulletPool m_pool;
+  std::vector<ecs::Entity> m_emitters;
+  std::vector<ecs::Entity> m_players;
+  std::vector<Target> m_targets;
+};
+
+} // namespace server
+
+#endif // SERVER_BULLET_PATTERN_SYSTEM_HPP_
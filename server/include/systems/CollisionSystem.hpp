@@ -10,9 +10,11 @@
 
 #include "../../../engineCore/include/ecs/Entity.hpp"
 #include "../../../engineCore/include/ecs/ISystem.hpp"
+#include "../../../engineCore/include/ecs/Sweep.hpp"
 #include "../../../engineCore/include/ecs/World.hpp"
 #include "../../../engineCore/include/ecs/components/Collider.hpp"
 #include "../../../engineCore/include/ecs/components/Sprite.hpp"
+#include "../../../engineCore/include/ecs/components/Swept.hpp"
 #include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/events/GameEvents.hpp"
 #include "ecs/ComponentSignature.hpp"
@@ -26,6 +28,11 @@ namespace server
 
 /**
  * @brief System that detects collisions and emits collision events
+ *
+ * Pairs are tested at their current positions, unless one of them has Swept:
+ * then the Swept entities are tested along the path they covered this tick,
+ * against the other one held still at its current position, so fast shots
+ * cannot step over a target when the tick is long (e.g. a 30 Hz lobby).
  */
 class CollisionSystem : public ecs::ISystem
 {
@@ -36,14 +43,27 @@ public:
   {
     (void)deltaTime;
 
-    std::vector<ecs::Entity> entities;
-    world.getEntitiesWithSignature(getSignature(), entities);
+    world.getEntitiesWithSignature(getSignature(), m_entities);
+
+    // Displacement of this tick for the entities with Swept
+    auto &sweeps = world.getStorage<ecs::Swept>();
+    m_motions.assign(m_entities.size(), Motion{});
+    for (size_t i = 0; i < m_entities.size(); ++i) {
+      if (!sweeps.hasComponent(m_entities[i])) {
+        continue;
+      }
+      const auto &swept = sweeps.getComponent(m_entities[i]);
+      if (swept.moved) {
+        const auto &transform = world.getComponent<ecs::Transform>(m_entities[i]);
+        m_motions[i] = Motion{transform.x - swept.prevX, transform.y - swept.prevY, true};
+      }
+    }
 
     // Check all pairs of entities
-    for (size_t i = 0; i < entities.size(); ++i) {
-      for (size_t j = i + 1; j < entities.size(); ++j) {
-        ecs::Entity entityA = entities[i];
-        ecs::Entity entityB = entities[j];
+    for (size_t i = 0; i < m_entities.size(); ++i) {
+      for (size_t j = i + 1; j < m_entities.size(); ++j) {
+        ecs::Entity entityA = m_entities[i];
+        ecs::Entity entityB = m_entities[j];
 
         if (!world.isAlive(entityA) || !world.isAlive(entityB)) {
           continue;
@@ -66,7 +86,10 @@ public:
           continue; // Enemies don't collide with each other
         }
 
-        if (checkCollision(transformA, colliderA, transformB, colliderB)) {
+        const bool collides = m_motions[i].swept || m_motions[j].swept
+          ? checkSweptCollision(transformA, colliderA, m_motions[i], transformB, colliderB, m_motions[j])
+          : checkCollision(transformA, colliderA, transformB, colliderB);
+        if (collides) {
           // Emit collision event
           ecs::CollisionEvent event(entityA, entityB);
           world.emitEvent(event);
@@ -84,6 +107,16 @@ public:
   }
 
 private:
+  /** @brief Move of an entity during this tick, zero for the entities without Swept */
+  struct Motion {
+    float dx = 0.0F;
+    float dy = 0.0F;
+    bool swept = false;
+  };
+
+  std::vector<ecs::Entity> m_entities; // Query scratch, reused every tick
+  std::vector<Motion> m_motions; // Parallel to m_entities, refilled every tick
+
   /**
    * @brief Check if an entity is an enemy based on its sprite ID
    */
@@ -110,6 +143,34 @@ private:
     return checkBoxCircle(transA, colA, transB, colB);
   }
 
+  /**
+   * @brief Whether the colliders overlap at some time of the tick, each moving from its Transform minus its motion
+   *
+   * An entity without Swept has a zero motion, so it is tested where it ended the tick.
+   */
+  static bool checkSweptCollision(const ecs::Transform &transA, const ecs::Collider &colA, const Motion &moveA,
+                                  const ecs::Transform &transB, const ecs::Collider &colB, const Motion &moveB)
+  {
+    const float startAX = transA.x - moveA.dx;
+    const float startAY = transA.y - moveA.dy;
+    const float startBX = transB.x - moveB.dx;
+    const float startBY = transB.y - moveB.dy;
+    if (colA.shape == ecs::Collider::Shape::BOX && colB.shape == ecs::Collider::Shape::BOX) {
+      return ecs::sweep::boxBox({startAX, startAY, colA.width, colA.height}, moveA.dx, moveA.dy,
+                                {startBX, startBY, colB.width, colB.height}, moveB.dx, moveB.dy);
+    }
+    if (colA.shape == ecs::Collider::Shape::CIRCLE && colB.shape == ecs::Collider::Shape::CIRCLE) {
+      return ecs::sweep::circleCircle(startAX, startAY, colA.radius, moveA.dx, moveA.dy, startBX, startBY, colB.radius,
+                                      moveB.dx, moveB.dy);
+    }
+    if (colA.shape == ecs::Collider::Shape::BOX) {
+      return ecs::sweep::boxCircle({startAX, startAY, colA.width, colA.height}, moveA.dx, moveA.dy, startBX, startBY,
+                                   colB.radius, moveB.dx, moveB.dy);
+    }
+    return ecs::sweep::boxCircle({startBX, startBY, colB.width, colB.height}, moveB.dx, moveB.dy, startAX, startAY,
+                                 colA.radius, moveA.dx, moveA.dy);
+  }
+
   static bool checkBoxBox(const ecs::Transform &transA, const ecs::Collider &colA, const ecs::Transform &transB,
                           const ecs::Collider &colB)
   {
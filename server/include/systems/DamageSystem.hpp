@@ -60,6 +60,95 @@ public:
     return {};
   }
 
+  /**
+   * @brief Damage target, crediting the owner when source is a projectile
+   * @param source Projectile or entity dealing the damage, 0 for none
+   * @note Also used by BulletPatternSystem for the pooled bullets, which are not entities
+   */
+  static void applyDamage(ecs::World &world, ecs::Entity target, ecs::Entity source, int damage)
+  {
+    (void)damage; // We use fixed 1 life per hit; keep parameter for compatibility
+    if (!world.isAlive(target) || !world.hasComponent<ecs::Health>(target)) {
+      return;
+    }
+
+    // Find the real source (if source is a projectile, get its owner)
+    ecs::Entity realSource = source;
+    if (source != 0 && world.hasComponent<ecs::Owner>(source)) {
+      const auto &owner = world.getComponent<ecs::Owner>(source);
+      if (world.isAlive(owner.ownerId)) {
+        realSource = owner.ownerId; // Credit the owner, not the projectile
+      }
+    }
+
+    // Prevent friendly fire: if source is a player and target is also a player, skip
+    if (realSource != 0 && world.hasComponent<ecs::Input>(realSource) && world.hasComponent<ecs::Input>(target)) {
+      return;
+    }
+
+    // Prevent friendly fire between allies and players
+    if (realSource != 0 && world.hasComponent<ecs::Ally>(realSource) && world.hasComponent<ecs::Input>(target)) {
+      return; // Ally can't damage player
+    }
+    if (realSource != 0 && world.hasComponent<ecs::Input>(realSource) && world.hasComponent<ecs::Ally>(target)) {
+      return; // Player can't damage ally
+    }
+
+    // Check immortality first
+    if (world.hasComponent<ecs::Immortal>(target)) {
+      const auto &immortal = world.getComponent<ecs::Immortal>(target);
+      if (immortal.isImmortal) {
+        return; // Do not apply damage to immortal entities
+      }
+    }
+
+    // Prevent enemy friendly fire: if source is an enemy (has Pattern) and target is also an enemy (has Pattern), skip
+    bool sourceIsEnemy = realSource != 0 && world.isAlive(realSource) && world.hasComponent<ecs::Pattern>(realSource);
+    bool targetIsEnemy = world.hasComponent<ecs::Pattern>(target);
+
+    if (sourceIsEnemy && targetIsEnemy) {
+      return;
+    }
+
+    // Skip if target is currently invulnerable
+    if (world.hasComponent<ecs::Invulnerable>(target)) {
+      const auto &inv = world.getComponent<ecs::Invulnerable>(target);
+      if (inv.remaining > 0.0F) {
+        return; // ignore repeated collision while invulnerable
+      }
+    }
+
+    // Decide applied damage: players lose exactly 1 life per hit; other entities take full damage value
+    int appliedDamage = damage;
+    if (world.hasComponent<ecs::Input>(target)) {
+      appliedDamage = 1; // players lose one life per hit
+    }
+    // Emit damage event with applied damage
+    ecs::DamageEvent damageEvent(target, realSource, appliedDamage);
+    world.emitEvent(damageEvent);
+
+    auto &health = world.getComponent<ecs::Health>(target);
+    health.hp -= appliedDamage;
+
+    // If target is a player, give a short invulnerability window to avoid multi-hits while overlapping
+    if (world.hasComponent<ecs::Input>(target)) {
+      constexpr float INVULNERABILITY_SECONDS = 0.6F;
+      if (world.hasComponent<ecs::Invulnerable>(target)) {
+        auto &inv = world.getComponent<ecs::Invulnerable>(target);
+        inv.remaining = INVULNERABILITY_SECONDS;
+      } else {
+        world.addComponent<ecs::Invulnerable>(target, ecs::Invulnerable{INVULNERABILITY_SECONDS});
+      }
+    }
+
+    if (health.hp <= 0) {
+      health.hp = 0;
+      // Emit death event with the real killer
+      ecs::DeathEvent deathEvent(target, realSource);
+      world.emitEvent(deathEvent);
+    }
+  }
+
 private:
   ecs::EventListenerHandle m_collisionHandle;
   static constexpr int damageFromProjectile = 20;
@@ -228,90 +317,6 @@ private:
       }
     }
   }
-
-  static void applyDamage(ecs::World &world, ecs::Entity target, ecs::Entity source, int damage)
-  {
-    (void)damage; // We use fixed 1 life per hit; keep parameter for compatibility
-    if (!world.isAlive(target) || !world.hasComponent<ecs::Health>(target)) {
-      return;
-    }
-
-    // Find the real source (if source is a projectile, get its owner)
-    ecs::Entity realSource = source;
-    if (world.hasComponent<ecs::Owner>(source)) {
-      const auto &owner = world.getComponent<ecs::Owner>(source);
-      if (world.isAlive(owner.ownerId)) {
-        realSource = owner.ownerId; // Credit the owner, not the projectile
-      }
-    }
-
-    // Prevent friendly fire: if source is a player and target is also a player, skip
-    if (realSource != 0 && world.hasComponent<ecs::Input>(realSource) && world.hasComponent<ecs::Input>(target)) {
-      return;
-    }
-
-    // Prevent friendly fire between allies and players
-    if (realSource != 0 && world.hasComponent<ecs::Ally>(realSource) && world.hasComponent<ecs::Input>(target)) {
-      return; // Ally can't damage player
-    }
-    if (realSource != 0 && world.hasComponent<ecs::Input>(realSource) && world.hasComponent<ecs::Ally>(target)) {
-      return; // Player can't damage ally
-    }
-
-    // Check immortality first
-    if (world.hasComponent<ecs::Immortal>(target)) {
-      const auto &immortal = world.getComponent<ecs::Immortal>(target);
-      if (immortal.isImmortal) {
-        return; // Do not apply damage to immortal entities
-      }
-    }
-
-    // Prevent enemy friendly fire: if source is an enemy (has Pattern) and target is also an enemy (has Pattern), skip
-    bool sourceIsEnemy = realSource != 0 && world.isAlive(realSource) && world.hasComponent<ecs::Pattern>(realSource);
-    bool targetIsEnemy = world.hasComponent<ecs::Pattern>(target);
-
-    if (sourceIsEnemy && targetIsEnemy) {
-      return;
-    }
-
-    // Skip if target is currently invulnerable
-    if (world.hasComponent<ecs::Invulnerable>(target)) {
-      const auto &inv = world.getComponent<ecs::Invulnerable>(target);
-      if (inv.remaining > 0.0F) {
-        return; // ignore repeated collision while invulnerable
-      }
-    }
-
-    // Decide applied damage: players lose exactly 1 life per hit; other entities take full damage value
-    int appliedDamage = damage;
-    if (world.hasComponent<ecs::Input>(target)) {
-      appliedDamage = 1; // players lose one life per hit
-    }
-    // Emit damage event with applied damage
-    ecs::DamageEvent damageEvent(target, realSource, appliedDamage);
-    world.emitEvent(damageEvent);
-
-    auto &health = world.getComponent<ecs::Health>(target);
-    health.hp -= appliedDamage;
-
-    // If target is a player, give a short invulnerability window to avoid multi-hits while overlapping
-    if (world.hasComponent<ecs::Input>(target)) {
-      constexpr float INVULNERABILITY_SECONDS = 0.6F;
-      if (world.hasComponent<ecs::Invulnerable>(target)) {
-        auto &inv = world.getComponent<ecs::Invulnerable>(target);
-        inv.remaining = INVULNERABILITY_SECONDS;
-      } else {
-        world.addComponent<ecs::Invulnerable>(target, ecs::Invulnerable{INVULNERABILITY_SECONDS});
-      }
-    }
-
-    if (health.hp <= 0) {
-      health.hp = 0;
-      // Emit death event with the real killer
-      ecs::DeathEvent deathEvent(target, realSource);
-      world.emitEvent(deathEvent);
-    }
-  }
 };
 
 } // namespace server
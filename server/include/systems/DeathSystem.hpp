@@ -15,7 +15,6 @@
 #include "../../../engineCore/include/ecs/components/Health.hpp"
 #include "../../../engineCore/include/ecs/components/Immortal.hpp"
 #include "../../../engineCore/include/ecs/components/Input.hpp"
-#include "../../../engineCore/include/ecs/components/Lifetime.hpp"
 #include "../../../engineCore/include/ecs/components/Networked.hpp"
 #include "../../../engineCore/include/ecs/components/Pattern.hpp"
 #include "../../../engineCore/include/ecs/components/Shield.hpp"
@@ -23,14 +22,15 @@
 #include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/events/EventListenerHandle.hpp"
 #include "../../../engineCore/include/ecs/events/GameEvents.hpp"
+#include "../../../engineCore/include/utils/Log.hpp"
 #include "../../engineCore/include/ecs/components/PlayerId.hpp"
 #include "../../engineCore/include/ecs/components/Score.hpp"
 #include "../Lobby.hpp"
 #include "../WorldLobbyRegistry.hpp"
 #include "SpawnSystem.hpp"
 #include "ecs/ComponentSignature.hpp"
-#include <iostream>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <vector>
 
 namespace server
@@ -101,44 +101,9 @@ private:
     // Get position of dead entity
     const auto &transform = world.getComponent<ecs::Transform>(deadEntity);
 
-    // Create death animation entity
-    ecs::Entity deathAnim = world.createEntity();
-
-    // Position
-    ecs::Transform animTransform;
-    animTransform.x = transform.x;
-    animTransform.y = transform.y;
-    animTransform.rotation = 0.0F;
-    animTransform.scale = 1.0F;
-    world.addComponent(deathAnim, animTransform);
-
-    // Sprite configuration for death animation
-    // Image: 586x94, 6 frames → each frame is ~98px wide
-    ecs::Sprite sprite;
-    sprite.spriteId = ecs::SpriteId::DEATH_ANIM;
-    sprite.width = 98; // 586 / 6
-    sprite.height = 94;
-    sprite.animated = true;
-    sprite.frameCount = 6;
-    sprite.currentFrame = 0;
-    sprite.startFrame = 0;
-    sprite.endFrame = 5;
-    sprite.frameTime = 0.07F; // 100ms per frame = 600ms total animation
-    sprite.loop = false; // One-shot animation
-    sprite.animationTimer = 0.0F;
-    sprite.reverseAnimation = false;
-    world.addComponent(deathAnim, sprite);
-
-    // Network replication
-    ecs::Networked net;
-    net.networkId = deathAnim;
-    world.addComponent(deathAnim, net);
-
-    // Add lifetime: animation duration = 6 frames * 0.05s = 0.3s
-    // Set slightly higher to ensure last frame is displayed
-    ecs::Lifetime lifetime;
-    lifetime.remaining = 0.35F; // 350ms = animation duration + minimal buffer
-    world.addComponent(deathAnim, lifetime);
+    // SpawnSystem owns the pooled death animation
+    world.emitEvent(
+      ecs::SpawnEntityEvent(ecs::SpawnEntityEvent::EntityType::EXPLOSION, transform.x, transform.y, deadEntity));
   }
 
   static void handleDeath(ecs::World &world, const ecs::DeathEvent &event)
@@ -149,7 +114,7 @@ private:
       if (world.isAlive(shield.parent) && world.hasComponent<ecs::Immortal>(shield.parent)) {
         auto &immortal = world.getComponent<ecs::Immortal>(shield.parent);
         immortal.isImmortal = false;
-        std::cout << "[DeathSystem] Shield destroyed, removing immortality from parent " << shield.parent << std::endl;
+        RTYPE_LOG_DEBUG("[DeathSystem] Shield destroyed, removing immortality from parent " << shield.parent);
       }
     }
 
@@ -158,11 +123,11 @@ private:
       // Award 100 points to the killer
       ecs::ScoreEvent scoreEvent(event.killer, 100);
       world.emitEvent(scoreEvent);
-      std::cout << "[DeathSystem] Entity " << event.entity << " killed by " << event.killer << " - awarding 100 points"
-                << std::endl;
+      RTYPE_LOG_DEBUG("[DeathSystem] Entity " << event.entity << " killed by " << event.killer
+                                              << " - awarding 100 points");
     } else {
-      std::cout << "[DeathSystem] Entity " << event.entity << " died but killer " << event.killer << " is not alive"
-                << std::endl;
+      RTYPE_LOG_DEBUG("[DeathSystem] Entity " << event.entity << " died but killer " << event.killer
+                                              << " is not alive");
     }
 
     // Special-case: if a boss brocolis projectile/egg was killed by a player, spawn a mini-boss immediately
@@ -233,17 +198,15 @@ private:
           world.addComponent(newBoss, bossHp);
 
           // IA (Récursive)
-          ecs::Pattern bossPat;
-          bossPat.patternType = "boss_brocolis_pattern";
-          bossPat.phase = 0.0F;
+          ecs::Pattern bossPat{"boss_brocolis_pattern"};
           world.addComponent(newBoss, bossPat);
 
           ecs::Networked net;
           net.networkId = newBoss;
           world.addComponent(newBoss, net);
 
-          std::cout << "[DeathSystem] Spawned mini boss brocolis at (" << bossTrans.x << ',' << bossTrans.y
-                    << ") from destroyed projectile\n";
+          RTYPE_LOG_DEBUG("[DeathSystem] Spawned mini boss brocolis at (" << bossTrans.x << ',' << bossTrans.y
+                                                                          << ") from destroyed projectile");
         }
       }
     }
@@ -254,8 +217,7 @@ private:
       if (world.isAlive(event.entity) && world.hasComponent<ecs::PlayerId>(event.entity)) {
         const auto &pid = world.getComponent<ecs::PlayerId>(event.entity);
 
-        std::cout << "[DeathSystem] Player " << pid.clientId << " died. Counting remaining alive players..."
-                  << std::endl;
+        RTYPE_LOG_DEBUG("[DeathSystem] Player " << pid.clientId << " died. Counting remaining alive players...");
 
         // Count remaining alive players (non-spectators), excluding the current dying player
         int alivePlayerCount = 0;
@@ -268,42 +230,39 @@ private:
           // Skip spectators
           if (lobby->isSpectator(clientId)) {
             spectatorCount++;
-            std::cout << "[DeathSystem]   Client " << clientId << ": SPECTATOR (skipping)" << std::endl;
+            RTYPE_LOG_DEBUG("[DeathSystem]   Client " << clientId << ": SPECTATOR (skipping)");
             continue;
           }
 
           // Skip the player who is dying
           if (clientId == pid.clientId) {
-            std::cout << "[DeathSystem]   Client " << clientId << ": DYING PLAYER (skipping)" << std::endl;
+            RTYPE_LOG_DEBUG("[DeathSystem]   Client " << clientId << ": DYING PLAYER (skipping)");
             continue;
           }
 
-          ecs::Entity playerEntity = lobby->getPlayerEntity(clientId);
-          std::cout << "[DeathSystem]   Client " << clientId << ": entity=" << playerEntity;
-
-          // Check if entity is alive (don't check != 0 because entity 0 is valid)
-          if (world.isAlive(playerEntity) && world.hasComponent<ecs::Health>(playerEntity)) {
-            const auto &health = world.getComponent<ecs::Health>(playerEntity);
-            std::cout << " hp=" << health.hp << "/" << health.maxHp;
-            if (health.hp > 0) {
-              alivePlayerCount++;
-              std::cout << " -> ALIVE" << std::endl;
-            } else {
-              std::cout << " -> DEAD" << std::endl;
-            }
-          } else {
-            std::cout << " -> NO VALID ENTITY (not alive or no health)" << std::endl;
+          // Entity 0 is a valid player: only a missing entry means no player
+          const std::optional<ecs::Entity> playerEntity = lobby->getPlayerEntity(clientId);
+          if (!playerEntity || !world.isAlive(*playerEntity) || !world.hasComponent<ecs::Health>(*playerEntity)) {
+            RTYPE_LOG_DEBUG("[DeathSystem]   Client " << clientId << ": NO VALID ENTITY (not alive or no health)");
+            continue;
+          }
+          const auto &health = world.getComponent<ecs::Health>(*playerEntity);
+          if (health.hp > 0) {
+            alivePlayerCount++;
           }
+          RTYPE_LOG_DEBUG("[DeathSystem]   Client " << clientId << ": entity=" << *playerEntity << " hp=" << health.hp
+                                                    << "/" << health.maxHp
+                                                    << (health.hp > 0 ? " -> ALIVE" : " -> DEAD"));
         }
 
-        std::cout << "[DeathSystem] Summary: totalClients=" << totalClients << " spectators=" << spectatorCount
-                  << " alive=" << alivePlayerCount << std::endl;
+        RTYPE_LOG_DEBUG("[DeathSystem] Summary: totalClients=" << totalClients << " spectators=" << spectatorCount
+                                                               << " alive=" << alivePlayerCount);
 
         nlohmann::json msg;
 
         // If there are still alive players, convert dead player to spectator
         if (alivePlayerCount > 0) {
-          std::cout << "[DeathSystem] -> Sending player_died_spectate" << std::endl;
+          RTYPE_LOG_DEBUG("[DeathSystem] -> Sending player_died_spectate");
           msg["type"] = "player_died_spectate";
           msg["reason"] = "killed";
           msg["alive_players"] = alivePlayerCount;
@@ -312,12 +271,12 @@ private:
           lobby->convertToSpectator(pid.clientId);
 
         } else {
-          std::cout << "[DeathSystem] -> Last player died, stopping spawn and triggering end-screen" << std::endl;
+          RTYPE_LOG_INFO("[DeathSystem] -> Last player died, stopping spawn and triggering end-screen");
           // Last player died - game over for everyone
 
           // Stop level spawning when game is over
           if (auto *spawnSystem = world.getSystem<server::SpawnSystem>()) {
-            std::cout << "[DeathSystem] -> Stopping spawn system (game over)" << std::endl;
+            RTYPE_LOG_DEBUG("[DeathSystem] -> Stopping spawn system (game over)");
             spawnSystem->stopLevel();
           }
 
@@ -326,7 +285,7 @@ private:
             try {
               lobby->endGameShowScores();
             } catch (const std::exception &e) {
-              std::cerr << "[DeathSystem] Exception while triggering end-screen: " << e.what() << std::endl;
+              RTYPE_LOG_ERROR("[DeathSystem] Exception while triggering end-screen: " << e.what());
             }
           }
           return; // Don't send any message - endGameShowScores handles it
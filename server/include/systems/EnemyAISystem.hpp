@@ -10,9 +10,15 @@
 
 #include "../../../engineCore/include/ecs/Entity.hpp"
 #include "../../../engineCore/include/ecs/ISystem.hpp"
+#include "../../../engineCore/include/ecs/Prefab.hpp"
+#include "../../../engineCore/include/ecs/SpatialIndex.hpp"
 #include "../../../engineCore/include/ecs/World.hpp"
 #include "../../../engineCore/include/ecs/components/Attraction.hpp"
+#include "../../../engineCore/include/ecs/components/BoomerangState.hpp"
+#include "../../../engineCore/include/ecs/components/BossState.hpp"
+#include "../../../engineCore/include/ecs/components/BrocolisState.hpp"
 #include "../../../engineCore/include/ecs/components/Collider.hpp"
+#include "../../../engineCore/include/ecs/components/Health.hpp"
 #include "../../../engineCore/include/ecs/components/Lifetime.hpp"
 #include "../../../engineCore/include/ecs/components/Networked.hpp"
 #include "../../../engineCore/include/ecs/components/Owner.hpp"
@@ -25,9 +31,12 @@
 #include "ecs/components/Transform.hpp"
 #include "ecs/components/Velocity.hpp"
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <random>
-#include <unordered_map>
 #include <vector>
 
 namespace server
@@ -45,1162 +54,1176 @@ class EnemyAISystem : public ecs::ISystem
 public:
   void update(ecs::World &world, float deltaTime) override
   {
-    std::vector<ecs::Entity> entities;
-    world.getEntitiesWithSignature(getSignature(), entities);
-
-    for (auto entity : entities) {
-      // Note: These references are valid at the start, but MAY become invalid
-      // if world.addComponent is called inside the loop (vector reallocation).
-      auto &transform = world.getComponent<ecs::Transform>(entity);
-      auto &velocity = world.getComponent<ecs::Velocity>(entity);
-      auto &pattern = world.getComponent<ecs::Pattern>(entity);
+    world.getEntitiesWithSignature(getSignature(), m_entities);
+
+    // One player query per tick on the spatial index; each pattern then aims at the player nearest to the enemy
+    ecs::ComponentSignature playerSig;
+    playerSig.set(ecs::getComponentId<ecs::PlayerId>());
+    playerSig.set(ecs::getComponentId<ecs::Transform>());
+    world.getSpatialIndex().collect(playerSig, m_playerEntries);
+    m_players.clear();
+    for (const auto *entry : m_playerEntries) {
+      if (world.isAlive(entry->entity) && world.hasComponent<ecs::PlayerId>(entry->entity) &&
+          world.hasComponent<ecs::Transform>(entry->entity)) {
+        m_players.push_back(entry->entity);
+      }
+    }
 
-      // Apply pattern-based movement
-      if (pattern.patternType == "sine_wave") {
-        velocity.dx = ENEMY_MOVE_SPEED;
-        pattern.phase += deltaTime * pattern.frequency;
-        velocity.dy = pattern.amplitude * pattern.frequency * std::cos(pattern.phase);
-
-      } else if (pattern.patternType == "zigzag") {
-        float relativeY = transform.y - pattern.phase;
-        if (pattern.phase == 0.0F) {
-          pattern.phase = transform.y;
-          relativeY = 0.0F;
-        }
-        if (relativeY > pattern.amplitude) {
-          velocity.dy = -std::abs(velocity.dy);
-        } else if (relativeY < -pattern.amplitude) {
-          velocity.dy = std::abs(velocity.dy);
-        }
+    // Group the enemies by the pattern interned when they spawned, then run each pattern over its group
+    for (auto &entities : m_groups) {
+      entities.clear();
+    }
+    auto &patterns = world.getStorage<ecs::Pattern>();
+    for (const auto entity : m_entities) {
+      m_groups[static_cast<std::size_t>(patterns.getComponent(entity).kind)].push_back(entity);
+    }
 
-      } else if (pattern.patternType == "straight") {
-        velocity.dx = ENEMY_MOVE_SPEED;
-        velocity.dy = 0.0F;
+    moveStraight(world, group(ecs::PatternKind::STRAIGHT));
+    moveSineWave(world, group(ecs::PatternKind::SINE_WAVE), deltaTime);
+    moveZigzag(world, group(ecs::PatternKind::ZIGZAG));
+    updateBounce(world, group(ecs::PatternKind::BOUNCE), deltaTime);
 
-      } else if (pattern.patternType == "bounce") {
-        constexpr float SCREEN_TOP_BOUNDARY = 0.0F;
-        constexpr float SCREEN_BOTTOM_BOUNDARY = 1080.0F;
-        constexpr float SCREEN_LEFT_BOUNDARY = 0.0F;
-        constexpr float SCREEN_RIGHT_BOUNDARY = 1920.0F;
-
-        if (pattern.phase == 0.0F) {
-          pattern.phase = 1.0F;
-          std::mt19937 rng(static_cast<unsigned int>(entity) + static_cast<unsigned int>(transform.x * 100.0F) +
-                           static_cast<unsigned int>(transform.y * 100.0F));
-          std::uniform_int_distribution<int> dist(0, 1);
-          if (dist(rng) == 0)
-            velocity.dy = std::abs(velocity.dy);
-          else
-            velocity.dy = -std::abs(velocity.dy);
+    // These patterns shoot, hatch or despawn as they go: one entity at a time, skipping the ones already gone
+    const auto forEachAlive = [&world](const std::vector<ecs::Entity> &entities, auto &&updateOne) {
+      for (const auto entity : entities) {
+        if (world.isAlive(entity)) {
+          updateOne(entity);
         }
-        if (transform.y <= SCREEN_TOP_BOUNDARY && velocity.dy < 0.0F)
-          velocity.dy = -velocity.dy;
-        if (transform.y >= SCREEN_BOTTOM_BOUNDARY && velocity.dy > 0.0F)
-          velocity.dy = -velocity.dy;
-        if (transform.x >= SCREEN_RIGHT_BOUNDARY && velocity.dx > 0.0F)
-          velocity.dx = -velocity.dx;
-        if (transform.x <= SCREEN_LEFT_BOUNDARY && velocity.dx < 0.0F)
-          velocity.dx = -velocity.dx;
+      }
+    };
+    forEachAlive(group(ecs::PatternKind::GROUND_WALK),
+                 [&](ecs::Entity entity) { updateGroundWalk(world, entity, deltaTime); });
+    forEachAlive(group(ecs::PatternKind::ELITE_TRACK),
+                 [&](ecs::Entity entity) { updateEliteTrack(world, entity, deltaTime); });
+    forEachAlive(group(ecs::PatternKind::BOSS_DOBKERATOPS),
+                 [&](ecs::Entity entity) { updateDobkeratops(world, entity, deltaTime); });
+    forEachAlive(group(ecs::PatternKind::BOSS_BROCOLIS),
+                 [&](ecs::Entity entity) { updateBrocolis(world, entity, deltaTime); });
+    forEachAlive(group(ecs::PatternKind::BOSS_EVANGELIC),
+                 [&](ecs::Entity entity) { updateEvangelic(world, entity, deltaTime); });
+
+    for (const auto entity : m_entities) {
+      // Update rotation for yellow bee based on velocity direction
+      if (world.hasComponent<ecs::Sprite>(entity)) {
+        auto &sprite = world.getComponent<ecs::Sprite>(entity);
+        if (sprite.spriteId == ecs::SpriteId::ENEMY_YELLOW) {
+          // Re-fetch velocity/transform just in case, though ENEMY_YELLOW doesn't trigger spawns
+          if (world.hasComponent<ecs::Velocity>(entity) && world.hasComponent<ecs::Transform>(entity)) {
+            auto &currVel = world.getComponent<ecs::Velocity>(entity);
+            auto &currTrans = world.getComponent<ecs::Transform>(entity);
 
-        if (world.hasComponent<ecs::Sprite>(entity)) {
-          auto &sprite = world.getComponent<ecs::Sprite>(entity);
-          if (sprite.spriteId == ecs::SpriteId::ENEMY_ROBOT) {
-            if (velocity.dx < 0.0F) {
-              sprite.startFrame = 0;
-              sprite.endFrame = 2;
+            float targetAngle = std::atan2(currVel.dy, currVel.dx) * (180.0F / 3.14159265F) + 180.0F;
+            float currentAngle = currTrans.rotation;
+            float angleDiff = targetAngle - currentAngle;
+            while (angleDiff > 180.0F)
+              angleDiff -= 360.0F;
+            while (angleDiff < -180.0F)
+              angleDiff += 360.0F;
+            constexpr float ROTATION_SPEED = 180.0F;
+            float maxRotation = ROTATION_SPEED * deltaTime;
+            if (std::abs(angleDiff) < maxRotation) {
+              currTrans.rotation = targetAngle;
             } else {
-              sprite.startFrame = 3;
-              sprite.endFrame = 5;
+              currTrans.rotation += (angleDiff > 0 ? maxRotation : -maxRotation);
             }
+            while (currTrans.rotation >= 360.0F)
+              currTrans.rotation -= 360.0F;
+            while (currTrans.rotation < 0.0F)
+              currTrans.rotation += 360.0F;
           }
         }
+      }
 
-        pattern.amplitude += deltaTime;
-        constexpr float ROBOT_SHOOT_INTERVAL = 2.5F;
-        if (pattern.amplitude >= ROBOT_SHOOT_INTERVAL) {
-          pattern.amplitude = 0.0F;
-          std::vector<ecs::Entity> players;
-          ecs::ComponentSignature playerSig;
-          playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-          world.getEntitiesWithSignature(playerSig, players);
-
-          if (!players.empty()) {
-            // Copy values to avoid invalid references if reallocation occurs
-            float robotX = transform.x;
-            float robotY = transform.y;
-            auto &playerPos = world.getComponent<ecs::Transform>(players[0]);
-            float targetX = playerPos.x;
-            float targetY = playerPos.y;
-
-            float dx = targetX - robotX;
-            float dy = targetY - robotY;
-            float distance = std::sqrt(dx * dx + dy * dy);
-
-            if (distance > 0.0F) {
-              constexpr float ROBOT_PROJECTILE_SPEED = 350.0F;
-              float dirX = (dx / distance) * ROBOT_PROJECTILE_SPEED;
-              float dirY = (dy / distance) * ROBOT_PROJECTILE_SPEED;
-
-              ecs::Entity projectile = world.createEntity();
-              ecs::Transform projTransform;
-              projTransform.x = robotX;
-              projTransform.y = robotY;
-              projTransform.rotation = 0.0F;
-              projTransform.scale = 0.4F;
-              world.addComponent(projectile, projTransform);
-
-              ecs::Velocity projVelocity;
-              projVelocity.dx = dirX;
-              projVelocity.dy = dirY;
-              world.addComponent(projectile, projVelocity);
-
-              ecs::Sprite projSprite;
-              projSprite.spriteId = ecs::SpriteId::ROBOT_PROJECTILE;
-              projSprite.width = 101;
-              projSprite.height = 114;
-              projSprite.animated = false;
-              projSprite.frameCount = 1;
-              projSprite.currentFrame = 0;
-              projSprite.startFrame = 0;
-              projSprite.endFrame = 0;
-              projSprite.frameTime = 0.0F;
-              projSprite.animationTimer = 0.0F;
-              projSprite.reverseAnimation = false;
-              projSprite.loop = false;
-              world.addComponent(projectile, projSprite);
-
-              ecs::Collider projCollider;
-              projCollider.width = 101.0F * 0.4F;
-              projCollider.height = 114.0F * 0.4F;
-              projCollider.shape = ecs::Collider::Shape::BOX;
-              world.addComponent(projectile, projCollider);
-
-              ecs::Owner projOwner;
-              projOwner.ownerId = entity;
-              world.addComponent(projectile, projOwner);
-
-              ecs::Networked net;
-              net.networkId = projectile;
-              world.addComponent(projectile, net);
-            }
-          }
+      // Safe destruction check at end of loop
+      // Refetch components because previous references (transform, pattern) may be invalid due to vector reallocation
+      if (world.isAlive(entity) && world.hasComponent<ecs::Transform>(entity) &&
+          world.hasComponent<ecs::Pattern>(entity)) {
+        const auto &currTrans = world.getComponent<ecs::Transform>(entity);
+        const auto &currPattern = world.getComponent<ecs::Pattern>(entity);
+
+        if (currPattern.kind != ecs::PatternKind::GROUND_WALK && currTrans.x < OFFSCREEN_DESTROY_X) {
+          world.destroyEntity(entity);
         }
+      }
+    }
+  }
 
-      } else if (pattern.patternType == "ground_walk") {
-        constexpr float SHOOTING_RANGE_MIN = 200.0F;
-        constexpr float SHOOTING_RANGE_MAX = 800.0F;
-        constexpr float SCREEN_LEFT_BOUNDARY = 50.0F;
-        constexpr float SCREEN_RIGHT_BOUNDARY = 1820.0F;
-        constexpr float GROUND_Y_POSITION = 950.0F;
-        constexpr float WALKER_SPEED = 150.0F;
+  [[nodiscard]] ecs::ComponentSignature getSignature() const override
+  {
+    ecs::ComponentSignature sig;
+    sig.set(ecs::getComponentId<ecs::Pattern>());
+    sig.set(ecs::getComponentId<ecs::Velocity>());
+    sig.set(ecs::getComponentId<ecs::Transform>());
+    return sig;
+  }
 
-        transform.y = GROUND_Y_POSITION;
-        velocity.dy = 0.0F;
+  /**
+   * @brief Park count bullets of each enemy bullet kind, see LevelConfig::pool
+   */
+  static void prewarmBullets(ecs::World &world, std::size_t count)
+  {
+    for (std::size_t kind = 0; kind < static_cast<std::size_t>(BulletKind::COUNT); ++kind) {
+      world.prewarm(bulletPrefab(static_cast<BulletKind>(kind)), count);
+    }
+  }
 
-        std::vector<ecs::Entity> players;
-        ecs::ComponentSignature playerSig;
-        playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-        world.getEntitiesWithSignature(playerSig, players);
+private:
+  ecs::EventListenerHandle m_damageHandle;
+  static constexpr float ENEMY_MOVE_SPEED = -384.0F;
+  static constexpr float OFFSCREEN_DESTROY_X = -100.0F;
 
-        if (!players.empty()) {
-          auto &playerPos = world.getComponent<ecs::Transform>(players[0]);
-          float dx = playerPos.x - transform.x;
-          float horizontalDistance = std::abs(dx);
+  std::vector<ecs::Entity> m_entities; // Query scratch, reused every tick
+  std::vector<const ecs::SpatialIndex::Entry *> m_playerEntries;
+  std::vector<ecs::Entity> m_players;
+  std::array<std::vector<ecs::Entity>, static_cast<std::size_t>(ecs::PatternKind::COUNT)> m_groups;
 
-          if (horizontalDistance > SHOOTING_RANGE_MAX) {
-            velocity.dx = (dx > 0.0F ? WALKER_SPEED : -WALKER_SPEED);
-          } else if (horizontalDistance < SHOOTING_RANGE_MIN) {
-            velocity.dx = (dx > 0.0F ? -WALKER_SPEED : WALKER_SPEED);
-          } else {
-            velocity.dx = (dx / horizontalDistance) * (WALKER_SPEED * 0.3F);
-          }
+  /** @brief Components and pattern state of one group, gathered so that the kernels are plain loops over arrays */
+  struct MotionBatch {
+    std::vector<ecs::Velocity *> velocities;
+    std::vector<ecs::Pattern *> patterns;
+    std::vector<float> x, y, dx, dy, phase, amplitude, frequency;
+  };
+  MotionBatch m_batch;
 
-          if (transform.x < SCREEN_LEFT_BOUNDARY) {
-            transform.x = SCREEN_LEFT_BOUNDARY;
-            velocity.dx = std::max(0.0F, velocity.dx);
-          } else if (transform.x > SCREEN_RIGHT_BOUNDARY) {
-            transform.x = SCREEN_RIGHT_BOUNDARY;
-            velocity.dx = std::min(0.0F, velocity.dx);
-          }
+  std::vector<ecs::Entity> &group(ecs::PatternKind kind) { return m_groups[static_cast<std::size_t>(kind)]; }
 
-          if (world.hasComponent<ecs::Sprite>(entity)) {
-            auto &sprite = world.getComponent<ecs::Sprite>(entity);
-            if (sprite.spriteId == ecs::SpriteId::ENEMY_WALKER) {
-              if (velocity.dx > -0.1F) {
-                sprite.startFrame = 3;
-                sprite.endFrame = 5;
-              } else if (velocity.dx < 0.1F) {
-                sprite.startFrame = 0;
-                sprite.endFrame = 2;
-              } else {
-                sprite.startFrame = 2;
-                sprite.endFrame = 2;
-              }
-            }
-          }
+  /** @brief Transform of the player nearest to (x, y), nullptr when no player is left */
+  const ecs::Transform *targetPlayer(ecs::World &world, float x, float y) const
+  {
+    const ecs::Transform *target = nullptr;
+    float best = std::numeric_limits<float>::max();
+    for (const auto player : m_players) {
+      const auto &playerTransform = world.getComponent<ecs::Transform>(player);
+      const float dx = playerTransform.x - x;
+      const float dy = playerTransform.y - y;
+      const float distance = dx * dx + dy * dy;
+      if (distance < best) {
+        best = distance;
+        target = &playerTransform;
+      }
+    }
+    return target;
+  }
 
-          pattern.phase += deltaTime;
-          constexpr float SHOOT_INTERVAL = 2.0F;
-          float dy = playerPos.y - transform.y;
-          float fullDistance = std::sqrt(dx * dx + dy * dy);
+  void gather(ecs::World &world, const std::vector<ecs::Entity> &entities)
+  {
+    auto &transforms = world.getStorage<ecs::Transform>();
+    auto &velocities = world.getStorage<ecs::Velocity>();
+    auto &patterns = world.getStorage<ecs::Pattern>();
+    const std::size_t count = entities.size();
+    m_batch.velocities.resize(count);
+    m_batch.patterns.resize(count);
+    for (auto *values : {&m_batch.x, &m_batch.y, &m_batch.dx, &m_batch.dy, &m_batch.phase, &m_batch.amplitude,
+                         &m_batch.frequency}) {
+      values->resize(count);
+    }
 
-          if (pattern.phase >= SHOOT_INTERVAL && horizontalDistance <= SHOOTING_RANGE_MAX &&
-              horizontalDistance >= SHOOTING_RANGE_MIN) {
-            pattern.phase = 0.0F;
-            if (fullDistance > 0.0F) {
-              // Copy values before spawning
-              float walkerX = transform.x;
-              float walkerY = transform.y;
-              float targetX = playerPos.x;
-              float targetY = playerPos.y;
-
-              constexpr float PROJECTILE_SPEED = 400.0F;
-              float dirX = ((targetX - walkerX) / fullDistance) * PROJECTILE_SPEED;
-              float dirY = ((targetY - walkerY) / fullDistance) * PROJECTILE_SPEED;
-
-              ecs::Entity projectile = world.createEntity();
-              ecs::Transform projTransform;
-              projTransform.x = walkerX;
-              projTransform.y = walkerY;
-              projTransform.rotation = 0.0F;
-              projTransform.scale = 0.5F;
-              world.addComponent(projectile, projTransform);
-
-              ecs::Velocity projVelocity;
-              projVelocity.dx = dirX;
-              projVelocity.dy = dirY;
-              world.addComponent(projectile, projVelocity);
-
-              ecs::Sprite projSprite;
-              projSprite.spriteId = ecs::SpriteId::WALKER_PROJECTILE;
-              projSprite.width = 78;
-              projSprite.height = 72;
-              projSprite.animated = true;
-              projSprite.frameCount = 4;
-              projSprite.currentFrame = 0;
-              projSprite.startFrame = 0;
-              projSprite.endFrame = 3;
-              projSprite.frameTime = 0.08F;
-              projSprite.animationTimer = 0.0F;
-              projSprite.reverseAnimation = false;
-              projSprite.loop = false;
-              world.addComponent(projectile, projSprite);
-
-              ecs::Collider projCollider;
-              projCollider.width = 78.0F * 0.5F;
-              projCollider.height = 72.0F * 0.5F;
-              projCollider.shape = ecs::Collider::Shape::BOX;
-              world.addComponent(projectile, projCollider);
-
-              ecs::Owner projOwner;
-              projOwner.ownerId = entity;
-              world.addComponent(projectile, projOwner);
-
-              ecs::Networked net;
-              net.networkId = projectile;
-              world.addComponent(projectile, net);
-            }
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto &transform = transforms.getComponent(entities[i]);
+      auto &velocity = velocities.getComponent(entities[i]);
+      auto &pattern = patterns.getComponent(entities[i]);
+      m_batch.velocities[i] = &velocity;
+      m_batch.patterns[i] = &pattern;
+      m_batch.x[i] = transform.x;
+      m_batch.y[i] = transform.y;
+      m_batch.dx[i] = velocity.dx;
+      m_batch.dy[i] = velocity.dy;
+      m_batch.phase[i] = pattern.phase;
+      m_batch.amplitude[i] = pattern.amplitude;
+      m_batch.frequency[i] = pattern.frequency;
+    }
+  }
+
+  /** @brief Write the velocities and phases computed by a kernel back to the components gathered */
+  void scatter()
+  {
+    for (std::size_t i = 0; i < m_batch.velocities.size(); ++i) {
+      m_batch.velocities[i]->dx = m_batch.dx[i];
+      m_batch.velocities[i]->dy = m_batch.dy[i];
+      m_batch.patterns[i]->phase = m_batch.phase[i];
+    }
+  }
+
+  /** @brief "straight": fly left at the enemy speed */
+  static void moveStraight(ecs::World &world, const std::vector<ecs::Entity> &entities)
+  {
+    auto &velocities = world.getStorage<ecs::Velocity>();
+    for (const auto entity : entities) {
+      auto &velocity = velocities.getComponent(entity);
+      velocity.dx = ENEMY_MOVE_SPEED;
+      velocity.dy = 0.0F;
+    }
+  }
+
+  /** @brief "sine_wave": fly left while oscillating around the spawn height */
+  void moveSineWave(ecs::World &world, const std::vector<ecs::Entity> &entities, float deltaTime)
+  {
+    gather(world, entities);
+    const std::size_t count = entities.size();
+    float *phase = m_batch.phase.data();
+    float *dx = m_batch.dx.data();
+    float *dy = m_batch.dy.data();
+    const float *amplitude = m_batch.amplitude.data();
+    const float *frequency = m_batch.frequency.data();
+    for (std::size_t i = 0; i < count; ++i) {
+      dx[i] = ENEMY_MOVE_SPEED;
+      phase[i] += deltaTime * frequency[i];
+      dy[i] = amplitude[i] * frequency[i] * std::cos(phase[i]);
+    }
+    scatter();
+  }
+
+  /** @brief "zigzag": bounce between amplitude above and below the height of the first tick, kept in phase */
+  void moveZigzag(ecs::World &world, const std::vector<ecs::Entity> &entities)
+  {
+    gather(world, entities);
+    const std::size_t count = entities.size();
+    const float *y = m_batch.y.data();
+    const float *amplitude = m_batch.amplitude.data();
+    float *phase = m_batch.phase.data();
+    float *dy = m_batch.dy.data();
+    for (std::size_t i = 0; i < count; ++i) {
+      const bool first = phase[i] == 0.0F;
+      const float relativeY = first ? 0.0F : y[i] - phase[i];
+      phase[i] = first ? y[i] : phase[i];
+      const float speed = std::abs(dy[i]);
+      dy[i] = relativeY > amplitude[i] ? -speed : (relativeY < -amplitude[i] ? speed : dy[i]);
+    }
+    scatter();
+  }
+
+  /**
+   * @brief "bounce": the robot bounces off the screen edges and shoots at the player
+   *
+   * The bounce itself is a kernel; the first-tick random direction, the sprite
+   * frames and the shots stay per entity.
+   */
+  void updateBounce(ecs::World &world, const std::vector<ecs::Entity> &entities, float deltaTime)
+  {
+    constexpr float SCREEN_TOP_BOUNDARY = 0.0F;
+    constexpr float SCREEN_BOTTOM_BOUNDARY = 1080.0F;
+    constexpr float SCREEN_LEFT_BOUNDARY = 0.0F;
+    constexpr float SCREEN_RIGHT_BOUNDARY = 1920.0F;
+    constexpr float ROBOT_SHOOT_INTERVAL = 2.5F;
+    constexpr float ROBOT_PROJECTILE_SPEED = 350.0F;
+
+    // Random vertical direction on the first tick, drawn in entity order
+    for (const auto entity : entities) {
+      auto &pattern = world.getComponent<ecs::Pattern>(entity);
+      if (pattern.phase == 0.0F) {
+        pattern.phase = 1.0F;
+        auto &velocity = world.getComponent<ecs::Velocity>(entity);
+        std::uniform_int_distribution<int> dist(0, 1);
+        if (dist(world.getRandom()) == 0)
+          velocity.dy = std::abs(velocity.dy);
+        else
+          velocity.dy = -std::abs(velocity.dy);
+      }
+    }
+
+    gather(world, entities);
+    const std::size_t count = entities.size();
+    const float *x = m_batch.x.data();
+    const float *y = m_batch.y.data();
+    float *dx = m_batch.dx.data();
+    float *dy = m_batch.dy.data();
+    for (std::size_t i = 0; i < count; ++i) {
+      dy[i] = ((y[i] <= SCREEN_TOP_BOUNDARY && dy[i] < 0.0F) || (y[i] >= SCREEN_BOTTOM_BOUNDARY && dy[i] > 0.0F))
+        ? -dy[i]
+        : dy[i];
+      dx[i] = ((x[i] >= SCREEN_RIGHT_BOUNDARY && dx[i] > 0.0F) || (x[i] <= SCREEN_LEFT_BOUNDARY && dx[i] < 0.0F))
+        ? -dx[i]
+        : dx[i];
+    }
+    scatter();
+
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto entity = entities[i];
+      if (world.hasComponent<ecs::Sprite>(entity)) {
+        auto &sprite = world.getComponent<ecs::Sprite>(entity);
+        if (sprite.spriteId == ecs::SpriteId::ENEMY_ROBOT) {
+          if (dx[i] < 0.0F) {
+            sprite.startFrame = 0;
+            sprite.endFrame = 2;
+          } else {
+            sprite.startFrame = 3;
+            sprite.endFrame = 5;
           }
-        } else {
-          velocity.dx = 0.0F;
-          velocity.dy = 0.0F;
         }
-      } else if (pattern.patternType == "elite_track") {
-        // Elite green enemy: track player at a small distance and fire straight shots
-        constexpr float FOLLOW_DISTANCE_DEFAULT = 240.0F;
-        constexpr float FOLLOW_SPEED_DEFAULT = 220.0F;
-        constexpr float SHOOT_INTERVAL = 1.8F;
-        constexpr float SHOOT_FRAME_DURATION = 0.2F;
-        constexpr float PROJECTILE_SPEED = 520.0F;
-
-        std::vector<ecs::Entity> players;
-        ecs::ComponentSignature playerSig;
-        playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-        world.getEntitiesWithSignature(playerSig, players);
-
-        if (!players.empty()) {
-          auto &playerPos = world.getComponent<ecs::Transform>(players[0]);
-
-          const float followDistance = (pattern.amplitude > 0.0F) ? pattern.amplitude : FOLLOW_DISTANCE_DEFAULT;
-          const float followSpeed = (pattern.frequency > 0.0F) ? pattern.frequency : FOLLOW_SPEED_DEFAULT;
-
-          const float desiredX = playerPos.x + followDistance;
-          const float desiredY = playerPos.y;
-
-          const float dx = desiredX - transform.x;
-          const float dy = desiredY - transform.y;
-
-          const auto clampSpeed = [followSpeed](float value) {
-            if (value > followSpeed)
-              return followSpeed;
-            if (value < -followSpeed)
-              return -followSpeed;
-            return value;
-          };
-
-          velocity.dx = clampSpeed(dx);
-          velocity.dy = clampSpeed(dy);
-
-          // Shooting timer using pattern.phase
-          pattern.phase += deltaTime;
-          bool fired = false;
+      }
 
-          if (pattern.phase >= SHOOT_INTERVAL) {
-            pattern.phase = 0.0F;
-            fired = true;
-
-            // Compute straight direction towards player at fire time
-            float shotDx = playerPos.x - transform.x;
-            float shotDy = playerPos.y - transform.y;
-            float shotDist = std::sqrt(shotDx * shotDx + shotDy * shotDy);
-            if (shotDist < 1.0F)
-              shotDist = 1.0F;
-            const float dirX = (shotDx / shotDist) * PROJECTILE_SPEED;
-            const float dirY = (shotDy / shotDist) * PROJECTILE_SPEED;
-
-            constexpr float ELITE_SPRITE_HEIGHT = 58.0F;
-            const float enemyHeight = ELITE_SPRITE_HEIGHT * transform.scale;
-
-            const float projectileScale = transform.scale;
-            const float projectileWidth = 65.0F * projectileScale;
-            const float projectileHeight = 18.0F * projectileScale;
-
-            // Spawn slightly forward (left) and a bit lower on the enemy body
-            const float muzzleOffsetX = -projectileWidth * 1.2F;
-            const float muzzleOffsetY = (enemyHeight - projectileHeight) * 0.6F;
-
-            // Spawn projectile (elite_enemy_green_out)
-            ecs::Entity projectile = world.createEntity();
-
-            ecs::Transform projTransform;
-            projTransform.x = transform.x + muzzleOffsetX;
-            projTransform.y = transform.y + muzzleOffsetY;
-            projTransform.rotation = 0.0F;
-            projTransform.scale = projectileScale;
-            world.addComponent(projectile, projTransform);
-
-            ecs::Velocity projVelocity;
-            projVelocity.dx = dirX;
-            projVelocity.dy = dirY;
-            world.addComponent(projectile, projVelocity);
-
-            ecs::Sprite projSprite;
-            projSprite.spriteId = ecs::SpriteId::ELITE_ENEMY_GREEN_OUT;
-            projSprite.width = 65; // elite_enemy_green_out frame width (131/2)
-            projSprite.height = 18;
-            projSprite.animated = true;
-            projSprite.frameCount = 2;
-            projSprite.currentFrame = 0;
-            projSprite.startFrame = 0;
-            projSprite.endFrame = 1;
-            projSprite.frameTime = 0.08F;
-            projSprite.reverseAnimation = false;
-            projSprite.loop = true;
-            world.addComponent(projectile, projSprite);
-
-            ecs::Collider projCollider;
-            projCollider.width = projSprite.width * projectileScale;
-            projCollider.height = projSprite.height * projectileScale;
-            projCollider.shape = ecs::Collider::Shape::BOX;
-            world.addComponent(projectile, projCollider);
-
-            ecs::Owner projOwner;
-            projOwner.ownerId = entity;
-            world.addComponent(projectile, projOwner);
-
-            ecs::Networked net;
-            net.networkId = projectile;
-            world.addComponent(projectile, net);
-
-            // Spawn muzzle flash (elite_enemy_green_in) - one-shot animation
-            ecs::Entity muzzle = world.createEntity();
-
-            ecs::Transform muzzleTransform;
-            const float muzzleScale = projectileScale; // match projectile height
-            const float muzzleWidth = 31.0F * muzzleScale;
-            muzzleTransform.x = transform.x - muzzleWidth * 1.2F;
-            // Align muzzle Y with projectile Y so both are on the same line
-            muzzleTransform.y = projTransform.y;
-            muzzleTransform.rotation = 0.0F;
-            muzzleTransform.scale = muzzleScale;
-            world.addComponent(muzzle, muzzleTransform);
-
-            ecs::Velocity muzzleVelocity;
-            muzzleVelocity.dx = 0.0F;
-            muzzleVelocity.dy = 0.0F;
-            world.addComponent(muzzle, muzzleVelocity);
-
-            ecs::Sprite muzzleSprite;
-            muzzleSprite.spriteId = ecs::SpriteId::ELITE_ENEMY_GREEN_IN;
-            muzzleSprite.width = 31; // elite_enemy_green_in frame width (93/3)
-            muzzleSprite.height = 18;
-            muzzleSprite.animated = true;
-            muzzleSprite.frameCount = 3;
-            muzzleSprite.currentFrame = 0;
-            muzzleSprite.startFrame = 0;
-            muzzleSprite.endFrame = 2;
-            muzzleSprite.frameTime = 0.06F;
-            muzzleSprite.reverseAnimation = false;
-            muzzleSprite.loop = false;
-            world.addComponent(muzzle, muzzleSprite);
-
-            ecs::Lifetime life;
-            life.remaining = muzzleSprite.frameTime * static_cast<float>(muzzleSprite.frameCount);
-            world.addComponent(muzzle, life);
-
-            ecs::Networked muzzleNet;
-            muzzleNet.networkId = muzzle;
-            world.addComponent(muzzle, muzzleNet);
+      // Shots can grow the component storages: nothing gathered is used past this point
+      auto &pattern = world.getComponent<ecs::Pattern>(entity);
+      pattern.amplitude += deltaTime;
+      if (pattern.amplitude >= ROBOT_SHOOT_INTERVAL) {
+        pattern.amplitude = 0.0F;
+        const float robotX = x[i];
+        const float robotY = y[i];
+        if (const auto *target = targetPlayer(world, robotX, robotY); target != nullptr) {
+          const auto &playerPos = *target;
+          const float targetDx = playerPos.x - robotX;
+          const float targetDy = playerPos.y - robotY;
+          const float distance = std::sqrt(targetDx * targetDx + targetDy * targetDy);
+
+          if (distance > 0.0F) {
+            const float dirX = (targetDx / distance) * ROBOT_PROJECTILE_SPEED;
+            const float dirY = (targetDy / distance) * ROBOT_PROJECTILE_SPEED;
+            spawnBullet(world, BulletKind::ROBOT, robotX, robotY, dirX, dirY, entity);
           }
+        }
+      }
+    }
+  }
 
-          // Update elite green sprite frame based on movement/shooting
-          if (world.hasComponent<ecs::Sprite>(entity)) {
-            auto &sprite = world.getComponent<ecs::Sprite>(entity);
-            if (sprite.spriteId == ecs::SpriteId::ELITE_ENEMY_GREEN) {
-              uint32_t frame = 0;
-              if (pattern.phase <= SHOOT_FRAME_DURATION || fired) {
-                frame = 0; // shooting
-              } else if (velocity.dy < -0.1F) {
-                frame = 1; // moving up
-              } else if (velocity.dy > 0.1F) {
-                frame = 2; // moving down
-              } else {
-                frame = 1;
-              }
-              sprite.startFrame = frame;
-              sprite.endFrame = frame;
-              sprite.currentFrame = frame;
-            }
+  /** @brief Per-entity state of the boss patterns, added the first time the entity runs its pattern */
+  template <typename T>
+  static T &stateOf(ecs::World &world, ecs::Entity entity)
+  {
+    if (!world.hasComponent<T>(entity)) {
+      world.addComponent(entity, T{});
+    }
+    return world.getComponent<T>(entity);
+  }
+
+  /**
+   * @brief "ground_walk": walk on the ground, keep a firing distance from the player and shoot at them
+   */
+  void updateGroundWalk(ecs::World &world, ecs::Entity entity, float deltaTime)
+  {
+    auto &transform = world.getComponent<ecs::Transform>(entity);
+    auto &velocity = world.getComponent<ecs::Velocity>(entity);
+    auto &pattern = world.getComponent<ecs::Pattern>(entity);
+
+    constexpr float SHOOTING_RANGE_MIN = 200.0F;
+    constexpr float SHOOTING_RANGE_MAX = 800.0F;
+    constexpr float SCREEN_LEFT_BOUNDARY = 50.0F;
+    constexpr float SCREEN_RIGHT_BOUNDARY = 1820.0F;
+    constexpr float GROUND_Y_POSITION = 950.0F;
+    constexpr float WALKER_SPEED = 150.0F;
+
+    transform.y = GROUND_Y_POSITION;
+    velocity.dy = 0.0F;
+
+    if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+      const auto &playerPos = *target;
+      float dx = playerPos.x - transform.x;
+      float horizontalDistance = std::abs(dx);
+
+      if (horizontalDistance > SHOOTING_RANGE_MAX) {
+        velocity.dx = (dx > 0.0F ? WALKER_SPEED : -WALKER_SPEED);
+      } else if (horizontalDistance < SHOOTING_RANGE_MIN) {
+        velocity.dx = (dx > 0.0F ? -WALKER_SPEED : WALKER_SPEED);
+      } else {
+        velocity.dx = (dx / horizontalDistance) * (WALKER_SPEED * 0.3F);
+      }
+
+      if (transform.x < SCREEN_LEFT_BOUNDARY) {
+        transform.x = SCREEN_LEFT_BOUNDARY;
+        velocity.dx = std::max(0.0F, velocity.dx);
+      } else if (transform.x > SCREEN_RIGHT_BOUNDARY) {
+        transform.x = SCREEN_RIGHT_BOUNDARY;
+        velocity.dx = std::min(0.0F, velocity.dx);
+      }
+
+      if (world.hasComponent<ecs::Sprite>(entity)) {
+        auto &sprite = world.getComponent<ecs::Sprite>(entity);
+        if (sprite.spriteId == ecs::SpriteId::ENEMY_WALKER) {
+          if (velocity.dx > -0.1F) {
+            sprite.startFrame = 3;
+            sprite.endFrame = 5;
+          } else if (velocity.dx < 0.1F) {
+            sprite.startFrame = 0;
+            sprite.endFrame = 2;
+          } else {
+            sprite.startFrame = 2;
+            sprite.endFrame = 2;
           }
-        } else {
-          // No player found: move left slowly
-          velocity.dx = ENEMY_MOVE_SPEED;
-          velocity.dy = 0.0F;
-        }
-      } else if (pattern.patternType == "boss_pattern") {
-        // ... (Boss Dobkeratops logic - mostly existing) ...
-        constexpr float SCREEN_TOP_BOUNDARY = 0.0F;
-        constexpr float SCREEN_BOTTOM_BOUNDARY = 1080.0F;
-        constexpr float SCREEN_RIGHT_BOUNDARY = 1920.0F;
-        constexpr float DEFAULT_ENTRY_MARGIN = 400.0F;
-
-        struct BossState {
-          bool verticalMode = false;
-          float speedChangeTimer = 0.0F;
-          float nextChangeInterval = 1.0F;
-          float targetSpeed = 150.0F;
-        };
-
-        static std::unordered_map<ecs::Entity, BossState> s_bossStates;
-        auto &state = s_bossStates[entity];
-
-        if (pattern.phase == 0.0F) {
-          pattern.phase = 1.0F;
-          std::mt19937 rng(static_cast<unsigned int>(entity));
-          std::uniform_int_distribution<int> dist(0, 1);
-          velocity.dy = (dist(rng) == 0 ? std::abs(velocity.dy) : -std::abs(velocity.dy));
-          std::uniform_real_distribution<float> ivar(0.8F, 2.0F);
-          std::uniform_real_distribution<float> speedVar(100.0F, 280.0F);
-          state.nextChangeInterval = ivar(rng);
-          state.targetSpeed = speedVar(rng);
-          state.speedChangeTimer = 0.0F;
         }
+      }
 
-        float entryX = SCREEN_RIGHT_BOUNDARY - DEFAULT_ENTRY_MARGIN;
-        if (world.hasComponent<ecs::Sprite>(entity)) {
-          auto &sprite = world.getComponent<ecs::Sprite>(entity);
-          float halfWidth = (sprite.width * (world.getComponent<ecs::Transform>(entity).scale));
-          entryX = SCREEN_RIGHT_BOUNDARY - halfWidth;
+      pattern.phase += deltaTime;
+      constexpr float SHOOT_INTERVAL = 2.0F;
+      float dy = playerPos.y - transform.y;
+      float fullDistance = std::sqrt(dx * dx + dy * dy);
+
+      if (pattern.phase >= SHOOT_INTERVAL && horizontalDistance <= SHOOTING_RANGE_MAX &&
+          horizontalDistance >= SHOOTING_RANGE_MIN) {
+        pattern.phase = 0.0F;
+        if (fullDistance > 0.0F) {
+          // Copy values before spawning
+          float walkerX = transform.x;
+          float walkerY = transform.y;
+          float targetX = playerPos.x;
+          float targetY = playerPos.y;
+
+          constexpr float PROJECTILE_SPEED = 400.0F;
+          float dirX = ((targetX - walkerX) / fullDistance) * PROJECTILE_SPEED;
+          float dirY = ((targetY - walkerY) / fullDistance) * PROJECTILE_SPEED;
+
+          spawnBullet(world, BulletKind::WALKER, walkerX, walkerY, dirX, dirY, entity);
         }
+      }
+    } else {
+      velocity.dx = 0.0F;
+      velocity.dy = 0.0F;
+    }
+  }
 
-        if (!state.verticalMode) {
-          if (transform.x <= entryX) {
-            state.verticalMode = true;
-            transform.x = entryX;
-            velocity.dx = 0.0F;
-            float sign = (velocity.dy < 0.0F ? -1.0F : 1.0F);
-            velocity.dy = sign * state.targetSpeed;
-            transform.y = std::clamp(transform.y, SCREEN_TOP_BOUNDARY + 20.0F, SCREEN_BOTTOM_BOUNDARY - 20.0F);
-          }
-        } else {
-          transform.x = entryX;
-          velocity.dx = 0.0F;
-          state.speedChangeTimer += deltaTime;
-          if (state.speedChangeTimer >= state.nextChangeInterval) {
-            std::mt19937 rng(static_cast<unsigned int>(entity) +
-                             static_cast<unsigned int>(state.speedChangeTimer * 1000.0F));
-            std::uniform_real_distribution<float> ivar(0.6F, 2.2F);
-            std::uniform_real_distribution<float> speedVar(90.0F, 340.0F);
-            state.nextChangeInterval = ivar(rng);
-            state.targetSpeed = speedVar(rng);
-            state.speedChangeTimer = 0.0F;
-          }
-          constexpr float SPEED_LERP = 4.0F;
-          float curSpeed = std::abs(velocity.dy);
-          float newSpeed = curSpeed + (state.targetSpeed - curSpeed) * std::min(1.0F, SPEED_LERP * deltaTime);
-          velocity.dy = (velocity.dy < 0.0F ? -newSpeed : newSpeed);
-
-          if (transform.y <= SCREEN_TOP_BOUNDARY + 10.0F && velocity.dy < 0.0F)
-            velocity.dy = -velocity.dy;
-          if (transform.y >= SCREEN_BOTTOM_BOUNDARY - 10.0F && velocity.dy > 0.0F)
-            velocity.dy = -velocity.dy;
-          transform.y = std::clamp(transform.y, SCREEN_TOP_BOUNDARY + 1.0F, SCREEN_BOTTOM_BOUNDARY - 1.0F);
-        }
+  /**
+   * @brief "elite_track": follow the player at a small distance and fire straight shots
+   */
+  void updateEliteTrack(ecs::World &world, ecs::Entity entity, float deltaTime)
+  {
+    auto &transform = world.getComponent<ecs::Transform>(entity);
+    auto &velocity = world.getComponent<ecs::Velocity>(entity);
+    auto &pattern = world.getComponent<ecs::Pattern>(entity);
+
+    // Elite green enemy: track player at a small distance and fire straight shots
+    constexpr float FOLLOW_DISTANCE_DEFAULT = 240.0F;
+    constexpr float FOLLOW_SPEED_DEFAULT = 220.0F;
+    constexpr float SHOOT_INTERVAL = 1.8F;
+    constexpr float SHOOT_FRAME_DURATION = 0.2F;
+    constexpr float PROJECTILE_SPEED = 520.0F;
+
+    if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+      const auto &playerPos = *target;
+
+      const float followDistance = (pattern.amplitude > 0.0F) ? pattern.amplitude : FOLLOW_DISTANCE_DEFAULT;
+      const float followSpeed = (pattern.frequency > 0.0F) ? pattern.frequency : FOLLOW_SPEED_DEFAULT;
+
+      const float desiredX = playerPos.x + followDistance;
+      const float desiredY = playerPos.y;
+
+      const float dx = desiredX - transform.x;
+      const float dy = desiredY - transform.y;
+
+      const auto clampSpeed = [followSpeed](float value) {
+        if (value > followSpeed)
+          return followSpeed;
+        if (value < -followSpeed)
+          return -followSpeed;
+        return value;
+      };
+
+      velocity.dx = clampSpeed(dx);
+      velocity.dy = clampSpeed(dy);
+
+      // Shooting timer using pattern.phase
+      pattern.phase += deltaTime;
+      bool fired = false;
+
+      if (pattern.phase >= SHOOT_INTERVAL) {
+        pattern.phase = 0.0F;
+        fired = true;
+
+        // Compute straight direction towards player at fire time
+        float shotDx = playerPos.x - transform.x;
+        float shotDy = playerPos.y - transform.y;
+        float shotDist = std::sqrt(shotDx * shotDx + shotDy * shotDy);
+        if (shotDist < 1.0F)
+          shotDist = 1.0F;
+        const float dirX = (shotDx / shotDist) * PROJECTILE_SPEED;
+        const float dirY = (shotDy / shotDist) * PROJECTILE_SPEED;
+
+        constexpr float ELITE_SPRITE_HEIGHT = 58.0F;
+        const float enemyHeight = ELITE_SPRITE_HEIGHT * transform.scale;
+
+        const float projectileScale = transform.scale;
+        const float projectileWidth = 65.0F * projectileScale;
+        const float projectileHeight = 18.0F * projectileScale;
+
+        // Spawn slightly forward (left) and a bit lower on the enemy body
+        const float muzzleOffsetX = -projectileWidth * 1.2F;
+        const float muzzleOffsetY = (enemyHeight - projectileHeight) * 0.6F;
+
+        // Spawn projectile (elite_enemy_green_out)
+        ecs::Entity projectile = world.createEntity();
+
+        ecs::Transform projTransform;
+        projTransform.x = transform.x + muzzleOffsetX;
+        projTransform.y = transform.y + muzzleOffsetY;
+        projTransform.rotation = 0.0F;
+        projTransform.scale = projectileScale;
+        world.addComponent(projectile, projTransform);
+
+        ecs::Velocity projVelocity;
+        projVelocity.dx = dirX;
+        projVelocity.dy = dirY;
+        world.addComponent(projectile, projVelocity);
+
+        ecs::Sprite projSprite;
+        projSprite.spriteId = ecs::SpriteId::ELITE_ENEMY_GREEN_OUT;
+        projSprite.width = 65; // elite_enemy_green_out frame width (131/2)
+        projSprite.height = 18;
+        projSprite.animated = true;
+        projSprite.frameCount = 2;
+        projSprite.currentFrame = 0;
+        projSprite.startFrame = 0;
+        projSprite.endFrame = 1;
+        projSprite.frameTime = 0.08F;
+        projSprite.reverseAnimation = false;
+        projSprite.loop = true;
+        world.addComponent(projectile, projSprite);
+
+        ecs::Collider projCollider;
+        projCollider.width = projSprite.width * projectileScale;
+        projCollider.height = projSprite.height * projectileScale;
+        projCollider.shape = ecs::Collider::Shape::BOX;
+        world.addComponent(projectile, projCollider);
+
+        ecs::Owner projOwner;
+        projOwner.ownerId = entity;
+        world.addComponent(projectile, projOwner);
+
+        ecs::Networked net;
+        net.networkId = projectile;
+        world.addComponent(projectile, net);
+
+        // Spawn muzzle flash (elite_enemy_green_in) - one-shot animation
+        ecs::Entity muzzle = world.createEntity();
+
+        ecs::Transform muzzleTransform;
+        const float muzzleScale = projectileScale; // match projectile height
+        const float muzzleWidth = 31.0F * muzzleScale;
+        muzzleTransform.x = transform.x - muzzleWidth * 1.2F;
+        // Align muzzle Y with projectile Y so both are on the same line
+        muzzleTransform.y = projTransform.y;
+        muzzleTransform.rotation = 0.0F;
+        muzzleTransform.scale = muzzleScale;
+        world.addComponent(muzzle, muzzleTransform);
+
+        ecs::Velocity muzzleVelocity;
+        muzzleVelocity.dx = 0.0F;
+        muzzleVelocity.dy = 0.0F;
+        world.addComponent(muzzle, muzzleVelocity);
+
+        ecs::Sprite muzzleSprite;
+        muzzleSprite.spriteId = ecs::SpriteId::ELITE_ENEMY_GREEN_IN;
+        muzzleSprite.width = 31; // elite_enemy_green_in frame width (93/3)
+        muzzleSprite.height = 18;
+        muzzleSprite.animated = true;
+        muzzleSprite.frameCount = 3;
+        muzzleSprite.currentFrame = 0;
+        muzzleSprite.startFrame = 0;
+        muzzleSprite.endFrame = 2;
+        muzzleSprite.frameTime = 0.06F;
+        muzzleSprite.reverseAnimation = false;
+        muzzleSprite.loop = false;
+        world.addComponent(muzzle, muzzleSprite);
+
+        ecs::Lifetime life;
+        life.remaining = muzzleSprite.frameTime * static_cast<float>(muzzleSprite.frameCount);
+        world.addComponent(muzzle, life);
+
+        ecs::Networked muzzleNet;
+        muzzleNet.networkId = muzzle;
+        world.addComponent(muzzle, muzzleNet);
+      }
 
-        pattern.amplitude += deltaTime;
-        constexpr float ROBOT_SHOOT_INTERVAL = 2.5F;
-        if (pattern.amplitude >= ROBOT_SHOOT_INTERVAL) {
-          pattern.amplitude = 0.0F;
-          std::vector<ecs::Entity> players;
-          ecs::ComponentSignature playerSig;
-          playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-          world.getEntitiesWithSignature(playerSig, players);
-          if (!players.empty()) {
-            float bossX = transform.x;
-            float bossY = transform.y;
-            auto &playerPos = world.getComponent<ecs::Transform>(players[0]);
-            float targetX = playerPos.x;
-            float targetY = playerPos.y;
-
-            float dx = targetX - bossX;
-            float dy = targetY - bossY;
-            float distance = std::sqrt(dx * dx + dy * dy);
-            if (distance > 0.0F) {
-              constexpr float ROBOT_PROJECTILE_SPEED = 350.0F;
-              float dirX = (dx / distance) * ROBOT_PROJECTILE_SPEED;
-              float dirY = (dy / distance) * ROBOT_PROJECTILE_SPEED;
-
-              ecs::Entity projectile = world.createEntity();
-              ecs::Transform projTransform;
-              projTransform.x = bossX;
-              projTransform.y = bossY;
-              projTransform.rotation = 1.0F;
-              projTransform.scale = 3.0F;
-              world.addComponent(projectile, projTransform);
-
-              ecs::Velocity projVelocity;
-              projVelocity.dx = dirX;
-              projVelocity.dy = dirY;
-              world.addComponent(projectile, projVelocity);
-
-              ecs::Sprite projSprite;
-              projSprite.spriteId = ecs::SpriteId::BOSS_DOBKERATOP_SHOOT;
-              projSprite.width = 34;
-              projSprite.height = 34;
-              projSprite.animated = true;
-              projSprite.frameCount = 3;
-              projSprite.currentFrame = 0;
-              projSprite.startFrame = 0;
-              projSprite.endFrame = 2;
-              projSprite.frameTime = 0.08F;
-              projSprite.reverseAnimation = false;
-              projSprite.loop = true;
-              world.addComponent(projectile, projSprite);
-
-              ecs::Collider projCollider;
-              projCollider.width = 34.0F;
-              projCollider.height = 34.0F;
-              projCollider.shape = ecs::Collider::Shape::CIRCLE;
-              world.addComponent(projectile, projCollider);
-
-              ecs::Owner projOwner;
-              projOwner.ownerId = entity;
-              world.addComponent(projectile, projOwner);
-
-              ecs::Attraction projAttraction;
-              projAttraction.force = 500.0F;
-              projAttraction.radius = 300.0F;
-              world.addComponent(projectile, projAttraction);
-
-              ecs::Networked net;
-              net.networkId = projectile;
-              world.addComponent(projectile, net);
-            }
+      // Update elite green sprite frame based on movement/shooting
+      if (world.hasComponent<ecs::Sprite>(entity)) {
+        auto &sprite = world.getComponent<ecs::Sprite>(entity);
+        if (sprite.spriteId == ecs::SpriteId::ELITE_ENEMY_GREEN) {
+          uint32_t frame = 0;
+          if (pattern.phase <= SHOOT_FRAME_DURATION || fired) {
+            frame = 0; // shooting
+          } else if (velocity.dy < -0.1F) {
+            frame = 1; // moving up
+          } else if (velocity.dy > 0.1F) {
+            frame = 2; // moving down
+          } else {
+            frame = 1;
           }
+          sprite.startFrame = frame;
+          sprite.endFrame = frame;
+          sprite.currentFrame = frame;
         }
+      }
+    } else {
+      // No player found: move left slowly
+      velocity.dx = ENEMY_MOVE_SPEED;
+      velocity.dy = 0.0F;
+    }
+  }
 
-      } else if (pattern.patternType == "boss_brocolis_pattern") {
-        // ... (Boss Brocolis logic) ...
-        struct BrocolisState {
-          bool hasEntered = false;
-          bool isHatching = false;
-          float hatchingTimer = 0.0F;
-        };
-        static std::unordered_map<ecs::Entity, BrocolisState> s_brocolisStates;
-        auto &state = s_brocolisStates[entity];
-
-        bool isProjectile = false;
-        bool isHatchingEgg = false;
-        if (world.hasComponent<ecs::Sprite>(entity)) {
-          auto &sprite = world.getComponent<ecs::Sprite>(entity);
-          if (sprite.spriteId == ecs::SpriteId::BOSS_BROCOLIS_SHOOT) {
-            isProjectile = true;
-          } else if (sprite.spriteId == ecs::SpriteId::BOSS_BROCOLIS_ECLOSION) {
-            isHatchingEgg = true;
-          }
+  /**
+   * @brief "boss_pattern": Dobkeratops enters from the right, patrols vertically and shoots at the player
+   *
+   * The aimed shot pulls the players in (Attraction), so it stays an entity; the boss's bullet patterns are the
+   * pooled emitters of its enemies.json entry.
+   */
+  void updateDobkeratops(ecs::World &world, ecs::Entity entity, float deltaTime)
+  {
+    auto &state = stateOf<ecs::BossState>(world, entity);
+    auto &transform = world.getComponent<ecs::Transform>(entity);
+    auto &velocity = world.getComponent<ecs::Velocity>(entity);
+    auto &pattern = world.getComponent<ecs::Pattern>(entity);
+
+    constexpr float SCREEN_TOP_BOUNDARY = 0.0F;
+    constexpr float SCREEN_BOTTOM_BOUNDARY = 1080.0F;
+    constexpr float SCREEN_RIGHT_BOUNDARY = 1920.0F;
+    constexpr float DEFAULT_ENTRY_MARGIN = 400.0F;
+
+    if (pattern.phase == 0.0F) {
+      pattern.phase = 1.0F;
+      auto &rng = world.getRandom();
+      std::uniform_int_distribution<int> dist(0, 1);
+      velocity.dy = (dist(rng) == 0 ? std::abs(velocity.dy) : -std::abs(velocity.dy));
+      std::uniform_real_distribution<float> ivar(0.8F, 2.0F);
+      std::uniform_real_distribution<float> speedVar(100.0F, 280.0F);
+      state.nextChangeInterval = ivar(rng);
+      state.targetSpeed = speedVar(rng);
+      state.speedChangeTimer = 0.0F;
+    }
+
+    float entryX = SCREEN_RIGHT_BOUNDARY - DEFAULT_ENTRY_MARGIN;
+    if (world.hasComponent<ecs::Sprite>(entity)) {
+      auto &sprite = world.getComponent<ecs::Sprite>(entity);
+      float halfWidth = (sprite.width * (world.getComponent<ecs::Transform>(entity).scale));
+      entryX = SCREEN_RIGHT_BOUNDARY - halfWidth;
+    }
+
+    if (!state.verticalMode) {
+      if (transform.x <= entryX) {
+        state.verticalMode = true;
+        transform.x = entryX;
+        velocity.dx = 0.0F;
+        float sign = (velocity.dy < 0.0F ? -1.0F : 1.0F);
+        velocity.dy = sign * state.targetSpeed;
+        transform.y = std::clamp(transform.y, SCREEN_TOP_BOUNDARY + 20.0F, SCREEN_BOTTOM_BOUNDARY - 20.0F);
+      }
+    } else {
+      transform.x = entryX;
+      velocity.dx = 0.0F;
+      state.speedChangeTimer += deltaTime;
+      if (state.speedChangeTimer >= state.nextChangeInterval) {
+        auto &rng = world.getRandom();
+        std::uniform_real_distribution<float> ivar(0.6F, 2.2F);
+        std::uniform_real_distribution<float> speedVar(90.0F, 340.0F);
+        state.nextChangeInterval = ivar(rng);
+        state.targetSpeed = speedVar(rng);
+        state.speedChangeTimer = 0.0F;
+      }
+      constexpr float SPEED_LERP = 4.0F;
+      float curSpeed = std::abs(velocity.dy);
+      float newSpeed = curSpeed + (state.targetSpeed - curSpeed) * std::min(1.0F, SPEED_LERP * deltaTime);
+      velocity.dy = (velocity.dy < 0.0F ? -newSpeed : newSpeed);
+
+      if (transform.y <= SCREEN_TOP_BOUNDARY + 10.0F && velocity.dy < 0.0F)
+        velocity.dy = -velocity.dy;
+      if (transform.y >= SCREEN_BOTTOM_BOUNDARY - 10.0F && velocity.dy > 0.0F)
+        velocity.dy = -velocity.dy;
+      transform.y = std::clamp(transform.y, SCREEN_TOP_BOUNDARY + 1.0F, SCREEN_BOTTOM_BOUNDARY - 1.0F);
+    }
+
+    pattern.amplitude += deltaTime;
+    constexpr float ROBOT_SHOOT_INTERVAL = 2.5F;
+    if (pattern.amplitude >= ROBOT_SHOOT_INTERVAL) {
+      pattern.amplitude = 0.0F;
+      if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+        float bossX = transform.x;
+        float bossY = transform.y;
+        const auto &playerPos = *target;
+        float targetX = playerPos.x;
+        float targetY = playerPos.y;
+
+        float dx = targetX - bossX;
+        float dy = targetY - bossY;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance > 0.0F) {
+          constexpr float ROBOT_PROJECTILE_SPEED = 350.0F;
+          float dirX = (dx / distance) * ROBOT_PROJECTILE_SPEED;
+          float dirY = (dy / distance) * ROBOT_PROJECTILE_SPEED;
+
+          spawnBullet(world, BulletKind::DOBKERATOP, bossX, bossY, dirX, dirY, entity);
         }
+      }
+    }
+  }
 
-        if (isProjectile || isHatchingEgg) {
-          auto &sprite = world.getComponent<ecs::Sprite>(entity);
-          if (isProjectile && !state.isHatching) {
-            if (world.hasComponent<ecs::Health>(entity)) {
-              const auto &hp = world.getComponent<ecs::Health>(entity);
-              if (hp.hp < hp.maxHp) {
-                bool ownerIsParentBoss = false;
-                if (world.hasComponent<ecs::Owner>(entity)) {
-                  const auto &ownerComp = world.getComponent<ecs::Owner>(entity);
-                  if (world.isAlive(ownerComp.ownerId) && world.hasComponent<ecs::Transform>(ownerComp.ownerId) &&
-                      world.hasComponent<ecs::Sprite>(ownerComp.ownerId)) {
-                    const auto &ownerTrans = world.getComponent<ecs::Transform>(ownerComp.ownerId);
-                    const auto &ownerSpr = world.getComponent<ecs::Sprite>(ownerComp.ownerId);
-                    if (ownerSpr.spriteId == ecs::SpriteId::BOSS_BROCOLIS && ownerTrans.scale > 2.0F) {
-                      ownerIsParentBoss = true;
-                    }
-                  }
-                }
-                if (ownerIsParentBoss) {
-                  state.isHatching = true;
-                  sprite.spriteId = ecs::SpriteId::BOSS_BROCOLIS_ECLOSION;
-                  velocity.dx = 0.0F;
-                  velocity.dy = 0.0F;
-                  sprite.animated = true;
-                  sprite.reverseAnimation = true;
-                  sprite.startFrame = 0;
-                  sprite.endFrame = 3;
-                  sprite.currentFrame = 3;
-                  sprite.loop = false;
-                  sprite.frameTime = 0.15F;
-                  state.hatchingTimer = 0.0F;
+  /**
+   * @brief "boss_brocolis_pattern": the Brocolis boss and mini bosses, and their shots that hatch into mini bosses
+   */
+  void updateBrocolis(ecs::World &world, ecs::Entity entity, float deltaTime)
+  {
+    auto &state = stateOf<ecs::BrocolisState>(world, entity);
+    auto &transform = world.getComponent<ecs::Transform>(entity);
+    auto &velocity = world.getComponent<ecs::Velocity>(entity);
+    auto &pattern = world.getComponent<ecs::Pattern>(entity);
+
+    bool isProjectile = false;
+    bool isHatchingEgg = false;
+    if (world.hasComponent<ecs::Sprite>(entity)) {
+      auto &sprite = world.getComponent<ecs::Sprite>(entity);
+      if (sprite.spriteId == ecs::SpriteId::BOSS_BROCOLIS_SHOOT) {
+        isProjectile = true;
+      } else if (sprite.spriteId == ecs::SpriteId::BOSS_BROCOLIS_ECLOSION) {
+        isHatchingEgg = true;
+      }
+    }
+
+    if (isProjectile || isHatchingEgg) {
+      auto &sprite = world.getComponent<ecs::Sprite>(entity);
+      if (isProjectile && !state.isHatching) {
+        if (world.hasComponent<ecs::Health>(entity)) {
+          const auto &hp = world.getComponent<ecs::Health>(entity);
+          if (hp.hp < hp.maxHp) {
+            bool ownerIsParentBoss = false;
+            if (world.hasComponent<ecs::Owner>(entity)) {
+              const auto &ownerComp = world.getComponent<ecs::Owner>(entity);
+              if (world.isAlive(ownerComp.ownerId) && world.hasComponent<ecs::Transform>(ownerComp.ownerId) &&
+                  world.hasComponent<ecs::Sprite>(ownerComp.ownerId)) {
+                const auto &ownerTrans = world.getComponent<ecs::Transform>(ownerComp.ownerId);
+                const auto &ownerSpr = world.getComponent<ecs::Sprite>(ownerComp.ownerId);
+                if (ownerSpr.spriteId == ecs::SpriteId::BOSS_BROCOLIS && ownerTrans.scale > 2.0F) {
+                  ownerIsParentBoss = true;
                 }
               }
             }
-          } else if (state.isHatching || isHatchingEgg) {
-            velocity.dx = 0.0F;
-            velocity.dy = 0.0F;
-            state.hatchingTimer += deltaTime;
-            constexpr float HATCH_DURATION = 0.6F;
-            if (state.hatchingTimer >= HATCH_DURATION) {
-              float spawnX = transform.x;
-              float spawnY = transform.y;
-
-              ecs::Entity newBoss = world.createEntity();
-              ecs::Transform bossTrans;
-              bossTrans.x = spawnX;
-              bossTrans.y = spawnY;
-              bossTrans.scale = 1.5F;
-              world.addComponent(newBoss, bossTrans);
-
-              ecs::Sprite bossSprite;
-              bossSprite.spriteId = ecs::SpriteId::BOSS_BROCOLIS;
-              bossSprite.width = 33;
-              bossSprite.height = 34;
-              bossSprite.animated = true;
-              bossSprite.frameCount = 4;
-              bossSprite.startFrame = 0;
-              bossSprite.endFrame = 3;
-              bossSprite.currentFrame = 0;
-              bossSprite.frameTime = 0.15F;
-              bossSprite.loop = true;
-              world.addComponent(newBoss, bossSprite);
-
-              ecs::Velocity bossVel;
-              bossVel.dx = 0.0F;
-              bossVel.dy = 0.0F;
-              world.addComponent(newBoss, bossVel);
-
-              ecs::Collider bossCol;
-              bossCol.width = 33.0F * 1.5F;
-              bossCol.height = 34.0F * 1.5F;
-              world.addComponent(newBoss, bossCol);
-
-              ecs::Health bossHp;
-              bossHp.maxHp = 1500;
-              bossHp.hp = 1500;
-              world.addComponent(newBoss, bossHp);
-
-              ecs::Pattern bossPat;
-              bossPat.patternType = "boss_brocolis_pattern";
-              bossPat.phase = 0.0F;
-              world.addComponent(newBoss, bossPat);
-
-              ecs::Networked net;
-              net.networkId = newBoss;
-              world.addComponent(newBoss, net);
-
-              world.destroyEntity(entity);
-              s_brocolisStates.erase(entity);
-            }
-          }
-        } else {
-          constexpr float TARGET_ENTER_X = 960.0F;
-          constexpr float TARGET_ENTER_Y = 200.0F;
-          constexpr float ENTER_SPEED = 300.0F;
-          constexpr float ENTER_THRESHOLD = 10.0F;
-
-          if (!state.hasEntered) {
-            float dx = TARGET_ENTER_X - transform.x;
-            float dy = TARGET_ENTER_Y - transform.y;
-            float dist = std::sqrt(dx * dx + dy * dy);
-            if (dist < ENTER_THRESHOLD) {
-              state.hasEntered = true;
+            if (ownerIsParentBoss) {
+              state.isHatching = true;
+              sprite.spriteId = ecs::SpriteId::BOSS_BROCOLIS_ECLOSION;
               velocity.dx = 0.0F;
               velocity.dy = 0.0F;
-              transform.x = TARGET_ENTER_X;
-              transform.y = TARGET_ENTER_Y;
-            } else {
-              velocity.dx = (dx / dist) * ENTER_SPEED;
-              velocity.dy = (dy / dist) * ENTER_SPEED;
+              sprite.animated = true;
+              sprite.reverseAnimation = true;
+              sprite.startFrame = 0;
+              sprite.endFrame = 3;
+              sprite.currentFrame = 3;
+              sprite.loop = false;
+              sprite.frameTime = 0.15F;
+              state.hatchingTimer = 0.0F;
             }
+          }
+        }
+      } else if (state.isHatching || isHatchingEgg) {
+        velocity.dx = 0.0F;
+        velocity.dy = 0.0F;
+        state.hatchingTimer += deltaTime;
+        constexpr float HATCH_DURATION = 0.6F;
+        if (state.hatchingTimer >= HATCH_DURATION) {
+          float spawnX = transform.x;
+          float spawnY = transform.y;
+
+          ecs::Entity newBoss = world.createEntity();
+          ecs::Transform bossTrans;
+          bossTrans.x = spawnX;
+          bossTrans.y = spawnY;
+          bossTrans.scale = 1.5F;
+          world.addComponent(newBoss, bossTrans);
+
+          ecs::Sprite bossSprite;
+          bossSprite.spriteId = ecs::SpriteId::BOSS_BROCOLIS;
+          bossSprite.width = 33;
+          bossSprite.height = 34;
+          bossSprite.animated = true;
+          bossSprite.frameCount = 4;
+          bossSprite.startFrame = 0;
+          bossSprite.endFrame = 3;
+          bossSprite.currentFrame = 0;
+          bossSprite.frameTime = 0.15F;
+          bossSprite.loop = true;
+          world.addComponent(newBoss, bossSprite);
+
+          ecs::Velocity bossVel;
+          bossVel.dx = 0.0F;
+          bossVel.dy = 0.0F;
+          world.addComponent(newBoss, bossVel);
+
+          ecs::Collider bossCol;
+          bossCol.width = 33.0F * 1.5F;
+          bossCol.height = 34.0F * 1.5F;
+          world.addComponent(newBoss, bossCol);
+
+          ecs::Health bossHp;
+          bossHp.maxHp = 1500;
+          bossHp.hp = 1500;
+          world.addComponent(newBoss, bossHp);
+
+          ecs::Pattern bossPat{"boss_brocolis_pattern"};
+          world.addComponent(newBoss, bossPat);
+
+          ecs::Networked net;
+          net.networkId = newBoss;
+          world.addComponent(newBoss, net);
+
+          world.destroyEntity(entity);
+        }
+      }
+    } else {
+      constexpr float TARGET_ENTER_X = 960.0F;
+      constexpr float TARGET_ENTER_Y = 200.0F;
+      constexpr float ENTER_SPEED = 300.0F;
+      constexpr float ENTER_THRESHOLD = 10.0F;
+
+      if (!state.hasEntered) {
+        float dx = TARGET_ENTER_X - transform.x;
+        float dy = TARGET_ENTER_Y - transform.y;
+        float dist = std::sqrt(dx * dx + dy * dy);
+        if (dist < ENTER_THRESHOLD) {
+          state.hasEntered = true;
+          velocity.dx = 0.0F;
+          velocity.dy = 0.0F;
+          transform.x = TARGET_ENTER_X;
+          transform.y = TARGET_ENTER_Y;
+        } else {
+          velocity.dx = (dx / dist) * ENTER_SPEED;
+          velocity.dy = (dy / dist) * ENTER_SPEED;
+        }
+      } else {
+        constexpr float PREFERRED_DISTANCE = 600.0F;
+        constexpr float MOVE_SPEED = 200.0F;
+        constexpr float SHOOT_INTERVAL = 5.0F;
+        constexpr float SCREEN_MARGIN = 50.0F;
+
+        float targetDx = 0.0F;
+        float targetDy = 0.0F;
+
+        if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+          const auto &playerPos = *target;
+          float dx = transform.x - playerPos.x;
+          float dy = transform.y - playerPos.y;
+          float dist = std::sqrt(dx * dx + dy * dy);
+          if (dist > 0.0F) {
+            dx /= dist;
+            dy /= dist;
+          }
+          if (dist < PREFERRED_DISTANCE) {
+            targetDx = dx * MOVE_SPEED;
+            targetDy = dy * MOVE_SPEED;
           } else {
-            constexpr float PREFERRED_DISTANCE = 600.0F;
-            constexpr float MOVE_SPEED = 200.0F;
-            constexpr float SHOOT_INTERVAL = 5.0F;
-            constexpr float SCREEN_MARGIN = 50.0F;
-
-            std::vector<ecs::Entity> players;
-            ecs::ComponentSignature playerSig;
-            playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-            world.getEntitiesWithSignature(playerSig, players);
-
-            float targetDx = 0.0F;
-            float targetDy = 0.0F;
-
-            if (!players.empty()) {
-              auto &playerPos = world.getComponent<ecs::Transform>(players[0]);
-              float dx = transform.x - playerPos.x;
-              float dy = transform.y - playerPos.y;
-              float dist = std::sqrt(dx * dx + dy * dy);
-              if (dist > 0.0F) {
-                dx /= dist;
-                dy /= dist;
-              }
-              if (dist < PREFERRED_DISTANCE) {
-                targetDx = dx * MOVE_SPEED;
-                targetDy = dy * MOVE_SPEED;
-              } else {
-                float driftX = std::cos(pattern.phase * 0.5F);
-                float driftY = std::sin(pattern.phase * 0.8F);
-                targetDx = driftX * (MOVE_SPEED * 0.5F);
-                targetDy = driftY * (MOVE_SPEED * 0.5F);
-              }
-            }
+            float driftX = std::cos(pattern.phase * 0.5F);
+            float driftY = std::sin(pattern.phase * 0.8F);
+            targetDx = driftX * (MOVE_SPEED * 0.5F);
+            targetDy = driftY * (MOVE_SPEED * 0.5F);
+          }
+        }
 
-            velocity.dx += (targetDx - velocity.dx) * 2.0F * deltaTime;
-            velocity.dy += (targetDy - velocity.dy) * 2.0F * deltaTime;
-
-            if (transform.x < SCREEN_MARGIN && velocity.dx < 0)
-              velocity.dx = -velocity.dx;
-            if (transform.x > 1920.0F - SCREEN_MARGIN && velocity.dx > 0)
-              velocity.dx = -velocity.dx;
-            if (transform.y < SCREEN_MARGIN && velocity.dy < 0)
-              velocity.dy = -velocity.dy;
-            if (transform.y > 1080.0F - SCREEN_MARGIN && velocity.dy > 0)
-              velocity.dy = -velocity.dy;
-
-            if (transform.scale > 2.0F) {
-              pattern.phase += deltaTime;
-              if (pattern.phase >= SHOOT_INTERVAL) {
-                pattern.phase = 0.0F;
-                float shootDirX = 0.0F;
-                float shootDirY = 1.0F;
-                if (!players.empty()) {
-                  auto &pPos = world.getComponent<ecs::Transform>(players[0]);
-                  float pdx = pPos.x - transform.x;
-                  float pdy = pPos.y - transform.y;
-                  float pdist = std::sqrt(pdx * pdx + pdy * pdy);
-                  if (pdist > 0) {
-                    shootDirX = pdx / pdist;
-                    shootDirY = pdy / pdist;
-                  }
-                }
+        velocity.dx += (targetDx - velocity.dx) * 2.0F * deltaTime;
+        velocity.dy += (targetDy - velocity.dy) * 2.0F * deltaTime;
 
-                // Copy values
-                float bossX = transform.x;
-                float bossY = transform.y;
-
-                ecs::Entity proj = world.createEntity();
-                ecs::Transform projTrans;
-                projTrans.x = bossX;
-                projTrans.y = bossY + 40.0F;
-                projTrans.scale = 0.75F;
-                world.addComponent(proj, projTrans);
-
-                ecs::Sprite projSprite;
-                projSprite.spriteId = ecs::SpriteId::BOSS_BROCOLIS_SHOOT;
-                projSprite.width = 33;
-                projSprite.height = 31;
-                projSprite.animated = true;
-                projSprite.frameCount = 4;
-                projSprite.currentFrame = 0;
-                projSprite.startFrame = 0;
-                projSprite.endFrame = 3;
-                projSprite.frameTime = 0.08F;
-                projSprite.animationTimer = 0.0F;
-                projSprite.reverseAnimation = false;
-                projSprite.loop = true;
-                world.addComponent(proj, projSprite);
-
-                constexpr float PROJ_SPEED = 300.0F;
-                ecs::Velocity projVel;
-                projVel.dx = shootDirX * PROJ_SPEED;
-                projVel.dy = shootDirY * PROJ_SPEED;
-                world.addComponent(proj, projVel);
-
-                ecs::Pattern projPat;
-                projPat.patternType = "boss_brocolis_pattern";
-                world.addComponent(proj, projPat);
-
-                ecs::Health projHp;
-                projHp.maxHp = 10;
-                projHp.hp = 10;
-                world.addComponent(proj, projHp);
-
-                ecs::Collider projCol;
-                projCol.width = 33.0F * 0.75F;
-                projCol.height = 31.0F * 0.75F;
-                projCol.shape = ecs::Collider::Shape::CIRCLE;
-                world.addComponent(proj, projCol);
-
-                ecs::Owner owner;
-                owner.ownerId = entity;
-                world.addComponent(proj, owner);
-
-                ecs::Networked net;
-                net.networkId = proj;
-                world.addComponent(proj, net);
-              }
-            } else if (transform.scale > 1.0F) {
-              constexpr float MINI_SHOOT_INTERVAL = 3.0F;
-              pattern.phase += deltaTime;
-              if (pattern.phase >= MINI_SHOOT_INTERVAL) {
-                pattern.phase = 0.0F;
-                float shootDirX = 0.0F;
-                float shootDirY = 1.0F;
-                if (!players.empty()) {
-                  auto &pPos = world.getComponent<ecs::Transform>(players[0]);
-                  float pdx = pPos.x - transform.x;
-                  float pdy = pPos.y - transform.y;
-                  float pdist = std::sqrt(pdx * pdx + pdy * pdy);
-                  if (pdist > 0) {
-                    shootDirX = pdx / pdist;
-                    shootDirY = pdy / pdist;
-                  }
-                }
+        if (transform.x < SCREEN_MARGIN && velocity.dx < 0)
+          velocity.dx = -velocity.dx;
+        if (transform.x > 1920.0F - SCREEN_MARGIN && velocity.dx > 0)
+          velocity.dx = -velocity.dx;
+        if (transform.y < SCREEN_MARGIN && velocity.dy < 0)
+          velocity.dy = -velocity.dy;
+        if (transform.y > 1080.0F - SCREEN_MARGIN && velocity.dy > 0)
+          velocity.dy = -velocity.dy;
 
-                // Copy values
-                float bossX = transform.x;
-                float bossY = transform.y;
-
-                ecs::Entity proj = world.createEntity();
-                ecs::Transform projTrans;
-                projTrans.x = bossX;
-                projTrans.y = bossY + 28.0F;
-                projTrans.scale = 0.65F;
-                world.addComponent(proj, projTrans);
-
-                ecs::Sprite projSprite;
-                projSprite.spriteId = ecs::SpriteId::BOSS_BROCOLIS_SHOOT;
-                projSprite.width = 33;
-                projSprite.height = 31;
-                projSprite.animated = true;
-                projSprite.frameCount = 4;
-                projSprite.currentFrame = 0;
-                projSprite.startFrame = 0;
-                projSprite.endFrame = 3;
-                projSprite.frameTime = 0.08F;
-                projSprite.loop = true;
-                world.addComponent(proj, projSprite);
-
-                constexpr float PROJ_SPEED_CHILD = 240.0F;
-                ecs::Velocity projVel;
-                projVel.dx = shootDirX * PROJ_SPEED_CHILD;
-                projVel.dy = shootDirY * PROJ_SPEED_CHILD;
-                world.addComponent(proj, projVel);
-
-                ecs::Pattern projPat;
-                projPat.patternType = "boss_brocolis_pattern";
-                world.addComponent(proj, projPat);
-
-                ecs::Health projHp;
-                projHp.maxHp = 6;
-                projHp.hp = 6;
-                world.addComponent(proj, projHp);
-
-                ecs::Collider projCol;
-                projCol.width = 28.0F * 0.65F;
-                projCol.height = 28.0F * 0.65F;
-                projCol.shape = ecs::Collider::Shape::CIRCLE;
-                world.addComponent(proj, projCol);
-
-                ecs::Owner owner;
-                owner.ownerId = entity;
-                world.addComponent(proj, owner);
-
-                ecs::Networked net;
-                net.networkId = proj;
-                world.addComponent(proj, net);
+        if (transform.scale > 2.0F) {
+          pattern.phase += deltaTime;
+          if (pattern.phase >= SHOOT_INTERVAL) {
+            pattern.phase = 0.0F;
+            float shootDirX = 0.0F;
+            float shootDirY = 1.0F;
+            if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+              const auto &pPos = *target;
+              float pdx = pPos.x - transform.x;
+              float pdy = pPos.y - transform.y;
+              float pdist = std::sqrt(pdx * pdx + pdy * pdy);
+              if (pdist > 0) {
+                shootDirX = pdx / pdist;
+                shootDirY = pdy / pdist;
               }
             }
-          }
-        }
 
-      } else if (pattern.patternType == "boss_evangelic_pattern") {
-        bool isProjectile = world.hasComponent<ecs::Owner>(entity);
-
-        std::vector<ecs::Entity> players;
-        ecs::ComponentSignature playerSig;
-        playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-        world.getEntitiesWithSignature(playerSig, players);
-
-        if (isProjectile) {
-          struct BoomerangState {
-            float spawnX = 0.0F;
-            float spawnY = 0.0F;
-            float timer = 0.0F;
-            bool returning = false;
-            bool hasReachedSpawn = false;
-          };
-          static std::unordered_map<ecs::Entity, BoomerangState> s_boomerangStates;
-          auto &bState = s_boomerangStates[entity];
-
-          constexpr float PROJ_SPEED = 250.0F;
-          constexpr float BOOMERANG_TIMER = 7.0F;
-
-          if (bState.timer == 0.0F && bState.spawnX == 0.0F && bState.spawnY == 0.0F) {
-            bState.spawnX = transform.x;
-            bState.spawnY = transform.y;
-          }
+            // Copy values
+            float bossX = transform.x;
+            float bossY = transform.y;
 
-          bState.timer += deltaTime;
-
-          if (!bState.returning && bState.timer < BOOMERANG_TIMER) {
-            if (!players.empty()) {
-              auto &playerPos = world.getComponent<ecs::Transform>(players[0]);
-              float dx = playerPos.x - transform.x;
-              float dy = playerPos.y - transform.y;
-              float dist = std::sqrt(dx * dx + dy * dy);
-              if (dist > 0.0F) {
-                velocity.dx = (dx / dist) * PROJ_SPEED;
-                velocity.dy = (dy / dist) * PROJ_SPEED;
-                float angleRad = std::atan2(velocity.dy, velocity.dx);
-                transform.rotation = angleRad * (180.0F / 3.14159F);
-              }
-            } else {
-              if (velocity.dx == 0 && velocity.dy == 0)
-                velocity.dx = -PROJ_SPEED;
-            }
-          } else if (bState.timer >= BOOMERANG_TIMER && !bState.hasReachedSpawn) {
-            bState.returning = true;
-            float dx = bState.spawnX - transform.x;
-            float dy = bState.spawnY - transform.y;
-            float dist = std::sqrt(dx * dx + dy * dy);
-            if (dist < 20.0F) {
-              bState.hasReachedSpawn = true;
-              bState.timer = 0.0F;
-            } else if (dist > 0.0F) {
-              velocity.dx = (dx / dist) * PROJ_SPEED;
-              velocity.dy = (dy / dist) * PROJ_SPEED;
-              float angleRad = std::atan2(velocity.dy, velocity.dx);
-              transform.rotation = angleRad * (180.0F / 3.14159F);
-            }
-          } else if (bState.hasReachedSpawn) {
-            if (!players.empty()) {
-              auto &playerPos = world.getComponent<ecs::Transform>(players[0]);
-              float dx = playerPos.x - transform.x;
-              float dy = playerPos.y - transform.y;
-              float dist = std::sqrt(dx * dx + dy * dy);
-              if (dist > 0.0F) {
-                velocity.dx = (dx / dist) * PROJ_SPEED;
-                velocity.dy = (dy / dist) * PROJ_SPEED;
-                float angleRad = std::atan2(velocity.dy, velocity.dx);
-                transform.rotation = angleRad * (180.0F / 3.14159F);
+            constexpr float PROJ_SPEED = 300.0F;
+            spawnBullet(world, BulletKind::BROCOLIS, bossX, bossY + 40.0F, shootDirX * PROJ_SPEED,
+                        shootDirY * PROJ_SPEED, entity);
+          }
+        } else if (transform.scale > 1.0F) {
+          constexpr float MINI_SHOOT_INTERVAL = 3.0F;
+          pattern.phase += deltaTime;
+          if (pattern.phase >= MINI_SHOOT_INTERVAL) {
+            pattern.phase = 0.0F;
+            float shootDirX = 0.0F;
+            float shootDirY = 1.0F;
+            if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+              const auto &pPos = *target;
+              float pdx = pPos.x - transform.x;
+              float pdy = pPos.y - transform.y;
+              float pdist = std::sqrt(pdx * pdx + pdy * pdy);
+              if (pdist > 0) {
+                shootDirX = pdx / pdist;
+                shootDirY = pdy / pdist;
               }
             }
-          }
 
-          if (transform.x < -400.0F || transform.x > 2320.0F || transform.y < -400.0F || transform.y > 1480.0F) {
-            world.destroyEntity(entity);
-            s_boomerangStates.erase(entity);
+            // Copy values
+            float bossX = transform.x;
+            float bossY = transform.y;
+
+            constexpr float PROJ_SPEED_CHILD = 240.0F;
+            spawnBullet(world, BulletKind::BROCOLIS_CHILD, bossX, bossY + 28.0F, shootDirX * PROJ_SPEED_CHILD,
+                        shootDirY * PROJ_SPEED_CHILD, entity);
           }
+        }
+      }
+    }
+  }
 
-        } else {
-          // BOSS EVANGELIC LOGIC
-          constexpr float PREFERRED_X = 1400.0F;
-          constexpr float PREFERRED_Y = 540.0F;
-          constexpr float X_SMOOTH = 3.0F;
-          constexpr float HOVER_AMPL = 120.0F;
-          constexpr float HOVER_FREQ = 1.2F;
-          constexpr float EDGE_SPAWN_INTERVAL = 2.0F;
-          constexpr float EDGE_MARGIN = 24.0F;
-          constexpr int MAX_PROJECTILES = 5;
-
-          float targetDx = (PREFERRED_X - transform.x) * X_SMOOTH;
-          velocity.dx += (targetDx - velocity.dx) * std::min(1.0F, deltaTime * 4.0F);
-
-          pattern.phase += deltaTime * HOVER_FREQ;
-          float hoverTargetY = PREFERRED_Y + std::sin(pattern.phase) * HOVER_AMPL;
-          float desiredDy = (hoverTargetY - transform.y) * 2.0F;
-          velocity.dy += (desiredDy - velocity.dy) * (0.5F * deltaTime);
-
-          pattern.amplitude += deltaTime;
-
-          if (pattern.amplitude >= EDGE_SPAWN_INTERVAL) {
-            pattern.amplitude = 0.0F;
-
-            std::vector<ecs::Entity> allEntities;
-            ecs::ComponentSignature projSig;
-            projSig.set(ecs::getComponentId<ecs::Owner>());
-            projSig.set(ecs::getComponentId<ecs::Pattern>());
-            world.getEntitiesWithSignature(projSig, allEntities);
-
-            int currentProjectiles = 0;
-            for (auto e : allEntities) {
-              if (world.hasComponent<ecs::Owner>(e)) {
-                auto &owner = world.getComponent<ecs::Owner>(e);
-                if (owner.ownerId == entity) {
-                  currentProjectiles++;
-                }
-              }
-            }
+  /**
+   * @brief "boss_evangelic_pattern": the Evangelic boss hovers and throws boomerang shots from the screen edges
+   */
+  void updateEvangelic(ecs::World &world, ecs::Entity entity, float deltaTime)
+  {
+    auto &transform = world.getComponent<ecs::Transform>(entity);
+    auto &velocity = world.getComponent<ecs::Velocity>(entity);
+    auto &pattern = world.getComponent<ecs::Pattern>(entity);
 
-            if (!players.empty() && currentProjectiles < MAX_PROJECTILES) {
-              // SAFE COPY: Capture player position values before any addComponent call
-              auto &playerTrans = world.getComponent<ecs::Transform>(players[0]);
-              float targetX = playerTrans.x;
-              float targetY = playerTrans.y;
-
-              // SAFE COPY: Capture boss position
-              float bossX = transform.x;
-
-              int toSpawn = std::min(2, MAX_PROJECTILES - currentProjectiles);
-
-              for (int side = 0; side < toSpawn; ++side) {
-                ecs::Entity proj = world.createEntity();
-
-                ecs::Transform projTrans;
-                projTrans.x = bossX; // Use copy
-                projTrans.y = (side == 0) ? EDGE_MARGIN : (1080.0F - EDGE_MARGIN);
-                projTrans.rotation = 0.0F;
-                projTrans.scale = 3.0F;
-                world.addComponent(proj, projTrans);
-
-                // Use copies for calculation
-                float dx = targetX - projTrans.x;
-                float dy = targetY - projTrans.y;
-                float dist = std::sqrt(dx * dx + dy * dy);
-                float dirX = -1.0F;
-                float dirY = 0.0F;
-
-                if (dist > 0.0F) {
-                  dirX = dx / dist;
-                  dirY = dy / dist;
-                }
+    bool isProjectile = world.hasComponent<ecs::Owner>(entity);
 
-                constexpr float INITIAL_SPEED = 250.0F;
-                ecs::Velocity projVel;
-                projVel.dx = dirX * INITIAL_SPEED;
-                projVel.dy = dirY * INITIAL_SPEED;
-                world.addComponent(proj, projVel);
-
-                ecs::Pattern projPattern;
-                projPattern.patternType = "boss_evangelic_pattern";
-                world.addComponent(proj, projPattern);
-
-                ecs::Sprite projSprite;
-                projSprite.spriteId = ecs::SpriteId::BOSS_EVANGELIC_SHOOT;
-                projSprite.width = 32;
-                projSprite.height = 30;
-                projSprite.animated = true;
-                projSprite.frameCount = 6;
-                projSprite.currentFrame = 0;
-                projSprite.startFrame = 0;
-                projSprite.endFrame = 5;
-                projSprite.frameTime = 0.08F;
-                projSprite.loop = true;
-                world.addComponent(proj, projSprite);
-
-                ecs::Collider projCol;
-                projCol.width = 32.0F * 3.0F;
-                projCol.height = 30.0F * 3.0F;
-                projCol.shape = ecs::Collider::Shape::CIRCLE;
-                world.addComponent(proj, projCol);
-
-                ecs::Health projHp;
-                projHp.maxHp = 12;
-                projHp.hp = 12;
-                world.addComponent(proj, projHp);
-
-                ecs::Owner owner;
-                owner.ownerId = entity;
-                world.addComponent(proj, owner);
-
-                ecs::Networked net;
-                net.networkId = proj;
-                world.addComponent(proj, net);
-              }
-            }
+    if (isProjectile) {
+      auto &bState = stateOf<ecs::BoomerangState>(world, entity);
+
+      constexpr float PROJ_SPEED = 250.0F;
+      constexpr float BOOMERANG_TIMER = 7.0F;
+
+      if (bState.timer == 0.0F && bState.spawnX == 0.0F && bState.spawnY == 0.0F) {
+        bState.spawnX = transform.x;
+        bState.spawnY = transform.y;
+      }
+
+      bState.timer += deltaTime;
+
+      if (!bState.returning && bState.timer < BOOMERANG_TIMER) {
+        if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+          const auto &playerPos = *target;
+          float dx = playerPos.x - transform.x;
+          float dy = playerPos.y - transform.y;
+          float dist = std::sqrt(dx * dx + dy * dy);
+          if (dist > 0.0F) {
+            velocity.dx = (dx / dist) * PROJ_SPEED;
+            velocity.dy = (dy / dist) * PROJ_SPEED;
+            float angleRad = std::atan2(velocity.dy, velocity.dx);
+            transform.rotation = angleRad * (180.0F / 3.14159F);
+          }
+        } else {
+          if (velocity.dx == 0 && velocity.dy == 0)
+            velocity.dx = -PROJ_SPEED;
+        }
+      } else if (bState.timer >= BOOMERANG_TIMER && !bState.hasReachedSpawn) {
+        bState.returning = true;
+        float dx = bState.spawnX - transform.x;
+        float dy = bState.spawnY - transform.y;
+        float dist = std::sqrt(dx * dx + dy * dy);
+        if (dist < 20.0F) {
+          bState.hasReachedSpawn = true;
+          bState.timer = 0.0F;
+        } else if (dist > 0.0F) {
+          velocity.dx = (dx / dist) * PROJ_SPEED;
+          velocity.dy = (dy / dist) * PROJ_SPEED;
+          float angleRad = std::atan2(velocity.dy, velocity.dx);
+          transform.rotation = angleRad * (180.0F / 3.14159F);
+        }
+      } else if (bState.hasReachedSpawn) {
+        if (const auto *target = targetPlayer(world, transform.x, transform.y); target != nullptr) {
+          const auto &playerPos = *target;
+          float dx = playerPos.x - transform.x;
+          float dy = playerPos.y - transform.y;
+          float dist = std::sqrt(dx * dx + dy * dy);
+          if (dist > 0.0F) {
+            velocity.dx = (dx / dist) * PROJ_SPEED;
+            velocity.dy = (dy / dist) * PROJ_SPEED;
+            float angleRad = std::atan2(velocity.dy, velocity.dx);
+            transform.rotation = angleRad * (180.0F / 3.14159F);
           }
         }
       }
 
-      // Update rotation for yellow bee based on velocity direction
-      if (world.hasComponent<ecs::Sprite>(entity)) {
-        auto &sprite = world.getComponent<ecs::Sprite>(entity);
-        if (sprite.spriteId == ecs::SpriteId::ENEMY_YELLOW) {
-          // Re-fetch velocity/transform just in case, though ENEMY_YELLOW doesn't trigger spawns
-          if (world.hasComponent<ecs::Velocity>(entity) && world.hasComponent<ecs::Transform>(entity)) {
-            auto &currVel = world.getComponent<ecs::Velocity>(entity);
-            auto &currTrans = world.getComponent<ecs::Transform>(entity);
+      if (transform.x < -400.0F || transform.x > 2320.0F || transform.y < -400.0F || transform.y > 1480.0F) {
+        world.destroyEntity(entity);
+      }
 
-            float targetAngle = std::atan2(currVel.dy, currVel.dx) * (180.0F / 3.14159265F) + 180.0F;
-            float currentAngle = currTrans.rotation;
-            float angleDiff = targetAngle - currentAngle;
-            while (angleDiff > 180.0F)
-              angleDiff -= 360.0F;
-            while (angleDiff < -180.0F)
-              angleDiff += 360.0F;
-            constexpr float ROTATION_SPEED = 180.0F;
-            float maxRotation = ROTATION_SPEED * deltaTime;
-            if (std::abs(angleDiff) < maxRotation) {
-              currTrans.rotation = targetAngle;
-            } else {
-              currTrans.rotation += (angleDiff > 0 ? maxRotation : -maxRotation);
+    } else {
+      // BOSS EVANGELIC LOGIC
+      constexpr float PREFERRED_X = 1400.0F;
+      constexpr float PREFERRED_Y = 540.0F;
+      constexpr float X_SMOOTH = 3.0F;
+      constexpr float HOVER_AMPL = 120.0F;
+      constexpr float HOVER_FREQ = 1.2F;
+      constexpr float EDGE_SPAWN_INTERVAL = 2.0F;
+      constexpr float EDGE_MARGIN = 24.0F;
+      constexpr int MAX_PROJECTILES = 5;
+
+      float targetDx = (PREFERRED_X - transform.x) * X_SMOOTH;
+      velocity.dx += (targetDx - velocity.dx) * std::min(1.0F, deltaTime * 4.0F);
+
+      pattern.phase += deltaTime * HOVER_FREQ;
+      float hoverTargetY = PREFERRED_Y + std::sin(pattern.phase) * HOVER_AMPL;
+      float desiredDy = (hoverTargetY - transform.y) * 2.0F;
+      velocity.dy += (desiredDy - velocity.dy) * (0.5F * deltaTime);
+
+      pattern.amplitude += deltaTime;
+
+      if (pattern.amplitude >= EDGE_SPAWN_INTERVAL) {
+        pattern.amplitude = 0.0F;
+
+        // The boss's projectiles run the same pattern, so they are in its group: no scan of the world
+        int currentProjectiles = 0;
+        for (auto e : group(ecs::PatternKind::BOSS_EVANGELIC)) {
+          if (world.isAlive(e) && world.hasComponent<ecs::Owner>(e)) {
+            auto &owner = world.getComponent<ecs::Owner>(e);
+            if (owner.ownerId == entity) {
+              currentProjectiles++;
             }
-            while (currTrans.rotation >= 360.0F)
-              currTrans.rotation -= 360.0F;
-            while (currTrans.rotation < 0.0F)
-              currTrans.rotation += 360.0F;
           }
         }
-      }
 
-      // Safe destruction check at end of loop
-      // Refetch components because previous references (transform, pattern) may be invalid due to vector reallocation
-      if (world.isAlive(entity) && world.hasComponent<ecs::Transform>(entity) &&
-          world.hasComponent<ecs::Pattern>(entity)) {
-        const auto &currTrans = world.getComponent<ecs::Transform>(entity);
-        const auto &currPattern = world.getComponent<ecs::Pattern>(entity);
+        const auto *target = targetPlayer(world, transform.x, transform.y);
+        if (target != nullptr && currentProjectiles < MAX_PROJECTILES) {
+          // SAFE COPY: Capture player position values before any addComponent call
+          const auto &playerTrans = *target;
+          float targetX = playerTrans.x;
+          float targetY = playerTrans.y;
 
-        if (currPattern.patternType != "ground_walk" && currTrans.x < OFFSCREEN_DESTROY_X) {
-          world.destroyEntity(entity);
+          // SAFE COPY: Capture boss position
+          float bossX = transform.x;
+
+          int toSpawn = std::min(2, MAX_PROJECTILES - currentProjectiles);
+
+          for (int side = 0; side < toSpawn; ++side) {
+            // Use copies for calculation
+            const float projX = bossX;
+            const float projY = (side == 0) ? EDGE_MARGIN : (1080.0F - EDGE_MARGIN);
+            float dx = targetX - projX;
+            float dy = targetY - projY;
+            float dist = std::sqrt(dx * dx + dy * dy);
+            float dirX = -1.0F;
+            float dirY = 0.0F;
+
+            if (dist > 0.0F) {
+              dirX = dx / dist;
+              dirY = dy / dist;
+            }
+
+            constexpr float INITIAL_SPEED = 250.0F;
+            spawnBullet(world, BulletKind::EVANGELIC, projX, projY, dirX * INITIAL_SPEED, dirY * INITIAL_SPEED,
+                        entity);
+          }
         }
       }
     }
   }
 
-  [[nodiscard]] ecs::ComponentSignature getSignature() const override
+  // Enemy bullets with a fixed look, pooled: compiled once per process into prefabs
+  enum class BulletKind : std::uint8_t { ROBOT, WALKER, DOBKERATOP, BROCOLIS, BROCOLIS_CHILD, EVANGELIC, COUNT };
+
+  static const ecs::Prefab &bulletPrefab(BulletKind kind)
   {
-    ecs::ComponentSignature sig;
-    sig.set(ecs::getComponentId<ecs::Pattern>());
-    sig.set(ecs::getComponentId<ecs::Velocity>());
-    sig.set(ecs::getComponentId<ecs::Transform>());
-    return sig;
+    static const std::array<ecs::Prefab, static_cast<std::size_t>(BulletKind::COUNT)> prefabs = buildBulletPrefabs();
+    return prefabs[static_cast<std::size_t>(kind)];
   }
 
-private:
-  ecs::EventListenerHandle m_damageHandle;
-  static constexpr float ENEMY_MOVE_SPEED = -384.0F;
-  static constexpr float OFFSCREEN_DESTROY_X = -100.0F;
+  static void spawnBullet(ecs::World &world, BulletKind kind, float posX, float posY, float dx, float dy,
+                          ecs::Entity owner)
+  {
+    const ecs::Prefab &prefab = bulletPrefab(kind);
+    ecs::Transform projTransform = *prefab.get<ecs::Transform>();
+    projTransform.x = posX;
+    projTransform.y = posY;
+    ecs::Entity projectile = world.acquire(prefab, projTransform);
+
+    auto &projVelocity = world.getComponent<ecs::Velocity>(projectile);
+    projVelocity.dx = dx;
+    projVelocity.dy = dy;
+    world.getComponent<ecs::Owner>(projectile).ownerId = owner;
+  }
+
+  static ecs::Sprite makeBulletSprite(std::uint32_t spriteId, std::uint32_t width, std::uint32_t height,
+                                      std::uint32_t frameCount, float frameTime, bool loop)
+  {
+    ecs::Sprite projSprite;
+    projSprite.spriteId = spriteId;
+    projSprite.width = width;
+    projSprite.height = height;
+    projSprite.animated = frameCount > 1;
+    projSprite.frameCount = frameCount;
+    projSprite.currentFrame = 0;
+    projSprite.startFrame = 0;
+    projSprite.endFrame = frameCount - 1;
+    projSprite.frameTime = frameTime;
+    projSprite.animationTimer = 0.0F;
+    projSprite.reverseAnimation = false;
+    projSprite.loop = loop;
+    return projSprite;
+  }
+
+  /**
+   * @brief Bullet prefab: Transform (scale only), Velocity set per shot, Sprite, Collider, Owner and Networked
+   */
+  static ecs::Prefab makeBulletPrefab(float scale, float rotation, const ecs::Sprite &sprite, float colliderWidth,
+                                      float colliderHeight, ecs::Collider::Shape shape)
+  {
+    ecs::Transform projTransform;
+    projTransform.rotation = rotation;
+    projTransform.scale = scale;
+
+    ecs::Collider projCollider;
+    projCollider.width = colliderWidth;
+    projCollider.height = colliderHeight;
+    projCollider.shape = shape;
+
+    ecs::Prefab prefab;
+    prefab.set(projTransform)
+      .set(ecs::Velocity{})
+      .set(sprite)
+      .set(projCollider)
+      .set(ecs::Owner{})
+      .set(ecs::Networked{}, [](ecs::Networked &net, ecs::Entity entity) { net.networkId = entity; });
+    return prefab;
+  }
+
+  static ecs::Health makeBulletHealth(int hp)
+  {
+    ecs::Health projHp;
+    projHp.maxHp = hp;
+    projHp.hp = hp;
+    return projHp;
+  }
+
+  static std::array<ecs::Prefab, static_cast<std::size_t>(BulletKind::COUNT)> buildBulletPrefabs()
+  {
+    using Shape = ecs::Collider::Shape;
+    std::array<ecs::Prefab, static_cast<std::size_t>(BulletKind::COUNT)> prefabs;
+    auto at = [&prefabs](BulletKind kind) -> ecs::Prefab & { return prefabs[static_cast<std::size_t>(kind)]; };
+
+    at(BulletKind::ROBOT) =
+      makeBulletPrefab(0.4F, 0.0F, makeBulletSprite(ecs::SpriteId::ROBOT_PROJECTILE, 101, 114, 1, 0.0F, false),
+                       101.0F * 0.4F, 114.0F * 0.4F, Shape::BOX);
+    at(BulletKind::WALKER) =
+      makeBulletPrefab(0.5F, 0.0F, makeBulletSprite(ecs::SpriteId::WALKER_PROJECTILE, 78, 72, 4, 0.08F, false),
+                       78.0F * 0.5F, 72.0F * 0.5F, Shape::BOX);
+
+    // Dobkeratops shots pull the players in
+    ecs::Attraction projAttraction;
+    projAttraction.force = 500.0F;
+    projAttraction.radius = 300.0F;
+    at(BulletKind::DOBKERATOP) =
+      makeBulletPrefab(3.0F, 1.0F, makeBulletSprite(ecs::SpriteId::BOSS_DOBKERATOP_SHOOT, 34, 34, 3, 0.08F, true),
+                       34.0F, 34.0F, Shape::CIRCLE);
+    at(BulletKind::DOBKERATOP).set(projAttraction);
+
+    // Brocolis and Evangelic shots are shootable and steered by their own pattern
+    at(BulletKind::BROCOLIS) =
+      makeBulletPrefab(0.75F, 0.0F, makeBulletSprite(ecs::SpriteId::BOSS_BROCOLIS_SHOOT, 33, 31, 4, 0.08F, true),
+                       33.0F * 0.75F, 31.0F * 0.75F, Shape::CIRCLE);
+    at(BulletKind::BROCOLIS).set(ecs::Pattern{"boss_brocolis_pattern"}).set(makeBulletHealth(10));
+    at(BulletKind::BROCOLIS_CHILD) =
+      makeBulletPrefab(0.65F, 0.0F, makeBulletSprite(ecs::SpriteId::BOSS_BROCOLIS_SHOOT, 33, 31, 4, 0.08F, true),
+                       28.0F * 0.65F, 28.0F * 0.65F, Shape::CIRCLE);
+    at(BulletKind::BROCOLIS_CHILD).set(ecs::Pattern{"boss_brocolis_pattern"}).set(makeBulletHealth(6));
+    at(BulletKind::EVANGELIC) =
+      makeBulletPrefab(3.0F, 0.0F, makeBulletSprite(ecs::SpriteId::BOSS_EVANGELIC_SHOOT, 32, 30, 6, 0.08F, true),
+                       32.0F * 3.0F, 30.0F * 3.0F, Shape::CIRCLE);
+    at(BulletKind::EVANGELIC).set(ecs::Pattern{"boss_evangelic_pattern"}).set(makeBulletHealth(12));
+    return prefabs;
+  }
 };
 
 } // namespace server
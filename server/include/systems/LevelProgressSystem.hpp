@@ -15,8 +15,8 @@
 #include "../../../engineCore/include/ecs/components/PlayerId.hpp"
 #include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/components/Velocity.hpp"
+#include "../../../engineCore/include/utils/Log.hpp"
 #include "ecs/ComponentSignature.hpp"
-#include <iostream>
 #include <vector>
 
 namespace server
@@ -59,13 +59,9 @@ public:
       auto &progress = world.getComponent<ecs::LevelProgress>(player);
       progress.distanceTraveled += distanceThisFrame;
 
-      // Log every 500 units for visibility
-      static float lastLoggedDistance = 0;
-      if (progress.distanceTraveled - lastLoggedDistance >= 500) {
-        std::cout << "[LevelProgress] Distance traveled: " << progress.distanceTraveled
-                  << " px (scroll speed: " << SCROLL_SPEED << " px/s)" << std::endl;
-        lastLoggedDistance = progress.distanceTraveled;
-      }
+      RTYPE_LOG_EVERY(::logging::Level::DEBUG, 5.0,
+                      "[LevelProgress] Distance traveled: " << progress.distanceTraveled
+                                                            << " px (scroll speed: " << SCROLL_SPEED << " px/s)");
     }
   }
 
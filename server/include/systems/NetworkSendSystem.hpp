@@ -7,13 +7,26 @@
 #define NETWORKSENDSYSTEM_HPP_
 #include "../../engineCore/include/ecs/ISystem.hpp"
 #include "../../network/include/INetworkManager.hpp"
+#include "config/ServerConfig.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 class LobbyManager;
 
+namespace ecs
+{
+class BulletPool;
+} // namespace ecs
+
+namespace server
+{
+class ServerMetrics;
+} // namespace server
+
 /**
  * @class NetworkSendSystem
  * @brief Server system that broadcasts world state to clients.
@@ -36,21 +49,153 @@ public:
    */
   void setLobbyManager(LobbyManager *lobbyManager);
 
+  /**
+   * @brief Set the snapshot budget and priority tuning
+   * @param config Replication configuration
+   */
+  void setReplicationConfig(const server::ReplicationConfig &config);
+
+  /**
+   * @brief Count every snapshot sent into the metrics (optional)
+   * @param metrics Server metrics, or nullptr
+   */
+  void setMetrics(server::ServerMetrics *metrics);
+
+  /**
+   * @brief Budget and starvation metrics of the last send tick (all clients)
+   */
+  struct ReplicationStats {
+    std::size_t bytesSent = 0; ///< Entity, volley and hit payload bytes written
+    std::size_t entitiesSent = 0; ///< Entity states written
+    std::size_t deferredEntities = 0; ///< Relevant entities left out by the budget
+    std::size_t starvedEntities = 0; ///< Deferred longer than the starvation threshold
+    float maxStarvationSeconds = 0.0f; ///< Longest time a relevant entity went unsent
+    std::size_t volleysSent = 0; ///< Pooled bullet volleys written (see BulletPatternSystem)
+  };
+
+  /** @brief Get the metrics of the last send tick. */
+  [[nodiscard]] const ReplicationStats &getReplicationStats() const;
+
 private:
   std::shared_ptr<INetworkManager> m_networkManager;
   LobbyManager *m_lobbyManager = nullptr;
+  server::ServerMetrics *m_metrics = nullptr;
   float m_timeSinceLastSend = 0.0f;
+  std::vector<std::uint8_t> m_sendBuffer; ///< Reused serialization buffer
+
+  server::ReplicationConfig m_replicationConfig;
+  ReplicationStats m_stats;
+
+  /**
+   * @brief Per-entity replication priority for one client
+   */
+  struct EntityPriority {
+    float accumulated = 0.0f; ///< Grows every tick the entity is relevant but unsent
+    float unsentSeconds = 0.0f; ///< Time since the entity was last sent to this client
+  };
+
+  /**
+   * @brief What a client knows about the world
+   */
+  struct ClientReplicationState {
+    std::unordered_set<std::uint32_t> knownIds; ///< Ids the client currently holds
+    std::unordered_map<std::uint32_t, EntityPriority> priorities; ///< Relevant entities
+  };
 
-  // Track network IDs per lobby for destroyed entity detection
-  std::unordered_map<std::string, std::vector<uint32_t>> m_lobbyLastNetworkIds;
+  // Replication state per client so that entries, exits, destructions and
+  // priorities are tracked per client interest set.
+  std::unordered_map<std::uint32_t, ClientReplicationState> m_clientStates;
 
   static constexpr float SEND_INTERVAL = 0.016f;
 
+  // Interest management: entities are only replicated to a client while their
+  // bounds overlap that client's viewport grown by this margin (in pixels).
+  // The margin gives new enemies a lead-in before they scroll on screen.
+  static constexpr float INTEREST_MARGIN = 256.0f;
+  // Viewport assumed for clients that did not report one (or spectators).
+  static constexpr float DEFAULT_VIEWPORT_WIDTH = 1920.0f;
+  static constexpr float DEFAULT_VIEWPORT_HEIGHT = 1080.0f;
+
+  /**
+   * @brief Entity state gathered once per lobby and filtered per client
+   */
+  struct ReplicatedEntity {
+    std::uint32_t networkId = 0;
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+    float centerX = 0.0f;
+    float centerY = 0.0f;
+    float basePriority = 0.0f;
+    bool alwaysRelevant = false; ///< Players are visible to everyone
+    bool distanceScaled = true; ///< Priority decays with distance to the client
+    std::string encoded; ///< Entity state, serialized once per lobby
+  };
+
+  /**
+   * @brief Area of the world a client is interested in
+   */
+  struct InterestArea {
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+    float focusX = 0.0f; ///< Client's player position (or view center)
+    float focusY = 0.0f;
+
+    [[nodiscard]] bool overlaps(const ReplicatedEntity &entity) const
+    {
+      return entity.maxX >= minX && entity.minX <= maxX && entity.maxY >= minY && entity.minY <= maxY;
+    }
+  };
+
   /**
    * @brief Get all clients that are in an active game
    * @return Vector of client IDs in active games
    */
   [[nodiscard]] std::vector<std::uint32_t> getActiveGameClients() const;
+
+  /**
+   * @brief Compute the interest area of every client of a lobby
+   * @param lobbyWorld World of the lobby
+   * @param clients Clients of the lobby
+   * @return Interest area per client id
+   */
+  [[nodiscard]] static std::unordered_map<std::uint32_t, InterestArea>
+  computeInterestAreas(ecs::World &lobbyWorld, const std::unordered_set<std::uint32_t> &clients);
+
+  /**
+   * @brief Drop per-client state of clients no longer in a running game
+   */
+  void pruneClientInterest();
+
+  /**
+   * @brief Serialize the recent volleys and hits of a lobby's bullet pool
+   * @param pool Bullets of the lobby
+   * @param volleys Set to the number of volleys written
+   * @return Snapshot fields (',"volleys":[...],"bullet_hits":[...]'), empty when there is nothing to send
+   *
+   * Pooled bullets are not entities: each client gets the same volleys,
+   * outside the entity budget, and rebuilds the bullets from them.
+   */
+  [[nodiscard]] static std::string encodeBullets(const ecs::BulletPool &pool, std::size_t &volleys);
+
+  /**
+   * @brief Build the snapshot of one client within its byte budget
+   * @param replicated Entity states of the client's lobby
+   * @param aliveNetworkIds Network ids alive in the lobby
+   * @param area Interest area of the client
+   * @param state Replication state of the client
+   * @param elapsed Seconds since the previous send tick
+   * @param tick Simulation steps the lobby world has run, echoed so clients can order snapshots
+   * @param bullets Pooled bullet fields of the lobby, see encodeBullets()
+   * @return Serialized snapshot JSON
+   */
+  std::string buildClientSnapshot(const std::vector<ReplicatedEntity> &replicated,
+                                  const std::unordered_set<std::uint32_t> &aliveNetworkIds, const InterestArea &area,
+                                  ClientReplicationState &state, float elapsed, std::uint64_t tick,
+                                  const std::string &bullets);
 };
 
 #endif /* !NETWORKSENDSYSTEM_HPP_ */
@@ -14,8 +14,8 @@
 #include "../../../engineCore/include/ecs/components/Score.hpp"
 #include "../../../engineCore/include/ecs/events/EventListenerHandle.hpp"
 #include "../../../engineCore/include/ecs/events/GameEvents.hpp"
+#include "../../../engineCore/include/utils/Log.hpp"
 #include "ecs/ComponentSignature.hpp"
-#include <iostream>
 
 namespace server
 {
@@ -52,11 +52,11 @@ private:
     if (world.isAlive(event.player) && world.hasComponent<ecs::Score>(event.player)) {
       auto &score = world.getComponent<ecs::Score>(event.player);
       score.points += event.points;
-      std::cout << "[ScoreSystem] Added " << event.points << " points to entity " << event.player
-                << " (total: " << score.points << ")" << std::endl;
+      RTYPE_LOG_DEBUG("[ScoreSystem] Added " << event.points << " points to entity " << event.player
+                                             << " (total: " << score.points << ")");
     } else {
-      std::cout << "[ScoreSystem] Cannot add score - entity " << event.player
-                << " is not alive or has no Score component" << std::endl;
+      RTYPE_LOG_WARN("[ScoreSystem] Cannot add score - entity " << event.player
+                                                                << " is not alive or has no Score component");
     }
   }
 };
@@ -21,8 +21,8 @@
 #include "../../../engineCore/include/ecs/components/Velocity.hpp"
 #include "../../../engineCore/include/ecs/events/EventListenerHandle.hpp"
 #include "../../../engineCore/include/ecs/events/GameEvents.hpp"
+#include "../../../engineCore/include/utils/Log.hpp"
 #include "ecs/ComponentSignature.hpp"
-#include <iostream>
 #include <unordered_map>
 #include <vector>
 
@@ -114,8 +114,8 @@ public:
         charging.maxChargeTime = 1.2F;
         charging.loadingShotEntity = loadingShotEntity;
 
-        std::cout << "[ShootingSystem] Started charging for entity " << entity
-                  << " (loading shot: " << loadingShotEntity << ")" << std::endl;
+        RTYPE_LOG_DEBUG("[ShootingSystem] Started charging for entity " << entity << " (loading shot: "
+                                                                        << loadingShotEntity << ")");
       }
 
       // Update charge time automatically (no need to hold the key)
@@ -377,8 +377,8 @@ private:
         (sprite.spriteId >= ecs::SpriteId::BUBBLE_RUBAN_BACK1 && sprite.spriteId <= ecs::SpriteId::BUBBLE_RUBAN_FRONT4);
 
       if (isPowerup) {
-        std::cout << "[ShootingSystem] Detaching powerup " << followerEntity << " from player " << player
-                  << " (keeping sprite " << sprite.spriteId << ")" << std::endl;
+        RTYPE_LOG_DEBUG("[ShootingSystem] Detaching powerup " << followerEntity << " from player " << player
+                                                              << " (keeping sprite " << sprite.spriteId << ")");
 
         // Keep the original sprite - don't transform it
         // The powerup will display with the same appearance as when it was attached
@@ -407,8 +407,7 @@ private:
           world.addComponent(followerEntity, collider);
         }
 
-        std::cout << "[ShootingSystem] Powerup detached and moving left at " << DETACHED_SPEED << " units/s"
-                  << std::endl;
+        RTYPE_LOG_DEBUG("[ShootingSystem] Powerup detached and moving left at " << DETACHED_SPEED << " units/s");
         return; // Only detach one powerup at a time
       }
     }
@@ -12,6 +12,7 @@
 
 #include "../../../engineCore/include/ecs/Entity.hpp"
 #include "../../../engineCore/include/ecs/ISystem.hpp"
+#include "../../../engineCore/include/ecs/Prefab.hpp"
 #include "../../../engineCore/include/ecs/World.hpp"
 #include "../../../engineCore/include/ecs/components/Attraction.hpp"
 #include "../../../engineCore/include/ecs/components/Collider.hpp"
@@ -20,26 +21,30 @@
 #include "../../../engineCore/include/ecs/components/Health.hpp"
 #include "../../../engineCore/include/ecs/components/Immortal.hpp"
 #include "../../../engineCore/include/ecs/components/LevelProgress.hpp"
+#include "../../../engineCore/include/ecs/components/Lifetime.hpp"
 #include "../../../engineCore/include/ecs/components/Networked.hpp"
 #include "../../../engineCore/include/ecs/components/Owner.hpp"
 #include "../../../engineCore/include/ecs/components/Pattern.hpp"
 #include "../../../engineCore/include/ecs/components/PlayerId.hpp"
 #include "../../../engineCore/include/ecs/components/Shield.hpp"
 #include "../../../engineCore/include/ecs/components/Sprite.hpp"
+#include "../../../engineCore/include/ecs/components/Swept.hpp"
 #include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/components/Velocity.hpp"
 #include "../../../engineCore/include/ecs/components/Viewport.hpp"
 #include "../../../engineCore/include/ecs/events/EventListenerHandle.hpp"
 #include "../../../engineCore/include/ecs/events/GameEvents.hpp"
+#include "../../../engineCore/include/utils/Log.hpp"
 #include "../config/EnemyConfig.hpp"
 #include "../config/LevelConfig.hpp"
+#include "EnemyAISystem.hpp"
 #include "ecs/ComponentSignature.hpp"
 #include <algorithm>
 #include <array>
 #include <cmath>
-#include <iostream>
+#include <deque>
 #include <random>
-#include <unordered_map>
+#include <string>
 #include <vector>
 
 namespace server
@@ -62,7 +67,7 @@ typedef struct SpawnedProjectileConfig {
 class SpawnSystem : public ecs::ISystem
 {
 public:
-  SpawnSystem() : m_rng(std::random_device{}()) {}
+  SpawnSystem() = default;
   Difficulty difficulty = Difficulty::MEDIUM;
 
   /**
@@ -104,17 +109,18 @@ public:
   void startLevel(const std::string &levelId)
   {
     if (!m_levelConfigManager) {
-      std::cerr << "[SpawnSystem] ERROR: No level config manager set!" << std::endl;
+      RTYPE_LOG_ERROR("[SpawnSystem] No level config manager set!");
       return;
     }
 
     const LevelConfig *config = m_levelConfigManager->getConfig(levelId);
     if (!config) {
-      std::cerr << "[SpawnSystem] ERROR: Unknown level ID '" << levelId << "'" << std::endl;
+      RTYPE_LOG_ERROR("[SpawnSystem] Unknown level ID '" << levelId << "'");
       return;
     }
 
     m_currentLevel = config;
+    m_poolsPrewarmed = false; // startLevel() has no world, the next update() prewarms the level's pools
     m_maxPlayerDistance = 0.0F;
     m_nextWaveIndex = 0;
     m_isLevelActive = true;
@@ -124,14 +130,21 @@ public:
 
     // Clear existing spawn modes
     m_enemyTypeTimers.clear();
-    m_spawnQueue.clear();
+    m_pendingSpawns.clear();
+    m_activeWaves.clear();
 
-    std::cout << "[SpawnSystem] *** STARTED LEVEL: " << config->name << " (" << config->waves.size() << " waves) ***"
-              << std::endl;
-    std::cout << "[SpawnSystem] Level length: " << config->levelLength << std::endl;
+    // The timeline indexes enemies by level-local ID, resolve them once instead of once per spawn
+    m_levelEnemies.clear();
+    for (const auto &enemyType : config->timeline.enemyTypes) {
+      m_levelEnemies.push_back(resolveEnemy(enemyType));
+    }
+
+    RTYPE_LOG_INFO("[SpawnSystem] *** STARTED LEVEL: " << config->name << " (" << config->waves.size()
+                                                       << " waves) ***");
+    RTYPE_LOG_DEBUG("[SpawnSystem] Level length: " << config->levelLength);
     for (size_t i = 0; i < config->waves.size(); ++i) {
-      std::cout << "[SpawnSystem]   Wave " << i << ": " << config->waves[i].name
-                << " (triggerX=" << config->waves[i].triggerX << ")" << std::endl;
+      RTYPE_LOG_DEBUG("[SpawnSystem]   Wave " << i << ": " << config->waves[i].name << " (triggerX="
+                                              << config->waves[i].triggerX << ")");
     }
   }
 
@@ -168,7 +181,7 @@ public:
     for (auto player : players) {
       auto &progress = world.getComponent<ecs::LevelProgress>(player);
       progress.distanceTraveled = 0.0f;
-      std::cout << "[SpawnSystem] Reset player distance to 0" << std::endl;
+      RTYPE_LOG_DEBUG("[SpawnSystem] Reset player distance to 0");
     }
   }
 
@@ -202,16 +215,19 @@ public:
     m_maxPlayerDistance = 0.0F;
     m_nextWaveIndex = 0;
 
-    // Clear spawn queue to prevent spawning enemies after death
-    m_spawnQueue.clear();
-    m_spawnQueueTimer = 0.0F;
+    // Clear pending spawns to prevent spawning enemies after death
+    m_pendingSpawns.clear();
+    m_activeWaves.clear();
 
-    std::cout << "[SpawnSystem] Level stopped (cleared spawn queue)" << std::endl;
+    RTYPE_LOG_INFO("[SpawnSystem] Level stopped (cleared spawn queue)");
   }
 
   void update(ecs::World &world, float deltaTime) override
   {
-    (void)world;
+    if (!m_poolsPrewarmed && m_currentLevel) {
+      prewarmPools(world, m_currentLevel->pool);
+      m_poolsPrewarmed = true;
+    }
     m_spawnTimer += deltaTime;
     m_powerupSpawnTimer += deltaTime;
 
@@ -230,8 +246,7 @@ public:
     // Priority 0: Level-based spawning (highest priority)
     if (m_isLevelActive && m_currentLevel) {
       updateLevelSpawning(world, deltaTime);
-      // Still process spawn queue even in level mode
-      processSpawnQueue(world, deltaTime);
+      processLevelTimeline(world, deltaTime);
 
       // Spawn powerups periodically even in level mode
       if (m_powerupSpawnTimer >= POWERUP_SPAWN_INTERVAL) {
@@ -266,19 +281,19 @@ public:
     // Mode 2: Single-type spawning avec cycle automatique
     m_spawnTimer += deltaTime;
     if (!m_enemyConfigManager) {
-      std::cerr << "[SpawnSystem] ERROR: No enemy config manager, cannot spawn enemies" << std::endl;
+      RTYPE_LOG_ERROR("[SpawnSystem] No enemy config manager, cannot spawn enemies");
       return;
     }
 
     // Use config-based spawning
     const EnemyConfig *config = m_enemyConfigManager->getConfig(m_currentEnemyType);
     if (!config) {
-      std::cerr << "[SpawnSystem] ERROR: Unknown enemy type '" << m_currentEnemyType << "'" << std::endl;
+      RTYPE_LOG_ERROR("[SpawnSystem] Unknown enemy type '" << m_currentEnemyType << "'");
       return;
     }
 
     if (m_spawnTimer >= config->spawn.spawnInterval) {
-      spawnEnemyGroup(world, m_currentEnemyType);
+      spawnEnemyGroup(world, resolveEnemy(m_currentEnemyType));
       m_spawnTimer = 0.0F;
 
       // Alterner automatiquement entre les types d'ennemis
@@ -345,7 +360,7 @@ public:
   void spawnMultipleTypes(ecs::World &world, const std::vector<std::string> &enemyTypes)
   {
     for (const auto &enemyType : enemyTypes) {
-      spawnEnemyGroup(world, enemyType);
+      spawnEnemyGroup(world, resolveEnemy(enemyType));
     }
   }
 
@@ -357,11 +372,10 @@ public:
   {
     m_enemyTypeTimers.clear();
     for (const auto &type : enemyTypes) {
-      m_enemyTypeTimers[type] = 0.0F;
-      std::cout << "[SpawnSystem] Enabled multi-spawn for enemy type: " << type << std::endl;
+      m_enemyTypeTimers.push_back({resolveEnemy(type), 0.0F});
+      RTYPE_LOG_DEBUG("[SpawnSystem] Enabled multi-spawn for enemy type: " << type);
     }
-    std::cout << "[SpawnSystem] Multi-spawn mode activated with " << m_enemyTypeTimers.size() << " enemy types"
-              << std::endl;
+    RTYPE_LOG_DEBUG("[SpawnSystem] Multi-spawn mode activated with " << m_enemyTypeTimers.size() << " enemy types");
   }
 
   /**
@@ -372,14 +386,13 @@ public:
     if (!m_enemyConfigManager || m_enemyTypeTimers.empty())
       return;
 
-    for (auto &[enemyType, timer] : m_enemyTypeTimers) {
+    for (auto &[enemy, timer] : m_enemyTypeTimers) {
       timer += deltaTime;
 
-      const EnemyConfig *config = m_enemyConfigManager->getConfig(enemyType);
-      if (config && timer >= config->spawn.spawnInterval) {
-        std::cout << "[SpawnSystem] Spawning group of " << enemyType << " (timer=" << timer
-                  << ", interval=" << config->spawn.spawnInterval << ")" << std::endl;
-        spawnEnemyGroup(world, enemyType);
+      if (enemy.config && timer >= enemy.config->spawn.spawnInterval) {
+        RTYPE_LOG_DEBUG("[SpawnSystem] Spawning group of " << enemy.config->id << " (timer=" << timer << ", interval="
+                                                           << enemy.config->spawn.spawnInterval << ")");
+        spawnEnemyGroup(world, enemy);
         timer = 0.0F;
       }
     }
@@ -395,22 +408,24 @@ public:
 
     m_infiniteElapsed += deltaTime;
 
-    if (m_infiniteEnemyTypes.empty()) {
-      m_infiniteEnemyTypes = m_enemyConfigManager->getEnemyIds();
-      if (!m_infiniteEnemyTypes.empty()) {
+    // Every type is resolved up front and unlocked in order, the first m_infiniteUnlockedCount spawn
+    if (m_infiniteEnemies.empty()) {
+      for (const auto &enemyType : m_enemyConfigManager->getEnemyIds()) {
+        m_infiniteEnemies.push_back({resolveEnemy(enemyType), 0.0F});
+      }
+      if (!m_infiniteEnemies.empty()) {
         m_infiniteUnlockedCount = 1;
-        m_infiniteEnemyTimers[m_infiniteEnemyTypes[0]] = 0.0F;
       }
     }
 
-    if (m_infiniteUnlockedCount < m_infiniteEnemyTypes.size()) {
+    if (m_infiniteUnlockedCount < m_infiniteEnemies.size()) {
       m_infiniteUnlockTimer += deltaTime;
       if (m_infiniteUnlockTimer >= INFINITE_UNLOCK_INTERVAL) {
         m_infiniteUnlockTimer = 0.0F;
-        const auto &newType = m_infiniteEnemyTypes[m_infiniteUnlockedCount];
-        m_infiniteEnemyTimers[newType] = 0.0F;
+        auto &newType = m_infiniteEnemies[m_infiniteUnlockedCount];
+        newType.timer = 0.0F;
         m_infiniteUnlockedCount++;
-        std::cout << "[SpawnSystem] Infinite mode unlocked enemy type: " << newType << std::endl;
+        RTYPE_LOG_DEBUG("[SpawnSystem] Infinite mode unlocked enemy type: " << newType.enemy.config->id);
       }
     }
 
@@ -419,19 +434,16 @@ public:
     if (extraGroups > INFINITE_MAX_EXTRA_GROUPS)
       extraGroups = INFINITE_MAX_EXTRA_GROUPS;
 
-    for (auto &[enemyType, timer] : m_infiniteEnemyTimers) {
+    for (std::size_t i = 0; i < m_infiniteUnlockedCount; ++i) {
+      auto &[enemy, timer] = m_infiniteEnemies[i];
       timer += deltaTime;
 
-      const EnemyConfig *config = m_enemyConfigManager->getConfig(enemyType);
-      if (!config)
-        continue;
-
-      const float effectiveInterval = std::max(config->spawn.spawnInterval / ramp, INFINITE_MIN_INTERVAL);
+      const float effectiveInterval = std::max(enemy.config->spawn.spawnInterval / ramp, INFINITE_MIN_INTERVAL);
 
       if (timer >= effectiveInterval) {
-        spawnEnemyGroup(world, enemyType);
-        for (int i = 0; i < extraGroups; ++i) {
-          spawnEnemyGroup(world, enemyType);
+        spawnEnemyGroup(world, enemy);
+        for (int group = 0; group < extraGroups; ++group) {
+          spawnEnemyGroup(world, enemy);
         }
         timer = 0.0F;
       }
@@ -444,10 +456,9 @@ public:
     m_infiniteElapsed = 0.0F;
     m_infiniteUnlockTimer = 0.0F;
     m_infiniteUnlockedCount = 0;
-    m_infiniteEnemyTimers.clear();
-    m_infiniteEnemyTypes.clear();
-    m_spawnQueue.clear();
-    m_spawnQueueTimer = 0.0F;
+    m_infiniteEnemies.clear();
+    m_pendingSpawns.clear();
+    m_activeWaves.clear();
     m_isLevelActive = false;
     m_currentLevel = nullptr;
     m_enemyTypeTimers.clear();
@@ -459,12 +470,11 @@ public:
     m_infiniteElapsed = 0.0F;
     m_infiniteUnlockTimer = 0.0F;
     m_infiniteUnlockedCount = 0;
-    m_infiniteEnemyTimers.clear();
-    m_infiniteEnemyTypes.clear();
+    m_infiniteEnemies.clear();
   }
 
   /**
-   * @brief Process the spawn queue for delayed spawns
+   * @brief Process the spawn queue for the delayed enemies of random groups
    */
   void processSpawnQueue(ecs::World &world, float deltaTime)
   {
@@ -472,30 +482,41 @@ public:
     if (!m_isLevelActive && !m_isInfiniteMode)
       return;
 
-    if (m_spawnQueue.empty())
+    if (m_pendingSpawns.empty()) {
+      m_spawnClock = 0.0F; // Nothing is scheduled against it, keep it small
       return;
+    }
 
-    m_spawnQueueTimer += deltaTime;
+    m_spawnClock += deltaTime;
 
-    while (!m_spawnQueue.empty() && m_spawnQueueTimer >= m_spawnQueue.front().delay) {
-      const auto &queuedSpawn = m_spawnQueue.front();
-      if (!m_enemyConfigManager) {
-        std::cerr << "[SpawnSystem] CRITICAL: No enemy config manager set!" << std::endl;
-        m_spawnQueue.erase(m_spawnQueue.begin());
-        continue;
-      }
-      if (queuedSpawn.enemyType.empty()) {
-        std::cerr << "[SpawnSystem] ERROR: Empty enemy type in spawn queue!" << std::endl;
-        m_spawnQueue.erase(m_spawnQueue.begin());
-        continue;
-      }
+    while (!m_pendingSpawns.empty() && m_spawnClock >= m_pendingSpawns.front().time) {
+      const PendingSpawn spawn = m_pendingSpawns.front();
+      m_pendingSpawns.pop_front();
+      spawnEnemy(world, spawn.x, spawn.y, spawn.enemy);
+    }
+  }
 
-      // Spawn single enemy (count should always be 1 now)
-      spawnEnemyFromConfig(world, queuedSpawn.x, queuedSpawn.y, queuedSpawn.enemyType);
+  /**
+   * @brief Spawn the level timeline events that are due in the triggered waves
+   *
+   * Each triggered wave walks its slice of the timeline with its own cursor,
+   * so a tick costs one comparison per active wave plus one per spawn.
+   */
+  void processLevelTimeline(ecs::World &world, float deltaTime)
+  {
+    if (!m_isLevelActive || !m_currentLevel || m_activeWaves.empty())
+      return;
 
-      m_spawnQueueTimer -= queuedSpawn.delay;
-      m_spawnQueue.erase(m_spawnQueue.begin());
+    const auto &events = m_currentLevel->timeline.events;
+    std::uniform_real_distribution<float> yVariation(-30.0f, 30.0f);
+    for (auto &wave : m_activeWaves) {
+      wave.clock += deltaTime;
+      for (; wave.next < wave.end && wave.clock >= events[wave.next].time; ++wave.next) {
+        const auto &event = events[wave.next];
+        spawnEnemy(world, wave.spawnX, event.y + yVariation(world.getRandom()), m_levelEnemies[event.enemy]);
+      }
     }
+    std::erase_if(m_activeWaves, [](const ActiveWave &wave) { return wave.next >= wave.end; });
   }
 
   /**
@@ -509,105 +530,81 @@ public:
     // Handle level transition state
     if (m_transitionState == TransitionState::TRANSITIONING) {
       m_transitionTimer += deltaTime;
-      std::cout << "[SpawnSystem] Transition in progress: " << m_transitionTimer << " / " << TRANSITION_DURATION
-                << " seconds" << std::endl;
+      RTYPE_LOG_EVERY(::logging::Level::DEBUG, 1.0,
+                      "[SpawnSystem] Transition in progress: " << m_transitionTimer << " / " << TRANSITION_DURATION
+                                                                << " seconds");
 
       if (m_transitionTimer >= TRANSITION_DURATION) {
-        std::cout << "[SpawnSystem] ✓ Transition complete! Loading next level..." << std::endl;
+        RTYPE_LOG_DEBUG("[SpawnSystem] ✓ Transition complete! Loading next level...");
         m_transitionState = TransitionState::NONE;
         m_transitionTimer = 0.0f;
 
         if (!m_nextLevelIdToLoad.empty()) {
-          std::cout << "[SpawnSystem] Starting level: " << m_nextLevelIdToLoad << std::endl;
+          RTYPE_LOG_INFO("[SpawnSystem] Starting level: " << m_nextLevelIdToLoad);
           startLevel(m_nextLevelIdToLoad);
           resetPlayersLevelProgress(world); // Reset distance to 0 for new level
         } else {
-          std::cout << "[SpawnSystem] No more levels, game complete!" << std::endl;
+          RTYPE_LOG_INFO("[SpawnSystem] No more levels, game complete!");
           stopLevel();
         }
       }
       return; // Skip normal spawning during transition
     }
 
-    // Update max player distance traveled
-    ecs::ComponentSignature playerSig;
-    playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-    playerSig.set(ecs::getComponentId<ecs::LevelProgress>());
-    std::vector<ecs::Entity> players;
-    world.getEntitiesWithSignature(playerSig, players);
-
-    float previousMaxDistance = m_maxPlayerDistance;
-    for (const auto &player : players) {
-      const auto &progress = world.getComponent<ecs::LevelProgress>(player);
-      m_maxPlayerDistance = std::max(m_maxPlayerDistance, progress.distanceTraveled);
-    }
+    // DO NOT trigger new waves if level is ending (transition in progress)
+    if (!m_levelEnding && m_nextWaveIndex < m_currentLevel->waves.size()) {
+      // Update max player distance traveled, only needed while a wave is left to trigger
+      ecs::ComponentSignature playerSig;
+      playerSig.set(ecs::getComponentId<ecs::PlayerId>());
+      playerSig.set(ecs::getComponentId<ecs::LevelProgress>());
+      world.getEntitiesWithSignature(playerSig, m_players);
+
+      float previousMaxDistance = m_maxPlayerDistance;
+      for (const auto &player : m_players) {
+        const auto &progress = world.getComponent<ecs::LevelProgress>(player);
+        m_maxPlayerDistance = std::max(m_maxPlayerDistance, progress.distanceTraveled);
+      }
 
-    // Debug log when player distance changes significantly
-    if (std::abs(m_maxPlayerDistance - previousMaxDistance) > 100.0f) {
-      std::cout << "[SpawnSystem] Player distance traveled: " << m_maxPlayerDistance << std::endl;
-    }
+      // Debug log when player distance changes significantly
+      if (std::abs(m_maxPlayerDistance - previousMaxDistance) > 100.0f) {
+        RTYPE_LOG_DEBUG("[SpawnSystem] Player distance traveled: " << m_maxPlayerDistance);
+      }
 
-    // DO NOT trigger new waves if level is ending (transition in progress)
-    if (!m_levelEnding) {
       // Check if we need to trigger the next wave based on player distance
       while (m_nextWaveIndex < m_currentLevel->waves.size()) {
         const auto &wave = m_currentLevel->waves[m_nextWaveIndex];
 
         if (m_maxPlayerDistance >= wave.triggerX) {
-          std::cout << "[SpawnSystem] *** Triggering wave " << m_nextWaveIndex << ": " << wave.name
-                    << " (distance=" << m_maxPlayerDistance << ", triggerX=" << wave.triggerX << ") ***" << std::endl;
+          RTYPE_LOG_DEBUG("[SpawnSystem] *** Triggering wave " << m_nextWaveIndex << ": " << wave.name
+                                                               << " (distance=" << m_maxPlayerDistance
+                                                               << ", triggerX=" << wave.triggerX << ") ***");
 
           // Get viewport width to spawn just outside screen
           float worldWidth = DEFAULT_VIEWPORT_WIDTH;
           ecs::ComponentSignature vpSig;
           vpSig.set(ecs::getComponentId<ecs::PlayerId>());
           vpSig.set(ecs::getComponentId<ecs::Viewport>());
-          std::vector<ecs::Entity> vpPlayers;
-          world.getEntitiesWithSignature(vpSig, vpPlayers);
-          for (const auto &player : vpPlayers) {
+          world.getEntitiesWithSignature(vpSig, m_players);
+          for (const auto &player : m_players) {
             const auto &viewport = world.getComponent<ecs::Viewport>(player);
             if (viewport.width > 0) {
               worldWidth = std::max(worldWidth, static_cast<float>(viewport.width));
             }
           }
 
-          // Queue all spawns in this wave
-          for (const auto &spawn : wave.spawns) {
-            // Calculate delay to maintain spacing if count > 1
-            float spawnDelayPerEnemy = 0.0f;
-            if (spawn.count > 1 && spawn.spacing > 0.0f) {
-              // Get enemy config to calculate proper delay based on velocity
-              const EnemyConfig *enemyConfig =
-                m_enemyConfigManager ? m_enemyConfigManager->getConfig(spawn.enemyType) : nullptr;
-              float enemyVelocity = enemyConfig ? std::abs(enemyConfig->velocity.dx) : 384.0f;
-              spawnDelayPerEnemy = (enemyVelocity > 0.0f) ? (spawn.spacing / enemyVelocity) : 0.08f;
-            }
-
-            std::uniform_real_distribution<float> yVariation(-30.0f, 30.0f);
-            for (int i = 0; i < spawn.count; ++i) {
-              float offsetY = yVariation(m_rng);
-              float individualDelay = spawn.delay + i * spawnDelayPerEnemy;
-
-              // Spawn just outside the right edge of screen
-              float spawnX = worldWidth + 100.0f;
-              // float spawnX = (spawn.x > 0.0f) ? spawn.x : (worldWidth + 100.0f);
-
-              m_spawnQueue.push_back({spawnX, spawn.y + offsetY, individualDelay, spawn.enemyType,
-                                      1, // Spawn only 1 enemy per queue entry
-                                      0.0f});
-            }
+          // Start the wave's slice of the timeline, spawning just outside the right edge of screen
+          const auto &timeline = m_currentLevel->timeline;
+          const ActiveWave active{timeline.waveBegin[m_nextWaveIndex], timeline.waveBegin[m_nextWaveIndex + 1], 0.0F,
+                                  worldWidth + 100.0f};
+          if (active.next < active.end) {
+            m_activeWaves.push_back(active);
           }
 
-          std::cout << "[SpawnSystem] Queued " << wave.spawns.size() << " spawn groups for wave " << wave.name
-                    << std::endl;
-          std::cout << "[SpawnSystem] → Wave triggered at distance: " << m_maxPlayerDistance
-                    << " (triggerX: " << wave.triggerX << ")" << std::endl;
-
-          // Sort spawn queue by delay
-          std::sort(m_spawnQueue.begin(), m_spawnQueue.end(),
-                    [](const QueuedSpawn &a, const QueuedSpawn &b) { return a.delay < b.delay; });
+          RTYPE_LOG_DEBUG("[SpawnSystem] Queued " << (active.end - active.next) << " spawns (" << wave.spawns.size()
+                                                  << " groups) for wave " << wave.name);
+          RTYPE_LOG_DEBUG("[SpawnSystem] → Wave triggered at distance: " << m_maxPlayerDistance << " (triggerX: "
+                                                                         << wave.triggerX << ")");
 
-          m_spawnQueueTimer = 0.0F;
           m_nextWaveIndex++;
         } else {
           break; // No more waves to trigger yet
@@ -624,19 +621,19 @@ public:
       size_t aliveEnemies = countAliveEnemies(world);
 
       if (debugLogTimer >= 1.0f) {
-        std::cout << "[SpawnSystem] Level completion check:" << std::endl;
-        std::cout << "  - Wave index: " << m_nextWaveIndex << " / " << m_currentLevel->waves.size() << std::endl;
-        std::cout << "  - Spawn queue size: " << m_spawnQueue.size() << std::endl;
-        std::cout << "  - Alive enemies: " << aliveEnemies << std::endl;
-        std::cout << "  - Distance: " << m_maxPlayerDistance << " / " << m_currentLevel->levelLength << std::endl;
+        RTYPE_LOG_DEBUG("[SpawnSystem] Level completion check:");
+        RTYPE_LOG_DEBUG("  - Wave index: " << m_nextWaveIndex << " / " << m_currentLevel->waves.size());
+        RTYPE_LOG_DEBUG("  - Waves still spawning: " << m_activeWaves.size());
+        RTYPE_LOG_DEBUG("  - Alive enemies: " << aliveEnemies);
+        RTYPE_LOG_DEBUG("  - Distance: " << m_maxPlayerDistance << " / " << m_currentLevel->levelLength);
         debugLogTimer = 0;
       }
 
-      // Level complete = all waves triggered + spawn queue empty + all enemies dead
-      if (m_spawnQueue.empty() && aliveEnemies == 0) {
-        std::cout << "[SpawnSystem] ✓✓✓ LEVEL COMPLETE ✓✓✓" << std::endl;
-        std::cout << "[SpawnSystem] Level: " << m_currentLevel->name << std::endl;
-        std::cout << "[SpawnSystem] Distance: " << m_maxPlayerDistance << std::endl;
+      // Level complete = all waves triggered + all of them spawned + all enemies dead
+      if (m_activeWaves.empty() && aliveEnemies == 0) {
+        RTYPE_LOG_INFO("[SpawnSystem] ✓✓✓ LEVEL COMPLETE ✓✓✓");
+        RTYPE_LOG_DEBUG("[SpawnSystem] Level: " << m_currentLevel->name);
+        RTYPE_LOG_DEBUG("[SpawnSystem] Distance: " << m_maxPlayerDistance);
 
         // Mark level as ending to block new wave triggers
         m_levelEnding = true;
@@ -650,9 +647,8 @@ public:
         m_transitionTimer = 0.0f;
         m_nextLevelIdToLoad = nextLevelId;
 
-        std::cout << "[SpawnSystem] → Emitting LevelCompleteEvent: " << currentLevelId << " → " << nextLevelId
-                  << std::endl;
-        std::cout << "[SpawnSystem] → Entering transition state (6 seconds)" << std::endl;
+        RTYPE_LOG_DEBUG("[SpawnSystem] → Emitting LevelCompleteEvent: " << currentLevelId << " → " << nextLevelId);
+        RTYPE_LOG_DEBUG("[SpawnSystem] → Entering transition state (6 seconds)");
         world.getEventBus().emit(ecs::LevelCompleteEvent{currentLevelId, nextLevelId});
       }
     }
@@ -660,9 +656,7 @@ public:
 
 private:
   ecs::EventListenerHandle m_spawnHandle;
-  std::mt19937 m_rng;
   float m_spawnTimer = 0.0F;
-  float m_spawnQueueTimer = 0.0F;
   float m_powerupSpawnTimer = 0.0F;
   int m_powerupSpawnCount = 0; // Counter to alternate powerup types: 0=DRONE, 1=BUBBLE
   std::shared_ptr<EnemyConfigManager> m_enemyConfigManager;
@@ -674,8 +668,18 @@ private:
   float m_infiniteElapsed = 0.0F;
   float m_infiniteUnlockTimer = 0.0F;
   size_t m_infiniteUnlockedCount = 0;
-  std::vector<std::string> m_infiniteEnemyTypes;
-  std::unordered_map<std::string, float> m_infiniteEnemyTimers;
+
+  /** @brief Enemy type resolved once, see resolveEnemy() */
+  struct EnemyRef {
+    const EnemyConfig *config = nullptr;
+    const ecs::Prefab *prefab = nullptr;
+  };
+
+  struct TypeTimer {
+    EnemyRef enemy;
+    float timer;
+  };
+  std::vector<TypeTimer> m_infiniteEnemies; // Every enemy type, the first m_infiniteUnlockedCount are unlocked
 
   // Level-based spawning state
   const LevelConfig *m_currentLevel = nullptr;
@@ -683,6 +687,18 @@ private:
   size_t m_nextWaveIndex = 0;
   bool m_isLevelActive = false;
   bool m_levelEnding = false; // Flag to block new waves during transition
+  bool m_poolsPrewarmed = true;
+  std::vector<EnemyRef> m_levelEnemies; // Indexed by SpawnEvent::enemy
+
+  /** @brief A triggered wave: its cursor into the level timeline and the clock its events are due on */
+  struct ActiveWave {
+    std::size_t next;
+    std::size_t end;
+    float clock; // Seconds since the wave triggered
+    float spawnX;
+  };
+  std::vector<ActiveWave> m_activeWaves;
+  std::vector<ecs::Entity> m_players; // Query scratch, reused every tick
 
   // Transition state management
   enum class TransitionState {
@@ -695,17 +711,17 @@ private:
   static constexpr float TRANSITION_DURATION = 6.0f; // Must match client transition time
 
   // Timers individuels pour chaque type d'ennemi
-  std::unordered_map<std::string, float> m_enemyTypeTimers;
+  std::vector<TypeTimer> m_enemyTypeTimers;
 
-  struct QueuedSpawn {
+  /** @brief An enemy of a random group, due when m_spawnClock reaches its time */
+  struct PendingSpawn {
+    float time;
     float x;
     float y;
-    float delay;
-    std::string enemyType;
-    int count; // Nombre d'ennemis à spawner
-    float spacing; // Espacement entre les ennemis
+    EnemyRef enemy;
   };
-  std::vector<QueuedSpawn> m_spawnQueue;
+  std::deque<PendingSpawn> m_pendingSpawns; // Sorted by time
+  float m_spawnClock = 0.0F;
 
   // Spawn configuration constants
   static constexpr float SPAWN_INTERVAL = 6.0F;
@@ -775,6 +791,9 @@ private:
   static constexpr float LOADING_SHOT_SCALE = 2.5F;
   static constexpr float LOADING_SHOT_FRAME_TIME = 0.12F; // plus rapide (≈1s pour 8 frames)
 
+  // Death animation, despawned by its Lifetime
+  static constexpr float EXPLOSION_LIFETIME = 0.35F; // 350ms = animation duration + minimal buffer
+
   // Ruban/Wave beam projectile configuration (R-Type ribbon effect)
   // Uses xruban_projectile.png format (x = phase 1-14)
   // Phase 1 initial dimensions: 21x49, 1 frame
@@ -794,6 +813,257 @@ private:
     std::uint32_t spriteId;
   } configRubanProjectile;
 
+  /**
+   * @brief Entities spawned with fixed components, compiled once per process into prefabs
+   * @note Enemies are compiled from their config instead, see EnemyConfigManager::getPrefab
+   */
+  enum class PrefabKind : std::uint8_t {
+    PROJECTILE,
+    CHARGED_PROJECTILE,
+    LOADING_SHOT,
+    RUBAN_PROJECTILE,
+    TRIPLE_PROJECTILE_RIGHT,
+    TRIPLE_PROJECTILE_UP,
+    TRIPLE_PROJECTILE_DOWN,
+    ELITE_SHIELD,
+    EXPLOSION,
+    COUNT
+  };
+
+  static const ecs::Prefab &prefab(PrefabKind kind)
+  {
+    static const std::array<ecs::Prefab, static_cast<std::size_t>(PrefabKind::COUNT)> prefabs = buildPrefabs();
+    return prefabs[static_cast<std::size_t>(kind)];
+  }
+
+  /**
+   * @brief Park the entities the level asks for, so its first shots and explosions reuse them
+   */
+  static void prewarmPools(ecs::World &world, const PoolConfig &pool)
+  {
+    world.prewarm(prefab(PrefabKind::PROJECTILE), pool.projectiles);
+    world.prewarm(prefab(PrefabKind::CHARGED_PROJECTILE), pool.chargedProjectiles);
+    world.prewarm(prefab(PrefabKind::LOADING_SHOT), pool.loadingShots);
+    world.prewarm(prefab(PrefabKind::RUBAN_PROJECTILE), pool.rubanProjectiles);
+    world.prewarm(prefab(PrefabKind::TRIPLE_PROJECTILE_RIGHT), pool.tripleProjectiles);
+    world.prewarm(prefab(PrefabKind::TRIPLE_PROJECTILE_UP), pool.tripleProjectiles);
+    world.prewarm(prefab(PrefabKind::TRIPLE_PROJECTILE_DOWN), pool.tripleProjectiles);
+    world.prewarm(prefab(PrefabKind::EXPLOSION), pool.explosions);
+    EnemyAISystem::prewarmBullets(world, pool.bossBullets);
+  }
+
+  /**
+   * @brief Acquire a pooled projectile at a position, owned by owner
+   * @return The new projectile
+   */
+  static ecs::Entity instantiateProjectile(ecs::World &world, PrefabKind kind, float posX, float posY,
+                                           ecs::Entity owner)
+  {
+    const ecs::Prefab &projectilePrefab = prefab(kind);
+    ecs::Transform transform = *projectilePrefab.get<ecs::Transform>();
+    transform.x = posX;
+    transform.y = posY;
+    ecs::Entity projectile = world.acquire(projectilePrefab, transform);
+
+    // Track owner to prevent self-damage
+    world.getComponent<ecs::Owner>(projectile).ownerId = owner;
+    return projectile;
+  }
+
+  static ecs::Transform makeTransform(float scale)
+  {
+    ecs::Transform transform;
+    transform.rotation = 0.0F;
+    transform.scale = scale;
+    return transform;
+  }
+
+  static ecs::Velocity makeVelocity(float dx, float dy)
+  {
+    ecs::Velocity velocity;
+    velocity.dx = dx;
+    velocity.dy = dy;
+    return velocity;
+  }
+
+  // Mark as networked so the snapshot system replicates it to clients.
+  static void stampNetworkId(ecs::Networked &net, ecs::Entity entity) { net.networkId = entity; }
+
+  /**
+   * @brief Projectile prefab: Transform (scale only), Velocity, Sprite, Collider sized to sprite * scale,
+   * Networked, Owner and Swept: player shots cross up to 80 px per tick at 30 Hz, more than most targets
+   */
+  static ecs::Prefab makeProjectilePrefab(float scale, const ecs::Velocity &velocity, const ecs::Sprite &sprite)
+  {
+    ecs::Prefab projectile;
+    projectile.set(makeTransform(scale))
+      .set(velocity)
+      .set(sprite)
+      .set(ecs::Collider{static_cast<float>(sprite.width) * scale, static_cast<float>(sprite.height) * scale})
+      .set(ecs::Networked{}, stampNetworkId)
+      .set(ecs::Owner{})
+      .set(ecs::Swept{});
+    return projectile;
+  }
+
+  static std::array<ecs::Prefab, static_cast<std::size_t>(PrefabKind::COUNT)> buildPrefabs()
+  {
+    std::array<ecs::Prefab, static_cast<std::size_t>(PrefabKind::COUNT)> prefabs;
+    auto at = [&prefabs](PrefabKind kind) -> ecs::Prefab & { return prefabs[static_cast<std::size_t>(kind)]; };
+
+    // SERVER ASSIGNS VISUAL IDENTITY AS DATA
+    // Projectile sprite decided at creation, never inferred later
+    ecs::Sprite sprite;
+    sprite.spriteId = ecs::SpriteId::PROJECTILE;
+    sprite.width = PROJECTILE_SPRITE_WIDTH; // 211x92 aspect ratio (422/2 frames, scaled down ~2.5x)
+    sprite.height = PROJECTILE_SPRITE_HEIGHT;
+    sprite.animated = true;
+    sprite.frameCount = 3;
+    sprite.loop = false;
+    sprite.startFrame = 0;
+    sprite.endFrame = 2;
+    at(PrefabKind::PROJECTILE) = makeProjectilePrefab(1.0F, makeVelocity(PROJECTILE_VELOCITY_MULTIPLIER, 0.0F), sprite);
+
+    sprite = ecs::Sprite{};
+    sprite.spriteId = ecs::SpriteId::CHARGED_PROJECTILE;
+    sprite.width = CHARGED_PROJECTILE_SPRITE_WIDTH;
+    sprite.height = CHARGED_PROJECTILE_SPRITE_HEIGHT;
+    sprite.animated = true;
+    sprite.frameCount = 2;
+    sprite.loop = true;
+    sprite.startFrame = 0;
+    sprite.endFrame = 1;
+    ecs::Immortal immortalComponent;
+    immortalComponent.isImmortal = true;
+    at(PrefabKind::CHARGED_PROJECTILE) =
+      makeProjectilePrefab(CHARGED_PROJECTILE_SCALE, makeVelocity(CHARGED_PROJECTILE_VELOCITY, 0.0F), sprite);
+    at(PrefabKind::CHARGED_PROJECTILE).set(immortalComponent);
+
+    // Sprite avec animation de chargement, no Collider: the shot is not live while loading
+    sprite = ecs::Sprite{};
+    sprite.spriteId = ecs::SpriteId::LOADING_SHOT;
+    sprite.width = LOADING_SHOT_SPRITE_WIDTH;
+    sprite.height = LOADING_SHOT_SPRITE_HEIGHT;
+    sprite.animated = true;
+    sprite.frameCount = 8;
+    sprite.loop = true;
+    sprite.startFrame = 0;
+    sprite.endFrame = 7;
+    sprite.frameTime = LOADING_SHOT_FRAME_TIME; // Animation rapide
+    at(PrefabKind::LOADING_SHOT)
+      .set(makeTransform(LOADING_SHOT_SCALE))
+      .set(makeVelocity(LOADING_SHOT_VELOCITY, 0.0F))
+      .set(sprite)
+      .set(ecs::Networked{}, stampNetworkId)
+      .set(ecs::Owner{});
+
+    // Start with phase 1 sprite (1ruban_projectile.png: 21x49, 1 frame)
+    sprite = ecs::Sprite{};
+    sprite.spriteId = ecs::SpriteId::RUBAN1_PROJECTILE;
+    sprite.width = RUBAN_INITIAL_WIDTH;
+    sprite.height = RUBAN_INITIAL_HEIGHT;
+    sprite.animated = false;
+    sprite.frameCount = 1;
+    sprite.loop = false;
+    sprite.startFrame = 0;
+    sprite.endFrame = 0;
+    sprite.currentFrame = 0;
+    at(PrefabKind::RUBAN_PROJECTILE) =
+      makeProjectilePrefab(RUBAN_SCALE, makeVelocity(RUBAN_PROJECTILE_VELOCITY, 0.0F), sprite);
+    // Add wave beam pattern for R-Type ribbon effect (oscillating vertically)
+    at(PrefabKind::RUBAN_PROJECTILE).set(ecs::Pattern{"wave_beam", RUBAN_WAVE_AMPLITUDE, RUBAN_WAVE_FREQUENCY});
+
+    // Three projectile angles: 0° (forward), -50° (up-forward), 50° (down-forward)
+    // Note: In game coords, negative Y = up, positive Y = down
+    constexpr float PI = 3.14159265358979323846F;
+    const std::array<float, 3> angles = {0.0F, -50.0F * PI / 180.0F, 50.0F * PI / 180.0F};
+    const std::array<std::uint32_t, 3> spriteIds = {
+      ecs::SpriteId::TRIPLE_PROJECTILE_RIGHT, // Straight forward
+      ecs::SpriteId::TRIPLE_PROJECTILE_UP, // Up-forward
+      ecs::SpriteId::TRIPLE_PROJECTILE_DOWN // Down-forward
+    };
+    const std::array<PrefabKind, 3> tripleKinds = {
+      PrefabKind::TRIPLE_PROJECTILE_RIGHT, PrefabKind::TRIPLE_PROJECTILE_UP, PrefabKind::TRIPLE_PROJECTILE_DOWN};
+    for (std::size_t i = 0; i < tripleKinds.size(); ++i) {
+      sprite = ecs::Sprite{};
+      sprite.spriteId = spriteIds[i];
+      sprite.width = PROJECTILE_SPRITE_WIDTH;
+      sprite.height = PROJECTILE_SPRITE_HEIGHT;
+      sprite.animated = false; // Individual images, no animation
+      sprite.frameCount = 1;
+      sprite.loop = false;
+      sprite.startFrame = 0;
+      sprite.endFrame = 0;
+      // No rotation needed - sprite already oriented correctly
+      at(tripleKinds[i]) = makeProjectilePrefab(
+        1.0F,
+        makeVelocity(PROJECTILE_VELOCITY_MULTIPLIER * std::cos(angles[i]),
+                     PROJECTILE_VELOCITY_MULTIPLIER * std::sin(angles[i])),
+        sprite);
+    }
+
+    // Elite shield, parent set per instance
+    ecs::Follower follower;
+    follower.offsetX = -60.0F;
+    follower.offsetY = 20.0F;
+    follower.smoothing = 30.0F;
+
+    // Shield health: 3 hits (damageFromProjectile=20)
+    ecs::Health shieldHealth;
+    shieldHealth.hp = 60;
+    shieldHealth.maxHp = 60;
+
+    // Shield sprite (match BUBBLE animation)
+    sprite = ecs::Sprite{};
+    sprite.spriteId = ecs::SpriteId::SHIELD_BUBBLE;
+    sprite.width = 24; // bubble.png frame width
+    sprite.height = 24; // bubble.png height
+    sprite.animated = true;
+    sprite.frameCount = 12;
+    sprite.startFrame = 0;
+    sprite.endFrame = 11;
+    sprite.currentFrame = 0;
+    sprite.frameTime = 0.1F;
+    sprite.reverseAnimation = false;
+    sprite.loop = true;
+    sprite.row = 0;
+    sprite.offsetX = 0;
+    at(PrefabKind::ELITE_SHIELD)
+      .set(makeTransform(2.5F))
+      .set(follower)
+      .set(ecs::Shield{})
+      .set(shieldHealth)
+      // Shield collider (bubble frame size * scale)
+      .set(ecs::Collider{60.0F, 60.0F})
+      .set(sprite)
+      .set(ecs::Networked{}, stampNetworkId);
+
+    // Death animation
+    // Image: 586x94, 6 frames → each frame is ~98px wide
+    sprite = ecs::Sprite{};
+    sprite.spriteId = ecs::SpriteId::DEATH_ANIM;
+    sprite.width = 98; // 586 / 6
+    sprite.height = 94;
+    sprite.animated = true;
+    sprite.frameCount = 6;
+    sprite.currentFrame = 0;
+    sprite.startFrame = 0;
+    sprite.endFrame = 5;
+    sprite.frameTime = 0.07F;
+    sprite.loop = false; // One-shot animation
+    sprite.animationTimer = 0.0F;
+    sprite.reverseAnimation = false;
+    // Lifetime: animation duration + minimal buffer, so the last frame is displayed
+    ecs::Lifetime lifetime;
+    lifetime.remaining = EXPLOSION_LIFETIME;
+    at(PrefabKind::EXPLOSION)
+      .set(makeTransform(1.0F))
+      .set(sprite)
+      .set(ecs::Networked{}, stampNetworkId)
+      .set(lifetime);
+    return prefabs;
+  }
+
   void spawnFollower(ecs::World &world, ecs::Entity parent, ecs::Entity child, float offsetX, float offsetY)
   {
     ecs::Follower follower;
@@ -833,7 +1103,7 @@ private:
     // Random Y position
     std::uniform_real_distribution<float> yDist(SPAWN_Y_MARGIN, worldHeight - SPAWN_Y_MARGIN);
     float spawnX = worldWidth - SPAWN_X_OFFSET;
-    float spawnY = yDist(m_rng);
+    float spawnY = yDist(world.getRandom());
 
     // Alternate powerup types: DRONE first, then BUBBLE
     PowerupType powerupType;
@@ -854,24 +1124,13 @@ private:
   /**
    * @brief Spawn a group of enemies from configuration
    * @param world ECS world
-   * @param enemyType Enemy type ID from config
+   * @param enemy Enemy type from resolveEnemy()
    */
-  void spawnEnemyGroup(ecs::World &world, const std::string &enemyType)
+  void spawnEnemyGroup(ecs::World &world, const EnemyRef &enemy)
   {
-    if (!m_enemyConfigManager) {
-      std::cerr << "[SpawnSystem] CRITICAL: No enemy config manager set!" << std::endl;
-      return;
-    }
-
-    const EnemyConfig *config = m_enemyConfigManager->getConfig(enemyType);
+    const EnemyConfig *config = enemy.config;
     if (!config) {
-      std::cerr << "[SpawnSystem] ERROR: Unknown enemy type '" << enemyType << "'" << std::endl;
-      std::cerr << "[SpawnSystem] Available enemy types: ";
-      for (const auto &id : m_enemyConfigManager->getEnemyIds()) {
-        std::cerr << id << " ";
-      }
-      std::cerr << std::endl;
-      return;
+      return; // Reported by resolveEnemy()
     }
 
     // Get world dimensions
@@ -896,11 +1155,11 @@ private:
 
     // Random group size from config
     std::uniform_int_distribution<int> groupSizeDist(config->spawn.groupSizeMin, config->spawn.groupSizeMax);
-    int groupSize = groupSizeDist(m_rng);
+    int groupSize = groupSizeDist(world.getRandom());
 
     // Pick a random height range (1-6)
     std::uniform_int_distribution<int> heightRangeDist(0, 5);
-    int heightRange = heightRangeDist(m_rng);
+    int heightRange = heightRangeDist(world.getRandom());
 
     // Calculate Y position within the chosen range (height / 6)
     float rangeHeight = (worldHeight - 2 * SPAWN_Y_MARGIN) / 6.0f;
@@ -911,15 +1170,17 @@ private:
     // Spawn X position at right edge
     float spawnX = worldWidth - SPAWN_X_OFFSET;
 
-    // Queue all enemies in the group with delays
+    // Queue all enemies in the group with delays, after the ones already due earlier
     for (int i = 0; i < groupSize; ++i) {
-      float y = baseY + yOffsetDist(m_rng);
-      float delay = i * config->spawn.spawnDelay;
-      m_spawnQueue.push_back({spawnX, y, delay, enemyType, 1, 0.0F});
+      const PendingSpawn spawn{m_spawnClock + static_cast<float>(i) * config->spawn.spawnDelay, spawnX,
+                               baseY + yOffsetDist(world.getRandom()), enemy};
+      const auto at =
+        std::upper_bound(m_pendingSpawns.begin(), m_pendingSpawns.end(), spawn.time,
+                         [](float time, const PendingSpawn &pending) { return time < pending.time; });
+      m_pendingSpawns.insert(at, spawn);
     }
 
-    std::cout << "[SpawnSystem] Queued " << groupSize << " enemies of type '" << enemyType << "' at X=" << spawnX
-              << std::endl;
+    RTYPE_LOG_DEBUG("[SpawnSystem] Queued " << groupSize << " enemies of type '" << config->id << "' at X=" << spawnX);
   }
 
   /**
@@ -930,61 +1191,56 @@ private:
    * @param enemyType Enemy type ID from config
    */
   void spawnEnemyFromConfig(ecs::World &world, float posX, float posY, const std::string &enemyType)
+  {
+    spawnEnemy(world, posX, posY, resolveEnemy(enemyType));
+  }
+
+  /**
+   * @brief Look an enemy type up in the enemy configs, once for all of its spawns
+   * @param enemyType Enemy type ID from config
+   * @return The config and prefab of the type, both null if it is unknown
+   */
+  [[nodiscard]] EnemyRef resolveEnemy(const std::string &enemyType) const
   {
     if (!m_enemyConfigManager) {
-      std::cerr << "[SpawnSystem] CRITICAL: No enemy config manager set!" << std::endl;
-      return;
+      RTYPE_LOG_ERROR("[SpawnSystem] No enemy config manager set!");
+      return {};
     }
 
     const EnemyConfig *config = m_enemyConfigManager->getConfig(enemyType);
-    if (!config) {
-      std::cerr << "[SpawnSystem] ERROR: Unknown enemy type '" << enemyType << "'" << std::endl;
-      std::cerr << "[SpawnSystem] Available enemy types: ";
+    const ecs::Prefab *enemyPrefab = m_enemyConfigManager->getPrefab(enemyType);
+    if (!config || !enemyPrefab) {
+      std::string available;
       for (const auto &id : m_enemyConfigManager->getEnemyIds()) {
-        std::cerr << id << " ";
+        available += id + " ";
       }
-      std::cerr << std::endl;
-      return;
+      RTYPE_LOG_ERROR("[SpawnSystem] Unknown enemy type '" << enemyType << "', available types: " << available);
+      return {};
     }
+    return {config, enemyPrefab};
+  }
 
-    ecs::Entity enemy = world.createEntity();
-
-    // Pattern component
-    world.addComponent(enemy, ecs::Pattern{config->pattern.type, config->pattern.amplitude, config->pattern.frequency});
+  /**
+   * @brief Spawn an enemy of a resolved type
+   * @param world ECS world
+   * @param posX X position
+   * @param posY Y position
+   * @param type Enemy type from resolveEnemy(), nothing spawns if it is unknown
+   */
+  void spawnEnemy(ecs::World &world, float posX, float posY, const EnemyRef &type)
+  {
+    if (!type.config || !type.prefab) {
+      return;
+    }
+    const EnemyConfig *config = type.config;
+    const ecs::Prefab *enemyPrefab = type.prefab;
+    const std::string &enemyType = config->id;
 
-    // Transform component
-    ecs::Transform transform;
+    // Pattern, Velocity, Health, Sprite, Collider and Networked come from the prefab compiled from the config
+    ecs::Transform transform = *enemyPrefab->get<ecs::Transform>();
     transform.x = posX;
     transform.y = posY;
-    transform.rotation = 0.0F;
-    transform.scale = config->transform.scale;
-    world.addComponent(enemy, transform);
-
-    // Velocity component
-    ecs::Velocity velocity;
-    velocity.dx = config->velocity.dx;
-    velocity.dy = config->velocity.dy;
-    world.addComponent(enemy, velocity);
-
-    // Health component
-    ecs::Health health;
-    health.hp = config->health.hp;
-    health.maxHp = config->health.maxHp;
-    world.addComponent(enemy, health);
-
-    // Sprite component
-    ecs::Sprite sprite;
-    sprite.spriteId = config->sprite.spriteId;
-    sprite.width = config->sprite.width;
-    sprite.height = config->sprite.height;
-    sprite.animated = config->sprite.animated;
-    sprite.frameCount = config->sprite.frameCount;
-    sprite.startFrame = config->sprite.startFrame;
-    sprite.endFrame = config->sprite.endFrame;
-    sprite.currentFrame = config->sprite.startFrame;
-    sprite.frameTime = config->sprite.frameTime;
-    sprite.reverseAnimation = config->sprite.reverseAnimation;
-    world.addComponent(enemy, sprite);
+    ecs::Entity enemy = world.instantiate(*enemyPrefab, transform);
 
     // Elite enemy: spawn shield and make elite immortal until shield is destroyed
     if (enemyType == "enemy_elite_blue") {
@@ -993,77 +1249,23 @@ private:
       world.addComponent(enemy, immortal);
       spawnEliteShield(world, enemy, transform);
     }
-    // Collider component sized to sprite * transform.scale (matches visual size)
-    world.addComponent(enemy,
-                       ecs::Collider{static_cast<float>(sprite.width) * transform.scale,
-                                     static_cast<float>(sprite.height) * transform.scale});
 
-    std::cout << "[SpawnSystem] Spawned enemy '" << enemyType << "' (spriteId=" << config->sprite.spriteId
-              << ", pattern=" << config->pattern.type << ") at (" << posX << ", " << posY << ")" << std::endl;
-
-    // Networked component
-    ecs::Networked net;
-    net.networkId = enemy;
-    world.addComponent(enemy, net);
+    RTYPE_LOG_DEBUG("[SpawnSystem] Spawned enemy '" << enemyType << "' (spriteId=" << config->sprite.spriteId
+                                                    << ", pattern=" << config->pattern.type << ") at (" << posX
+                                                    << ", " << posY << ")");
   }
 
   void spawnEliteShield(ecs::World &world, ecs::Entity parent, const ecs::Transform &parentTransform)
   {
-    ecs::Entity shield = world.createEntity();
-
     // Shield transform (follow parent)
-    ecs::Transform shieldTransform;
+    ecs::Transform shieldTransform = *prefab(PrefabKind::ELITE_SHIELD).get<ecs::Transform>();
     shieldTransform.x = parentTransform.x;
     shieldTransform.y = parentTransform.y;
-    shieldTransform.rotation = 0.0F;
-    shieldTransform.scale = 2.5F;
-    world.addComponent(shield, shieldTransform);
-
-    ecs::Follower follower;
-    follower.parent = parent;
-    follower.offsetX = -60.0F;
-    follower.offsetY = 20.0F;
-    follower.smoothing = 30.0F;
-    world.addComponent(shield, follower);
-
-    // Shield marker with parent link
-    ecs::Shield shieldComp;
-    shieldComp.parent = parent;
-    world.addComponent(shield, shieldComp);
-
-    // Shield health: 3 hits (damageFromProjectile=20)
-    ecs::Health shieldHealth;
-    shieldHealth.hp = 60;
-    shieldHealth.maxHp = 60;
-    world.addComponent(shield, shieldHealth);
-
-    // Shield collider (bubble frame size * scale)
-    world.addComponent(shield, ecs::Collider{60.0F, 60.0F});
+    ecs::Entity shield = world.instantiate(prefab(PrefabKind::ELITE_SHIELD), shieldTransform);
+    world.getComponent<ecs::Follower>(shield).parent = parent;
+    world.getComponent<ecs::Shield>(shield).parent = parent;
 
-    // Shield sprite (match BUBBLE animation)
-    ecs::Sprite shieldSprite;
-    shieldSprite.spriteId = ecs::SpriteId::SHIELD_BUBBLE;
-    shieldSprite.width = 24; // bubble.png frame width
-    shieldSprite.height = 24; // bubble.png height
-    shieldSprite.animated = true;
-    shieldSprite.frameCount = 12;
-    shieldSprite.startFrame = 0;
-    shieldSprite.endFrame = 11;
-    shieldSprite.currentFrame = 0;
-    shieldSprite.frameTime = 0.1F;
-    shieldSprite.reverseAnimation = false;
-    shieldSprite.loop = true;
-    shieldSprite.row = 0;
-    shieldSprite.offsetX = 0;
-    world.addComponent(shield, shieldSprite);
-
-    // Networked for replication
-    ecs::Networked net;
-    net.networkId = shield;
-    world.addComponent(shield, net);
-
-    std::cout << "[SpawnSystem] Spawned elite shield for entity " << parent << " (shield=" << shield << ")"
-              << std::endl;
+    RTYPE_LOG_DEBUG("[SpawnSystem] Spawned elite shield for entity " << parent << " (shield=" << shield << ")");
   }
 
   static void handleSpawnEvent(ecs::World &world, const ecs::SpawnEntityEvent &event)
@@ -1074,8 +1276,7 @@ private:
       // NONE type means nothing to spawn (e.g., simple bubble doesn't shoot)
       break;
     case ecs::SpawnEntityEvent::EntityType::ENEMY:
-      std::cerr << "[SpawnSystem] WARNING: SpawnEntityEvent for ENEMY is deprecated, use spawnEnemyFromConfig instead"
-                << std::endl;
+      RTYPE_LOG_WARN("[SpawnSystem] SpawnEntityEvent for ENEMY is deprecated, use spawnEnemyFromConfig instead");
       break;
     case ecs::SpawnEntityEvent::EntityType::PROJECTILE:
       spawnProjectile(world, event.x, event.y, event.spawner);
@@ -1112,147 +1313,36 @@ private:
     // Ignore passed config - always start at phase 1
     (void)config;
 
-    const float projectileVelocity = RUBAN_PROJECTILE_VELOCITY;
-
-    ecs::Entity projectile = world.createEntity();
-
     // Capability-based offset: use GunOffset if entity has it
     float offsetX = 0.0F;
     if (world.hasComponent<ecs::GunOffset>(owner)) {
       offsetX = world.getComponent<ecs::GunOffset>(owner).x * 1.0F;
     }
 
-    ecs::Transform transform;
-    transform.x = posX + offsetX;
     // Adjust Y position to align ruban projectile with regular projectile
     // Regular projectile: 84x37 at scale 1.0 = 84x37 effective size
     // Ruban projectile starts at: 21x49 at scale 3.0 = 63x147 effective size
     // Center vertically: (147 - 37) / 2 = 55 pixels up
-    transform.y = posY - 55.0f;
-    transform.rotation = 0.0F;
-    transform.scale = RUBAN_SCALE;
-    world.addComponent(projectile, transform);
-
-    ecs::Velocity velocity;
-    velocity.dx = projectileVelocity;
-    velocity.dy = 0.0F;
-    world.addComponent(projectile, velocity);
-
-    // Add wave beam pattern for R-Type ribbon effect (oscillating vertically)
-    world.addComponent(projectile, ecs::Pattern{"wave_beam", RUBAN_WAVE_AMPLITUDE, RUBAN_WAVE_FREQUENCY});
-
-    // Start with phase 1 sprite (1ruban_projectile.png: 21x49, 1 frame)
-    ecs::Sprite sprite;
-    sprite.spriteId = ecs::SpriteId::RUBAN1_PROJECTILE;
-    sprite.width = RUBAN_INITIAL_WIDTH;
-    sprite.height = RUBAN_INITIAL_HEIGHT;
-    sprite.animated = false;
-    sprite.frameCount = 1;
-    sprite.loop = false;
-    sprite.startFrame = 0;
-    sprite.endFrame = 0;
-    sprite.currentFrame = 0;
-
-    world.addComponent(projectile, sprite);
-
-    // Collider based on initial phase dimensions (after sprite so it matches visual)
-    world.addComponent(projectile,
-                       ecs::Collider{static_cast<float>(sprite.width) * transform.scale,
-                                     static_cast<float>(sprite.height) * transform.scale});
-
-    // Mark as networked so the snapshot system replicates it to clients.
-    ecs::Networked net;
-    net.networkId = projectile;
-    world.addComponent(projectile, net);
-
-    // Track owner to prevent self-damage
-    ecs::Owner ownerComp;
-    ownerComp.ownerId = owner;
-    world.addComponent(projectile, ownerComp);
+    instantiateProjectile(world, PrefabKind::RUBAN_PROJECTILE, posX + offsetX, posY - 55.0f, owner);
   }
 
   static void spawnTripleProjectile(ecs::World &world, float posX, float posY, ecs::Entity owner)
   {
-    const float projectileVelocity = PROJECTILE_VELOCITY_MULTIPLIER * 1.0F;
-
     // Capability-based offset: use GunOffset if entity has it
     float offsetX = 0.0F;
     if (world.hasComponent<ecs::GunOffset>(owner)) {
       offsetX = world.getComponent<ecs::GunOffset>(owner).x * 1.0F;
     }
 
-    // Three projectile angles: 0° (forward), -50° (up-forward), 50° (down-forward)
-    // Note: In game coords, negative Y = up, positive Y = down
-    constexpr float PI = 3.14159265358979323846F;
-    const std::array<float, 3> angles = {0.0F, -50.0F * PI / 180.0F, 50.0F * PI / 180.0F};
-
-    // Corresponding sprite IDs for each direction
-    const std::array<std::uint32_t, 3> spriteIds = {
-      ecs::SpriteId::TRIPLE_PROJECTILE_RIGHT, // Straight forward
-      ecs::SpriteId::TRIPLE_PROJECTILE_UP, // Up-forward
-      ecs::SpriteId::TRIPLE_PROJECTILE_DOWN // Down-forward
-    };
-
-    for (int i = 0; i < 3; i++) {
-      ecs::Entity projectile = world.createEntity();
-
-      ecs::Transform transform;
-      transform.x = posX + offsetX;
-      transform.y = posY;
-      transform.rotation = 0.0F; // No rotation needed - sprite already oriented correctly
-      transform.scale = 1.0F;
-      world.addComponent(projectile, transform);
-
-      ecs::Velocity velocity;
-      velocity.dx = projectileVelocity * std::cos(angles[i]);
-      velocity.dy = projectileVelocity * std::sin(angles[i]);
-      world.addComponent(projectile, velocity);
-
-      // Sprite for triple projectile - use direction-specific sprite
-      ecs::Sprite sprite;
-      sprite.spriteId = spriteIds[i];
-      sprite.width = PROJECTILE_SPRITE_WIDTH;
-      sprite.height = PROJECTILE_SPRITE_HEIGHT;
-      sprite.animated = false; // Individual images, no animation
-      sprite.frameCount = 1;
-      sprite.loop = false;
-      sprite.startFrame = 0;
-      sprite.endFrame = 0;
-
-      world.addComponent(projectile, sprite);
-
-      // Collider sized to sprite dimensions (scale == 1)
-      world.addComponent(projectile,
-                         ecs::Collider{static_cast<float>(sprite.width) * transform.scale,
-                                       static_cast<float>(sprite.height) * transform.scale});
-
-      // Mark as networked
-      ecs::Networked net;
-      net.networkId = projectile;
-      world.addComponent(projectile, net);
-
-      // Track owner to prevent self-damage
-      ecs::Owner ownerComp;
-      ownerComp.ownerId = owner;
-      world.addComponent(projectile, ownerComp);
+    // Forward, up-forward and down-forward, each with its direction-specific sprite
+    for (const PrefabKind kind :
+         {PrefabKind::TRIPLE_PROJECTILE_RIGHT, PrefabKind::TRIPLE_PROJECTILE_UP, PrefabKind::TRIPLE_PROJECTILE_DOWN}) {
+      instantiateProjectile(world, kind, posX + offsetX, posY, owner);
     }
   }
 
   static void spawnProjectile(ecs::World &world, float posX, float posY, ecs::Entity owner)
   {
-    // Determine direction: prefer requested direction, fall back to owner velocity
-    float directionX = 0.0F;
-    if (std::abs(directionX) < DIRECTION_THRESHOLD && world.hasComponent<ecs::Velocity>(owner)) {
-      directionX = world.getComponent<ecs::Velocity>(owner).dx;
-    }
-    if (std::abs(directionX) < DIRECTION_THRESHOLD) {
-      directionX = 1.0F; // Default to right if nothing else is known
-    }
-
-    const float projectileVelocity = PROJECTILE_VELOCITY_MULTIPLIER * 1.0F;
-
-    ecs::Entity projectile = world.createEntity();
-
     // Capability-based offset: use GunOffset if entity has it (no identity checks).
     // Systems ask "What can this entity do?" not "What kind is it?"
     float offsetX = 0.0F;
@@ -1260,150 +1350,26 @@ private:
       offsetX = world.getComponent<ecs::GunOffset>(owner).x * 1.0F;
     }
 
-    ecs::Transform transform;
-    transform.x = posX + offsetX;
-    transform.y = posY;
-    transform.rotation = 0.0F;
-    transform.scale = 1.0F;
-    world.addComponent(projectile, transform);
-
-    ecs::Velocity velocity;
-    velocity.dx = projectileVelocity;
-    velocity.dy = 0.0F;
-    world.addComponent(projectile, velocity);
-
     // Despawn is handled by LifetimeSystem when projectile leaves the viewport.
-
-    // SERVER ASSIGNS VISUAL IDENTITY AS DATA
-    // Projectile sprite decided at creation, never inferred later
-    ecs::Sprite sprite;
-    sprite.spriteId = ecs::SpriteId::PROJECTILE;
-    sprite.width = PROJECTILE_SPRITE_WIDTH; // 211x92 aspect ratio (422/2 frames, scaled down ~2.5x)
-    sprite.height = PROJECTILE_SPRITE_HEIGHT;
-    sprite.animated = true;
-    sprite.frameCount = 3;
-    sprite.loop = false;
-    sprite.startFrame = 0;
-    sprite.endFrame = 2;
-
-    world.addComponent(projectile, sprite);
-
-    // Collider sized to sprite * transform.scale
-    world.addComponent(projectile,
-                       ecs::Collider{static_cast<float>(sprite.width) * transform.scale,
-                                     static_cast<float>(sprite.height) * transform.scale});
-
-    // Mark as networked so the snapshot system replicates it to clients.
-    ecs::Networked net;
-    net.networkId = projectile;
-    world.addComponent(projectile, net);
-
-    // Track owner to prevent self-damage
-    ecs::Owner ownerComp;
-    ownerComp.ownerId = owner;
-    world.addComponent(projectile, ownerComp);
+    instantiateProjectile(world, PrefabKind::PROJECTILE, posX + offsetX, posY, owner);
   }
 
   static void spawnChargedProjectile(ecs::World &world, float posX, float posY, ecs::Entity owner)
   {
-    float directionX = 0.0F;
-    if (std::abs(directionX) < DIRECTION_THRESHOLD && world.hasComponent<ecs::Velocity>(owner)) {
-      directionX = world.getComponent<ecs::Velocity>(owner).dx;
-    }
-    if (std::abs(directionX) < DIRECTION_THRESHOLD) {
-      directionX = 1.0F;
-    }
-
-    ecs::Entity projectile = world.createEntity();
-
     float offsetX = 0.0F;
     if (world.hasComponent<ecs::GunOffset>(owner)) {
       offsetX = world.getComponent<ecs::GunOffset>(owner).x;
     }
 
-    ecs::Transform transform;
-    transform.x = posX + offsetX;
-    transform.y = posY;
-    transform.rotation = 0.0F;
-    transform.scale = CHARGED_PROJECTILE_SCALE;
-    world.addComponent(projectile, transform);
-
-    ecs::Velocity velocity;
-    velocity.dx = CHARGED_PROJECTILE_VELOCITY * 1.0F;
-    velocity.dy = 0.0F;
-    world.addComponent(projectile, velocity);
-
-    ecs::Sprite sprite;
-    sprite.spriteId = ecs::SpriteId::CHARGED_PROJECTILE;
-    sprite.width = CHARGED_PROJECTILE_SPRITE_WIDTH;
-    sprite.height = CHARGED_PROJECTILE_SPRITE_HEIGHT;
-    sprite.animated = true;
-    sprite.frameCount = 2;
-    sprite.loop = true;
-    sprite.startFrame = 0;
-    sprite.endFrame = 1;
-    world.addComponent(projectile, sprite);
-
-    // Collider sized to sprite * scale
-    world.addComponent(projectile,
-                       ecs::Collider{static_cast<float>(sprite.width) * transform.scale,
-                                     static_cast<float>(sprite.height) * transform.scale});
-
-    ecs::Networked net;
-    net.networkId = projectile;
-    world.addComponent(projectile, net);
-
-    ecs::Owner ownerComp;
-    ownerComp.ownerId = owner;
-    world.addComponent(projectile, ownerComp);
-
-    ecs::Immortal immortalComponent;
-    immortalComponent.isImmortal = true;
-    world.addComponent(projectile, immortalComponent);
+    instantiateProjectile(world, PrefabKind::CHARGED_PROJECTILE, posX + offsetX, posY, owner);
   }
 
   static void spawnLoadingShot(ecs::World &world, float posX, float posY, ecs::Entity owner)
   {
-    ecs::Entity loadingShot = world.createEntity();
-
-    // Transform component
-    ecs::Transform transform;
-    transform.x = posX;
-    transform.y = posY;
-    transform.rotation = 0.0F;
-    transform.scale = LOADING_SHOT_SCALE;
-    world.addComponent(loadingShot, transform);
-
     // Velocity = 0 (l'animation suivra le joueur)
-    ecs::Velocity velocity;
-    velocity.dx = 0.0F;
-    velocity.dy = 0.0F;
-    world.addComponent(loadingShot, velocity);
-
-    // Sprite avec animation de chargement
-    ecs::Sprite sprite;
-    sprite.spriteId = ecs::SpriteId::LOADING_SHOT;
-    sprite.width = LOADING_SHOT_SPRITE_WIDTH;
-    sprite.height = LOADING_SHOT_SPRITE_HEIGHT;
-    sprite.animated = true;
-    sprite.frameCount = 8;
-    sprite.loop = true;
-    sprite.startFrame = 0;
-    sprite.endFrame = 7;
-    sprite.frameTime = LOADING_SHOT_FRAME_TIME; // Animation rapide
-    world.addComponent(loadingShot, sprite);
+    ecs::Entity loadingShot = instantiateProjectile(world, PrefabKind::LOADING_SHOT, posX, posY, owner);
 
-    // Networked component pour la réplication
-    ecs::Networked net;
-    net.networkId = loadingShot;
-    world.addComponent(loadingShot, net);
-
-    // Owner component pour lier au joueur
-    ecs::Owner ownerComp;
-    ownerComp.ownerId = owner;
-    world.addComponent(loadingShot, ownerComp);
-
-    std::cout << "[SpawnSystem] Spawned loading shot " << loadingShot << " for entity " << owner << std::endl;
+    RTYPE_LOG_DEBUG("[SpawnSystem] Spawned loading shot " << loadingShot << " for entity " << owner);
   }
 
   static void spawnPowerup(ecs::World &world, float posX, float posY, PowerupType powerupType = PowerupType::DRONE)
@@ -1473,16 +1439,16 @@ private:
     world.addComponent(powerup, net);
 
     const char *typeNames[] = {"DRONE", "BUBBLE", "BUBBLE_TRIPLE", "BUBBLE_RUBAN"};
-    std::cout << "[SpawnSystem] Spawned " << typeNames[static_cast<int>(powerupType)] << " powerup at (" << posX << ", "
-              << posY << ")\n";
+    RTYPE_LOG_DEBUG("[SpawnSystem] Spawned " << typeNames[static_cast<int>(powerupType)] << " powerup at (" << posX
+                                             << ", " << posY << ")");
   }
 
   static void spawnExplosion(ecs::World &world, float posX, float posY)
   {
-    (void)world;
-    (void)posX;
-    (void)posY;
-    // TODO: Implement explosion effect
+    ecs::Transform transform = *prefab(PrefabKind::EXPLOSION).get<ecs::Transform>();
+    transform.x = posX;
+    transform.y = posY;
+    world.acquire(prefab(PrefabKind::EXPLOSION), transform);
   }
 };
 
@@ -6,9 +6,15 @@
 #include "Game.hpp"
 #include "../../engineCore/include/ecs/EngineComponents.hpp"
 #include "../../engineCore/include/ecs/components/Immortal.hpp"
+#include "../../engineCore/include/utils/Log.hpp"
+#include "../../engineCore/include/utils/Trace.hpp"
+#include "../include/NetworkStatsReporter.hpp"
 #include "../include/TestMode.hpp"
+#include "../include/TickScheduler.hpp"
 #include "../include/config/EnemyConfig.hpp"
 #include "../include/config/LevelConfig.hpp"
+#include "../include/metrics/MetricsServer.hpp"
+#include "../include/metrics/ServerMetrics.hpp"
 #include "systems/AllySystem.hpp"
 #include "systems/ChargeSystem.hpp"
 #include "systems/InvulnerabilitySystem.hpp"
@@ -17,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <thread>
+#include <utility>
 
 /**
  * @brief Constructs the game and initializes all ECS systems
@@ -35,7 +42,9 @@ Game::Game()
   world->registerSystem<server::AllySystem>();
   // Map collision system removed — map collisions are no longer used
   world->registerSystem<ecs::MovementSystem>();
+  world->registerSystem<ecs::SpatialIndexSystem>();
   world->registerSystem<server::CollisionSystem>();
+  world->registerSystem<server::BulletPatternSystem>();
 
   damageSystem = &world->registerSystem<server::DamageSystem>();
   deathSystem = &world->registerSystem<server::DeathSystem>();
@@ -57,6 +66,15 @@ Game::Game()
   // Initialize systems first
   initializeSystems();
 
+  // Runtime tuning (snapshot budget, ...); defaults are kept when missing
+  m_serverConfig.loadFromFile("server/config/server.json");
+
+  m_aiBudget.setPerStep(std::chrono::microseconds(m_serverConfig.ai.budgetUs));
+  server::ai::AISchedule aiSchedule;
+  aiSchedule.decisionRateHz = static_cast<float>(m_serverConfig.ai.decisionRateHz);
+  aiSchedule.budget = &m_aiBudget;
+  m_lobbyManager.setAISchedule(aiSchedule);
+
   // Load enemy configurations AFTER initialization
   m_enemyConfigManager = std::make_shared<server::EnemyConfigManager>();
   if (m_enemyConfigManager->loadFromFile("server/config/enemies.json")) {
@@ -70,9 +88,9 @@ Game::Game()
     std::cerr << "[Game] Warning: Failed to load enemy configurations" << std::endl;
   }
 
-  // Load level configurations
+  // Load level configurations once for every lobby, compiling their spawn timelines
   m_levelConfigManager = std::make_shared<server::LevelConfigManager>();
-  if (m_levelConfigManager->loadFromFile("server/config/levels.json")) {
+  if (m_levelConfigManager->loadFromFile("server/config/levels.json", *m_enemyConfigManager)) {
     spawnSystem->setLevelConfigManager(m_levelConfigManager);
 
     // Pass level config manager to lobby manager
@@ -88,6 +106,22 @@ Game::Game()
     // Fallback to multi-type spawning for testing
     spawnSystem->enableMultipleSpawnTypes({"enemy_blue"});
   }
+
+  if (m_serverConfig.replay.enabled) {
+    server::replay::RecordingOptions recording;
+    recording.enabled = true;
+    recording.directory = m_serverConfig.replay.directory;
+    recording.chunkBytes = static_cast<std::size_t>(m_serverConfig.replay.chunkKb) * 1024;
+    recording.checksumIntervalTicks = static_cast<std::uint64_t>(m_serverConfig.replay.checksumIntervalTicks);
+    // The float the lobbies are stepped with (see runGameLoop), so a replay steps them with the same value
+    const auto step =
+        std::chrono::round<std::chrono::nanoseconds>(std::chrono::duration<double>(1.0 / m_serverConfig.tick.rateHz));
+    recording.stepSeconds = std::chrono::duration<float>(step).count();
+    recording.enemyConfigHash = server::replay::hashFile("server/config/enemies.json");
+    recording.levelConfigHash = server::replay::hashFile("server/config/levels.json");
+    m_lobbyManager.setRecordingOptions(recording);
+    std::cout << "[Game] Recording lobby games to " << recording.directory << std::endl;
+  }
 }
 
 Game::~Game() {}
@@ -167,7 +201,7 @@ void Game::spawnPlayer()
   health.maxHp = startingLives;
   world->addComponent(player, health);
 
-  std::cout << "[Server] Spawning player with " << startingLives << " LIVES" << std::endl;
+  RTYPE_LOG_INFO("[Server] Spawning player with " << startingLives << " LIVES");
 
   ecs::Input input;
   input.up = false;
@@ -195,7 +229,7 @@ void Game::spawnPlayer()
 
   if (TestMode::ENABLE_IMMORTAL_MODE) {
     world->addComponent(player, ecs::Immortal{true});
-    std::cout << "[Server] ✓ IMMORTAL MODE: Player is invincible!" << std::endl;
+    RTYPE_LOG_INFO("[Server] ✓ IMMORTAL MODE: Player is invincible!");
   }
 }
 
@@ -246,8 +280,7 @@ void Game::spawnPlayer(std::uint32_t networkId)
   health.maxHp = startingLives;
   world->addComponent(player, health);
 
-  std::cout << "[Server] Spawning player with networkId " << networkId << " with " << startingLives << " LIVES"
-            << std::endl;
+  RTYPE_LOG_INFO("[Server] Spawning player with networkId " << networkId << " with " << startingLives << " LIVES");
 
   ecs::Input input;
   input.up = false;
@@ -281,10 +314,10 @@ void Game::spawnPlayer(std::uint32_t networkId)
 
   if (TestMode::ENABLE_IMMORTAL_MODE) {
     world->addComponent(player, ecs::Immortal{true});
-    std::cout << "[Server] ✓ IMMORTAL MODE: Player is invincible!" << std::endl;
+    RTYPE_LOG_INFO("[Server] ✓ IMMORTAL MODE: Player is invincible!");
   }
 
-  std::cout << "[Server] Spawned player entity " << player << " for client " << networkId << '\n';
+  RTYPE_LOG_INFO("[Server] Spawned player entity " << player << " for client " << networkId);
 }
 
 /**
@@ -311,53 +344,171 @@ void Game::setNetworkManager(const std::shared_ptr<INetworkManager> &networkMana
 
   if (m_networkSendSystem != nullptr) {
     m_networkSendSystem->setLobbyManager(&m_lobbyManager);
+    m_networkSendSystem->setReplicationConfig(m_serverConfig.replication);
   }
   // Give the lobby manager access to the network manager so lobbies can send direct messages
   m_lobbyManager.setNetworkManager(m_networkManager);
+
+  if (m_serverConfig.network.statsIntervalMs > 0) {
+    m_statsReporter = std::make_unique<server::NetworkStatsReporter>(
+      std::chrono::milliseconds(m_serverConfig.network.statsIntervalMs));
+  }
+
+  if (m_serverConfig.metrics.enabled && !m_metrics) {
+    m_metrics = std::make_unique<server::ServerMetrics>();
+    try {
+      // The listener thread reads the network counters itself at scrape time
+      m_metricsServer = std::make_unique<server::MetricsServer>(
+        m_serverConfig.metrics.port, [metrics = m_metrics.get(), network = m_networkManager]() {
+          return metrics->render(network->getNetworkStats());
+        });
+      m_metricsServer->start();
+    } catch (const std::exception &e) {
+      std::cerr << "[Metrics] Cannot listen on port " << m_serverConfig.metrics.port << ": " << e.what() << std::endl;
+      m_metricsServer.reset();
+    }
+    if (m_networkSendSystem != nullptr) {
+      m_networkSendSystem->setMetrics(m_metrics.get());
+    }
+  }
 }
 
 void Game::runGameLoop()
 {
   running = true;
-  nextTick = std::chrono::steady_clock::now();
+  const auto &tickSettings = m_serverConfig.tick;
+  const int maxCatchUpSteps = tickSettings.maxCatchUpSteps;
+  // Nanosecond steps keep fractional rates: 60 Hz is 16666666 ns, not 16 ms (62.5 Hz)
+  m_tickStep = std::chrono::round<std::chrono::nanoseconds>(std::chrono::duration<double>(1.0 / tickSettings.rateHz));
+  const float stepSeconds = std::chrono::duration<float>(m_tickStep).count();
+  const server::TickScheduler scheduler(std::chrono::microseconds(tickSettings.spinUs));
+  if (tickSettings.pinCore >= 0) {
+    if (server::TickScheduler::pinCurrentThread(tickSettings.pinCore)) {
+      std::cout << "[Game] Game thread pinned to core " << tickSettings.pinCore << std::endl;
+    } else {
+      std::cerr << "[Game] Cannot pin the game thread to core " << tickSettings.pinCore << std::endl;
+    }
+  }
+  std::chrono::nanoseconds accumulator{0};
   auto lastUpdateTime = std::chrono::steady_clock::now();
+  nextTick = lastUpdateTime + m_tickStep;
+  RTYPE_TRACE_THREAD("game");
+  std::cout << "[Game] Simulation step " << tickSettings.rateHz << " Hz, up to " << maxCatchUpSteps
+            << " steps per frame" << std::endl;
 
   while (running) {
-    currentTime = std::chrono::steady_clock::now();
-
-    if (currentTime < nextTick) {
-      std::this_thread::sleep_for(nextTick - currentTime);
-      continue;
+    // Outside the tick scope: writing the trace must not show up as a slow tick
+    RTYPE_TRACE_POLL_DUMP("rtype_server_trace.json");
+    currentTime = scheduler.waitUntil(nextTick);
+    if (m_metrics) {
+      m_metrics->observeTickJitter(std::chrono::duration<double>(currentTime - nextTick).count());
     }
+    RTYPE_TRACE_SCOPE("Game::tick");
 
-    auto deltaTimeDuration = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastUpdateTime);
-    float deltaTime = static_cast<float>(deltaTimeDuration.count()) / GameConfig::MICROSECONDS_TO_SECONDS;
+    const auto frameTime = currentTime - lastUpdateTime;
+    accumulator += std::chrono::duration_cast<std::chrono::nanoseconds>(frameTime);
     lastUpdateTime = currentTime;
 
     // Always process incoming network messages (uses main world for system registration,
     // but routes to lobby worlds internally)
     if (m_networkReceiveSystem != nullptr) {
-      m_networkReceiveSystem->update(*world, deltaTime);
+      RTYPE_TRACE_SCOPE("Game::receive");
+      m_networkReceiveSystem->update(*world, std::chrono::duration<float>(frameTime).count());
     }
 
-    // Update each active lobby's game world independently
-    for (const auto &[code, lobby] : m_lobbyManager.getLobbies()) {
-      if (lobby && lobby->isGameStarted() && !lobby->isEmpty()) {
-        // Update this lobby's isolated world
-        lobby->update(deltaTime);
+    // Advance every active lobby by whole fixed steps, so a simulation never
+    // depends on how late the thread woke up
+    int steps = 0;
+    while (accumulator >= m_tickStep && steps < maxCatchUpSteps) {
+      RTYPE_TRACE_SCOPE("Game::step");
+      m_aiBudget.beginStep();
+      for (const auto &[code, lobby] : m_lobbyManager.getLobbies()) {
+        if (lobby && lobby->isGameStarted() && !lobby->isEmpty()) {
+          lobby->update(stepSeconds);
+        }
       }
+      accumulator -= m_tickStep;
+      ++steps;
+    }
+
+    // Past the catch-up limit the backlog is dropped: the lobbies run slower
+    // than wall time for a moment instead of spiralling further behind
+    if (accumulator >= m_tickStep) {
+      const auto dropped = accumulator / m_tickStep;
+      accumulator -= dropped * m_tickStep;
+      RTYPE_LOG_EVERY(::logging::Level::WARN, 5.0,
+                      "[Game] Simulation behind by " << dropped << " steps after running " << steps
+                                                     << " this frame, dropping them");
+      if (m_metrics) {
+        m_metrics->countDroppedSteps(static_cast<std::uint64_t>(dropped));
+      }
+    }
+    if (m_metrics && steps > 1) {
+      m_metrics->countCatchUpSteps(static_cast<std::uint64_t>(steps - 1));
     }
 
     // Send snapshots for each lobby (NetworkSendSystem now handles per-lobby sending)
     if (m_networkSendSystem != nullptr) {
-      m_networkSendSystem->update(*world, deltaTime);
+      m_networkSendSystem->update(*world, stepSeconds * static_cast<float>(steps));
+    }
+
+    // Put everything queued this tick on the wire (aggregated per client)
+    if (m_networkManager) {
+      RTYPE_TRACE_SCOPE("Game::flush");
+      m_networkManager->flush();
+      if (m_statsReporter) {
+        m_statsReporter->update(*m_networkManager, m_lobbyManager, currentTime);
+      }
     }
 
     // Clean up empty lobbies at end of frame (safe after all systems updated)
     m_lobbyManager.cleanupEmptyLobbies();
 
-    nextTick += tickRate;
+    if (m_metrics) {
+      updateMetrics(currentTime);
+    }
+
+    // Wake up on the next step boundary; the leftover accumulator is time already past it
+    nextTick = currentTime + (m_tickStep - accumulator);
+  }
+  RTYPE_TRACE_DUMP("rtype_server_trace.json");
+}
+
+void Game::updateMetrics(std::chrono::steady_clock::time_point tickStart)
+{
+  const auto now = std::chrono::steady_clock::now();
+  const auto workTime = now - tickStart;
+  m_metrics->observeTick(std::chrono::duration<double>(workTime).count());
+  if (workTime > m_tickStep) {
+    m_metrics->countOverrun(std::chrono::duration<double>(workTime - m_tickStep).count());
+  }
+  m_metrics->setLobbyCount(m_lobbyManager.getLobbies().size());
+  m_metrics->setAIDecisions(m_aiBudget.getDecisions(), m_aiBudget.getDeferred(),
+                            std::chrono::duration<double>(m_aiBudget.getTotalTime()).count());
+
+  // The per-lobby table is the only part published under a lock: once per second
+  if (now - m_lastLobbyMetrics < std::chrono::seconds(1)) {
+    return;
+  }
+  m_lastLobbyMetrics = now;
+  std::vector<server::ServerMetrics::LobbySample> lobbies;
+  for (const auto &[code, lobby] : m_lobbyManager.getLobbies()) {
+    if (!lobby || !lobby->isGameStarted()) {
+      continue;
+    }
+    const auto lobbyWorld = lobby->getWorld();
+    server::ServerMetrics::LobbySample sample{code, 0, lobby->getClients().size()};
+    if (lobbyWorld) {
+      const auto &stats = lobbyWorld->getEntityStats();
+      sample.entities = lobbyWorld->getEntityCount();
+      sample.entitiesCreated = stats.created;
+      sample.entitiesDestroyed = stats.destroyed;
+      sample.entitiesReused = stats.reused;
+      sample.entitiesParked = stats.parked;
+    }
+    lobbies.push_back(std::move(sample));
   }
+  m_metrics->publishLobbies(std::move(lobbies));
 }
 
 /**
@@ -6,6 +6,7 @@
 #include "Lobby.hpp"
 #include "../../engineCore/include/ecs/EngineComponents.hpp"
 #include "../../engineCore/include/ecs/components/Immortal.hpp"
+#include "../../engineCore/include/utils/Trace.hpp"
 #include "../../network/include/INetworkManager.hpp"
 #include "../include/Game.hpp"
 #include "../include/ServerSystems.hpp"
@@ -13,8 +14,11 @@
 #include "../include/config/EnemyConfig.hpp"
 #include "WorldLobbyRegistry.hpp"
 #include "systems/InvulnerabilitySystem.hpp"
+#include <algorithm>
 #include <iostream>
 #include <nlohmann/json.hpp>
+#include <random>
+#include <vector>
 
 Lobby::Lobby(const std::string &code, std::shared_ptr<INetworkManager> networkManager, bool isSolo,
              AIDifficulty aiDifficulty, GameMode mode)
@@ -75,6 +79,9 @@ bool Lobby::addClient(std::uint32_t clientId, bool asSpectator)
       std::cout << "[Lobby:" << m_code << "] Player " << clientId << " joined (" << m_clients.size() << " total)"
                 << '\n';
     }
+    if (m_gameStarted && m_world) {
+      m_recorder.recordJoin(m_world->getTick(), clientId, asSpectator);
+    }
   }
   return inserted;
 }
@@ -97,6 +104,10 @@ std::string Lobby::getClientName(std::uint32_t clientId) const
 
 bool Lobby::removeClient(std::uint32_t clientId)
 {
+  if (m_gameStarted && m_world && hasClient(clientId)) {
+    m_recorder.recordLeave(m_world->getTick(), clientId);
+  }
+
   // Destroy the player entity if it exists (spectators don't have entities)
   destroyPlayerEntity(clientId);
 
@@ -147,19 +158,30 @@ bool Lobby::isSpectator(std::uint32_t clientId) const
 }
 
 void Lobby::startGame()
+{
+  std::random_device device;
+  startGame((static_cast<std::uint64_t>(device()) << 32) | device());
+}
+
+void Lobby::startGame(std::uint64_t seed)
 {
   if (m_gameStarted) {
     return;
   }
 
   m_gameStarted = true;
+  m_world->seedRandom(seed);
 
   // Initialize systems for this lobby's world
   initializeSystems();
 
+  // Spawn in client id order: entity ids must not depend on the hash set layout for a replay
+  std::vector<std::uint32_t> clients(m_clients.begin(), m_clients.end());
+  std::sort(clients.begin(), clients.end());
+
   // Spawn player entities only for non-spectator clients
   int playerCount = 0;
-  for (std::uint32_t clientId : m_clients) {
+  for (std::uint32_t clientId : clients) {
     if (!isSpectator(clientId)) {
       spawnPlayer(clientId);
       playerCount++;
@@ -173,6 +195,26 @@ void Lobby::startGame()
 
   std::cout << "[Lobby:" << m_code << "] Game started with " << playerCount << " players" << (m_isSolo ? " + ally" : "")
             << " and " << m_spectators.size() << " spectators" << '\n';
+
+  if (m_recordingOptions.enabled) {
+    server::replay::SessionInfo session;
+    session.lobbyCode = m_code;
+    session.seed = seed;
+    session.stepSeconds = m_recordingOptions.stepSeconds;
+    session.difficulty = static_cast<std::uint8_t>(m_difficulty);
+    session.gameMode = static_cast<std::uint8_t>(m_gameMode);
+    session.aiDifficulty = static_cast<std::uint8_t>(m_aiDifficulty);
+    session.solo = m_isSolo;
+    session.enemyConfigHash = m_recordingOptions.enemyConfigHash;
+    session.levelConfigHash = m_recordingOptions.levelConfigHash;
+    session.aiDecisionRateHz = m_aiSchedule.decisionRateHz;
+    for (std::uint32_t clientId : clients) {
+      session.players.push_back({clientId, isSpectator(clientId)});
+    }
+    if (!m_recorder.start(m_recordingOptions, session)) {
+      std::cerr << "[Lobby:" << m_code << "] Could not start replay recording" << '\n';
+    }
+  }
 }
 
 void Lobby::stopGame()
@@ -184,6 +226,7 @@ void Lobby::stopGame()
   std::cout << "[Lobby:" << m_code << "] Stopping game..." << '\n';
 
   m_gameStarted = false;
+  m_recorder.stop(m_world ? m_world->getTick() : 0);
 
   if (!m_world) {
     m_playerEntities.clear();
@@ -231,18 +274,88 @@ std::shared_ptr<ecs::World> Lobby::getWorld() const
 
 void Lobby::update(float deltaTime)
 {
+  RTYPE_TRACE_SCOPE_DETAIL("Lobby::update", m_code);
   if (m_gameStarted && m_world) {
     m_world->update(deltaTime);
+    if (m_recorder.isRecording()) {
+      m_recorder.afterStep(*m_world);
+    }
+  }
+}
+
+void Lobby::applyInput(std::uint32_t clientId, const ecs::Input &input)
+{
+  if (!m_gameStarted || !m_world) {
+    return;
+  }
+  const std::optional<ecs::Entity> player = getPlayerEntity(clientId);
+  if (!player || !m_world->isAlive(*player) || !m_world->hasComponent<ecs::Input>(*player)) {
+    return;
+  }
+  const ecs::Entity entity = *player;
+  auto &current = m_world->getComponent<ecs::Input>(entity);
+  if (server::replay::packInput(current) == server::replay::packInput(input)) {
+    return;
+  }
+  server::replay::unpackInput(server::replay::packInput(input), current);
+  m_recorder.recordInput(m_world->getTick(), clientId, input);
+}
+
+void Lobby::applyViewport(std::uint32_t clientId, std::uint32_t width, std::uint32_t height)
+{
+  if (!m_gameStarted || !m_world) {
+    return;
+  }
+  const std::optional<ecs::Entity> player = getPlayerEntity(clientId);
+  if (!player || !m_world->isAlive(*player)) {
+    return;
+  }
+  const ecs::Entity entity = *player;
+  if (!m_world->hasComponent<ecs::Viewport>(entity)) {
+    m_world->addComponent(entity, ecs::Viewport{.width = width, .height = height});
+  } else {
+    auto &viewport = m_world->getComponent<ecs::Viewport>(entity);
+    if (viewport.width == width && viewport.height == height) {
+      return;
+    }
+    viewport.width = width;
+    viewport.height = height;
+  }
+  m_recorder.recordViewport(m_world->getTick(), clientId, width, height);
+}
+
+void Lobby::setSpectator(std::uint32_t clientId, bool spectator)
+{
+  if (!hasClient(clientId) || isSpectator(clientId) == spectator) {
+    return;
+  }
+  if (m_gameStarted && m_world) {
+    m_recorder.recordSpectator(m_world->getTick(), clientId, spectator);
+  }
+  if (spectator) {
+    convertToSpectator(clientId);
+  } else {
+    convertToPlayer(clientId);
   }
 }
 
-ecs::Entity Lobby::getPlayerEntity(std::uint32_t clientId) const
+void Lobby::setRecordingOptions(const server::replay::RecordingOptions &options)
+{
+  m_recordingOptions = options;
+}
+
+void Lobby::setAISchedule(const server::ai::AISchedule &schedule)
+{
+  m_aiSchedule = schedule;
+}
+
+std::optional<ecs::Entity> Lobby::getPlayerEntity(std::uint32_t clientId) const
 {
   auto player_entity_it = m_playerEntities.find(clientId);
   if (player_entity_it != m_playerEntities.end()) {
     return player_entity_it->second;
   }
-  return 0;
+  return std::nullopt;
 }
 
 void Lobby::initializeSystems()
@@ -255,10 +368,15 @@ void Lobby::initializeSystems()
   m_world->registerSystem<server::InputMovementSystem>();
   m_world->registerSystem<server::LevelProgressSystem>();
   m_world->registerSystem<server::EnemyAISystem>();
-  m_world->registerSystem<server::AllySystem>();
+  // Deferring a decision depends on wall time, which a replay cannot reproduce
+  server::ai::AISchedule aiSchedule = m_aiSchedule;
+  aiSchedule.deferrable = aiSchedule.deferrable && !m_recordingOptions.enabled;
+  m_world->registerSystem<server::AllySystem>().setSchedule(aiSchedule);
   // Map collision system disabled for now
   m_world->registerSystem<ecs::MovementSystem>();
+  m_world->registerSystem<ecs::SpatialIndexSystem>();
   m_world->registerSystem<server::CollisionSystem>();
+  m_world->registerSystem<server::BulletPatternSystem>();
 
   auto *damageSystem = &m_world->registerSystem<server::DamageSystem>();
   auto *deathSystem = &m_world->registerSystem<server::DeathSystem>();
@@ -33,6 +33,8 @@ bool LobbyManager::createLobby(const std::string &code, GameConfig::Difficulty d
   // Set the difficulty before the game starts
   m_lobbies[code]->setDifficulty(difficulty);
   m_lobbies[code]->setGameMode(mode);
+  m_lobbies[code]->setRecordingOptions(m_recordingOptions);
+  m_lobbies[code]->setAISchedule(m_aiSchedule);
 
   // Let the lobby know its manager for callbacks
   m_lobbies[code]->setManager(this);
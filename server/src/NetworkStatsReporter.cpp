@@ -0,0 +1,118 @@
+/**
+ * @file NetworkStatsReporter.cpp
+ * @brief Periodic machine-readable dump of the network counters.
+ */
+
+#include "NetworkStatsReporter.hpp"
+#include "../../network/include/INetworkManager.hpp"
+#include "Lobby.hpp"
+#include "LobbyManager.hpp"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <utility>
+
+namespace server
+{
+namespace
+{
+struct LobbyTotals {
+  std::size_t clients = 0;
+  std::uint64_t bytesIn = 0;
+  std::uint64_t bytesOut = 0;
+  float rttSum = 0.0f;
+  int rttCount = 0;
+};
+
+double perSecond(std::uint64_t current, std::uint64_t previous, double seconds)
+{
+  // Counters restart from zero for a client id reused by a new connection
+  return current >= previous ? static_cast<double>(current - previous) / seconds : 0.0;
+}
+} // namespace
+
+NetworkStatsReporter::NetworkStatsReporter(std::chrono::milliseconds interval) : m_interval(interval) {}
+
+void NetworkStatsReporter::update(const INetworkManager &network, const LobbyManager &lobbies, Clock::time_point now)
+{
+  if (!m_started) {
+    // First call only takes the baseline, the rates need two samples
+    m_started = true;
+    m_lastReport = now;
+    buildReport(network.getNetworkStats(), lobbies, 1.0);
+    return;
+  }
+  if (now - m_lastReport < m_interval) {
+    return;
+  }
+  const double seconds = std::chrono::duration<double>(now - m_lastReport).count();
+  m_lastReport = now;
+  std::cout << "[NetStats] " << buildReport(network.getNetworkStats(), lobbies, seconds).dump() << '\n';
+}
+
+nlohmann::json NetworkStatsReporter::buildReport(const NetworkStats &stats, const LobbyManager &lobbies,
+                                                 double seconds)
+{
+  std::unordered_map<std::uint32_t, std::string> clientLobbies;
+  for (const auto &[code, lobby] : lobbies.getLobbies()) {
+    if (!lobby) {
+      continue;
+    }
+    for (const std::uint32_t clientId : lobby->getClients()) {
+      clientLobbies[clientId] = code;
+    }
+  }
+
+  nlohmann::json report;
+  report["interval_s"] = seconds;
+  report["totals"] = toJson(stats.traffic);
+  report["incoming_queue"] = stats.incomingQueueDepth;
+  report["dropped_in"] = stats.droppedIn;
+  report["rates"] = {{"pkts_in_s", perSecond(stats.traffic.packetsIn, m_lastTotals.packetsIn, seconds)},
+                     {"pkts_out_s", perSecond(stats.traffic.packetsOut, m_lastTotals.packetsOut, seconds)},
+                     {"bytes_in_s", perSecond(stats.traffic.bytesIn, m_lastTotals.bytesIn, seconds)},
+                     {"bytes_out_s", perSecond(stats.traffic.bytesOut, m_lastTotals.bytesOut, seconds)}};
+  m_lastTotals = stats.traffic;
+
+  std::unordered_map<std::string, LobbyTotals> lobbyTotals;
+  std::unordered_map<std::uint32_t, TrafficStats> clients;
+  nlohmann::json connections = nlohmann::json::array();
+  for (const auto &connection : stats.connections) {
+    const TrafficStats &previous = m_lastClients[connection.clientId];
+    nlohmann::json entry = toJson(connection);
+    entry["bytes_in_s"] = perSecond(connection.traffic.bytesIn, previous.bytesIn, seconds);
+    entry["bytes_out_s"] = perSecond(connection.traffic.bytesOut, previous.bytesOut, seconds);
+
+    auto lobbyIt = clientLobbies.find(connection.clientId);
+    if (lobbyIt != clientLobbies.end()) {
+      entry["lobby"] = lobbyIt->second;
+      LobbyTotals &totals = lobbyTotals[lobbyIt->second];
+      ++totals.clients;
+      totals.bytesIn += connection.traffic.bytesIn - std::min(connection.traffic.bytesIn, previous.bytesIn);
+      totals.bytesOut += connection.traffic.bytesOut - std::min(connection.traffic.bytesOut, previous.bytesOut);
+      if (connection.rttMs >= 0.0f) {
+        totals.rttSum += connection.rttMs;
+        ++totals.rttCount;
+      }
+    }
+    clients[connection.clientId] = connection.traffic;
+    connections.push_back(std::move(entry));
+  }
+  m_lastClients = std::move(clients);
+
+  nlohmann::json lobbyEntries = nlohmann::json::array();
+  for (const auto &[code, totals] : lobbyTotals) {
+    lobbyEntries.push_back({{"code", code},
+                            {"clients", totals.clients},
+                            {"bytes_in_s", static_cast<double>(totals.bytesIn) / seconds},
+                            {"bytes_out_s", static_cast<double>(totals.bytesOut) / seconds},
+                            {"rtt_ms", totals.rttCount > 0 ? totals.rttSum / static_cast<float>(totals.rttCount)
+                                                           : -1.0f}});
+  }
+  report["clients"] = stats.connections.size();
+  report["lobbies"] = std::move(lobbyEntries);
+  report["connections"] = std::move(connections);
+  return report;
+}
+
+} // namespace server
@@ -36,7 +36,7 @@ void Server::loop()
   while (g_running) {
     NetworkPacket msg;
     if (m_networkManager->poll(msg)) {
-      auto data = m_networkManager->getPacketHandler()->deserialize(msg.getData(), msg.getBytesTransferred());
+      auto data = m_networkManager->getPacketHandler()->deserialize(msg.getPayload());
       if (!data.has_value()) {
         std::cout << "Failed to deserialize incoming packet." << std::endl;
         continue;
@@ -46,6 +46,7 @@ void Server::loop()
     auto serialized = m_networkManager->getPacketHandler()->serialize("PONG");
     m_networkManager->send(
       std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()), 0);
+    m_networkManager->flush();
     std::this_thread::sleep_for(std::chrono::milliseconds(TICK_RATE_MS));
   }
 }
@@ -0,0 +1,78 @@
+/**
+ * @file TickScheduler.cpp
+ * @brief Precise wake-ups on the game loop tick deadlines.
+ */
+
+#include "TickScheduler.hpp"
+#include <cerrno>
+#include <thread>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+namespace server
+{
+namespace
+{
+void cpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+void sleepUntil(TickScheduler::Clock::time_point wakeTime)
+{
+#if defined(__linux__)
+  // libstdc++ and libc++ build steady_clock on CLOCK_MONOTONIC, so its epoch is the same
+  const auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeTime.time_since_epoch());
+  timespec target{};
+  target.tv_sec = static_cast<time_t>(sinceEpoch.count() / 1'000'000'000);
+  target.tv_nsec = static_cast<long>(sinceEpoch.count() % 1'000'000'000);
+  // Restarting with the same absolute target after a signal cannot drift
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {
+  }
+#else
+  std::this_thread::sleep_until(wakeTime);
+#endif
+}
+} // namespace
+
+TickScheduler::TickScheduler(std::chrono::nanoseconds spin) : m_spin(spin) {}
+
+TickScheduler::Clock::time_point TickScheduler::waitUntil(Clock::time_point deadline) const
+{
+  auto now = Clock::now();
+  if (now >= deadline) {
+    return now;
+  }
+  if (deadline - now > m_spin) {
+    sleepUntil(deadline - m_spin);
+  }
+  for (now = Clock::now(); now < deadline; now = Clock::now()) {
+    cpuRelax();
+  }
+  return now;
+}
+
+bool TickScheduler::pinCurrentThread(int core)
+{
+#if defined(__linux__)
+  if (core < 0 || core >= CPU_SETSIZE || static_cast<unsigned>(core) >= std::thread::hardware_concurrency()) {
+    return false;
+  }
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(core, &cpus);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  (void)core;
+  return false;
+#endif
+}
+
+} // namespace server
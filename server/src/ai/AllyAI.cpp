@@ -7,40 +7,67 @@
 
 #include "../../include/ai/AllyAI.hpp"
 #include "../../../engineCore/include/ecs/components/Ally.hpp"
-#include "../../../engineCore/include/ecs/components/PlayerId.hpp"
 #include "../../../engineCore/include/ecs/components/Transform.hpp"
 #include "../../../engineCore/include/ecs/components/Velocity.hpp"
 #include "../../include/ai/AllyAIUtility.hpp"
 #include "../../include/ai/AllyBehavior.hpp"
 #include "../../include/ai/AllyPerception.hpp"
-#include "ecs/ComponentSignature.hpp"
+#include <algorithm>
 
 namespace server::ai
 {
 
 AllyAI::AllyAI(AIStrength strength) : m_strength(strength) {}
 
-void AllyAI::update(ecs::World &world, ecs::Entity allyEntity, float deltaTime)
+bool AllyAI::canDrive(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity)
 {
-  // Validate entity
-  if (!world.isAlive(allyEntity) || !utility::isEntityValid(world, allyEntity)) {
+  return world.isAlive(allyEntity) && utility::isEntityValid(world, allyEntity) && world.isAlive(playerEntity) &&
+         world.hasComponent<ecs::Transform>(playerEntity);
+}
+
+void AllyAI::update(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float deltaTime)
+{
+  decide(world, allyEntity, playerEntity, deltaTime, 0.0f);
+  steer(world, allyEntity, playerEntity, deltaTime);
+}
+
+void AllyAI::decide(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float elapsed,
+                    float blendTime)
+{
+  // Validate entities
+  if (!canDrive(world, allyEntity, playerEntity)) {
     return;
   }
 
-  // Only process in solo mode (single player)
-  std::vector<ecs::Entity> players;
-  ecs::ComponentSignature playerSig;
-  playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-  world.getEntitiesWithSignature(playerSig, players);
+  // The behaviors write the velocity they want; keep it as the target and restore the current one
+  auto &allyVelocity = world.getComponent<ecs::Velocity>(allyEntity);
+  m_fromDx = allyVelocity.dx;
+  m_fromDy = allyVelocity.dy;
+  updateBehaviors(world, allyEntity, playerEntity, elapsed);
+  m_toDx = allyVelocity.dx;
+  m_toDy = allyVelocity.dy;
+  allyVelocity.dx = m_fromDx;
+  allyVelocity.dy = m_fromDy;
+
+  m_blendTime = blendTime;
+  m_blendElapsed = 0.0f;
+  m_hasDecision = true;
+}
 
-  if (players.size() != 1) {
-    return; // Not solo mode
+void AllyAI::steer(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float deltaTime)
+{
+  if (!m_hasDecision || !canDrive(world, allyEntity, playerEntity)) {
+    return;
   }
 
-  ecs::Entity playerEntity = players[0];
+  auto &allyVelocity = world.getComponent<ecs::Velocity>(allyEntity);
+  m_blendElapsed += deltaTime;
+  const float blend = m_blendTime > 0.0f ? std::min(1.0f, m_blendElapsed / m_blendTime) : 1.0f;
+  allyVelocity.dx = m_fromDx + (m_toDx - m_fromDx) * blend;
+  allyVelocity.dy = m_fromDy + (m_toDy - m_fromDy) * blend;
 
-  // Perform all AI updates
-  updateBehaviors(world, allyEntity, deltaTime);
+  // STEP 5: Update animation based on final velocity
+  m_animation.update(world, allyEntity, allyVelocity);
 
   // Apply viewport constraints at the end
   perception::ViewportConstraint::constrainToViewport(world, allyEntity, playerEntity);
@@ -51,25 +78,16 @@ void AllyAI::reset()
   m_movement.reset();
   m_shooting.reset();
   m_avoidance.reset();
+  m_blendTime = 0.0f;
+  m_blendElapsed = 0.0f;
+  m_hasDecision = false;
 }
 
-void AllyAI::updateBehaviors(ecs::World &world, ecs::Entity allyEntity, float deltaTime)
+void AllyAI::updateBehaviors(ecs::World &world, ecs::Entity allyEntity, ecs::Entity playerEntity, float deltaTime)
 {
   // Get ally's current state
   auto &allyTransform = world.getComponent<ecs::Transform>(allyEntity);
   auto &allyVelocity = world.getComponent<ecs::Velocity>(allyEntity);
-
-  // Find player for reference
-  std::vector<ecs::Entity> players;
-  ecs::ComponentSignature playerSig;
-  playerSig.set(ecs::getComponentId<ecs::PlayerId>());
-  world.getEntitiesWithSignature(playerSig, players);
-
-  if (players.empty()) {
-    return;
-  }
-
-  ecs::Entity playerEntity = players[0];
   auto &playerTransform = world.getComponent<ecs::Transform>(playerEntity);
 
   // STEP 1: Detect nearest enemy
@@ -81,7 +99,7 @@ void AllyAI::updateBehaviors(ecs::World &world, ecs::Entity allyEntity, float de
     (targetEntity != 0) ? world.getComponent<ecs::Transform>(targetEntity) : playerTransform;
 
   // STEP 2: Update movement toward target
-  m_movement.update(deltaTime, allyVelocity, allyTransform, targetTransform, m_strength);
+  m_movement.update(deltaTime, allyVelocity, allyTransform, targetTransform, m_strength, world.getRandom());
 
   // STEP 3: Update shooting (only if enemy detected)
   if (targetEntity != 0) {
@@ -90,9 +108,6 @@ void AllyAI::updateBehaviors(ecs::World &world, ecs::Entity allyEntity, float de
 
   // STEP 4: Apply obstacle avoidance (highest priority)
   m_avoidance.update(world, allyEntity, allyVelocity, allyTransform);
-
-  // STEP 5: Update animation based on final velocity
-  m_animation.update(world, allyEntity, allyVelocity);
 }
 
 } // namespace server::ai
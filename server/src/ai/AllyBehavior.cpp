@@ -6,6 +6,7 @@
 */
 
 #include "../../include/ai/AllyBehavior.hpp"
+#include "../../../engineCore/include/ecs/SpatialIndex.hpp"
 #include "../../../engineCore/include/ecs/components/Charging.hpp"
 #include "../../../engineCore/include/ecs/components/Follower.hpp"
 #include "../../../engineCore/include/ecs/components/Owner.hpp"
@@ -16,6 +17,8 @@
 #include "../../include/ai/AllyAIUtility.hpp"
 #include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <vector>
 
 namespace server::ai::behavior
 {
@@ -30,10 +33,10 @@ MovementBehavior::MovementBehavior()
 }
 
 void MovementBehavior::update(float deltaTime, ecs::Velocity &allyVelocity, const ecs::Transform &allyTransform,
-                              const ecs::Transform &targetTransform, AIStrength strength)
+                              const ecs::Transform &targetTransform, AIStrength strength, std::mt19937 &rng)
 {
   // Update idle state (only for weak AI)
-  updateIdleState(deltaTime, strength);
+  updateIdleState(deltaTime, strength, rng);
 
   // If idling, set velocities to zero but still allow obstacle avoidance to override
   if (m_isIdling) {
@@ -49,7 +52,7 @@ void MovementBehavior::update(float deltaTime, ecs::Velocity &allyVelocity, cons
 
   // Update horizontal movement (changes direction periodically)
   if (m_horizontalTimer >= utility::HORIZONTAL_CHANGE_INTERVAL) {
-    updateHorizontalDirection();
+    updateHorizontalDirection(rng);
     m_horizontalTimer = 0.0f;
   }
 
@@ -66,10 +69,10 @@ void MovementBehavior::reset()
   m_isIdling = false;
 }
 
-void MovementBehavior::updateHorizontalDirection()
+void MovementBehavior::updateHorizontalDirection(std::mt19937 &rng)
 {
   // Pick random direction: -1 (left), 0 (still), or 1 (right)
-  int randomChoice = rand() % 3;
+  int randomChoice = std::uniform_int_distribution<int>(0, 2)(rng);
   switch (randomChoice) {
   case 0:
     m_currentXDirection = -1.0f; // Move left
@@ -132,7 +135,7 @@ float MovementBehavior::calculateHorizontalVelocity(AIStrength strength)
   return m_currentXDirection * baseSpeed;
 }
 
-void MovementBehavior::updateIdleState(float deltaTime, AIStrength strength)
+void MovementBehavior::updateIdleState(float deltaTime, AIStrength strength, std::mt19937 &rng)
 {
   // Only weak AI has idle behavior
   if (strength != AIStrength::WEAK) {
@@ -153,19 +156,19 @@ void MovementBehavior::updateIdleState(float deltaTime, AIStrength strength)
     if (m_idleCheckTimer >= 3.0f) {
       m_idleCheckTimer = 0.0f; // Reset timer
       // 30% chance to enter idle state
-      float randomValue = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+      float randomValue = std::uniform_real_distribution<float>(0.0f, 1.0f)(rng);
       if (randomValue < 0.3f) {
         m_isIdling = true;
-        m_idleDuration = generateIdleDuration();
+        m_idleDuration = generateIdleDuration(rng);
         m_idleTimer = 0.0f;
       }
     }
   }
 }
 
-float MovementBehavior::generateIdleDuration() const
+float MovementBehavior::generateIdleDuration(std::mt19937 &rng)
 {
-  float randomValue = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+  float randomValue = std::uniform_real_distribution<float>(0.0f, 1.0f)(rng);
   return utility::IDLE_DURATION_MIN + randomValue * (utility::IDLE_DURATION_MAX - utility::IDLE_DURATION_MIN);
 }
 
@@ -181,7 +184,7 @@ void ShootingBehavior::update(float deltaTime, ecs::World &world, ecs::Entity al
 {
   m_shootingTimer += deltaTime;
 
-  if (isAlignedForShooting(allyTransform, targetTransform, strength) && shouldShoot(strength) &&
+  if (isAlignedForShooting(allyTransform, targetTransform, strength) && shouldShoot(strength, world.getRandom()) &&
       m_shootingTimer >= getShootingInterval(strength)) {
     // Check if strong AI should use charge shot
     if (shouldUseChargeShot(world, allyTransform, strength)) {
@@ -300,22 +303,17 @@ int ShootingBehavior::countEnemiesAtYLevel(ecs::World &world, float targetY) con
 {
   int count = 0;
 
-  // Get all entities with Pattern component (enemies)
-  std::vector<ecs::Entity> enemies;
+  // Enemies (entities with a Pattern component) in the horizontal band around targetY, from the spatial index
   ecs::ComponentSignature enemySig;
   enemySig.set(ecs::getComponentId<ecs::Pattern>());
   enemySig.set(ecs::getComponentId<ecs::Transform>());
-  world.getEntitiesWithSignature(enemySig, enemies);
+  std::vector<const ecs::SpatialIndex::Entry *> enemies;
+  const float infinity = std::numeric_limits<float>::infinity();
+  world.getSpatialIndex().queryRect(-infinity, targetY - utility::CHARGE_SHOT_ENEMY_Y_THRESHOLD, infinity,
+                                    targetY + utility::CHARGE_SHOT_ENEMY_Y_THRESHOLD, enemySig, enemies);
 
-  for (ecs::Entity enemy : enemies) {
-    if (!world.isAlive(enemy)) {
-      continue;
-    }
-
-    auto &enemyTransform = world.getComponent<ecs::Transform>(enemy);
-    float dy = std::abs(enemyTransform.y - targetY);
-
-    if (dy <= utility::CHARGE_SHOT_ENEMY_Y_THRESHOLD) {
+  for (const auto *enemy : enemies) {
+    if (world.isAlive(enemy->entity)) {
       count++;
     }
   }
@@ -338,14 +336,14 @@ float ShootingBehavior::getShootingInterval(AIStrength strength) const
   }
 }
 
-bool ShootingBehavior::shouldShoot(AIStrength strength) const
+bool ShootingBehavior::shouldShoot(AIStrength strength, std::mt19937 &rng)
 {
   if (strength != AIStrength::WEAK) {
     return true; // Medium and strong always shoot when aligned
   }
 
   // For weak AI, sometimes idle instead of shooting
-  int randomChoice = rand() % 10;
+  int randomChoice = std::uniform_int_distribution<int>(0, 9)(rng);
   return randomChoice < 7; // 70% chance to shoot, 30% to idle
 }
 
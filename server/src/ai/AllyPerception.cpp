@@ -6,6 +6,7 @@
 */
 
 #include "../../include/ai/AllyPerception.hpp"
+#include "../../../engineCore/include/ecs/SpatialIndex.hpp"
 #include "../../../engineCore/include/ecs/components/Ally.hpp"
 #include "../../../engineCore/include/ecs/components/Collider.hpp"
 #include "../../../engineCore/include/ecs/components/Owner.hpp"
@@ -21,52 +22,70 @@
 namespace server::ai::perception
 {
 
+namespace
+{
+// getEntityCenter() offsets an entity without a collider by 16 on both axes
+constexpr float NO_COLLIDER_OFFSET = 16.0f;
+constexpr float SQRT_2 = 1.41421356f;
+
+/**
+ * @brief Extra query reach so every threat the helpers below can place in range is a candidate
+ *
+ * The index centers a circle on its Transform and an entity without a collider
+ * has no radius there, while getEntityCenter() offsets them by their radius, or
+ * by 16, on both axes and getColliderRadius() gives the latter defaultRadius.
+ */
+float centerSlack(const ecs::SpatialIndex &index, float defaultRadius)
+{
+  return std::max(index.getMaxRadius() * SQRT_2, NO_COLLIDER_OFFSET * SQRT_2 + defaultRadius);
+}
+
+/**
+ * @brief Center of the entity after utility::PREDICTION_TIME, from its Transform and Velocity
+ */
+void predictCenter(ecs::World &world, ecs::Entity entity, float &outX, float &outY)
+{
+  const auto &transform = world.getComponent<ecs::Transform>(entity);
+  float predictedX = transform.x;
+  float predictedY = transform.y;
+  if (world.hasComponent<ecs::Velocity>(entity)) {
+    const auto &velocity = world.getComponent<ecs::Velocity>(entity);
+    predictedX += velocity.dx * utility::PREDICTION_TIME;
+    predictedY += velocity.dy * utility::PREDICTION_TIME;
+  }
+  utility::getEntityCenter(world, entity, predictedX, predictedY, outX, outY);
+}
+} // namespace
+
 // ============================================================================
 // EnemyPerception
 // ============================================================================
 
 ecs::Entity EnemyPerception::findNearestEnemy(ecs::World &world, float allyX, float allyY, ecs::Entity playerEntity)
 {
-  // Gather all enemies (entities with Pattern component)
-  std::vector<ecs::Entity> enemies;
+  // Enemies are the entities with a Pattern component
   ecs::ComponentSignature enemySig;
   enemySig.set(ecs::getComponentId<ecs::Transform>());
   enemySig.set(ecs::getComponentId<ecs::Pattern>());
-  world.getEntitiesWithSignature(enemySig, enemies);
 
-  ecs::Entity nearest = 0;
-  float minDistance = std::numeric_limits<float>::max();
-
-  for (auto enemy : enemies) {
-    // Skip dead or invalid enemies
-    if (!world.isAlive(enemy) || !world.hasComponent<ecs::Transform>(enemy)) {
-      continue;
-    }
-
-    auto &transform = world.getComponent<ecs::Transform>(enemy);
-
-    // Skip enemies outside viewport
-    if (!isWithinViewportBounds(transform.x, transform.y, world, playerEntity)) {
-      continue;
-    }
-
-    // Calculate distance
-    float distance = utility::calculateDistance(allyX, allyY, transform.x, transform.y);
+  float width, height;
+  getViewportBounds(world, playerEntity, width, height);
 
-    if (distance < minDistance) {
-      minDistance = distance;
-      nearest = enemy;
-    }
-  }
+  // Nearest center on the spatial index, skipping dead enemies and the ones whose position is outside the viewport
+  const auto *nearest = world.getSpatialIndex().nearest(
+    allyX, allyY, enemySig, std::numeric_limits<float>::infinity(), [&world, width, height](const auto &entry) {
+      if (!world.isAlive(entry.entity) || !world.hasComponent<ecs::Transform>(entry.entity)) {
+        return false;
+      }
+      const auto &transform = world.getComponent<ecs::Transform>(entry.entity);
+      return isWithinViewportBounds(transform.x, transform.y, width, height);
+    });
 
-  return nearest;
+  return nearest != nullptr ? nearest->entity : 0;
 }
 
-bool EnemyPerception::isWithinViewportBounds(float x, float y, const ecs::World &world, ecs::Entity playerEntity)
+bool EnemyPerception::isWithinViewportBounds(float x, float y, float width, float height)
 {
-  float width, height;
-  getViewportBounds(world, playerEntity, width, height);
-
   return (x >= 0.0f && x <= width && y >= 0.0f && y <= height);
 }
 
@@ -146,36 +165,27 @@ void ObstacleAvoidance::evaluateEnemyThreats(ecs::World &world, ecs::Entity ally
   float allyCenterX, allyCenterY;
   utility::getEntityCenter(world, allyEntity, allyTransform.x, allyTransform.y, allyCenterX, allyCenterY);
 
-  // Get all enemies
-  std::vector<ecs::Entity> enemies;
+  // Enemies whose predicted position can reach the avoidance radius, from the spatial index
+  const auto &index = world.getSpatialIndex();
   ecs::ComponentSignature enemySig;
   enemySig.set(ecs::getComponentId<ecs::Transform>());
   enemySig.set(ecs::getComponentId<ecs::Pattern>());
-  world.getEntitiesWithSignature(enemySig, enemies);
+  const float reach = enemyAvoidRadius + allyRadius + index.getMaxSpeed() * utility::PREDICTION_TIME +
+    centerSlack(index, utility::DEFAULT_ENEMY_RADIUS);
+  index.queryRadius(allyCenterX, allyCenterY, reach, enemySig, m_nearby);
 
-  for (auto enemy : enemies) {
+  for (const auto *candidate : m_nearby) {
+    const ecs::Entity enemy = candidate->entity;
     if (!world.isAlive(enemy) || !world.hasComponent<ecs::Transform>(enemy)) {
       continue;
     }
 
-    // Get enemy transform for prediction calculation
-    auto &enemyTransformRef = world.getComponent<ecs::Transform>(enemy);
-
-    // Predict enemy position (based on current position and velocity)
-    float predictedX = enemyTransformRef.x;
-    float predictedY = enemyTransformRef.y;
-    if (world.hasComponent<ecs::Velocity>(enemy)) {
-      const auto &enemyVel = world.getComponent<ecs::Velocity>(enemy);
-      predictedX += enemyVel.dx * utility::PREDICTION_TIME;
-      predictedY += enemyVel.dy * utility::PREDICTION_TIME;
-    }
-
-    // Get enemy center for accurate distance calculation
+    // Predict enemy center (based on current position and velocity)
     float enemyCenterX, enemyCenterY;
-    utility::getEntityCenter(world, enemy, predictedX, predictedY, enemyCenterX, enemyCenterY);
+    predictCenter(world, enemy, enemyCenterX, enemyCenterY);
 
     // Get enemy radius
-    float enemyRadius = utility::getColliderRadius(world, enemy);
+    float enemyRadius = utility::getColliderRadius(world, enemy, utility::DEFAULT_ENEMY_RADIUS);
 
     // Calculate threat using CENTERS
     float dirX, dirY, distance;
@@ -225,14 +235,17 @@ void ObstacleAvoidance::evaluateProjectileThreats(ecs::World &world, ecs::Entity
   float allyCenterX, allyCenterY;
   utility::getEntityCenter(world, allyEntity, allyTransform.x, allyTransform.y, allyCenterX, allyCenterY);
 
-  // Get all projectiles
-  std::vector<ecs::Entity> projectiles;
+  // Projectiles whose predicted position can reach the avoidance radius, from the spatial index
+  const auto &index = world.getSpatialIndex();
   ecs::ComponentSignature projectileSig;
   projectileSig.set(ecs::getComponentId<ecs::Transform>());
   projectileSig.set(ecs::getComponentId<ecs::Owner>());
-  world.getEntitiesWithSignature(projectileSig, projectiles);
+  const float reach = projectileAvoidRadius + allyRadius + index.getMaxSpeed() * utility::PREDICTION_TIME +
+    centerSlack(index, utility::DEFAULT_PROJECTILE_RADIUS);
+  index.queryRadius(allyCenterX, allyCenterY, reach, projectileSig, m_nearby);
 
-  for (auto projectile : projectiles) {
+  for (const auto *candidate : m_nearby) {
+    const ecs::Entity projectile = candidate->entity;
     if (!world.isAlive(projectile) || !world.hasComponent<ecs::Transform>(projectile) ||
         !world.hasComponent<ecs::Owner>(projectile)) {
       continue;
@@ -245,23 +258,12 @@ void ObstacleAvoidance::evaluateProjectileThreats(ecs::World &world, ecs::Entity
       continue;
     }
 
-    auto &projTransform = world.getComponent<ecs::Transform>(projectile);
-
-    // Predict projectile position (based on current position and velocity)
-    float predictedX = projTransform.x;
-    float predictedY = projTransform.y;
-    if (world.hasComponent<ecs::Velocity>(projectile)) {
-      const auto &projVel = world.getComponent<ecs::Velocity>(projectile);
-      predictedX += projVel.dx * utility::PREDICTION_TIME;
-      predictedY += projVel.dy * utility::PREDICTION_TIME;
-    }
-
-    // Get projectile center
+    // Predict projectile center (based on current position and velocity)
     float projCenterX, projCenterY;
-    utility::getEntityCenter(world, projectile, predictedX, predictedY, projCenterX, projCenterY);
+    predictCenter(world, projectile, projCenterX, projCenterY);
 
     // Get projectile radius
-    float projRadius = utility::getColliderRadius(world, projectile, 5.0f);
+    float projRadius = utility::getColliderRadius(world, projectile, utility::DEFAULT_PROJECTILE_RADIUS);
 
     // Calculate threat using CENTERS
     float dirX, dirY, distance;
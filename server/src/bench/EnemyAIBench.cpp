@@ -0,0 +1,105 @@
+/**
+ * @file EnemyAIBench.cpp
+ * @brief Headless benchmark of the enemy AI system.
+ */
+
+#include "bench/EnemyAIBench.hpp"
+#include "../../../engineCore/include/ecs/World.hpp"
+#include "../../../engineCore/include/ecs/components/Owner.hpp"
+#include "../../../engineCore/include/ecs/components/PlayerId.hpp"
+#include "../../../engineCore/include/ecs/components/Transform.hpp"
+#include "../../../engineCore/include/ecs/systems/SpatialIndexSystem.hpp"
+#include "config/EnemyConfig.hpp"
+#include "systems/EnemyAISystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace server::bench
+{
+namespace
+{
+constexpr const char *ENEMY_CONFIG_PATH = "server/config/enemies.json";
+constexpr int TICKS = 600;
+constexpr float STEP_SECONDS = 1.0F / 60.0F;
+constexpr std::uint32_t SEED = 42;
+
+double percentile(std::vector<double> &values, double fraction)
+{
+  if (values.empty()) {
+    return 0.0;
+  }
+  const auto index = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+  return values[index];
+}
+} // namespace
+
+int runEnemyAIBench(std::size_t enemyCount)
+{
+  EnemyConfigManager enemyConfig;
+  if (!enemyConfig.loadFromFile(ENEMY_CONFIG_PATH)) {
+    std::cerr << "[Bench] Cannot load " << ENEMY_CONFIG_PATH << '\n';
+    return 1;
+  }
+  // Sorted so that the same count always spawns the same crowd
+  std::vector<std::string> enemyTypes = enemyConfig.getEnemyIds();
+  std::sort(enemyTypes.begin(), enemyTypes.end());
+
+  ecs::World world;
+  world.getRandom().seed(SEED);
+  auto &enemyAI = world.registerSystem<EnemyAISystem>();
+  auto &spatialIndex = world.registerSystem<ecs::SpatialIndexSystem>();
+
+  const ecs::Entity player = world.createEntity();
+  world.addComponent(player, ecs::PlayerId{});
+  ecs::Transform playerTransform;
+  playerTransform.x = 300.0F;
+  playerTransform.y = 540.0F;
+  world.addComponent(player, playerTransform);
+
+  for (std::size_t i = 0; i < enemyCount; ++i) {
+    const ecs::Prefab *prefab = enemyConfig.getPrefab(enemyTypes[i % enemyTypes.size()]);
+    ecs::Transform transform = *prefab->get<ecs::Transform>();
+    transform.x = 400.0F + static_cast<float>(i * 37 % 1400);
+    transform.y = 60.0F + static_cast<float>(i * 53 % 960);
+    world.instantiate(*prefab, transform);
+  }
+
+  // Nothing moves or collides here, so the shots are swept after each tick, outside of the timing
+  ecs::ComponentSignature shotSig;
+  shotSig.set(ecs::getComponentId<ecs::Owner>());
+  std::vector<ecs::Entity> shots;
+  std::size_t shotCount = 0;
+
+  std::vector<double> tickTimes;
+  tickTimes.reserve(TICKS);
+  for (int tick = 0; tick < TICKS; ++tick) {
+    const auto start = std::chrono::steady_clock::now();
+    // The index rebuild is part of the AI cost: the AI queries it instead of scanning the world
+    spatialIndex.update(world, STEP_SECONDS);
+    enemyAI.update(world, STEP_SECONDS);
+    tickTimes.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    world.getEntitiesWithSignature(shotSig, shots);
+    for (const ecs::Entity shot : shots) {
+      world.destroyEntity(shot);
+    }
+    shotCount += shots.size();
+  }
+
+  double total = 0.0;
+  for (const double seconds : tickTimes) {
+    total += seconds;
+  }
+  const double p50 = percentile(tickTimes, 0.50);
+  const double p99 = percentile(tickTimes, 0.99);
+  std::cout << "[Bench] EnemyAISystem and spatial index, " << enemyCount << " enemies of " << enemyTypes.size()
+            << " types, " << TICKS << " ticks: mean " << total / TICKS * 1e6 << " us, p50 " << p50 * 1e6
+            << " us, p99 " << p99 * 1e6 << " us per tick, " << shotCount << " shots, " << world.getEntityCount() << " entities at the end" << '\n';
+  return 0;
+}
+
+} // namespace server::bench
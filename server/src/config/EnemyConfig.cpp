@@ -6,12 +6,119 @@
  */
 
 #include "../include/config/EnemyConfig.hpp"
+#include "../../../engineCore/include/ecs/components/BulletEmitter.hpp"
+#include "../../../engineCore/include/ecs/components/Collider.hpp"
+#include "../../../engineCore/include/ecs/components/Health.hpp"
+#include "../../../engineCore/include/ecs/components/Networked.hpp"
+#include "../../../engineCore/include/ecs/components/Pattern.hpp"
+#include "../../../engineCore/include/ecs/components/Sprite.hpp"
+#include "../../../engineCore/include/ecs/components/Transform.hpp"
+#include "../../../engineCore/include/ecs/components/Velocity.hpp"
+#include "../../../engineCore/include/utils/Log.hpp"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <memory>
 
 namespace server
 {
 
+ecs::EmitterConfig EnemyConfig::emitterFromJson(const nlohmann::json &json)
+{
+  ecs::EmitterConfig emitter;
+  const std::string shape = json.value("shape", "ring");
+  if (shape == "spiral") {
+    emitter.spin = 12.0F;
+  } else if (shape == "fan") {
+    emitter.arc = 45.0F;
+    emitter.aimed = true;
+  } else if (shape == "burst") {
+    emitter.arc = 20.0F;
+    emitter.aimed = true;
+    emitter.burst = 3;
+  } else if (shape != "ring") {
+    RTYPE_LOG_WARN("[EnemyConfig] Unknown emitter shape '" << shape << "', using ring");
+  }
+
+  emitter.count = json.value("count", emitter.count);
+  emitter.arc = json.value("arc", emitter.arc);
+  emitter.angle = json.value("angle", emitter.angle);
+  emitter.spin = json.value("spin", emitter.spin);
+  emitter.aimed = json.value("aimed", emitter.aimed);
+  emitter.interval = json.value("interval", emitter.interval);
+  emitter.delay = json.value("delay", emitter.interval);
+  emitter.burst = std::max<std::uint16_t>(1, json.value("burst", emitter.burst));
+  emitter.burstInterval = json.value("burstInterval", emitter.burstInterval);
+  emitter.speed = json.value("speed", emitter.speed);
+  emitter.lifetime = json.value("lifetime", emitter.lifetime);
+  emitter.radius = json.value("radius", emitter.radius);
+  emitter.damage = json.value("damage", emitter.damage);
+  emitter.offsetX = json.value("offsetX", emitter.offsetX);
+  emitter.offsetY = json.value("offsetY", emitter.offsetY);
+  emitter.minHealth = json.value("minHealth", emitter.minHealth);
+  emitter.maxHealth = json.value("maxHealth", emitter.maxHealth);
+
+  if (json.contains("sprite")) {
+    const auto &s = json["sprite"];
+    emitter.spriteId = s.value("spriteId", emitter.spriteId);
+    emitter.width = s.value("width", emitter.width);
+    emitter.height = s.value("height", emitter.height);
+    emitter.frameCount = s.value("frameCount", emitter.frameCount);
+    emitter.frameTime = s.value("frameTime", emitter.frameTime);
+    emitter.scale = s.value("scale", emitter.scale);
+  }
+  return emitter;
+}
+
+ecs::Prefab EnemyConfig::toPrefab() const
+{
+  ecs::Transform transformComp;
+  transformComp.rotation = 0.0F;
+  transformComp.scale = transform.scale;
+
+  ecs::Velocity velocityComp;
+  velocityComp.dx = velocity.dx;
+  velocityComp.dy = velocity.dy;
+
+  ecs::Health healthComp;
+  healthComp.hp = health.hp;
+  healthComp.maxHp = health.maxHp;
+
+  ecs::Sprite spriteComp;
+  spriteComp.spriteId = sprite.spriteId;
+  spriteComp.width = sprite.width;
+  spriteComp.height = sprite.height;
+  spriteComp.animated = sprite.animated;
+  spriteComp.frameCount = sprite.frameCount;
+  spriteComp.startFrame = sprite.startFrame;
+  spriteComp.endFrame = sprite.endFrame;
+  spriteComp.currentFrame = sprite.startFrame;
+  spriteComp.frameTime = sprite.frameTime;
+  spriteComp.reverseAnimation = sprite.reverseAnimation;
+
+  ecs::Prefab prefab;
+  prefab.set(ecs::Pattern{pattern.type, pattern.amplitude, pattern.frequency})
+    .set(transformComp)
+    .set(velocityComp)
+    .set(healthComp)
+    .set(spriteComp)
+    // Collider sized to sprite * transform.scale (matches visual size)
+    .set(ecs::Collider{static_cast<float>(sprite.width) * transform.scale,
+                       static_cast<float>(sprite.height) * transform.scale})
+    .set(ecs::Networked{}, [](ecs::Networked &net, ecs::Entity entity) { net.networkId = entity; });
+
+  if (!emitters.empty()) {
+    ecs::BulletEmitter emitterComp;
+    emitterComp.configs = std::make_shared<const std::vector<ecs::EmitterConfig>>(emitters);
+    for (std::size_t i = 0; i < emitters.size(); ++i) {
+      emitterComp.states[i].timer = emitters[i].delay;
+      emitterComp.states[i].angle = emitters[i].angle;
+    }
+    prefab.set(emitterComp);
+  }
+  return prefab;
+}
+
 bool EnemyConfigManager::loadFromFile(const std::string &filepath)
 {
   std::ifstream file(filepath);
@@ -30,6 +137,7 @@ bool EnemyConfigManager::loadFromFile(const std::string &filepath)
     }
 
     m_configs.clear();
+    m_prefabs.clear();
 
     for (const auto &enemyJson : json["enemies"]) {
       EnemyConfig config = EnemyConfig::fromJson(enemyJson);
@@ -37,6 +145,7 @@ bool EnemyConfigManager::loadFromFile(const std::string &filepath)
         std::cerr << "[EnemyConfig] Warning: skipping enemy with empty ID" << std::endl;
         continue;
       }
+      m_prefabs[config.id] = config.toPrefab();
       m_configs[config.id] = config;
       std::cout << "[EnemyConfig] Loaded enemy: " << config.id << " (" << config.name << ")" << std::endl;
     }
@@ -63,6 +172,15 @@ const EnemyConfig *EnemyConfigManager::getConfig(const std::string &id) const
   return nullptr;
 }
 
+const ecs::Prefab *EnemyConfigManager::getPrefab(const std::string &id) const
+{
+  auto it = m_prefabs.find(id);
+  if (it != m_prefabs.end()) {
+    return &it->second;
+  }
+  return nullptr;
+}
+
 std::vector<std::string> EnemyConfigManager::getEnemyIds() const
 {
   std::vector<std::string> ids;
@@ -6,13 +6,60 @@
 */
 
 #include "../include/config/LevelConfig.hpp"
+#include "../include/config/EnemyConfig.hpp"
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <utility>
 
 namespace server
 {
 
-bool LevelConfigManager::loadFromFile(const std::string &filepath)
+namespace
+{
+constexpr float DEFAULT_ENEMY_SPEED = 384.0F; // Spacing speed of enemy types missing from enemies.json
+constexpr float MIN_GROUP_DELAY = 0.08F; // Spacing delay of enemies that do not move
+
+LevelTimeline compileTimeline(const LevelConfig &level, const EnemyConfigManager &enemies)
+{
+  LevelTimeline timeline;
+  timeline.waveBegin.reserve(level.waves.size() + 1);
+
+  for (std::size_t waveIndex = 0; waveIndex < level.waves.size(); ++waveIndex) {
+    const auto begin = timeline.events.size();
+    timeline.waveBegin.push_back(begin);
+
+    for (const auto &spawn : level.waves[waveIndex].spawns) {
+      auto type = std::find(timeline.enemyTypes.begin(), timeline.enemyTypes.end(), spawn.enemyType);
+      if (type == timeline.enemyTypes.end()) {
+        type = timeline.enemyTypes.insert(type, spawn.enemyType);
+      }
+      const auto enemy = static_cast<std::uint32_t>(type - timeline.enemyTypes.begin());
+
+      // Delay between the enemies of a group, so that they enter the screen `spacing` apart
+      float groupDelay = 0.0F;
+      if (spawn.count > 1 && spawn.spacing > 0.0F) {
+        const EnemyConfig *config = enemies.getConfig(spawn.enemyType);
+        const float speed = config ? std::abs(config->velocity.dx) : DEFAULT_ENEMY_SPEED;
+        groupDelay = speed > 0.0F ? spawn.spacing / speed : MIN_GROUP_DELAY;
+      }
+
+      for (int i = 0; i < spawn.count; ++i) {
+        timeline.events.push_back(
+          {spawn.delay + static_cast<float>(i) * groupDelay, spawn.y, static_cast<std::uint32_t>(waveIndex), enemy});
+      }
+    }
+
+    std::stable_sort(timeline.events.begin() + static_cast<std::ptrdiff_t>(begin), timeline.events.end(),
+                     [](const SpawnEvent &a, const SpawnEvent &b) { return a.time < b.time; });
+  }
+  timeline.waveBegin.push_back(timeline.events.size());
+  return timeline;
+}
+} // namespace
+
+bool LevelConfigManager::loadFromFile(const std::string &filepath, const EnemyConfigManager &enemies)
 {
   std::ifstream file(filepath);
   if (!file.is_open()) {
@@ -40,9 +87,10 @@ bool LevelConfigManager::loadFromFile(const std::string &filepath)
       if (json.contains("map") && json["map"].is_object()) {
         config.map = MapConfig::fromJson(json["map"]);
       }
-      m_configs[config.id] = config;
+      config.timeline = compileTimeline(config, enemies);
       std::cout << "[LevelConfig] Loaded level: " << config.id << " (" << config.name << ") with "
-                << config.waves.size() << " waves" << std::endl;
+                << config.waves.size() << " waves, " << config.timeline.events.size() << " spawns" << std::endl;
+      m_configs[config.id] = std::move(config);
     }
 
     std::cout << "[LevelConfig] Successfully loaded " << m_configs.size() << " levels from " << filepath << std::endl;
@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** ServerConfig.cpp - Runtime server configuration loader implementation
+*/
+
+#include "../include/config/ServerConfig.hpp"
+#include <fstream>
+#include <iostream>
+
+namespace server
+{
+
+bool ServerConfig::loadFromFile(const std::string &filepath)
+{
+  std::ifstream file(filepath);
+  if (!file.is_open()) {
+    std::cerr << "[ServerConfig] Failed to open config file: " << filepath << ", using defaults" << std::endl;
+    return false;
+  }
+
+  try {
+    nlohmann::json json;
+    file >> json;
+
+    if (json.contains("replication") && json["replication"].is_object()) {
+      replication = ReplicationConfig::fromJson(json["replication"]);
+    }
+    if (json.contains("tick") && json["tick"].is_object()) {
+      tick = TickSettings::fromJson(json["tick"]);
+    }
+    if (json.contains("ai") && json["ai"].is_object()) {
+      ai = AISettings::fromJson(json["ai"]);
+    }
+    if (json.contains("network") && json["network"].is_object()) {
+      network = NetworkSettings::fromJson(json["network"]);
+    }
+    if (json.contains("metrics") && json["metrics"].is_object()) {
+      metrics = MetricsSettings::fromJson(json["metrics"]);
+    }
+    if (json.contains("logging") && json["logging"].is_object()) {
+      logging = LoggingSettings::fromJson(json["logging"]);
+    }
+    if (json.contains("replay") && json["replay"].is_object()) {
+      replay = ReplaySettings::fromJson(json["replay"]);
+    }
+
+    std::cout << "[ServerConfig] Loaded " << filepath << " (snapshot budget " << replication.budgetBytesPerClient
+              << " bytes/client)" << std::endl;
+    return true;
+
+  } catch (const nlohmann::json::exception &e) {
+    std::cerr << "[ServerConfig] JSON parsing error: " << e.what() << std::endl;
+    return false;
+  } catch (const std::exception &e) {
+    std::cerr << "[ServerConfig] Error loading config: " << e.what() << std::endl;
+    return false;
+  }
+}
+
+} // namespace server
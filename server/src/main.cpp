@@ -4,30 +4,102 @@
  */
 
 #include "../../network/include/AsioServer.hpp"
+#include "../../network/include/ConditionedNetworkManager.hpp"
+#include "../../engineCore/include/utils/Log.hpp"
+#include "../../engineCore/include/utils/Trace.hpp"
 #include "Game.hpp"
+#include "bench/EnemyAIBench.hpp"
+#include "replay/ReplayRunner.hpp"
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <thread>
+#if defined(RTYPE_HAS_IO_URING)
+#include "../../network/include/UringServer.hpp"
+#endif
 
-int main()
+namespace
 {
+/**
+ * @brief Create the network backend selected in server.json
+ *
+ * io_uring is only used when it was built in and the kernel supports it;
+ * otherwise the Asio server is used.
+ */
+std::shared_ptr<INetworkManager> createNetworkManager(const server::NetworkSettings &settings)
+{
+  if (settings.backend == "io_uring") {
+#if defined(RTYPE_HAS_IO_URING)
+    if (UringServer::isSupported()) {
+      return std::make_shared<UringServer>(GameConfig::DEFAULT_PORT);
+    }
+    std::cerr << "[Server] io_uring not supported by this kernel, falling back to asio" << '\n';
+#else
+    std::cerr << "[Server] io_uring backend not built, falling back to asio" << '\n';
+#endif
+  } else if (settings.backend != "asio") {
+    std::cerr << "[Server] Unknown network backend '" << settings.backend << "', using asio" << '\n';
+  }
+  return std::make_shared<AsioServer>(GameConfig::DEFAULT_PORT, settings.receiveShards);
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+  // `server --replay FILE` replays a recorded game headless and exits
+  if (argc == 3 && std::string(argv[1]) == "--replay") {
+    try {
+      return server::replay::runReplay(argv[2]);
+    } catch (const std::exception &e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return 1;
+    }
+  }
+
+  // `server --bench-ai [COUNT]` times the enemy AI over COUNT mixed enemies and exits
+  if ((argc == 2 || argc == 3) && std::string(argv[1]) == "--bench-ai") {
+    try {
+      return server::bench::runEnemyAIBench(argc == 3 ? std::stoul(argv[2]) : 2000);
+    } catch (const std::exception &e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return 1;
+    }
+  }
+
   std::cout << "🎮 R-Type Server Starting..." << '\n';
 
   try {
-    auto networkManager = std::make_shared<AsioServer>(GameConfig::DEFAULT_PORT);
-
     Game game;
+    logging::Logger::instance().configure(game.getServerConfig().logging.toLogSettings());
     std::cout << "Game initialized with all systems" << '\n';
 
-    game.setNetworkManager(networkManager);
+    const auto &networkSettings = game.getServerConfig().network;
+    auto networkManager = createNetworkManager(networkSettings);
 
     auto world = game.getWorld();
     if (world) {
-      networkManager->setWorld(world);
+      if (auto asioServer = std::dynamic_pointer_cast<AsioServer>(networkManager)) {
+        asioServer->setWorld(world);
+      }
+    }
+
+    if (networkSettings.simulation.enabled) {
+      const auto &simulation = networkSettings.simulation;
+      std::cout << "[Server] Network simulation on: downstream " << simulation.downstream.latencyMs << "ms/"
+                << simulation.downstream.lossRate * 100.0 << "% loss, upstream " << simulation.upstream.latencyMs
+                << "ms/" << simulation.upstream.lossRate * 100.0 << "% loss" << '\n';
+      networkManager = std::make_shared<ConditionedNetworkManager>(networkManager, simulation.downstream,
+                                                                   simulation.upstream, simulation.seed);
+    }
+
+    game.setNetworkManager(networkManager);
+    if (world) {
       networkManager->start();
     }
 
+    // With -DRTYPE_TRACING=ON, `kill -USR1` dumps the recorded trace
+    RTYPE_TRACE_INSTALL_DUMP_SIGNAL();
     std::thread gameThread([&game]() { game.runGameLoop(); });
 
     std::cout << "Press Ctrl+C to stop server" << '\n';
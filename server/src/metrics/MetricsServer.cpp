@@ -0,0 +1,121 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** MetricsServer.cpp - Localhost HTTP listener serving the Prometheus page
+*/
+
+#include "../../include/metrics/MetricsServer.hpp"
+#include "../../../engineCore/include/utils/Log.hpp"
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <utility>
+
+namespace server
+{
+namespace
+{
+constexpr std::size_t MAX_REQUEST_SIZE = 8192;
+// Wait before accepting again after a failure (e.g. EMFILE), so it cannot spin the metrics thread
+constexpr std::chrono::seconds ACCEPT_RETRY_DELAY{1};
+
+std::string makeResponse(const char *status, const char *contentType, const std::string &body)
+{
+  std::string response = "HTTP/1.0 ";
+  response += status;
+  response += "\r\nContent-Type: ";
+  response += contentType;
+  response += "\r\nContent-Length: " + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n";
+  response += body;
+  return response;
+}
+} // namespace
+
+struct MetricsServer::Connection {
+  explicit Connection(asio::io_context &ioContext) : socket(ioContext), request(MAX_REQUEST_SIZE) {}
+
+  asio::ip::tcp::socket socket;
+  asio::streambuf request;
+  std::string response;
+};
+
+MetricsServer::MetricsServer(std::uint16_t port, RenderFunction render)
+    : m_acceptor(m_ioContext, asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), port)),
+      m_retryTimer(m_ioContext), m_render(std::move(render))
+{
+  std::cout << "[Metrics] Serving http://127.0.0.1:" << port << "/metrics" << '\n';
+}
+
+MetricsServer::~MetricsServer()
+{
+  stop();
+}
+
+void MetricsServer::start()
+{
+  accept();
+  m_thread = std::thread([this]() { m_ioContext.run(); });
+}
+
+void MetricsServer::stop()
+{
+  m_ioContext.stop();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void MetricsServer::accept()
+{
+  auto connection = std::make_shared<Connection>(m_ioContext);
+  m_acceptor.async_accept(connection->socket, [this, connection](const std::error_code &error) {
+    if (error == asio::error::operation_aborted) {
+      return;
+    }
+    if (error) {
+      RTYPE_LOG_EVERY(::logging::Level::WARN, 10.0, "[Metrics] Accept error: " << error.message() << ", retrying");
+      m_retryTimer.expires_after(ACCEPT_RETRY_DELAY);
+      m_retryTimer.async_wait([this](const std::error_code &timerError) {
+        if (!timerError) {
+          accept();
+        }
+      });
+      return;
+    }
+    // The request buffer is capped at MAX_REQUEST_SIZE: a longer header fails the read
+    asio::async_read_until(connection->socket, connection->request, "\r\n\r\n",
+                           [this, connection](const std::error_code &readError, std::size_t /*bytes*/) {
+                             if (!readError) {
+                               respond(connection);
+                             }
+                           });
+    accept();
+  });
+}
+
+void MetricsServer::respond(const std::shared_ptr<Connection> &connection)
+{
+  std::istream request(&connection->request);
+  std::string method;
+  std::string target;
+  request >> method >> target;
+
+  if (method != "GET" || (target != "/metrics" && target != "/")) {
+    connection->response = makeResponse("404 Not Found", "text/plain", "Not found\n");
+  } else {
+    try {
+      connection->response = makeResponse("200 OK", "text/plain; version=0.0.4; charset=utf-8", m_render());
+    } catch (const std::exception &e) {
+      std::cerr << "[Metrics] Render error: " << e.what() << '\n';
+      connection->response = makeResponse("500 Internal Server Error", "text/plain", "Render error\n");
+    }
+  }
+  asio::async_write(connection->socket, asio::buffer(connection->response),
+                    [connection](const std::error_code & /*error*/, std::size_t /*bytes*/) {
+                      asio::error_code ignored;
+                      connection->socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignored);
+                    });
+}
+
+} // namespace server
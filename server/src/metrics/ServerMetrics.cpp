@@ -0,0 +1,173 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** ServerMetrics.cpp - Prometheus text rendering of the server metrics
+*/
+
+#include "../../include/metrics/ServerMetrics.hpp"
+#include <sstream>
+#include <utility>
+
+namespace server
+{
+namespace
+{
+void writeHeader(std::ostringstream &out, const char *name, const char *type, const char *help)
+{
+  out << "# HELP " << name << ' ' << help << '\n' << "# TYPE " << name << ' ' << type << '\n';
+}
+
+template <typename T>
+void writeMetric(std::ostringstream &out, const char *name, const char *type, const char *help, T value)
+{
+  writeHeader(out, name, type, help);
+  out << name << ' ' << value << '\n';
+}
+
+template <std::size_t Bounds>
+void observe(ServerMetrics::Histogram<Bounds> &histogram, const std::array<double, Bounds> &bounds, double seconds)
+{
+  std::size_t bucket = 0;
+  while (bucket < bounds.size() && seconds > bounds[bucket]) {
+    ++bucket;
+  }
+  histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  histogram.sumNs.fetch_add(static_cast<std::uint64_t>(seconds * 1e9), std::memory_order_relaxed);
+}
+
+/** @brief Buckets are stored per interval and exposed cumulatively. */
+template <std::size_t Bounds>
+std::uint64_t writeHistogram(std::ostringstream &out, const char *name, const char *help,
+                             const ServerMetrics::Histogram<Bounds> &histogram, const std::array<double, Bounds> &bounds)
+{
+  writeHeader(out, name, "histogram", help);
+  std::uint64_t cumulative = 0;
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    cumulative += histogram.buckets[i].load(std::memory_order_relaxed);
+    out << name << "_bucket{le=\"" << bounds[i] << "\"} " << cumulative << '\n';
+  }
+  cumulative += histogram.buckets.back().load(std::memory_order_relaxed);
+  out << name << "_bucket{le=\"+Inf\"} " << cumulative << '\n';
+  out << name << "_sum " << static_cast<double>(histogram.sumNs.load(std::memory_order_relaxed)) / 1e9 << '\n';
+  out << name << "_count " << cumulative << '\n';
+  return cumulative;
+}
+
+/** @brief Label values may only carry escaped backslashes, quotes and newlines. */
+std::string escapeLabel(const std::string &value)
+{
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char c : value) {
+    if (c == '\\' || c == '"') {
+      escaped += '\\';
+      escaped += c;
+    } else if (c == '\n') {
+      escaped += "\\n";
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+} // namespace
+
+void ServerMetrics::observeTick(double seconds)
+{
+  observe(m_tickDurations, TICK_BUCKETS, seconds);
+}
+
+void ServerMetrics::observeTickJitter(double seconds)
+{
+  observe(m_tickJitter, JITTER_BUCKETS, seconds);
+}
+
+void ServerMetrics::countOverrun(double seconds)
+{
+  observe(m_tickOverruns, OVERRUN_BUCKETS, seconds);
+}
+
+void ServerMetrics::publishLobbies(std::vector<LobbySample> lobbies)
+{
+  std::lock_guard<std::mutex> lock(m_lobbiesMutex);
+  m_lobbySamples = std::move(lobbies);
+}
+
+std::string ServerMetrics::render(const NetworkStats &network) const
+{
+  std::ostringstream out;
+
+  writeHistogram(out, "rtype_tick_duration_seconds", "Work time of one game loop tick.", m_tickDurations,
+                 TICK_BUCKETS);
+  writeHistogram(out, "rtype_tick_start_lateness_seconds", "Delay between a tick deadline and the tick start.",
+                 m_tickJitter, JITTER_BUCKETS);
+  const std::uint64_t overruns =
+    writeHistogram(out, "rtype_tick_overrun_seconds", "Time by which a tick's work exceeded the tick period.",
+                   m_tickOverruns, OVERRUN_BUCKETS);
+  writeMetric(out, "rtype_tick_overruns_total", "counter", "Ticks whose work exceeded the tick period.", overruns);
+  writeMetric(out, "rtype_tick_catchup_steps_total", "counter",
+              "Extra simulation steps run to catch up after a late frame.",
+              m_catchUpSteps.load(std::memory_order_relaxed));
+  writeMetric(out, "rtype_tick_dropped_steps_total", "counter",
+              "Simulation steps skipped because a frame exceeded the catch-up limit.",
+              m_droppedSteps.load(std::memory_order_relaxed));
+
+  writeMetric(out, "rtype_ai_decisions_total", "counter", "Ally AI decisions run.",
+              m_aiDecisions.load(std::memory_order_relaxed));
+  writeMetric(out, "rtype_ai_decisions_deferred_total", "counter",
+              "Ally AI decisions moved to a later step because the AI budget was spent.",
+              m_aiDeferred.load(std::memory_order_relaxed));
+  writeMetric(out, "rtype_ai_decision_seconds_total", "counter", "Time spent in ally AI decisions.",
+              m_aiSeconds.load(std::memory_order_relaxed));
+
+  writeMetric(out, "rtype_lobbies", "gauge", "Lobbies currently open.", m_lobbies.load(std::memory_order_relaxed));
+  writeMetric(out, "rtype_clients", "gauge", "Clients currently connected.", network.connections.size());
+  {
+    std::lock_guard<std::mutex> lock(m_lobbiesMutex);
+    writeHeader(out, "rtype_lobby_entities", "gauge", "Entities alive in a running lobby.");
+    for (const auto &lobby : m_lobbySamples) {
+      out << "rtype_lobby_entities{lobby=\"" << escapeLabel(lobby.code) << "\"} " << lobby.entities << '\n';
+    }
+    writeHeader(out, "rtype_lobby_clients", "gauge", "Clients in a running lobby.");
+    for (const auto &lobby : m_lobbySamples) {
+      out << "rtype_lobby_clients{lobby=\"" << escapeLabel(lobby.code) << "\"} " << lobby.clients << '\n';
+    }
+    // Pooled entities are reused/parked, so created + reused is what the lobby spawned
+    writeHeader(out, "rtype_lobby_entity_lifecycle_total", "counter",
+                "Entities of a running lobby created, destroyed, reused from a pool or parked in one.");
+    for (const auto &lobby : m_lobbySamples) {
+      const std::string label = escapeLabel(lobby.code);
+      out << "rtype_lobby_entity_lifecycle_total{lobby=\"" << label << "\",event=\"created\"} "
+          << lobby.entitiesCreated << '\n';
+      out << "rtype_lobby_entity_lifecycle_total{lobby=\"" << label << "\",event=\"destroyed\"} "
+          << lobby.entitiesDestroyed << '\n';
+      out << "rtype_lobby_entity_lifecycle_total{lobby=\"" << label << "\",event=\"reused\"} "
+          << lobby.entitiesReused << '\n';
+      out << "rtype_lobby_entity_lifecycle_total{lobby=\"" << label << "\",event=\"parked\"} "
+          << lobby.entitiesParked << '\n';
+    }
+  }
+
+  writeMetric(out, "rtype_snapshots_sent_total", "counter", "Snapshots handed to the network manager.",
+              m_snapshots.load(std::memory_order_relaxed));
+  writeMetric(out, "rtype_snapshot_bytes_total", "counter", "Serialized bytes of the snapshots sent.",
+              m_snapshotBytes.load(std::memory_order_relaxed));
+
+  writeMetric(out, "rtype_network_received_packets_total", "counter", "Datagrams received.",
+              network.traffic.packetsIn);
+  writeMetric(out, "rtype_network_received_bytes_total", "counter", "Bytes received.", network.traffic.bytesIn);
+  writeMetric(out, "rtype_network_sent_packets_total", "counter", "Datagrams sent.", network.traffic.packetsOut);
+  writeMetric(out, "rtype_network_sent_bytes_total", "counter", "Bytes sent.", network.traffic.bytesOut);
+  writeMetric(out, "rtype_network_send_errors_total", "counter", "Datagrams the socket failed to send.",
+              network.traffic.sendErrors);
+  writeMetric(out, "rtype_network_dropped_packets_total", "counter",
+              "Datagrams refused before reaching a connection.", network.droppedIn);
+  writeMetric(out, "rtype_network_send_queue_depth", "gauge", "Datagrams handed to the socket, not sent yet.",
+              network.traffic.sendQueueDepth);
+  writeMetric(out, "rtype_network_incoming_queue_depth", "gauge", "Messages received, not processed yet.",
+              network.incomingQueueDepth);
+  return out.str();
+}
+
+} // namespace server
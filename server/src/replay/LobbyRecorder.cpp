@@ -0,0 +1,237 @@
+/**
+ * @file LobbyRecorder.cpp
+ * @brief Records what drives a lobby simulation, for a headless replay.
+ */
+
+#include "replay/LobbyRecorder.hpp"
+#include "../../../engineCore/include/ecs/components/Health.hpp"
+#include "../../../engineCore/include/ecs/components/Transform.hpp"
+#include "../../../engineCore/include/ecs/components/Velocity.hpp"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace server::replay
+{
+namespace
+{
+constexpr std::uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+constexpr std::uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+template <typename T>
+void hashValue(std::uint64_t &hash, const T &value)
+{
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  for (const unsigned char byte : bytes) {
+    hash = (hash ^ byte) * FNV_PRIME;
+  }
+}
+} // namespace
+
+void SessionInfo::encode(PayloadWriter &out) const
+{
+  out.string(lobbyCode);
+  out.u64(seed);
+  out.f64(stepSeconds);
+  out.u8(difficulty);
+  out.u8(gameMode);
+  out.u8(aiDifficulty);
+  out.u8(solo ? 1 : 0);
+  out.u64(enemyConfigHash);
+  out.u64(levelConfigHash);
+  out.varint(players.size());
+  for (const auto &player : players) {
+    out.varint(player.clientId);
+    out.u8(player.spectator ? 1 : 0);
+  }
+  out.f64(aiDecisionRateHz);
+}
+
+std::optional<SessionInfo> SessionInfo::decode(std::span<const std::uint8_t> payload)
+{
+  PayloadReader in(payload);
+  SessionInfo session;
+  session.lobbyCode = in.string();
+  session.seed = in.u64();
+  session.stepSeconds = in.f64();
+  session.difficulty = in.u8();
+  session.gameMode = in.u8();
+  session.aiDifficulty = in.u8();
+  session.solo = in.u8() != 0;
+  session.enemyConfigHash = in.u64();
+  session.levelConfigHash = in.u64();
+  const std::uint64_t count = in.varint();
+  for (std::uint64_t i = 0; i < count && in.ok(); ++i) {
+    Player player;
+    player.clientId = static_cast<std::uint32_t>(in.varint());
+    player.spectator = in.u8() != 0;
+    session.players.push_back(player);
+  }
+  if (!in.atEnd()) {
+    session.aiDecisionRateHz = in.f64();
+  }
+  if (!in.ok() || session.stepSeconds <= 0.0) {
+    return std::nullopt;
+  }
+  return session;
+}
+
+std::uint64_t hashFile(const std::string &path)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return 0;
+  }
+  std::uint64_t hash = FNV_OFFSET;
+  for (auto it = std::istreambuf_iterator<char>(file); it != std::istreambuf_iterator<char>(); ++it) {
+    hash = (hash ^ static_cast<unsigned char>(*it)) * FNV_PRIME;
+  }
+  return hash;
+}
+
+std::uint64_t worldChecksum(const ecs::World &world, std::size_t &entityCount)
+{
+  std::vector<ecs::Entity> entities;
+  world.getEntitiesWithSignature(ecs::ComponentSignature{}, entities);
+  entityCount = entities.size();
+  std::uint64_t hash = FNV_OFFSET;
+  for (const ecs::Entity entity : entities) {
+    hashValue(hash, entity);
+    if (world.hasComponent<ecs::Transform>(entity)) {
+      const auto &transform = world.getComponent<ecs::Transform>(entity);
+      hashValue(hash, transform.x);
+      hashValue(hash, transform.y);
+    }
+    if (world.hasComponent<ecs::Velocity>(entity)) {
+      const auto &velocity = world.getComponent<ecs::Velocity>(entity);
+      hashValue(hash, velocity.dx);
+      hashValue(hash, velocity.dy);
+    }
+    if (world.hasComponent<ecs::Health>(entity)) {
+      hashValue(hash, world.getComponent<ecs::Health>(entity).hp);
+    }
+  }
+  return hash;
+}
+
+std::uint8_t packInput(const ecs::Input &input)
+{
+  return static_cast<std::uint8_t>((input.up ? 1 : 0) | (input.down ? 2 : 0) | (input.left ? 4 : 0) |
+                                   (input.right ? 8 : 0) | (input.shoot ? 16 : 0) | (input.chargedShoot ? 32 : 0) |
+                                   (input.detach ? 64 : 0));
+}
+
+void unpackInput(std::uint8_t bits, ecs::Input &input)
+{
+  input.up = (bits & 1) != 0;
+  input.down = (bits & 2) != 0;
+  input.left = (bits & 4) != 0;
+  input.right = (bits & 8) != 0;
+  input.shoot = (bits & 16) != 0;
+  input.chargedShoot = (bits & 32) != 0;
+  input.detach = (bits & 64) != 0;
+}
+
+bool LobbyRecorder::start(const RecordingOptions &options, const SessionInfo &session)
+{
+  std::error_code error;
+  std::filesystem::create_directories(options.directory, error);
+  const auto now = std::chrono::system_clock::now().time_since_epoch();
+  m_path = (std::filesystem::path(options.directory) /
+            (session.lobbyCode + "-" + std::to_string(std::chrono::duration_cast<std::chrono::seconds>(now).count()) +
+             ".rreplay"))
+             .string();
+  if (!m_writer.open(m_path, options.chunkBytes)) {
+    return false;
+  }
+  m_checksumInterval = options.checksumIntervalTicks;
+  m_payload.clear();
+  session.encode(m_payload);
+  write(RecordType::START, 0);
+  std::cout << "[Replay] Recording lobby " << session.lobbyCode << " to " << m_path << " (seed " << session.seed
+            << ")" << '\n';
+  return isRecording();
+}
+
+void LobbyRecorder::stop(std::uint64_t tick)
+{
+  if (!isRecording()) {
+    return;
+  }
+  m_payload.clear();
+  write(RecordType::END, tick);
+  m_writer.close();
+  std::cout << "[Replay] Saved " << m_path << " (" << tick << " ticks)" << '\n';
+}
+
+void LobbyRecorder::recordInput(std::uint64_t tick, std::uint32_t clientId, const ecs::Input &input)
+{
+  m_payload.clear();
+  m_payload.varint(clientId);
+  m_payload.u8(packInput(input));
+  write(RecordType::INPUT, tick);
+}
+
+void LobbyRecorder::recordViewport(std::uint64_t tick, std::uint32_t clientId, std::uint32_t width,
+                                   std::uint32_t height)
+{
+  m_payload.clear();
+  m_payload.varint(clientId);
+  m_payload.varint(width);
+  m_payload.varint(height);
+  write(RecordType::VIEWPORT, tick);
+}
+
+void LobbyRecorder::recordJoin(std::uint64_t tick, std::uint32_t clientId, bool spectator)
+{
+  m_payload.clear();
+  m_payload.varint(clientId);
+  m_payload.u8(spectator ? 1 : 0);
+  write(RecordType::JOIN, tick);
+}
+
+void LobbyRecorder::recordLeave(std::uint64_t tick, std::uint32_t clientId)
+{
+  m_payload.clear();
+  m_payload.varint(clientId);
+  write(RecordType::LEAVE, tick);
+}
+
+void LobbyRecorder::recordSpectator(std::uint64_t tick, std::uint32_t clientId, bool spectator)
+{
+  m_payload.clear();
+  m_payload.varint(clientId);
+  m_payload.u8(spectator ? 1 : 0);
+  write(RecordType::SPECTATOR, tick);
+}
+
+void LobbyRecorder::afterStep(const ecs::World &world)
+{
+  const std::uint64_t tick = world.getTick();
+  if (m_checksumInterval == 0 || tick % m_checksumInterval != 0) {
+    return;
+  }
+  std::size_t entityCount = 0;
+  const std::uint64_t checksum = worldChecksum(world, entityCount);
+  m_payload.clear();
+  m_payload.varint(entityCount);
+  m_payload.u64(checksum);
+  write(RecordType::CHECKSUM, tick);
+}
+
+void LobbyRecorder::write(RecordType type, std::uint64_t tick)
+{
+  if (!isRecording()) {
+    return;
+  }
+  if (!m_writer.append(type, tick, m_payload.bytes())) {
+    std::cerr << "[Replay] Recording of " << m_path << " stopped at tick " << tick << '\n';
+    m_writer.close();
+  }
+}
+
+} // namespace server::replay
@@ -0,0 +1,428 @@
+/**
+ * @file ReplayFile.cpp
+ * @brief Append-only, memory-mapped, chunked replay file.
+ */
+
+#include "replay/ReplayFile.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace server::replay
+{
+namespace
+{
+constexpr std::size_t MAX_VARINT_BYTES = 10;
+
+std::size_t encodeVarint(std::uint64_t value, std::uint8_t *out)
+{
+  std::size_t size = 0;
+  while (value >= 0x80) {
+    out[size++] = static_cast<std::uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  out[size++] = static_cast<std::uint8_t>(value);
+  return size;
+}
+} // namespace
+
+// ============================================================================
+// Payloads
+// ============================================================================
+
+void PayloadWriter::varint(std::uint64_t value)
+{
+  std::uint8_t buffer[MAX_VARINT_BYTES];
+  const std::size_t size = encodeVarint(value, buffer);
+  m_bytes.insert(m_bytes.end(), buffer, buffer + size);
+}
+
+void PayloadWriter::u64(std::uint64_t value)
+{
+  const auto *bytes = reinterpret_cast<const std::uint8_t *>(&value);
+  m_bytes.insert(m_bytes.end(), bytes, bytes + sizeof(value));
+}
+
+void PayloadWriter::f64(double value)
+{
+  std::uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  u64(bits);
+}
+
+void PayloadWriter::string(std::string_view value)
+{
+  varint(value.size());
+  m_bytes.insert(m_bytes.end(), value.begin(), value.end());
+}
+
+std::uint8_t PayloadReader::u8()
+{
+  if (m_offset >= m_bytes.size()) {
+    m_ok = false;
+    return 0;
+  }
+  return m_bytes[m_offset++];
+}
+
+std::uint64_t PayloadReader::varint()
+{
+  std::uint64_t value = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    if (m_offset >= m_bytes.size()) {
+      m_ok = false;
+      return 0;
+    }
+    const std::uint8_t byte = m_bytes[m_offset++];
+    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+  m_ok = false;
+  return 0;
+}
+
+std::uint64_t PayloadReader::u64()
+{
+  const auto raw = bytes(sizeof(std::uint64_t));
+  std::uint64_t value = 0;
+  if (!raw.empty()) {
+    std::memcpy(&value, raw.data(), sizeof(value));
+  }
+  return value;
+}
+
+double PayloadReader::f64()
+{
+  const std::uint64_t bits = u64();
+  double value = 0.0;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+std::string PayloadReader::string()
+{
+  const auto raw = bytes(static_cast<std::size_t>(varint()));
+  return {raw.begin(), raw.end()};
+}
+
+std::span<const std::uint8_t> PayloadReader::bytes(std::size_t size)
+{
+  if (!m_ok || size > m_bytes.size() - m_offset) {
+    m_ok = false;
+    return {};
+  }
+  const auto result = m_bytes.subspan(m_offset, size);
+  m_offset += size;
+  return result;
+}
+
+#if !defined(_WIN32)
+
+// ============================================================================
+// ReplayWriter
+// ============================================================================
+
+ReplayWriter::~ReplayWriter()
+{
+  close();
+}
+
+bool ReplayWriter::open(const std::string &path, std::size_t chunkBytes)
+{
+  close();
+  m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (m_fd < 0) {
+    std::cerr << "[Replay] Cannot create " << path << ": " << std::strerror(errno) << '\n';
+    return false;
+  }
+  const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  m_chunkBytes = (std::max(chunkBytes, page) + page - 1) / page * page;
+  m_dataOffset = page;
+  m_index.clear();
+
+  FileHeader header;
+  header.chunkBytes = static_cast<std::uint32_t>(m_chunkBytes);
+  header.dataOffset = m_dataOffset;
+  if (pwrite(m_fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+    std::cerr << "[Replay] Cannot write " << path << ": " << std::strerror(errno) << '\n';
+    ::close(m_fd);
+    m_fd = -1;
+    return false;
+  }
+  return true;
+}
+
+bool ReplayWriter::append(RecordType type, std::uint64_t tick, std::span<const std::uint8_t> payload)
+{
+  if (!isOpen()) {
+    return false;
+  }
+  std::uint8_t prefix[1 + 2 * MAX_VARINT_BYTES];
+  auto encodePrefix = [&]() {
+    prefix[0] = static_cast<std::uint8_t>(type);
+    std::size_t size = 1;
+    size += encodeVarint(tick - m_header.lastTick, prefix + size);
+    size += encodeVarint(payload.size(), prefix + size);
+    return size;
+  };
+
+  if (m_chunk != nullptr) {
+    tick = std::max(tick, m_header.lastTick);
+  }
+  std::size_t prefixSize = encodePrefix();
+  const std::size_t capacity = m_chunkBytes - sizeof(ChunkHeader);
+  if (m_chunk == nullptr || m_header.usedBytes + prefixSize + payload.size() > capacity) {
+    if (prefixSize + payload.size() > capacity) {
+      return false;
+    }
+    sealChunk();
+    if (!mapNextChunk(tick)) {
+      close();
+      return false;
+    }
+    prefixSize = encodePrefix();
+  }
+
+  std::uint8_t *out = m_chunk + sizeof(ChunkHeader) + m_header.usedBytes;
+  std::memcpy(out, prefix, prefixSize);
+  if (!payload.empty()) {
+    std::memcpy(out + prefixSize, payload.data(), payload.size());
+  }
+  m_header.usedBytes += static_cast<std::uint32_t>(prefixSize + payload.size());
+  m_header.lastTick = tick;
+  ++m_header.recordCount;
+  // Kept current so that a file whose writer crashed can still be read
+  std::memcpy(m_chunk, &m_header, sizeof(m_header));
+  return true;
+}
+
+bool ReplayWriter::mapNextChunk(std::uint64_t tick)
+{
+  const std::uint64_t offset = m_dataOffset + m_index.size() * m_chunkBytes;
+#if defined(__linux__)
+  const int error = posix_fallocate(m_fd, static_cast<off_t>(offset), static_cast<off_t>(m_chunkBytes));
+#else
+  const int error = ftruncate(m_fd, static_cast<off_t>(offset + m_chunkBytes)) == 0 ? 0 : errno;
+#endif
+  if (error != 0) {
+    std::cerr << "[Replay] Cannot grow the replay file: " << std::strerror(error) << '\n';
+    return false;
+  }
+  void *mapping =
+    mmap(nullptr, m_chunkBytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, static_cast<off_t>(offset));
+  if (mapping == MAP_FAILED) {
+    std::cerr << "[Replay] Cannot map a replay chunk: " << std::strerror(errno) << '\n';
+    return false;
+  }
+  m_chunk = static_cast<std::uint8_t *>(mapping);
+  m_header = ChunkHeader{};
+  m_header.firstTick = tick;
+  m_header.lastTick = tick;
+  std::memcpy(m_chunk, &m_header, sizeof(m_header));
+  m_index.push_back(ChunkIndexEntry{offset, tick, tick, 0, 0});
+  return true;
+}
+
+void ReplayWriter::sealChunk()
+{
+  if (m_chunk == nullptr) {
+    return;
+  }
+  auto &entry = m_index.back();
+  entry.lastTick = m_header.lastTick;
+  entry.recordCount = m_header.recordCount;
+  entry.usedBytes = m_header.usedBytes;
+  munmap(m_chunk, m_chunkBytes);
+  m_chunk = nullptr;
+}
+
+void ReplayWriter::close()
+{
+  if (!isOpen()) {
+    return;
+  }
+  sealChunk();
+  IndexFooter footer;
+  footer.count = static_cast<std::uint32_t>(m_index.size());
+  footer.indexOffset = m_dataOffset + m_index.size() * m_chunkBytes;
+  const std::size_t indexBytes = m_index.size() * sizeof(ChunkIndexEntry);
+  bool written = pwrite(m_fd, m_index.data(), indexBytes, static_cast<off_t>(footer.indexOffset)) ==
+                 static_cast<ssize_t>(indexBytes);
+  written = written && pwrite(m_fd, &footer, sizeof(footer), static_cast<off_t>(footer.indexOffset + indexBytes)) ==
+                         static_cast<ssize_t>(sizeof(footer));
+  if (!written) {
+    std::cerr << "[Replay] Cannot write the chunk index: " << std::strerror(errno) << '\n';
+  }
+  ::close(m_fd);
+  m_fd = -1;
+  m_index.clear();
+}
+
+// ============================================================================
+// ReplayReader
+// ============================================================================
+
+ReplayReader::~ReplayReader()
+{
+  close();
+}
+
+bool ReplayReader::open(const std::string &path)
+{
+  close();
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    std::cerr << "[Replay] Cannot open " << path << ": " << std::strerror(errno) << '\n';
+    return false;
+  }
+  struct stat info {};
+  if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(FileHeader)) {
+    std::cerr << "[Replay] " << path << " is not a replay file" << '\n';
+    ::close(fd);
+    return false;
+  }
+  m_size = static_cast<std::size_t>(info.st_size);
+  void *mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    std::cerr << "[Replay] Cannot map " << path << ": " << std::strerror(errno) << '\n';
+    m_size = 0;
+    return false;
+  }
+  m_data = static_cast<const std::uint8_t *>(mapping);
+
+  FileHeader header;
+  std::memcpy(&header, m_data, sizeof(header));
+  if (header.magic != FILE_MAGIC || header.version != FORMAT_VERSION || header.chunkBytes <= sizeof(ChunkHeader)) {
+    std::cerr << "[Replay] " << path << " is not a version " << FORMAT_VERSION << " replay file" << '\n';
+    close();
+    return false;
+  }
+
+  IndexFooter footer;
+  if (m_size >= header.dataOffset + sizeof(footer)) {
+    std::memcpy(&footer, m_data + m_size - sizeof(footer), sizeof(footer));
+  }
+  const std::uint64_t indexBytes = static_cast<std::uint64_t>(footer.count) * sizeof(ChunkIndexEntry);
+  if (footer.magic == INDEX_MAGIC && footer.indexOffset + indexBytes + sizeof(footer) == m_size) {
+    m_chunks.resize(footer.count);
+    std::memcpy(m_chunks.data(), m_data + footer.indexOffset, indexBytes);
+  } else {
+    // The writer did not close: rebuild the index from the chunk headers
+    m_recovered = true;
+    for (std::uint64_t offset = header.dataOffset; offset + header.chunkBytes <= m_size;
+         offset += header.chunkBytes) {
+      ChunkHeader chunk;
+      std::memcpy(&chunk, m_data + offset, sizeof(chunk));
+      if (chunk.magic != CHUNK_MAGIC) {
+        break;
+      }
+      m_chunks.push_back(ChunkIndexEntry{offset, chunk.firstTick, chunk.lastTick, chunk.recordCount, chunk.usedBytes});
+    }
+  }
+  for (const auto &entry : m_chunks) {
+    if (entry.offset + header.chunkBytes > m_size || entry.usedBytes > header.chunkBytes - sizeof(ChunkHeader)) {
+      std::cerr << "[Replay] " << path << " has a corrupt chunk index" << '\n';
+      close();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ReplayReader::next(Record &record)
+{
+  while (m_chunk < m_chunks.size()) {
+    const auto &entry = m_chunks[m_chunk];
+    if (m_offset == 0) {
+      m_tick = entry.firstTick;
+    }
+    if (m_offset >= entry.usedBytes) {
+      ++m_chunk;
+      m_offset = 0;
+      continue;
+    }
+    const std::uint8_t *records = m_data + entry.offset + sizeof(ChunkHeader);
+    PayloadReader reader(std::span<const std::uint8_t>(records + m_offset, entry.usedBytes - m_offset));
+    const auto type = reader.u8();
+    const auto delta = reader.varint();
+    const auto size = reader.varint();
+    const auto payload = reader.bytes(static_cast<std::size_t>(size));
+    if (!reader.ok()) {
+      std::cerr << "[Replay] Corrupt record in chunk " << m_chunk << ", stopping there" << '\n';
+      m_chunk = m_chunks.size();
+      return false;
+    }
+    m_offset += static_cast<std::size_t>(payload.data() + payload.size() - (records + m_offset));
+    m_tick += delta;
+    record.type = static_cast<RecordType>(type);
+    record.tick = m_tick;
+    record.payload = payload;
+    return true;
+  }
+  return false;
+}
+
+void ReplayReader::close()
+{
+  if (m_data != nullptr) {
+    munmap(const_cast<std::uint8_t *>(m_data), m_size);
+  }
+  m_data = nullptr;
+  m_size = 0;
+  m_chunks.clear();
+  m_recovered = false;
+  m_chunk = 0;
+  m_offset = 0;
+  m_tick = 0;
+}
+
+#else
+
+ReplayWriter::~ReplayWriter() = default;
+
+bool ReplayWriter::open(const std::string &path, std::size_t chunkBytes)
+{
+  (void)chunkBytes;
+  std::cerr << "[Replay] Cannot record " << path << ": replay files are not supported on this platform" << '\n';
+  return false;
+}
+
+bool ReplayWriter::append(RecordType type, std::uint64_t tick, std::span<const std::uint8_t> payload)
+{
+  (void)type;
+  (void)tick;
+  (void)payload;
+  return false;
+}
+
+void ReplayWriter::close() {}
+
+ReplayReader::~ReplayReader() = default;
+
+bool ReplayReader::open(const std::string &path)
+{
+  std::cerr << "[Replay] Cannot read " << path << ": replay files are not supported on this platform" << '\n';
+  return false;
+}
+
+bool ReplayReader::next(Record &record)
+{
+  (void)record;
+  return false;
+}
+
+void ReplayReader::close() {}
+
+#endif
+
+} // namespace server::replay
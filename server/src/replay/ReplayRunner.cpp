@@ -0,0 +1,185 @@
+/**
+ * @file ReplayRunner.cpp
+ * @brief Headless replay of a recorded lobby game.
+ */
+
+#include "replay/ReplayRunner.hpp"
+#include "Lobby.hpp"
+#include "config/EnemyConfig.hpp"
+#include "config/LevelConfig.hpp"
+#include "replay/LobbyRecorder.hpp"
+#include "replay/ReplayFile.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace server::replay
+{
+namespace
+{
+constexpr const char *ENEMY_CONFIG_PATH = "server/config/enemies.json";
+constexpr const char *LEVEL_CONFIG_PATH = "server/config/levels.json";
+
+void warnOnConfigChange(const char *path, std::uint64_t recorded)
+{
+  if (recorded != 0 && hashFile(path) != recorded) {
+    std::cerr << "[Replay] " << path << " changed since the recording, the replay may diverge" << '\n';
+  }
+}
+
+double percentile(std::vector<double> &values, double fraction)
+{
+  if (values.empty()) {
+    return 0.0;
+  }
+  const auto index = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+  std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+  return values[index];
+}
+} // namespace
+
+int runReplay(const std::string &path)
+{
+  ReplayReader reader;
+  Record record;
+  if (!reader.open(path) || !reader.next(record) || record.type != RecordType::START) {
+    std::cerr << "[Replay] " << path << " is not a replay file" << '\n';
+    return 1;
+  }
+  const auto session = SessionInfo::decode(record.payload);
+  if (!session) {
+    std::cerr << "[Replay] Corrupt START record in " << path << '\n';
+    return 1;
+  }
+  if (reader.isRecovered()) {
+    std::cerr << "[Replay] " << path << " was not closed, replaying the chunks that were written" << '\n';
+  }
+
+  auto enemyConfig = std::make_shared<EnemyConfigManager>();
+  auto levelConfig = std::make_shared<LevelConfigManager>();
+  if (!enemyConfig->loadFromFile(ENEMY_CONFIG_PATH) || !levelConfig->loadFromFile(LEVEL_CONFIG_PATH, *enemyConfig)) {
+    std::cerr << "[Replay] Cannot load the game configs from server/config" << '\n';
+    return 1;
+  }
+  warnOnConfigChange(ENEMY_CONFIG_PATH, session->enemyConfigHash);
+  warnOnConfigChange(LEVEL_CONFIG_PATH, session->levelConfigHash);
+
+  Lobby lobby(session->lobbyCode, nullptr, session->solo, static_cast<AIDifficulty>(session->aiDifficulty),
+              static_cast<GameMode>(session->gameMode));
+  lobby.setEnemyConfigManager(enemyConfig);
+  lobby.setLevelConfigManager(levelConfig);
+  lobby.setDifficulty(static_cast<GameConfig::Difficulty>(session->difficulty));
+  lobby.setGameMode(static_cast<GameMode>(session->gameMode));
+  // The allies decide on the recorded steps; a recorded game never deferred a decision
+  server::ai::AISchedule aiSchedule;
+  aiSchedule.decisionRateHz = static_cast<float>(session->aiDecisionRateHz);
+  aiSchedule.deferrable = false;
+  lobby.setAISchedule(aiSchedule);
+  for (const auto &player : session->players) {
+    lobby.addClient(player.clientId, player.spectator);
+  }
+  lobby.startGame(session->seed);
+
+  // The lobbies are stepped with this float, see Game::runGameLoop
+  const auto stepSeconds = static_cast<float>(session->stepSeconds);
+  std::vector<double> stepTimes;
+  std::uint64_t checksums = 0;
+  const auto replayStart = std::chrono::steady_clock::now();
+
+  // The game loop skips empty lobbies, so the tick cannot move while nobody is in it
+  auto stepTo = [&](std::uint64_t tick) {
+    while (lobby.isGameStarted() && !lobby.isEmpty() && lobby.getWorld()->getTick() < tick) {
+      const auto stepStart = std::chrono::steady_clock::now();
+      lobby.update(stepSeconds);
+      stepTimes.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - stepStart).count());
+    }
+  };
+
+  int result = 0;
+  bool ended = false;
+  while (!ended && result == 0 && reader.next(record)) {
+    stepTo(record.tick);
+    PayloadReader payload(record.payload);
+    switch (record.type) {
+    case RecordType::INPUT: {
+      const auto clientId = static_cast<std::uint32_t>(payload.varint());
+      ecs::Input input{};
+      unpackInput(payload.u8(), input);
+      lobby.applyInput(clientId, input);
+      break;
+    }
+    case RecordType::VIEWPORT: {
+      const auto clientId = static_cast<std::uint32_t>(payload.varint());
+      const auto width = static_cast<std::uint32_t>(payload.varint());
+      const auto height = static_cast<std::uint32_t>(payload.varint());
+      lobby.applyViewport(clientId, width, height);
+      break;
+    }
+    case RecordType::JOIN: {
+      const auto clientId = static_cast<std::uint32_t>(payload.varint());
+      lobby.addClient(clientId, payload.u8() != 0);
+      break;
+    }
+    case RecordType::LEAVE:
+      lobby.removeClient(static_cast<std::uint32_t>(payload.varint()));
+      break;
+    case RecordType::SPECTATOR: {
+      const auto clientId = static_cast<std::uint32_t>(payload.varint());
+      lobby.setSpectator(clientId, payload.u8() != 0);
+      break;
+    }
+    case RecordType::CHECKSUM: {
+      const std::uint64_t recordedCount = payload.varint();
+      const std::uint64_t recordedHash = payload.u64();
+      std::size_t entityCount = 0;
+      const std::uint64_t hash = worldChecksum(*lobby.getWorld(), entityCount);
+      if (hash != recordedHash || entityCount != recordedCount) {
+        std::cerr << "[Replay] Diverged at tick " << record.tick << ": " << entityCount << " entities (recorded "
+                  << recordedCount << "), checksum " << std::hex << hash << " (recorded " << recordedHash << ")"
+                  << std::dec << '\n';
+        result = 2;
+      }
+      ++checksums;
+      break;
+    }
+    case RecordType::END:
+      ended = true;
+      break;
+    case RecordType::START:
+      break;
+    }
+    if (!payload.ok()) {
+      std::cerr << "[Replay] Corrupt record at tick " << record.tick << '\n';
+      result = 1;
+    }
+  }
+
+  const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStart).count();
+  const auto ticks = stepTimes.size();
+  const double simulatedSeconds = static_cast<double>(ticks) * stepSeconds;
+  const double maxStep = stepTimes.empty() ? 0.0 : *std::max_element(stepTimes.begin(), stepTimes.end());
+  const double p50 = percentile(stepTimes, 0.50);
+  const double p99 = percentile(stepTimes, 0.99);
+  std::cout << "[Replay] " << ticks << " ticks (" << simulatedSeconds << " s of game) in " << wallSeconds << " s: "
+            << (wallSeconds > 0.0 ? static_cast<double>(ticks) / wallSeconds : 0.0) << " ticks/s, "
+            << (wallSeconds > 0.0 ? simulatedSeconds / wallSeconds : 0.0) << "x real time" << '\n';
+  std::cout << "[Replay] Step time p50 " << p50 * 1e6 << " us, p99 " << p99 * 1e6 << " us, max " << maxStep * 1e6
+            << " us" << '\n';
+  // Spawns served by a pool (reused) and despawns into one (parked) are the allocations pooling saved
+  const auto &entities = lobby.getWorld()->getEntityStats();
+  const auto perTick = [ticks](std::uint64_t count) {
+    return ticks > 0 ? static_cast<double>(count) / static_cast<double>(ticks) : 0.0;
+  };
+  std::cout << "[Replay] Entities per tick: " << perTick(entities.created + entities.reused) << " spawned ("
+            << perTick(entities.created) << " created, " << perTick(entities.reused) << " reused), "
+            << perTick(entities.destroyed + entities.parked) << " despawned (" << perTick(entities.destroyed)
+            << " destroyed, " << perTick(entities.parked) << " parked)" << '\n';
+  std::cout << "[Replay] " << checksums << " checksums " << (result == 2 ? "checked, diverged" : "matched")
+            << (ended ? "" : ", no END record") << '\n';
+  return result;
+}
+
+} // namespace server::replay
@@ -82,8 +82,7 @@ void NetworkReceiveSystem::update(ecs::World &world, [[maybe_unused]] float delt
   while (m_networkManager->poll(packet)) {
     const std::uint32_t clientId = packet.getSenderEndpointId();
 
-    const std::string message =
-      m_networkManager->getPacketHandler()->deserialize(packet.getData(), packet.getBytesTransferred()).value_or("");
+    const std::string message = m_networkManager->getPacketHandler()->deserialize(packet.getPayload()).value_or("");
 
     if (message.empty()) {
       std::cerr << "[Server] Empty or malformed message received from client " << clientId << '\n';
@@ -108,7 +107,7 @@ void NetworkReceiveSystem::handleMessage(ecs::World &world, const std::string &m
     // Respond with PONG
     auto pong = m_networkManager->getPacketHandler()->serialize("PONG");
     m_networkManager->send(std::span<const std::byte>(reinterpret_cast<const std::byte *>(pong.data()), pong.size()),
-                           clientId);
+                           clientId, Channel::UNRELIABLE_SEQUENCED);
     return;
   }
   if (message == "PONG") {
@@ -175,30 +174,8 @@ void NetworkReceiveSystem::handleViewport([[maybe_unused]] ecs::World &world, co
     return;
   }
 
-  auto lobbyWorld = lobby->getWorld();
-  if (!lobbyWorld) {
-    return;
-  }
-
-  std::vector<ecs::Entity> entities;
-  lobbyWorld->getEntitiesWithSignature(getSignature(), entities);
-
-  for (const auto &entity : entities) {
-    const auto &owner = lobbyWorld->getComponent<ecs::PlayerId>(entity);
-    if (owner.clientId != clientId) {
-      continue;
-    }
-
-    if (!lobbyWorld->hasComponent<ecs::Viewport>(entity)) {
-      ecs::Viewport viewport{.width = width, .height = height};
-      lobbyWorld->addComponent(entity, viewport);
-    } else {
-      auto &viewport = lobbyWorld->getComponent<ecs::Viewport>(entity);
-      viewport.width = width;
-      viewport.height = height;
-    }
-    break;
-  }
+  // The lobby records the change for replays
+  lobby->applyViewport(clientId, width, height);
 }
 
 void NetworkReceiveSystem::handlePlayerInput([[maybe_unused]] ecs::World &world, std::string message,
@@ -221,31 +198,17 @@ void NetworkReceiveSystem::handlePlayerInput([[maybe_unused]] ecs::World &world,
       return;
     }
 
-    auto lobbyWorld = lobby->getWorld();
-    if (!lobbyWorld) {
-      return;
-    }
-
     const auto &inputJson = json["input"];
-    std::vector<ecs::Entity> entities;
-    lobbyWorld->getEntitiesWithSignature(getSignature(), entities);
-
-    for (const auto &entity : entities) {
-      const auto &owner = lobbyWorld->getComponent<ecs::PlayerId>(entity);
-      if (owner.clientId != clientId) {
-        continue;
-      }
-
-      auto &input = lobbyWorld->getComponent<ecs::Input>(entity);
-      input.up = inputJson.value("up", false);
-      input.down = inputJson.value("down", false);
-      input.left = inputJson.value("left", false);
-      input.right = inputJson.value("right", false);
-      input.shoot = inputJson.value("shoot", false);
-      input.chargedShoot = inputJson.value("chargedShoot", false);
-      input.detach = inputJson.value("detach", false);
-      return;
-    }
+    ecs::Input input{};
+    input.up = inputJson.value("up", false);
+    input.down = inputJson.value("down", false);
+    input.left = inputJson.value("left", false);
+    input.right = inputJson.value("right", false);
+    input.shoot = inputJson.value("shoot", false);
+    input.chargedShoot = inputJson.value("chargedShoot", false);
+    input.detach = inputJson.value("detach", false);
+    // The lobby records the change for replays
+    lobby->applyInput(clientId, input);
   } catch (const std::exception &) {
     return;
   }
@@ -616,11 +579,7 @@ void NetworkReceiveSystem::handleToggleSpectator(const nlohmann::json &json, std
     wantSpectator = json["spectator"].get<bool>();
   }
 
-  if (wantSpectator) {
-    lobby->convertToSpectator(clientId);
-  } else {
-    lobby->convertToPlayer(clientId);
-  }
+  lobby->setSpectator(clientId, wantSpectator);
 }
 
 void NetworkReceiveSystem::handleEndScreenLeft([[maybe_unused]] ecs::World &world, std::uint32_t clientId)
@@ -4,26 +4,37 @@
  */
 
 #include "systems/NetworkSendSystem.hpp"
+#include "../../engineCore/include/ecs/BulletPool.hpp"
 #include "../../engineCore/include/ecs/World.hpp"
 #include "../../engineCore/include/ecs/components/Collider.hpp"
 #include "../../engineCore/include/ecs/components/Health.hpp"
 #include "../../engineCore/include/ecs/components/Networked.hpp"
+#include "../../engineCore/include/ecs/components/Owner.hpp"
+#include "../../engineCore/include/ecs/components/Pattern.hpp"
 #include "../../engineCore/include/ecs/components/PlayerId.hpp"
 #include "../../engineCore/include/ecs/components/Score.hpp"
 #include "../../engineCore/include/ecs/components/Sprite.hpp"
 #include "../../engineCore/include/ecs/components/Transform.hpp"
+#include "../../engineCore/include/ecs/components/Viewport.hpp"
+#include "../../engineCore/include/utils/Log.hpp"
+#include "../../engineCore/include/utils/Trace.hpp"
 #include "INetworkManager.hpp"
 #include "LobbyManager.hpp"
+#include "metrics/ServerMetrics.hpp"
+#include "systems/BulletPatternSystem.hpp"
 #include "ecs/ComponentSignature.hpp"
 #include "ecs/Entity.hpp"
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
-#include <iostream>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <nlohmann/json_fwd.hpp>
 #include <span>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 NetworkSendSystem::NetworkSendSystem(std::shared_ptr<INetworkManager> networkManager)
@@ -38,6 +49,21 @@ void NetworkSendSystem::setLobbyManager(LobbyManager *lobbyManager)
   m_lobbyManager = lobbyManager;
 }
 
+void NetworkSendSystem::setReplicationConfig(const server::ReplicationConfig &config)
+{
+  m_replicationConfig = config;
+}
+
+void NetworkSendSystem::setMetrics(server::ServerMetrics *metrics)
+{
+  m_metrics = metrics;
+}
+
+const NetworkSendSystem::ReplicationStats &NetworkSendSystem::getReplicationStats() const
+{
+  return m_stats;
+}
+
 std::vector<std::uint32_t> NetworkSendSystem::getActiveGameClients() const
 {
   std::vector<std::uint32_t> activeClients;
@@ -63,38 +89,248 @@ std::vector<std::uint32_t> NetworkSendSystem::getActiveGameClients() const
   return activeClients;
 }
 
+std::unordered_map<std::uint32_t, NetworkSendSystem::InterestArea>
+NetworkSendSystem::computeInterestAreas(ecs::World &lobbyWorld, const std::unordered_set<std::uint32_t> &clients)
+{
+  // Gather the viewport reported by each player. The screen is the world in
+  // R-Type (players are clamped to it), so the area is anchored at the origin.
+  std::unordered_map<std::uint32_t, std::pair<float, float>> viewports;
+  std::unordered_map<std::uint32_t, std::pair<float, float>> focus;
+  float widestW = 0.0f;
+  float widestH = 0.0f;
+
+  ecs::ComponentSignature playerSig;
+  playerSig.set(ecs::getComponentId<ecs::PlayerId>());
+  playerSig.set(ecs::getComponentId<ecs::Viewport>());
+  std::vector<ecs::Entity> players;
+  lobbyWorld.getEntitiesWithSignature(playerSig, players);
+  for (const auto &player : players) {
+    const auto &pid = lobbyWorld.getComponent<ecs::PlayerId>(player);
+    const auto &vp = lobbyWorld.getComponent<ecs::Viewport>(player);
+    if (lobbyWorld.hasComponent<ecs::Transform>(player)) {
+      const auto &transform = lobbyWorld.getComponent<ecs::Transform>(player);
+      focus[pid.clientId] = {transform.x, transform.y};
+    }
+    if (vp.width == 0 || vp.height == 0) {
+      continue;
+    }
+    const auto width = static_cast<float>(vp.width);
+    const auto height = static_cast<float>(vp.height);
+    viewports[pid.clientId] = {width, height};
+    widestW = std::max(widestW, width);
+    widestH = std::max(widestH, height);
+  }
+
+  // Clients without a player entity (spectators) follow the widest player view
+  if (widestW <= 0.0f || widestH <= 0.0f) {
+    widestW = DEFAULT_VIEWPORT_WIDTH;
+    widestH = DEFAULT_VIEWPORT_HEIGHT;
+  }
+
+  std::unordered_map<std::uint32_t, InterestArea> areas;
+  areas.reserve(clients.size());
+  for (const auto &clientId : clients) {
+    float width = widestW;
+    float height = widestH;
+    auto it = viewports.find(clientId);
+    if (it != viewports.end()) {
+      width = it->second.first;
+      height = it->second.second;
+    }
+    InterestArea area{-INTEREST_MARGIN, -INTEREST_MARGIN, width + INTEREST_MARGIN, height + INTEREST_MARGIN,
+                      width * 0.5f, height * 0.5f};
+    auto focusIt = focus.find(clientId);
+    if (focusIt != focus.end()) {
+      area.focusX = focusIt->second.first;
+      area.focusY = focusIt->second.second;
+    }
+    areas[clientId] = area;
+  }
+  return areas;
+}
+
+void NetworkSendSystem::pruneClientInterest()
+{
+  std::unordered_set<std::uint32_t> active;
+  for (const auto &clientId : getActiveGameClients()) {
+    active.insert(clientId);
+  }
+  for (auto it = m_clientStates.begin(); it != m_clientStates.end();) {
+    if (active.find(it->first) == active.end()) {
+      it = m_clientStates.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+std::string NetworkSendSystem::encodeBullets(const ecs::BulletPool &pool, std::size_t &volleys)
+{
+  // Every volley and hit is sent for REPLICATION_WINDOW seconds; the client drops the repeats
+  const float horizon = pool.getClock() - server::BulletPatternSystem::REPLICATION_WINDOW;
+  nlohmann::json volleysJson = nlohmann::json::array();
+  for (const auto &record : pool.getVolleys()) {
+    if (record.firedAt >= horizon) {
+      volleysJson.push_back(record.volley.toJson(pool.getClock() - record.firedAt));
+    }
+  }
+  nlohmann::json hitsJson = nlohmann::json::array();
+  for (const auto &hit : pool.getHits()) {
+    if (hit.time >= horizon) {
+      hitsJson.push_back({hit.volley, hit.slot});
+    }
+  }
+
+  volleys = volleysJson.size();
+  std::string fields;
+  if (!volleysJson.empty()) {
+    fields += R"(,"volleys":)" + volleysJson.dump();
+  }
+  if (!hitsJson.empty()) {
+    fields += R"(,"bullet_hits":)" + hitsJson.dump();
+  }
+  return fields;
+}
+
+std::string NetworkSendSystem::buildClientSnapshot(const std::vector<ReplicatedEntity> &replicated,
+                                                   const std::unordered_set<std::uint32_t> &aliveNetworkIds,
+                                                   const InterestArea &area, ClientReplicationState &state,
+                                                   float elapsed, std::uint64_t tick, const std::string &bullets)
+{
+  const auto &config = m_replicationConfig;
+
+  // Accumulate priority of every relevant entity. Entities left out by the
+  // budget keep their accumulated value, which lets them win a later tick.
+  struct Candidate {
+    const ReplicatedEntity *rep;
+    EntityPriority *entry;
+  };
+  std::vector<Candidate> candidates;
+  candidates.reserve(replicated.size());
+  std::unordered_set<std::uint32_t> relevantIds;
+  relevantIds.reserve(replicated.size());
+
+  for (const auto &rep : replicated) {
+    if (!rep.alwaysRelevant && !area.overlaps(rep)) {
+      continue;
+    }
+    float priority = rep.basePriority;
+    if (rep.distanceScaled && config.falloffDistance > 0.0f) {
+      const float distance = std::hypot(rep.centerX - area.focusX, rep.centerY - area.focusY);
+      priority *= std::max(config.minDistanceScale, 1.0f - distance / config.falloffDistance);
+    }
+    auto &entry = state.priorities[rep.networkId];
+    entry.accumulated += priority * elapsed;
+    entry.unsentSeconds += elapsed;
+    relevantIds.insert(rep.networkId);
+    candidates.push_back({&rep, &entry});
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const Candidate &lhs, const Candidate &rhs) {
+    return lhs.entry->accumulated > rhs.entry->accumulated;
+  });
+
+  // Fill the packet in priority order until the byte budget is spent; smaller
+  // entities may still fit after a large one was skipped. Volleys and hits
+  // are sent whole, so the entities get what they leave of the budget.
+  const std::size_t entityBudget = config.budgetBytesPerClient - std::min(config.budgetBytesPerClient, bullets.size());
+  std::string entitiesJson;
+  entitiesJson.reserve(std::min(entityBudget, static_cast<std::size_t>(BUFFER_SIZE)));
+  std::vector<std::uint32_t> enteredIds;
+  std::size_t sentCount = 0;
+
+  for (const auto &[rep, entryPtr] : candidates) {
+    auto &entry = *entryPtr;
+    const std::size_t cost = rep->encoded.size() + 1;
+    if (sentCount > 0 && entitiesJson.size() + cost > entityBudget) {
+      ++m_stats.deferredEntities;
+      if (entry.unsentSeconds > config.starvationThresholdSeconds) {
+        ++m_stats.starvedEntities;
+      }
+      m_stats.maxStarvationSeconds = std::max(m_stats.maxStarvationSeconds, entry.unsentSeconds);
+      continue;
+    }
+    if (sentCount > 0) {
+      entitiesJson += ',';
+    }
+    entitiesJson += rep->encoded;
+    ++sentCount;
+    entry.accumulated = 0.0f;
+    entry.unsentSeconds = 0.0f;
+    if (state.knownIds.insert(rep->networkId).second) {
+      enteredIds.push_back(rep->networkId);
+    }
+  }
+
+  m_stats.bytesSent += entitiesJson.size() + bullets.size();
+  m_stats.entitiesSent += sentCount;
+
+  // Entities the client holds that are not relevant anymore: either gone from
+  // the world (destroyed) or still alive but out of its interest area (exited).
+  std::vector<std::uint32_t> destroyedIds;
+  std::vector<std::uint32_t> exitedIds;
+  for (auto it = state.knownIds.begin(); it != state.knownIds.end();) {
+    if (relevantIds.find(*it) != relevantIds.end()) {
+      ++it;
+      continue;
+    }
+    if (aliveNetworkIds.find(*it) != aliveNetworkIds.end()) {
+      exitedIds.push_back(*it);
+    } else {
+      destroyedIds.push_back(*it);
+    }
+    it = state.knownIds.erase(it);
+  }
+  for (auto it = state.priorities.begin(); it != state.priorities.end();) {
+    if (relevantIds.find(it->first) == relevantIds.end()) {
+      it = state.priorities.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  std::string snapshot = R"({"type":"snapshot","tick":)";
+  snapshot += std::to_string(tick);
+  snapshot += R"(,"entities":[)";
+  snapshot += entitiesJson;
+  snapshot += ']';
+  if (!enteredIds.empty()) {
+    snapshot += R"(,"entered":)" + nlohmann::json(enteredIds).dump();
+  }
+  if (!exitedIds.empty()) {
+    snapshot += R"(,"exited":)" + nlohmann::json(exitedIds).dump();
+  }
+  if (!destroyedIds.empty()) {
+    snapshot += R"(,"destroyed":)" + nlohmann::json(destroyedIds).dump();
+  }
+  snapshot += bullets;
+  snapshot += '}';
+  return snapshot;
+}
+
 void NetworkSendSystem::update(UNUSED ecs::World &world, float deltaTime)
 {
+  RTYPE_TRACE_SCOPE("NetworkSendSystem::update");
   static float logAccumulator = 0.0f;
   logAccumulator += deltaTime;
 
   m_timeSinceLastSend += deltaTime;
   if (m_timeSinceLastSend >= SEND_INTERVAL) {
 
-    // Clean up cached last-network-id lists for lobbies that no longer exist
-    // or that are not currently running to avoid sending stale 'destroyed' lists.
-    if (m_lobbyManager != nullptr) {
-      std::vector<std::string> toErase;
-      for (const auto &pair : m_lobbyLastNetworkIds) {
-        const std::string &code = pair.first;
-        auto lobbyIt = m_lobbyManager->getLobbies().find(code);
-        if (lobbyIt == m_lobbyManager->getLobbies().end() || lobbyIt->second == nullptr ||
-            !lobbyIt->second->isGameStarted()) {
-          toErase.push_back(code);
-        }
-      }
-      for (const auto &code : toErase) {
-        m_lobbyLastNetworkIds.erase(code);
-      }
-    }
-
     // If no lobby manager, skip (can't send lobby-specific state)
     if (m_lobbyManager == nullptr) {
       m_timeSinceLastSend = 0.0f;
       return;
     }
 
-    // Send snapshots per-lobby: each lobby gets only its own entities
+    // Forget state of clients that left or whose game is not running anymore,
+    // so we never send them stale 'destroyed'/'exited' lists.
+    pruneClientInterest();
+    m_stats = ReplicationStats{};
+
+    // Send snapshots per-lobby: each lobby gets only its own entities, and each
+    // client only the entities overlapping its viewport (plus margin), in
+    // priority order within its byte budget.
     for (const auto &[code, lobby] : m_lobbyManager->getLobbies()) {
       if (!lobby || !lobby->isGameStarted()) {
         continue;
@@ -105,102 +341,142 @@ void NetworkSendSystem::update(UNUSED ecs::World &world, float deltaTime)
         continue;
       }
 
+      const auto &lobbyClients = lobby->getClients();
+      if (lobbyClients.empty()) {
+        continue;
+      }
+
       // Get entities from THIS lobby's world
       std::vector<ecs::Entity> entities;
       lobbyWorld->getEntitiesWithSignature(getSignature(), entities);
 
-      nlohmann::json snapshot;
-      snapshot["type"] = "snapshot";
-      snapshot["entities"] = nlohmann::json::array();
-
-      // Collect current network IDs for this lobby
-      std::vector<uint32_t> currentNetworkIds;
-
-      for (const auto &entity : entities) {
-        if (!lobbyWorld->hasComponent<ecs::Transform>(entity) || !lobbyWorld->isAlive(entity)) {
-          continue;
+      // Serialize each entity state once; it is then shared by every client that sees it
+      std::vector<ReplicatedEntity> replicated;
+      replicated.reserve(entities.size());
+      std::unordered_set<std::uint32_t> aliveNetworkIds;
+      aliveNetworkIds.reserve(entities.size());
+
+      {
+        RTYPE_TRACE_SCOPE_DETAIL("NetworkSendSystem::buildSnapshots", code);
+        for (const auto &entity : entities) {
+          if (!lobbyWorld->hasComponent<ecs::Transform>(entity) || !lobbyWorld->isAlive(entity)) {
+            continue;
+          }
+
+          const auto &networked = lobbyWorld->getComponent<ecs::Networked>(entity);
+          const auto &transform = lobbyWorld->getComponent<ecs::Transform>(entity);
+
+          aliveNetworkIds.insert(networked.networkId);
+
+          ReplicatedEntity rep;
+          rep.networkId = networked.networkId;
+          rep.minX = transform.x;
+          rep.minY = transform.y;
+          rep.maxX = transform.x;
+          rep.maxY = transform.y;
+
+          nlohmann::json entityJson;
+          entityJson["id"] = networked.networkId;
+          entityJson["transform"] = {
+            {"x", transform.x}, {"y", transform.y}, {"rotation", transform.rotation}, {"scale", transform.scale}};
+
+          if (lobbyWorld->hasComponent<ecs::Collider>(entity)) {
+            const auto &col = lobbyWorld->getComponent<ecs::Collider>(entity);
+            entityJson["collider"] = {{"w", col.width}, {"h", col.height}};
+            if (col.shape == ecs::Collider::Shape::CIRCLE) {
+              rep.maxX += col.radius * 2.0f;
+              rep.maxY += col.radius * 2.0f;
+            } else {
+              rep.maxX += col.width;
+              rep.maxY += col.height;
+            }
+          }
+          rep.centerX = (rep.minX + rep.maxX) * 0.5f;
+          rep.centerY = (rep.minY + rep.maxY) * 0.5f;
+
+          // SERVER-DRIVEN SPRITE REPLICATION
+          if (lobbyWorld->hasComponent<ecs::Sprite>(entity)) {
+            const auto &sprite = lobbyWorld->getComponent<ecs::Sprite>(entity);
+            entityJson["sprite"] = sprite.toJson();
+          }
+
+          // Replicate health for HUD display
+          if (lobbyWorld->hasComponent<ecs::Health>(entity)) {
+            const auto &health = lobbyWorld->getComponent<ecs::Health>(entity);
+            entityJson["health"] = {{"hp", health.hp}, {"maxHp", health.maxHp}};
+          }
+
+          // Replicate score for HUD display
+          if (lobbyWorld->hasComponent<ecs::Score>(entity)) {
+            const auto &score = lobbyWorld->getComponent<ecs::Score>(entity);
+            entityJson["score"] = {{"points", score.points}};
+          }
+
+          // Base priority: players > bosses > enemies > other > projectiles
+          rep.basePriority = m_replicationConfig.defaultPriority;
+          if (lobbyWorld->hasComponent<ecs::Owner>(entity)) {
+            rep.basePriority = m_replicationConfig.projectilePriority;
+          } else if (lobbyWorld->hasComponent<ecs::Pattern>(entity)) {
+            const bool isBoss = lobbyWorld->getComponent<ecs::Pattern>(entity).isBoss();
+            rep.basePriority = isBoss ? m_replicationConfig.bossPriority : m_replicationConfig.enemyPriority;
+          }
+
+          // Include owner client id when present so client can identify its player reliably.
+          // Players drive the HUD of every client, so they are always replicated.
+          if (lobbyWorld->hasComponent<ecs::PlayerId>(entity)) {
+            const auto &pid = lobbyWorld->getComponent<ecs::PlayerId>(entity);
+            entityJson["owner_client"] = pid.clientId;
+            rep.alwaysRelevant = true;
+            rep.distanceScaled = false;
+            rep.basePriority = m_replicationConfig.playerPriority;
+          }
+
+          rep.encoded = entityJson.dump();
+          replicated.push_back(std::move(rep));
         }
-
-        const auto &networked = lobbyWorld->getComponent<ecs::Networked>(entity);
-        const auto &transform = lobbyWorld->getComponent<ecs::Transform>(entity);
-
-        currentNetworkIds.push_back(networked.networkId);
-
-        nlohmann::json entityJson;
-        entityJson["id"] = networked.networkId;
-        entityJson["transform"] = {
-          {"x", transform.x}, {"y", transform.y}, {"rotation", transform.rotation}, {"scale", transform.scale}};
-
-        if (lobbyWorld->hasComponent<ecs::Collider>(entity)) {
-          const auto &col = lobbyWorld->getComponent<ecs::Collider>(entity);
-          entityJson["collider"] = {{"w", col.width}, {"h", col.height}};
-        }
-
-        // SERVER-DRIVEN SPRITE REPLICATION
-        if (lobbyWorld->hasComponent<ecs::Sprite>(entity)) {
-          const auto &sprite = lobbyWorld->getComponent<ecs::Sprite>(entity);
-          entityJson["sprite"] = sprite.toJson();
-        }
-
-        // Replicate health for HUD display
-        if (lobbyWorld->hasComponent<ecs::Health>(entity)) {
-          const auto &health = lobbyWorld->getComponent<ecs::Health>(entity);
-          entityJson["health"] = {{"hp", health.hp}, {"maxHp", health.maxHp}};
-        }
-
-        // Replicate score for HUD display
-        if (lobbyWorld->hasComponent<ecs::Score>(entity)) {
-          const auto &score = lobbyWorld->getComponent<ecs::Score>(entity);
-          entityJson["score"] = {{"points", score.points}};
-        }
-
-        // Include owner client id when present so client can identify its player reliably
-        if (lobbyWorld->hasComponent<ecs::PlayerId>(entity)) {
-          const auto &pid = lobbyWorld->getComponent<ecs::PlayerId>(entity);
-          entityJson["owner_client"] = pid.clientId;
-        }
-
-        snapshot["entities"].push_back(entityJson);
-      }
-
-      // Track entities that should be removed on client side (per-lobby)
-      auto &lastIds = m_lobbyLastNetworkIds[code];
-      std::vector<uint32_t> destroyedIds;
-      for (const auto &lastId : lastIds) {
-        if (std::find(currentNetworkIds.begin(), currentNetworkIds.end(), lastId) == currentNetworkIds.end()) {
-          destroyedIds.push_back(lastId);
-        }
-      }
-
-      if (!destroyedIds.empty()) {
-        snapshot["destroyed"] = destroyedIds;
       }
 
-      // Update last network IDs for this lobby
-      lastIds = currentNetworkIds;
-
-      // Send ONLY to clients in THIS lobby
-      const auto &lobbyClients = lobby->getClients();
-      if (lobbyClients.empty()) {
-        continue;
+      std::string bullets;
+      std::size_t volleys = 0;
+      if (const auto *bulletSystem = lobbyWorld->getSystem<server::BulletPatternSystem>()) {
+        bullets = encodeBullets(bulletSystem->getPool(), volleys);
       }
-
-      const std::string jsonStr = snapshot.dump();
-      const auto serialized = m_networkManager->getPacketHandler()->serialize(jsonStr);
-
-      for (const auto &clientId : lobbyClients) {
-        m_networkManager->send(
-          std::span<const std::byte>(reinterpret_cast<const std::byte *>(serialized.data()), serialized.size()),
-          clientId);
+      m_stats.volleysSent += volleys * lobbyClients.size();
+
+      const auto areas = computeInterestAreas(*lobbyWorld, lobbyClients);
+      const std::size_t entitiesBefore = m_stats.entitiesSent;
+
+      {
+        RTYPE_TRACE_SCOPE_DETAIL("NetworkSendSystem::sendSnapshots", code);
+        for (const auto &clientId : lobbyClients) {
+          const std::string jsonStr = buildClientSnapshot(replicated, aliveNetworkIds, areas.at(clientId),
+                                                          m_clientStates[clientId], m_timeSinceLastSend,
+                                                          lobbyWorld->getTick(), bullets);
+          m_networkManager->getPacketHandler()->serializeInto(jsonStr, m_sendBuffer);
+          // Snapshots supersede each other: never resend, drop stale ones
+          m_networkManager->send(
+            std::span<const std::byte>(reinterpret_cast<const std::byte *>(m_sendBuffer.data()), m_sendBuffer.size()),
+            clientId, Channel::UNRELIABLE_SEQUENCED);
+          if (m_metrics != nullptr) {
+            m_metrics->countSnapshot(m_sendBuffer.size());
+          }
+        }
       }
 
       if (logAccumulator >= 1.0f) {
-        std::cout << "[Lobby:" << code << "] Snapshot: entities=" << snapshot["entities"].size()
-                  << " clients=" << lobbyClients.size() << std::endl;
+        RTYPE_LOG_DEBUG("[Lobby:" << code << "] Snapshot: entities=" << replicated.size() << " sent="
+                                  << (m_stats.entitiesSent - entitiesBefore) << " volleys=" << volleys << " clients="
+                                  << lobbyClients.size());
       }
     }
 
     if (logAccumulator >= 1.0f) {
+      if (m_stats.deferredEntities > 0) {
+        RTYPE_LOG_DEBUG("[NetworkSend] Budget: bytes=" << m_stats.bytesSent << " deferred="
+                                                       << m_stats.deferredEntities << " starved="
+                                                       << m_stats.starvedEntities << " maxStarvation="
+                                                       << m_stats.maxStarvationSeconds << "s");
+      }
       logAccumulator = 0.0f;
     }
 
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** R-type-mirror
+** File description:
+** Lobby Unit Tests with doctest
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "Lobby.hpp"
+#include "ecs/components/Input.hpp"
+#include "ecs/components/Viewport.hpp"
+#include <cstdint>
+#include <doctest/doctest.h>
+#include <optional>
+
+namespace
+{
+constexpr std::uint64_t SEED = 42;
+
+ecs::Input makeInput(bool up, bool shoot)
+{
+  ecs::Input input{};
+  input.up = up;
+  input.shoot = shoot;
+  return input;
+}
+} // namespace
+
+TEST_SUITE("Lobby")
+{
+  TEST_CASE("The first player is entity 0 and receives its input and viewport")
+  {
+    Lobby lobby("TEST", nullptr, false, AIDifficulty::NO_ALLY);
+    lobby.addClient(7);
+    lobby.addClient(9);
+    lobby.startGame(SEED);
+
+    // Players are spawned before any other entity, in client id order
+    const std::optional<ecs::Entity> first = lobby.getPlayerEntity(7);
+    REQUIRE(first.has_value());
+    CHECK(*first == 0);
+    const std::optional<ecs::Entity> second = lobby.getPlayerEntity(9);
+    REQUIRE(second.has_value());
+    CHECK_FALSE(lobby.getPlayerEntity(8).has_value());
+
+    auto world = lobby.getWorld();
+    lobby.applyInput(7, makeInput(true, true));
+    CHECK(world->getComponent<ecs::Input>(*first).up);
+    CHECK(world->getComponent<ecs::Input>(*first).shoot);
+    CHECK_FALSE(world->getComponent<ecs::Input>(*second).up);
+
+    lobby.applyInput(9, makeInput(true, false));
+    CHECK(world->getComponent<ecs::Input>(*second).up);
+    CHECK_FALSE(world->getComponent<ecs::Input>(*second).shoot);
+
+    lobby.applyViewport(7, 1280, 720);
+    REQUIRE(world->hasComponent<ecs::Viewport>(*first));
+    CHECK(world->getComponent<ecs::Viewport>(*first).width == 1280);
+    CHECK(world->getComponent<ecs::Viewport>(*first).height == 720);
+  }
+
+  TEST_CASE("Input from a client without a player is ignored")
+  {
+    Lobby lobby("TEST", nullptr, false, AIDifficulty::NO_ALLY);
+    lobby.addClient(1);
+    lobby.addClient(2, true);
+    lobby.startGame(SEED);
+
+    CHECK_FALSE(lobby.getPlayerEntity(2).has_value());
+    lobby.applyInput(2, makeInput(true, true));
+    lobby.applyInput(3, makeInput(true, true));
+    const std::optional<ecs::Entity> player = lobby.getPlayerEntity(1);
+    REQUIRE(player.has_value());
+    CHECK_FALSE(lobby.getWorld()->getComponent<ecs::Input>(*player).up);
+  }
+}